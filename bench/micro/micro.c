@@ -0,0 +1,298 @@
+/*-
+ * Public Domain 2014-2015 MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "micro.h"
+
+static const char *progname = "micro";
+
+static int  micro_cmp(const void *, const void *);
+static int  micro_run(MICRO *, MICRO_OP, void *, uint64_t, double *, double *);
+static int  usage(void);
+
+extern int __wt_optind;
+extern char *__wt_optarg;
+
+/*
+ * micro_cycles --
+ *	Return the CPU's timestamp counter, or 0 if there isn't one we know how
+ * to read.
+ */
+static inline uint64_t
+micro_cycles(void)
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+	uint32_t hi, lo;
+
+	__asm__ volatile ("rdtsc" : "=a" (lo), "=d" (hi));
+	return ((uint64_t)hi << 32 | lo);
+#else
+	return (0);
+#endif
+}
+
+/*
+ * micro_nsecs --
+ *	Return a monotonic time in nanoseconds.
+ */
+static inline uint64_t
+micro_nsecs(void)
+{
+	struct timespec ts;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((uint64_t)ts.tv_sec * WT_BILLION + (uint64_t)ts.tv_nsec);
+}
+
+int
+main(int argc, char *argv[])
+{
+	MICRO _m, *m;
+	WT_DECL_RET;
+	int ch;
+
+	m = &_m;
+	memset(m, 0, sizeof(*m));
+	m->home = "WT_TEST";
+	m->runs = 7;
+	m->min_run_ns = 10 * WT_MILLION;
+
+	while ((ch = __wt_getopt(progname, argc, argv, "b:h:qr:t:")) != EOF)
+		switch (ch) {
+		case 'b':
+			m->filter = __wt_optarg;
+			break;
+		case 'h':
+			m->home = __wt_optarg;
+			break;
+		case 'q':
+			m->quick = true;
+			m->runs = 3;
+			m->min_run_ns = WT_MILLION;
+			break;
+		case 'r':
+			m->runs = (u_int)atoi(__wt_optarg);
+			if (m->runs == 0 || m->runs > 1000)
+				return (usage());
+			break;
+		case 't':
+			m->min_run_ns =
+			    (uint64_t)atoi(__wt_optarg) * WT_MILLION;
+			if (m->min_run_ns == 0)
+				return (usage());
+			break;
+		case '?':
+		default:
+			return (usage());
+		}
+	argc -= __wt_optind;
+	if (argc != 0)
+		return (usage());
+
+	__wt_random_init(&m->rnd);
+
+	printf("# wiredtiger_version: %s\n",
+	    wiredtiger_version(NULL, NULL, NULL));
+	printf("# runs: %u, min_run_ms: %" PRIu64 "\n",
+	    m->runs, m->min_run_ns / WT_MILLION);
+	printf("# ns/op: median, minimum and maximum of the runs; "
+	    "cycles/op: median, timestamp counter cycles, 0 if unavailable\n");
+	printf("benchmark,parameters,iterations,runs,"
+	    "ns_op_median,ns_op_min,ns_op_max,cycles_op_median\n");
+
+	if ((ret = micro_open(m)) == 0 &&
+	    (ret = micro_support(m)) == 0 &&
+	    (ret = micro_btree(m)) == 0)
+		ret = micro_log(m);
+	if (m->conn != NULL)
+		WT_TRET(micro_close(m));
+
+	if (ret != 0) {
+		fprintf(stderr,
+		    "%s: %s\n", progname, wiredtiger_strerror(ret));
+		return (EXIT_FAILURE);
+	}
+	return (EXIT_SUCCESS);
+}
+
+/*
+ * micro_open --
+ *	Open the database connection and session.
+ */
+int
+micro_open(MICRO *m)
+{
+	WT_DECL_RET;
+
+	/*
+	 * Configure a cache large enough to hold every benchmark's objects, so
+	 * eviction doesn't interfere with the measurements.
+	 */
+	if ((ret = wiredtiger_open(m->home, NULL,
+	    "create,cache_size=1GB,log=(enabled,file_max=10MB)",
+	    &m->conn)) != 0) {
+		fprintf(stderr, "%s: wiredtiger_open: %s: %s\n",
+		    progname, m->home, wiredtiger_strerror(ret));
+		return (ret);
+	}
+	if ((ret = m->conn->open_session(
+	    m->conn, NULL, NULL, &m->wt_session)) != 0) {
+		(void)m->conn->close(m->conn, NULL);
+		m->conn = NULL;
+		return (ret);
+	}
+	m->session = (WT_SESSION_IMPL *)m->wt_session;
+	return (0);
+}
+
+/*
+ * micro_close --
+ *	Close the database connection.
+ */
+int
+micro_close(MICRO *m)
+{
+	WT_DECL_RET;
+
+	ret = m->conn->close(m->conn, NULL);
+	m->conn = NULL;
+	m->wt_session = NULL;
+	m->session = NULL;
+	return (ret);
+}
+
+/*
+ * micro_run --
+ *	Run an operation for a count of iterations, returning the nanoseconds
+ * and cycles per iteration.
+ */
+static int
+micro_run(MICRO *m, MICRO_OP op, void *arg,
+    uint64_t iters, double *nsp, double *cyclesp)
+{
+	uint64_t cycles, start;
+
+	cycles = micro_cycles();
+	start = micro_nsecs();
+	WT_RET(op(m, arg, iters));
+	*nsp = (double)(micro_nsecs() - start) / iters;
+	if (cyclesp != NULL)
+		*cyclesp = (double)(micro_cycles() - cycles) / iters;
+	return (0);
+}
+
+/*
+ * micro_cmp --
+ *	Qsort comparison function for doubles.
+ */
+static int
+micro_cmp(const void *a, const void *b)
+{
+	double x, y;
+
+	x = *(const double *)a;
+	y = *(const double *)b;
+	return (x < y ? -1 : (x > y ? 1 : 0));
+}
+
+/*
+ * micro_measure --
+ *	Measure an operation and report its cost.
+ */
+int
+micro_measure(MICRO *m,
+    const char *name, const char *param, MICRO_OP op, void *arg)
+{
+	WT_DECL_RET;
+	double *cycles, ns, *nsecs;
+	uint64_t iters, target;
+	u_int i;
+
+	if (m->filter != NULL && strstr(name, m->filter) == NULL)
+		return (0);
+
+	if ((nsecs = calloc(m->runs, sizeof(double))) == NULL ||
+	    (cycles = calloc(m->runs, sizeof(double))) == NULL) {
+		free(nsecs);
+		return (ENOMEM);
+	}
+
+	/*
+	 * Calibrate: find an iteration count where a run takes at least the
+	 * minimum run length, so timer resolution and the fixed cost of a run
+	 * are lost in the noise.  The first run warms the caches and isn't
+	 * used for sizing, it's usually much slower than the rest.  Size the
+	 * count from the cost of the last warm run, aiming a little past the
+	 * minimum, then re-check with a run of that size: the cost of short
+	 * runs isn't a good estimate.  Runs too short to time grow the count
+	 * by a factor of 10.
+	 */
+	WT_ERR(micro_run(m, op, arg, 1, &ns, NULL));
+	target = m->min_run_ns + m->min_run_ns / 10;
+	for (iters = 1;;) {
+		WT_ERR(micro_run(m, op, arg, iters, &ns, NULL));
+		if (ns * iters >= (double)m->min_run_ns)
+			break;
+		if (ns * iters < (double)m->min_run_ns / 100)
+			iters *= 10;
+		else
+			iters = (uint64_t)(target / ns) + 1;
+	}
+
+	/*
+	 * Report the median of the runs, which is less sensitive than the mean
+	 * to the occasional run disturbed by something else on the machine.
+	 */
+	for (i = 0; i < m->runs; ++i)
+		WT_ERR(micro_run(m, op, arg, iters, &nsecs[i], &cycles[i]));
+	qsort(nsecs, m->runs, sizeof(double), micro_cmp);
+	qsort(cycles, m->runs, sizeof(double), micro_cmp);
+	printf("%s,%s,%" PRIu64 ",%u,%.2f,%.2f,%.2f,%.1f\n",
+	    name, param, iters, m->runs, nsecs[m->runs / 2],
+	    nsecs[0], nsecs[m->runs - 1], cycles[m->runs / 2]);
+	(void)fflush(stdout);
+
+err:	free(cycles);
+	free(nsecs);
+	if (ret != 0)
+		fprintf(stderr, "%s: %s: %s\n",
+		    progname, name, wiredtiger_strerror(ret));
+	return (ret);
+}
+
+/*
+ * usage --
+ *	Display a usage message.
+ */
+static int
+usage(void)
+{
+	fprintf(stderr,
+	    "usage: %s [-q] [-b benchmark] [-h home] [-r runs] [-t msecs]\n",
+	    progname);
+	return (EXIT_FAILURE);
+}
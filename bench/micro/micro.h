@@ -0,0 +1,78 @@
+/*-
+ * Public Domain 2014-2015 MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <wt_internal.h>			/* For __wt_XXX */
+
+/*
+ * Each benchmark is an operation function run for a count of iterations; the
+ * reported cost is the time taken by a run divided by its iterations.
+ */
+typedef struct __micro MICRO;
+typedef int (*MICRO_OP)(MICRO *, void *, uint64_t);
+
+struct __micro {
+	const char *home;			/* Database home */
+	const char *filter;			/* Benchmark name filter */
+
+	WT_CONNECTION *conn;			/* Database connection */
+	WT_SESSION *wt_session;			/* Session */
+	WT_SESSION_IMPL *session;		/* Session internals */
+
+	u_int runs;				/* Measured runs */
+	uint64_t min_run_ns;			/* Minimum run length */
+	bool quick;				/* Smoke test sizes */
+
+	WT_RAND_STATE rnd;			/* Random number state */
+
+	volatile uint64_t sink;			/* Defeat dead code removal */
+};
+
+/*
+ * Benchmark data sizes: keys are chosen from a table of MICRO_KEYS entries,
+ * which must be a power-of-two.
+ */
+#define	MICRO_KEYS	4096
+#define	MICRO_ROWS(m)	((m)->quick ? 10000 : 100000)
+
+int	micro_btree(MICRO *);
+int	micro_close(MICRO *);
+int	micro_log(MICRO *);
+int	micro_measure(MICRO *, const char *, const char *, MICRO_OP, void *);
+int	micro_open(MICRO *);
+int	micro_support(MICRO *);
@@ -0,0 +1,267 @@
+/*-
+ * Public Domain 2014-2015 MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "micro.h"
+
+#define	MICRO_INSERT_URI	"file:micro_insert.wt"
+#define	MICRO_SEARCH_URI	"file:micro_search.wt"
+#define	MICRO_TABLE_CONFIG						\
+	"key_format=S,value_format=S,log=(enabled=false)"
+#define	MICRO_VALUE_LEN		100
+
+typedef struct {
+	WT_CURSOR *cursor;			/* Cursor */
+	WT_CURSOR_BTREE *cbt;			/* Cursor internals */
+
+	WT_ITEM keys[MICRO_KEYS];		/* Search keys */
+	char keybuf[MICRO_KEYS][24];
+} BTREE_BENCH;
+
+/*
+ * btree_key --
+ *	Set a search key.
+ */
+static void
+btree_key(BTREE_BENCH *b, u_int i, uint64_t keyno)
+{
+	(void)snprintf(
+	    b->keybuf[i], sizeof(b->keybuf[i]), "%010" PRIu64, keyno);
+	b->keys[i].data = b->keybuf[i];
+	b->keys[i].size = strlen(b->keybuf[i]) + 1;
+}
+
+/*
+ * btree_insert --
+ *	Re-create an object and insert a set of records.
+ */
+static int
+btree_insert(MICRO *m, const char *uri, BTREE_BENCH *b, uint64_t rows)
+{
+	WT_CURSOR *cursor;
+	WT_DECL_RET;
+	WT_SESSION *wt_session;
+	uint64_t i;
+	char key[24], value[MICRO_VALUE_LEN + 1];
+
+	wt_session = m->wt_session;
+	memset(value, 'v', MICRO_VALUE_LEN);
+	value[MICRO_VALUE_LEN] = '\0';
+
+	WT_RET(wt_session->drop(wt_session, uri, "force"));
+	WT_RET(wt_session->create(wt_session, uri, MICRO_TABLE_CONFIG));
+	WT_RET(wt_session->open_cursor(wt_session, uri, NULL, NULL, &cursor));
+	for (i = 0; i < rows; ++i) {
+		if (b == NULL)
+			(void)snprintf(key, sizeof(key), "%010" PRIu64, i);
+		else
+			strcpy(key, b->keybuf[i]);
+		cursor->set_key(cursor, key);
+		cursor->set_value(cursor, value);
+		WT_ERR(cursor->insert(cursor));
+	}
+err:	WT_TRET(cursor->close(cursor));
+	return (ret);
+}
+
+/*
+ * btree_position --
+ *	Replace the benchmark's cursor, optionally positioning it on the first
+ * search key, which pins the key's leaf page in memory.
+ */
+static int
+btree_position(MICRO *m, const char *uri, BTREE_BENCH *b, bool position)
+{
+	WT_CURSOR *cursor;
+	WT_SESSION *wt_session;
+
+	wt_session = m->wt_session;
+	if ((cursor = b->cursor) != NULL) {
+		b->cursor = NULL;
+		WT_RET(cursor->close(cursor));
+	}
+	WT_RET(wt_session->open_cursor(wt_session, uri, NULL, NULL, &cursor));
+	b->cursor = cursor;
+	b->cbt = (WT_CURSOR_BTREE *)cursor;
+	if (position) {
+		cursor->set_key(cursor, b->keybuf[0]);
+		WT_RET(cursor->search(cursor));
+	}
+	return (0);
+}
+
+/*
+ * row_search_op --
+ *	Search a row-store tree from the root.
+ */
+static int
+row_search_op(MICRO *m, void *arg, uint64_t n)
+{
+	BTREE_BENCH *b;
+	WT_CURSOR_BTREE *cbt;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	uint64_t i;
+
+	b = arg;
+	cbt = b->cbt;
+	session = m->session;
+	for (i = 0; i < n; ++i) {
+		WT_WITH_PAGE_INDEX(session, ret = __wt_row_search(session,
+		    &b->keys[i & (MICRO_KEYS - 1)], NULL, cbt, false));
+		WT_RET(ret);
+		if (cbt->compare != 0)
+			WT_RET_MSG(session, WT_NOTFOUND, "row search failed");
+		m->sink += cbt->slot;
+		WT_RET(__wt_page_release(session, cbt->ref, 0));
+		cbt->ref = NULL;
+	}
+	return (0);
+}
+
+/*
+ * search_insert_op --
+ *	Search a page's insert list.
+ */
+static int
+search_insert_op(MICRO *m, void *arg, uint64_t n)
+{
+	BTREE_BENCH *b;
+	WT_CURSOR_BTREE *cbt;
+	WT_SESSION_IMPL *session;
+	uint64_t i;
+
+	b = arg;
+	cbt = b->cbt;
+	session = m->session;
+	for (i = 0; i < n; ++i) {
+		WT_RET(__wt_search_insert(
+		    session, cbt, &b->keys[i & (MICRO_KEYS - 1)]));
+		if (cbt->compare != 0)
+			WT_RET_MSG(session,
+			    WT_NOTFOUND, "insert list search failed");
+		m->sink += (uintptr_t)cbt->ins_stack[0];
+	}
+	return (0);
+}
+
+/*
+ * reconcile_op --
+ *	Reconcile a row-store leaf page.
+ */
+static int
+reconcile_op(MICRO *m, void *arg, uint64_t n)
+{
+	BTREE_BENCH *b;
+	WT_PAGE *page;
+	WT_REF *ref;
+	WT_SESSION_IMPL *session;
+	uint64_t i;
+
+	b = arg;
+	ref = b->cbt->ref;
+	page = ref->page;
+	session = m->session;
+	for (i = 0; i < n; ++i) {
+		/*
+		 * Marking the page dirty without changing it reconciles every
+		 * record from the page's disk image.
+		 */
+		WT_RET(__wt_page_modify_init(session, page));
+		__wt_page_modify_set(session, page);
+		WT_RET(__wt_reconcile(session, ref, NULL, 0));
+	}
+	return (0);
+}
+
+/*
+ * micro_btree --
+ *	Btree search and reconciliation benchmarks.
+ */
+int
+micro_btree(MICRO *m)
+{
+	BTREE_BENCH *b;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	uint64_t rows;
+	u_int i;
+	char param[64];
+
+	rows = MICRO_ROWS(m);
+
+	b = NULL;
+	WT_RET(__wt_calloc_one(m->session, &b));
+
+	/*
+	 * Populate the search object, then re-open the connection so searches
+	 * and reconciliation work on pages instantiated from disk images rather
+	 * than on insert lists.
+	 */
+	WT_ERR(btree_insert(m, MICRO_SEARCH_URI, NULL, rows));
+	WT_ERR(micro_close(m));
+	WT_ERR(micro_open(m));
+	session = m->session;
+
+	for (i = 0; i < MICRO_KEYS; ++i)
+		btree_key(b, i, __wt_random(&m->rnd) % rows);
+	(void)snprintf(param, sizeof(param), "%" PRIu64 "-rows", rows);
+	WT_ERR(btree_position(m, MICRO_SEARCH_URI, b, false));
+	WT_WITH_BTREE(session, b->cbt->btree, ret =
+	    micro_measure(m, "row-search", param, row_search_op, b));
+	WT_ERR(ret);
+
+	/* Reconcile the leaf page holding the first search key. */
+	WT_ERR(btree_position(m, MICRO_SEARCH_URI, b, true));
+	(void)snprintf(param, sizeof(param),
+	    "%" PRIu32 "-rows", b->cbt->ref->page->pg_row_entries);
+	WT_WITH_BTREE(session, b->cbt->btree, ret =
+	    micro_measure(m, "reconcile-row-leaf", param, reconcile_op, b));
+	WT_ERR(ret);
+
+	/*
+	 * Insert records into an empty object: they're all on the smallest key
+	 * insert list of its single leaf page.
+	 */
+	for (i = 0; i < MICRO_KEYS; ++i)
+		btree_key(b, i, (uint64_t)
+		    (__wt_random(&m->rnd) % WT_MILLION) * MICRO_KEYS + i);
+	WT_ERR(btree_insert(m, MICRO_INSERT_URI, b, MICRO_KEYS));
+	WT_ERR(btree_position(m, MICRO_INSERT_URI, b, true));
+	if ((b->cbt->ins_head =
+	    WT_ROW_INSERT_SMALLEST(b->cbt->ref->page)) == NULL)
+		WT_ERR_MSG(session, EINVAL, "no insert list");
+	(void)snprintf(param, sizeof(param), "%d-entries", MICRO_KEYS);
+	WT_WITH_BTREE(session, b->cbt->btree, ret =
+	    micro_measure(m, "search-insert", param, search_insert_op, b));
+	WT_ERR(ret);
+
+err:	if (b->cursor != NULL)
+		WT_TRET(b->cursor->close(b->cursor));
+	__wt_free(m->session, b);
+	return (ret);
+}
@@ -0,0 +1,93 @@
+/*-
+ * Public Domain 2014-2015 MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "micro.h"
+
+#define	MICRO_LOG_MESSAGE_LEN	100
+
+/*
+ * log_write_op --
+ *	Write a log record.
+ */
+static int
+log_write_op(MICRO *m, void *arg, uint64_t n)
+{
+	WT_ITEM *logrec;
+	uint64_t i;
+
+	logrec = arg;
+	for (i = 0; i < n; ++i)
+		WT_RET(__wt_log_write(m->session, logrec, NULL, 0));
+	return (0);
+}
+
+/*
+ * micro_log --
+ *	Log write benchmarks.
+ */
+int
+micro_log(MICRO *m)
+{
+	WT_DECL_ITEM(logrec);
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	size_t header_size;
+	uint32_t rectype;
+	char param[64];
+	const char *fmt;
+
+	session = m->session;
+	fmt = WT_UNCHECKED_STRING(I);
+	rectype = WT_LOGREC_MESSAGE;
+
+	/*
+	 * Build a message record, the way WT_SESSION::log_printf does, and
+	 * write it repeatedly: the log write path joins a slot, copies the
+	 * record into the slot's buffer and releases the slot.  The record is
+	 * padded to the log's allocation size on the first write, report the
+	 * padded size, that's what each write copies into the log.
+	 */
+	WT_RET(__wt_logrec_alloc(session,
+	    sizeof(WT_LOG_RECORD) + MICRO_LOG_MESSAGE_LEN, &logrec));
+	WT_ERR(__wt_struct_size(session, &header_size, fmt, rectype));
+	WT_ERR(__wt_struct_pack(session,
+	    (uint8_t *)logrec->data + logrec->size, header_size, fmt, rectype));
+	logrec->size += header_size;
+	memset((uint8_t *)logrec->data + logrec->size,
+	    'm', MICRO_LOG_MESSAGE_LEN - 1);
+	((char *)logrec->data)[
+	    logrec->size + MICRO_LOG_MESSAGE_LEN - 1] = '\0';
+	logrec->size += MICRO_LOG_MESSAGE_LEN;
+
+	(void)snprintf(param, sizeof(param), "%" PRIu32 "B", __wt_rduppo2(
+	    (uint32_t)logrec->size, S2C(session)->log->allocsize));
+	WT_ERR(micro_measure(m, "log-write", param, log_write_op, logrec));
+
+err:	__wt_logrec_free(session, &logrec);
+	return (ret);
+}
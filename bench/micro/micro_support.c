@@ -0,0 +1,315 @@
+/*-
+ * Public Domain 2014-2015 MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "micro.h"
+
+/*
+ * Buffers are filled with text drawn from letter frequencies, so checksums
+ * and Huffman coding see realistic data.
+ */
+#define	MICRO_TEXT							\
+	"eeeeeeeeeeeeettttttttttaaaaaaaaoooooooiiiiiiinnnnnnnssssss"	\
+	"hhhhhhrrrrrrdddduuullllcccmmmwwffggyyppbbvk      ...,,,"
+
+typedef struct {
+	uint8_t *buf;				/* Buffer */
+	size_t len;				/* Buffer length */
+	WT_ITEM in, out;			/* Encoded, decoded data */
+	void *huffman;				/* Huffman coding */
+} SUPPORT;
+
+typedef struct {
+	uint64_t v[MICRO_KEYS];			/* Values */
+	uint8_t packed[MICRO_KEYS * 10];	/* Packed values */
+} INTPACK;
+
+/* Huffman symbol frequency array element, as in bt_huffman.c */
+typedef struct {
+	uint32_t symbol;
+	uint32_t frequency;
+} HUFFMAN_SYMBOL;
+
+/*
+ * support_text --
+ *	Fill a buffer with text.
+ */
+static void
+support_text(MICRO *m, uint8_t *buf, size_t len)
+{
+	size_t i;
+
+	for (i = 0; i < len; ++i)
+		buf[i] = (uint8_t)MICRO_TEXT[
+		    __wt_random(&m->rnd) % (sizeof(MICRO_TEXT) - 1)];
+}
+
+/*
+ * cksum_op --
+ *	Checksum a buffer.
+ */
+static int
+cksum_op(MICRO *m, void *arg, uint64_t n)
+{
+	SUPPORT *s;
+	uint64_t i, sum;
+
+	s = arg;
+	for (i = sum = 0; i < n; ++i)
+		sum += __wt_cksum(s->buf, s->len);
+	m->sink += sum;
+	return (0);
+}
+
+/*
+ * vpack_op --
+ *	Pack variable-length unsigned integers.
+ */
+static int
+vpack_op(MICRO *m, void *arg, uint64_t n)
+{
+	INTPACK *ip;
+	uint64_t i;
+	uint8_t buf[10], *p;
+
+	ip = arg;
+	for (i = 0; i < n; ++i) {
+		p = buf;
+		WT_RET(__wt_vpack_uint(
+		    &p, sizeof(buf), ip->v[i & (MICRO_KEYS - 1)]));
+		m->sink += buf[0];
+	}
+	return (0);
+}
+
+/*
+ * vunpack_op --
+ *	Unpack variable-length unsigned integers.
+ */
+static int
+vunpack_op(MICRO *m, void *arg, uint64_t n)
+{
+	INTPACK *ip;
+	uint64_t i, sum, v;
+	const uint8_t *p;
+
+	ip = arg;
+	for (i = sum = 0; i < n;) {
+		p = ip->packed;
+		do {
+			WT_RET(__wt_vunpack_uint(&p, 10, &v));
+			sum += v;
+		} while (++i < n && (i & (MICRO_KEYS - 1)) != 0);
+	}
+	m->sink += sum;
+	return (0);
+}
+
+/*
+ * struct_pack_op --
+ *	Pack a record.
+ */
+static int
+struct_pack_op(MICRO *m, void *arg, uint64_t n)
+{
+	INTPACK *ip;
+	uint64_t i, v;
+	uint8_t buf[64];
+
+	ip = arg;
+	for (i = 0; i < n; ++i) {
+		v = ip->v[i & (MICRO_KEYS - 1)];
+		WT_RET(__wt_struct_pack(m->session, buf, sizeof(buf),
+		    "iSq", (int32_t)v, "key", (int64_t)v));
+		m->sink += buf[0];
+	}
+	return (0);
+}
+
+/*
+ * struct_unpack_op --
+ *	Unpack a record.
+ */
+static int
+struct_unpack_op(MICRO *m, void *arg, uint64_t n)
+{
+	SUPPORT *s;
+	int64_t q;
+	int32_t v;
+	uint64_t i;
+	const char *str;
+
+	s = arg;
+	for (i = 0; i < n; ++i) {
+		WT_RET(__wt_struct_unpack(m->session,
+		    s->buf, s->len, "iSq", &v, &str, &q));
+		m->sink += (uint64_t)q;
+	}
+	return (0);
+}
+
+/*
+ * huffman_decode_op --
+ *	Huffman decode a buffer.
+ */
+static int
+huffman_decode_op(MICRO *m, void *arg, uint64_t n)
+{
+	SUPPORT *s;
+	uint64_t i;
+
+	s = arg;
+	for (i = 0; i < n; ++i)
+		WT_RET(__wt_huffman_decode(m->session,
+		    s->huffman, s->in.data, s->in.size, &s->out));
+	m->sink += s->out.size;
+	return (0);
+}
+
+/*
+ * huffman_encode_op --
+ *	Huffman encode a buffer.
+ */
+static int
+huffman_encode_op(MICRO *m, void *arg, uint64_t n)
+{
+	SUPPORT *s;
+	uint64_t i;
+
+	s = arg;
+	for (i = 0; i < n; ++i)
+		WT_RET(__wt_huffman_encode(m->session,
+		    s->huffman, s->buf, s->len, &s->out));
+	m->sink += s->out.size;
+	return (0);
+}
+
+/*
+ * micro_huffman --
+ *	Huffman coding benchmarks.
+ */
+static int
+micro_huffman(MICRO *m, SUPPORT *s)
+{
+	HUFFMAN_SYMBOL symbols[256];
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	size_t i;
+	char param[64];
+
+	session = m->session;
+
+	/* Build the coding from the buffer's symbol frequencies. */
+	for (i = 0; i < WT_ELEMENTS(symbols); ++i) {
+		symbols[i].symbol = (uint32_t)i;
+		symbols[i].frequency = 1;
+	}
+	for (i = 0; i < s->len; ++i)
+		++symbols[s->buf[i]].frequency;
+	WT_RET(__wt_huffman_open(session,
+	    symbols, WT_ELEMENTS(symbols), 1, &s->huffman));
+
+	WT_ERR(__wt_huffman_encode(
+	    session, s->huffman, s->buf, s->len, &s->in));
+	WT_ERR(__wt_huffman_decode(
+	    session, s->huffman, s->in.data, s->in.size, &s->out));
+	if (s->out.size != s->len || memcmp(s->out.data, s->buf, s->len) != 0)
+		WT_ERR_MSG(session, EINVAL, "Huffman decode mismatch");
+
+	(void)snprintf(param, sizeof(param), "%" WT_SIZET_FMT "B", s->len);
+	WT_ERR(micro_measure(
+	    m, "huffman-decode", param, huffman_decode_op, s));
+	WT_ERR(micro_measure(
+	    m, "huffman-encode", param, huffman_encode_op, s));
+
+err:	__wt_huffman_close(session, s->huffman);
+	s->huffman = NULL;
+	return (ret);
+}
+
+/*
+ * micro_support --
+ *	Checksum, packing and Huffman coding benchmarks.
+ */
+int
+micro_support(MICRO *m)
+{
+	static const size_t sizes[] = { 512, 4096, 32768 };
+	INTPACK *ip;
+	SUPPORT _s, *s;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	size_t i, len;
+	uint8_t *p;
+	char param[64];
+
+	session = m->session;
+	ip = NULL;
+	s = &_s;
+	memset(s, 0, sizeof(*s));
+
+	WT_RET(__wt_calloc_def(
+	    session, sizes[WT_ELEMENTS(sizes) - 1], &s->buf));
+	support_text(m, s->buf, sizes[WT_ELEMENTS(sizes) - 1]);
+	for (i = 0; i < WT_ELEMENTS(sizes); ++i) {
+		s->len = sizes[i];
+		(void)snprintf(
+		    param, sizeof(param), "%" WT_SIZET_FMT "B", s->len);
+		WT_ERR(micro_measure(m, "cksum", param, cksum_op, s));
+	}
+
+	/*
+	 * Integers are spread over the packed sizes: shift random 64-bit values
+	 * right by a random number of bits.
+	 */
+	WT_ERR(__wt_calloc_one(session, &ip));
+	for (i = 0, p = ip->packed; i < MICRO_KEYS; ++i) {
+		ip->v[i] = ((uint64_t)__wt_random(&m->rnd) << 32 |
+		    __wt_random(&m->rnd)) >> (__wt_random(&m->rnd) % 64);
+		WT_ERR(__wt_vpack_uint(&p, 10, ip->v[i]));
+	}
+	WT_ERR(micro_measure(m, "vpack", "uint", vpack_op, ip));
+	WT_ERR(micro_measure(m, "vunpack", "uint", vunpack_op, ip));
+
+	WT_ERR(micro_measure(m, "struct-pack", "iSq", struct_pack_op, ip));
+	WT_ERR(__wt_struct_size(session,
+	    &len, "iSq", (int32_t)ip->v[0], "key", (int64_t)ip->v[0]));
+	WT_ERR(__wt_struct_pack(session, s->buf, len,
+	    "iSq", (int32_t)ip->v[0], "key", (int64_t)ip->v[0]));
+	s->len = len;
+	WT_ERR(micro_measure(m, "struct-unpack", "iSq", struct_unpack_op, s));
+
+	support_text(m, s->buf, 4096);
+	s->len = 4096;
+	WT_ERR(micro_huffman(m, s));
+
+err:	__wt_free(session, ip);
+	__wt_free(session, s->buf);
+	__wt_buf_free(session, &s->in);
+	__wt_buf_free(session, &s->out);
+	return (ret);
+}
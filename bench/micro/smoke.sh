@@ -0,0 +1,4 @@
+#! /bin/sh
+
+# Smoke-test the micro-benchmarks as part of running "make check".
+./micro -q
@@ -167,6 +167,41 @@ config_compress(CONFIG *cfg)
 
 }
 
+/*
+ * config_distribution --
+ *	Parse the key and scan length distribution configuration.
+ */
+int
+config_distribution(CONFIG *cfg)
+{
+	const char *s;
+
+	s = cfg->key_distribution;
+	if (strcmp(s, "hotspot") == 0)
+		cfg->key_dist = DIST_HOTSPOT;
+	else if (strcmp(s, "latest") == 0)
+		cfg->key_dist = DIST_LATEST;
+	else if (strcmp(s, "uniform") == 0)
+		cfg->key_dist = DIST_UNIFORM;
+	else if (strcmp(s, "zipfian") == 0)
+		cfg->key_dist = DIST_ZIPFIAN;
+	else {
+		fprintf(stderr, "invalid key distribution: %s\n", s);
+		return (EINVAL);
+	}
+
+	s = cfg->scan_distribution;
+	if (strcmp(s, "uniform") == 0)
+		cfg->scan_dist = DIST_UNIFORM;
+	else if (strcmp(s, "zipfian") == 0)
+		cfg->scan_dist = DIST_ZIPFIAN;
+	else {
+		fprintf(stderr, "invalid scan distribution: %s\n", s);
+		return (EINVAL);
+	}
+	return (0);
+}
+
 /*
  * config_threads --
  *	Parse the thread configuration.
@@ -238,6 +273,12 @@ config_threads(CONFIG *cfg, const char *config, size_t len)
 					goto err;
 				continue;
 			}
+			if (STRING_MATCH("overwrite", k.str, k.len) ||
+			    STRING_MATCH("overwrites", k.str, k.len)) {
+				if ((workp->overwrite = v.val) < 0)
+					goto err;
+				continue;
+			}
 			if (STRING_MATCH("ops_per_txn", k.str, k.len)) {
 				if ((workp->ops_per_txn = v.val) < 0)
 					goto err;
@@ -249,6 +290,12 @@ config_threads(CONFIG *cfg, const char *config, size_t len)
 					goto err;
 				continue;
 			}
+			if (STRING_MATCH("scan", k.str, k.len) ||
+			    STRING_MATCH("scans", k.str, k.len)) {
+				if ((workp->scan = v.val) < 0)
+					goto err;
+				continue;
+			}
 			if (STRING_MATCH("update", k.str, k.len) ||
 			    STRING_MATCH("updates", k.str, k.len)) {
 				if ((workp->update = v.val) < 0)
@@ -287,7 +334,8 @@ config_threads(CONFIG *cfg, const char *config, size_t len)
 		scan = NULL;
 		if (ret != 0)
 			goto err;
-		if (workp->insert == 0 && workp->read == 0 &&
+		if (workp->insert == 0 && workp->overwrite == 0 &&
+		    workp->read == 0 && workp->scan == 0 &&
 		    workp->update == 0 && workp->truncate == 0)
 			goto err;
 		/* Why run with truncate if we don't want any truncation. */
@@ -301,7 +349,8 @@ config_threads(CONFIG *cfg, const char *config, size_t len)
 		if (workp->truncate != 0 && workp->threads > 1)
 			goto err;
 		if (workp->truncate != 0 &&
-		    (workp->insert > 0 || workp->read > 0 || workp->update > 0))
+		    (workp->insert > 0 || workp->overwrite > 0 ||
+		    workp->read > 0 || workp->scan > 0 || workp->update > 0))
 			goto err;
 		cfg->workers_cnt += (u_int)workp->threads;
 	}
@@ -649,6 +698,27 @@ config_sanity(CONFIG *cfg)
 		    "Invalid pareto distribution - should be a percentage\n");
 		return (EINVAL);
 	}
+	if (cfg->pareto != 0 && cfg->key_dist != DIST_UNIFORM) {
+		fprintf(stderr,
+		    "pareto requires the uniform key distribution\n");
+		return (EINVAL);
+	}
+	if (cfg->hotspot_keys < 1 || cfg->hotspot_keys > 99 ||
+	    cfg->hotspot_ops > 100) {
+		fprintf(stderr,
+		    "Invalid hotspot distribution - hotspot_keys should be "
+		    "between 1 and 99, hotspot_ops should be a percentage\n");
+		return (EINVAL);
+	}
+	if (cfg->zipfian_skew < 1 || cfg->zipfian_skew > 99) {
+		fprintf(stderr,
+		    "Invalid zipfian skew - should be between 1 and 99\n");
+		return (EINVAL);
+	}
+	if (cfg->scan_length < 1) {
+		fprintf(stderr, "invalid scan length, less than 1\n");
+		return (EINVAL);
+	}
 	return (0);
 }
 
@@ -686,12 +756,16 @@ config_print(CONFIG *cfg)
 		for (i = 0, workp = cfg->workload;
 		    i < cfg->workload_cnt; ++i, ++workp)
 			printf("\t\t%" PRId64 " threads (inserts=%" PRId64
-			    ", reads=%" PRId64 ", updates=%" PRId64
+			    ", overwrites=%" PRId64 ", reads=%" PRId64
+			    ", scans=%" PRId64 ", updates=%" PRId64
 			    ", truncates=% " PRId64 ")\n",
 			    workp->threads,
-			    workp->insert, workp->read,
-			    workp->update, workp->truncate);
+			    workp->insert, workp->overwrite, workp->read,
+			    workp->scan, workp->update, workp->truncate);
 	}
+	printf("\t" "Key distribution: %s\n", cfg->key_distribution);
+	printf("\t" "Scan length: %" PRIu32 " (%s)\n",
+	    cfg->scan_length, cfg->scan_distribution);
 
 	printf("\t" "Checkpoint threads, interval: %" PRIu32 ", %" PRIu32 "\n",
 	    cfg->checkpoint_threads, cfg->checkpoint_interval);
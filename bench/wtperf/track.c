@@ -98,6 +98,11 @@ sum_read_ops(CONFIG *cfg)
 	return (sum_ops(cfg, offsetof(CONFIG_THREAD, read)));
 }
 uint64_t
+sum_scan_ops(CONFIG *cfg)
+{
+	return (sum_ops(cfg, offsetof(CONFIG_THREAD, scan)));
+}
+uint64_t
 sum_truncate_ops(CONFIG *cfg)
 {
 	return (sum_ops(cfg, offsetof(CONFIG_THREAD, truncate)));
@@ -266,11 +271,119 @@ sum_read_latency(CONFIG *cfg, TRACK *total)
 	sum_latency(cfg, offsetof(CONFIG_THREAD, read), total);
 }
 static void
+sum_scan_latency(CONFIG *cfg, TRACK *total)
+{
+	sum_latency(cfg, offsetof(CONFIG_THREAD, scan), total);
+}
+static void
 sum_update_latency(CONFIG *cfg, TRACK *total)
 {
 	sum_latency(cfg, offsetof(CONFIG_THREAD, update), total);
 }
 
+/*
+ * hdr_low --
+ *	Return the lowest latency recorded in an HDR histogram bucket.
+ */
+static uint64_t
+hdr_low(u_int i)
+{
+	u_int k;
+
+	if (i < 2 * HDR_SUB)
+		return (i);
+	k = i / HDR_SUB - 1;
+	return ((uint64_t)(i - k * HDR_SUB) << k);
+}
+
+/*
+ * latency_hdr_op --
+ *	Merge the threads' HDR histograms for an operation and write out the
+ * latencies recorded since the last call: the operation count, minimum,
+ * percentiles, maximum and each non-empty bucket.  Latencies other than the
+ * minimum are reported as the highest latency in their bucket.
+ */
+static void
+latency_hdr_op(CONFIG *cfg, FILE *fp,
+    const char *when, const char *name, size_t field_offset, uint64_t *last)
+{
+	static const double pct[] = { 50, 90, 99, 99.9, 99.99 };
+	CONFIG_THREAD *thread;
+	TRACK *trk;
+	uint64_t cum, interval[HDR_BUCKETS], ops, total, want;
+	int64_t i, th_cnt;
+	u_int j, max, min, p;
+	char sep;
+
+	if (cfg->popthreads == NULL) {
+		thread = cfg->workers;
+		th_cnt = cfg->workers_cnt;
+	} else {
+		thread = cfg->popthreads;
+		th_cnt = cfg->populate_threads;
+	}
+	memset(interval, 0, sizeof(interval));
+	for (i = 0; thread != NULL && i < th_cnt; ++i, ++thread) {
+		trk = (TRACK *)((uint8_t *)thread + field_offset);
+		for (j = 0; j < HDR_BUCKETS; ++j)
+			interval[j] += trk->hdr[j];
+	}
+
+	/*
+	 * Convert the totals into this interval's counts: the totals go
+	 * backward when the workload phase replaces the populate phase.
+	 */
+	for (ops = 0, j = 0; j < HDR_BUCKETS; ++j) {
+		total = interval[j];
+		if (total >= last[j])
+			interval[j] -= last[j];
+		last[j] = total;
+		ops += interval[j];
+	}
+	if (ops == 0)
+		return;
+
+	for (min = 0; interval[min] == 0; ++min)
+		;
+	for (max = HDR_BUCKETS - 1; interval[max] == 0; --max)
+		;
+	fprintf(fp, "%s,%" PRIu32 ",%s,%" PRIu64 ",%" PRIu64,
+	    when, cfg->totalsec, name, ops, hdr_low(min));
+	for (cum = 0, j = 0, p = 0; p < ELEMENTS(pct); ++p) {
+		if ((want = (uint64_t)(ops * pct[p] / 100)) == 0)
+			want = 1;
+		for (; cum + interval[j] < want; ++j)
+			cum += interval[j];
+		fprintf(fp, ",%" PRIu64, hdr_low(j + 1) - 1);
+	}
+	fprintf(fp, ",%" PRIu64, hdr_low(max + 1) - 1);
+	for (sep = ',', j = min; j <= max; ++j)
+		if (interval[j] != 0) {
+			fprintf(fp, "%c%" PRIu64 ":%" PRIu64,
+			    sep, hdr_low(j + 1) - 1, interval[j]);
+			sep = ' ';
+		}
+	fprintf(fp, "\n");
+}
+
+/*
+ * latency_hdr_print --
+ *	Write out the HDR histograms for the interval since the last call, the
+ * caller's buffer holds the previous totals, HDR_OPS * HDR_BUCKETS entries.
+ */
+void
+latency_hdr_print(CONFIG *cfg, FILE *fp, const char *when, uint64_t *last)
+{
+	latency_hdr_op(cfg, fp, when,
+	    "insert", offsetof(CONFIG_THREAD, insert), last);
+	latency_hdr_op(cfg, fp, when,
+	    "read", offsetof(CONFIG_THREAD, read), last + HDR_BUCKETS);
+	latency_hdr_op(cfg, fp, when,
+	    "scan", offsetof(CONFIG_THREAD, scan), last + 2 * HDR_BUCKETS);
+	latency_hdr_op(cfg, fp, when,
+	    "update", offsetof(CONFIG_THREAD, update), last + 3 * HDR_BUCKETS);
+}
+
 static void
 latency_print_single(CONFIG *cfg, TRACK *total, const char *name)
 {
@@ -325,6 +438,8 @@ latency_print(CONFIG *cfg)
 	latency_print_single(cfg, &total, "insert");
 	sum_read_latency(cfg, &total);
 	latency_print_single(cfg, &total, "read");
+	sum_scan_latency(cfg, &total);
+	latency_print_single(cfg, &total, "scan");
 	sum_update_latency(cfg, &total);
 	latency_print_single(cfg, &total, "update");
 }
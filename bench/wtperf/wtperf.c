@@ -40,6 +40,7 @@ static const CONFIG default_cfg = {
 	NULL,				/* logf */
 	NULL,				/* async */
 	NULL, NULL,			/* compressor ext, blk */
+	0, 0,				/* key, scan length distributions */
 	NULL, NULL,			/* populate, checkpoint threads */
 
 	NULL,				/* worker threads */
@@ -50,6 +51,7 @@ static const CONFIG default_cfg = {
 	0,				/* checkpoint operations */
 	0,				/* insert operations */
 	0,				/* read operations */
+	0,				/* scan operations */
 	0,				/* truncate operations */
 	0,				/* update operations */
 	0,				/* insert key */
@@ -86,8 +88,10 @@ static int	 start_threads(CONFIG *,
 static int	 stop_threads(CONFIG *, u_int, CONFIG_THREAD *);
 static void	*thread_run_wtperf(void *);
 static void	*worker(void *);
+static int	worker_open_loop(uint64_t *, uint64_t, struct timespec *);
 static void	worker_throttle(int64_t, int64_t *, struct timespec *);
 static uint64_t	 wtperf_rand(CONFIG_THREAD *);
+static uint32_t	 wtperf_scan_length(CONFIG_THREAD *);
 static uint64_t	 wtperf_value_range(CONFIG *);
 
 #define	HELIUM_NAME	"dev1"
@@ -240,6 +244,8 @@ track_operation(TRACK *trk, uint64_t usecs)
 	/* >100 seconds, accumulate in the biggest bucket. */
 	else
 		++trk->sec[ELEMENTS(trk->sec) - 1];
+
+	++trk->hdr[hdr_index(v)];
 }
 
 static const char *
@@ -250,8 +256,12 @@ op_name(uint8_t *op)
 		return ("insert");
 	case WORKER_INSERT_RMW:
 		return ("insert_rmw");
+	case WORKER_OVERWRITE:
+		return ("overwrite");
 	case WORKER_READ:
 		return ("read");
+	case WORKER_SCAN:
+		return ("scan");
 	case WORKER_TRUNCATE:
 		return ("truncate");
 	case WORKER_UPDATE:
@@ -297,6 +307,7 @@ worker_async(void *arg)
 			else
 				next_val = cfg->icount + get_next_incr(cfg);
 			break;
+		case WORKER_OVERWRITE:
 		case WORKER_READ:
 		case WORKER_UPDATE:
 			next_val = wtperf_rand(thread);
@@ -342,6 +353,7 @@ worker_async(void *arg)
 			if ((ret = asyncop->insert(asyncop)) == 0)
 				break;
 			goto op_err;
+		case WORKER_OVERWRITE:
 		case WORKER_UPDATE:
 			if (cfg->random_value)
 				randomize_value(thread, value_buf);
@@ -383,9 +395,10 @@ worker(void *arg)
 	WT_SESSION *session;
 	int64_t ops, ops_per_txn, throttle_ops;
 	size_t i;
-	uint64_t next_val, usecs;
+	uint64_t next_start, next_val, start_interval, usecs;
+	uint32_t scan_cnt;
 	uint8_t *op, *op_end;
-	int measure_latency, ret, truncated;
+	int exact, measure_latency, ret, truncated;
 	char *value_buf, *key_buf, *value;
 	char buf[512];
 
@@ -398,6 +411,9 @@ worker(void *arg)
 	session = NULL;
 	trk = NULL;
 	throttle_ops = 0;
+	next_start = 0;
+	start_interval = cfg->open_loop ?
+	    NSEC_PER_SEC / (uint64_t)thread->workload->throttle : 0;
 
 	if ((ret = conn->open_session(
 	    conn, NULL, cfg->sess_config, &session)) != 0) {
@@ -458,6 +474,16 @@ worker(void *arg)
 	}
 
 	while (!cfg->stop) {
+		/*
+		 * In open-loop mode, wait for the operation's scheduled start
+		 * time.
+		 */
+		if (cfg->open_loop && (ret = worker_open_loop(
+		    &next_start, start_interval, &start)) != 0) {
+			lprintf(cfg, ret, 0, "Get time call failed");
+			goto err;
+		}
+
 		/*
 		 * Generate the next key and setup operation specific
 		 * statistics tracking objects.
@@ -474,8 +500,12 @@ worker(void *arg)
 		case WORKER_READ:
 			trk = &thread->read;
 			/* FALLTHROUGH */
+		case WORKER_OVERWRITE:
+		case WORKER_SCAN:
 		case WORKER_UPDATE:
-			if (*op == WORKER_UPDATE)
+			if (*op == WORKER_SCAN)
+				trk = &thread->scan;
+			else if (*op != WORKER_READ)
 				trk = &thread->update;
 			next_val = wtperf_rand(thread);
 
@@ -504,14 +534,21 @@ worker(void *arg)
 
 		/*
 		 * Skip the first time we do an operation, when trk->ops
-		 * is 0, to avoid first time latency spikes.
+		 * is 0, to avoid first time latency spikes.  In open-loop
+		 * mode, every operation is measured from its scheduled start
+		 * time.
 		 */
-		measure_latency =
-		    cfg->sample_interval != 0 && trk != NULL &&
-		    trk->ops != 0 && (trk->ops % cfg->sample_rate == 0);
-		if (measure_latency && (ret = __wt_epoch(NULL, &start)) != 0) {
-			lprintf(cfg, ret, 0, "Get time call failed");
-			goto err;
+		if (cfg->open_loop)
+			measure_latency = trk != NULL;
+		else {
+			measure_latency =
+			    cfg->sample_interval != 0 && trk != NULL &&
+			    trk->ops != 0 && (trk->ops % cfg->sample_rate == 0);
+			if (measure_latency &&
+			    (ret = __wt_epoch(NULL, &start)) != 0) {
+				lprintf(cfg, ret, 0, "Get time call failed");
+				goto err;
+			}
 		}
 
 		cursor->set_key(cursor, key_buf);
@@ -552,6 +589,40 @@ worker(void *arg)
 			if ((ret = cursor->insert(cursor)) == 0)
 				break;
 			goto op_err;
+		case WORKER_OVERWRITE:
+			if (cfg->random_value)
+				randomize_value(thread, value_buf);
+			cursor->set_value(cursor, value_buf);
+			if ((ret = cursor->update(cursor)) == 0)
+				break;
+			goto op_err;
+		case WORKER_SCAN:
+			/*
+			 * Scans start at the chosen key (or the next larger key
+			 * if it doesn't exist), and read records until they've
+			 * read the chosen number or reach the end of the table.
+			 */
+			scan_cnt = wtperf_scan_length(thread);
+			if ((ret = cursor->search_near(cursor, &exact)) == 0 &&
+			    exact < 0)
+				ret = cursor->next(cursor);
+			while (ret == 0) {
+				if ((ret = cursor->get_value(
+				    cursor, &value)) != 0) {
+					lprintf(cfg, ret, 0,
+					    "get_value in scan.");
+					goto err;
+				}
+				if (--scan_cnt == 0)
+					break;
+				ret = cursor->next(cursor);
+			}
+
+			/* Release the cursor's position. */
+			if ((ret == 0 || ret == WT_NOTFOUND) &&
+			    (ret = cursor->reset(cursor)) == 0)
+				break;
+			goto op_err;
 		case WORKER_TRUNCATE:
 			if ((ret = run_truncate(
 			    cfg, thread, cursor, session, &truncated)) == 0) {
@@ -684,7 +755,7 @@ op_err:			if (ret == WT_ROLLBACK && ops_per_txn != 0) {
 		 * Check throttling periodically to avoid taking too
 		 * many time samples.
 		 */
-		if (thread->workload->throttle != 0 &&
+		if (thread->workload->throttle != 0 && !cfg->open_loop &&
 		    throttle_ops++ % THROTTLE_OPS == 0)
 			worker_throttle(thread->workload->throttle,
 			     &throttle_ops, &interval);
@@ -752,22 +823,37 @@ run_mix_schedule_op(WORKLOAD *workp, int op, int64_t op_cnt)
 static int
 run_mix_schedule(CONFIG *cfg, WORKLOAD *workp)
 {
-	int64_t pct;
+	int64_t pct, total;
 
-	/* Confirm reads, inserts, truncates and updates cannot all be zero. */
-	if (workp->insert == 0 && workp->read == 0 &&
-	    workp->truncate == 0 && workp->update == 0) {
+	/* Confirm the operation ratios cannot all be zero. */
+	if (workp->insert == 0 && workp->overwrite == 0 && workp->read == 0 &&
+	    workp->scan == 0 && workp->truncate == 0 && workp->update == 0) {
 		lprintf(cfg, EINVAL, 0, "no operations scheduled");
 		return (EINVAL);
 	}
 
+	/* Open-loop operations are scheduled at the throttle rate. */
+	if (cfg->open_loop && workp->throttle == 0) {
+		lprintf(cfg, EINVAL, 0,
+		    "Can't configure open_loop without a workload throttle");
+		return (EINVAL);
+	}
+
+	/* Async operations can't scan. */
+	if (workp->scan != 0 && cfg->use_asyncops) {
+		lprintf(cfg, EINVAL, 0,
+		    "Can't configure scans with async operations");
+		return (EINVAL);
+	}
+
 	/*
 	 * Handle truncate first - it's a special case that can't be used in
 	 * a mixed workload.
 	 */
 	if (workp->truncate != 0) {
-		if (workp->insert != 0 ||
-		    workp->read != 0 || workp->update != 0) {
+		if (workp->insert != 0 || workp->overwrite != 0 ||
+		    workp->read != 0 || workp->scan != 0 ||
+		    workp->update != 0) {
 			lprintf(cfg, EINVAL, 0,
 			    "Can't configure truncate in a mixed workload");
 			return (EINVAL);
@@ -782,13 +868,15 @@ run_mix_schedule(CONFIG *cfg, WORKLOAD *workp)
 	 * job-mix is read, the subsequent code works fine if only reads are
 	 * specified).
 	 */
-	if (workp->insert != 0 && workp->read == 0 && workp->update == 0) {
+	total = workp->insert +
+	    workp->overwrite + workp->read + workp->scan + workp->update;
+	if (workp->insert == total) {
 		memset(workp->ops,
 		    cfg->insert_rmw ? WORKER_INSERT_RMW : WORKER_INSERT,
 		    sizeof(workp->ops));
 		return (0);
 	}
-	if (workp->insert == 0 && workp->read == 0 && workp->update != 0) {
+	if (workp->update == total) {
 		memset(workp->ops, WORKER_UPDATE, sizeof(workp->ops));
 		return (0);
 	}
@@ -812,13 +900,17 @@ run_mix_schedule(CONFIG *cfg, WORKLOAD *workp)
 	 */
 	memset(workp->ops, WORKER_READ, sizeof(workp->ops));
 
-	pct = (workp->insert * 100) /
-	    (workp->insert + workp->read + workp->update);
+	pct = (workp->insert * 100) / total;
 	if (pct != 0)
 		run_mix_schedule_op(workp,
 		    cfg->insert_rmw ? WORKER_INSERT_RMW : WORKER_INSERT, pct);
-	pct = (workp->update * 100) /
-	    (workp->insert + workp->read + workp->update);
+	pct = (workp->overwrite * 100) / total;
+	if (pct != 0)
+		run_mix_schedule_op(workp, WORKER_OVERWRITE, pct);
+	pct = (workp->scan * 100) / total;
+	if (pct != 0)
+		run_mix_schedule_op(workp, WORKER_SCAN, pct);
+	pct = (workp->update * 100) / total;
 	if (pct != 0)
 		run_mix_schedule_op(workp, WORKER_UPDATE, pct);
 	return (0);
@@ -1089,9 +1181,9 @@ monitor(void *arg)
 	struct timespec t;
 	struct tm *tm, _tm;
 	CONFIG *cfg;
-	FILE *fp;
+	FILE *fp, *hdr_fp;
 	size_t len;
-	uint64_t min_thr, reads, inserts, updates;
+	uint64_t *hdr_last, min_thr, reads, inserts, updates;
 	uint64_t cur_reads, cur_inserts, cur_updates;
 	uint64_t last_reads, last_inserts, last_updates;
 	uint32_t read_avg, read_min, read_max;
@@ -1104,7 +1196,8 @@ monitor(void *arg)
 
 	cfg = (CONFIG *)arg;
 	assert(cfg->sample_interval != 0);
-	fp = NULL;
+	fp = hdr_fp = NULL;
+	hdr_last = NULL;
 	path = NULL;
 
 	min_thr = (uint64_t)cfg->min_throughput;
@@ -1140,6 +1233,34 @@ monitor(void *arg)
 	    "update min latency(uS),"
 	    "update maximum latency(uS)"
 	    "\n");
+
+	/* Open the HDR histogram file, it's written at the same intervals. */
+	snprintf(path, len, "%s/monitor.hdr", cfg->monitor_dir);
+	if ((hdr_fp = fopen(path, "w")) == NULL) {
+		lprintf(cfg, errno, 0, "%s", path);
+		goto err;
+	}
+	(void)setvbuf(hdr_fp, NULL, _IOLBF, 0);
+	fprintf(hdr_fp,
+	    "#time,"
+	    "totalsec,"
+	    "operation,"
+	    "operations,"
+	    "minimum latency(uS),"
+	    "50%% latency(uS),"
+	    "90%% latency(uS),"
+	    "99%% latency(uS),"
+	    "99.9%% latency(uS),"
+	    "99.99%% latency(uS),"
+	    "maximum latency(uS),"
+	    "latency(uS):operations ..."
+	    "\n");
+	if ((hdr_last =
+	    calloc(HDR_OPS * HDR_BUCKETS, sizeof(uint64_t))) == NULL) {
+		(void)enomem(cfg);
+		goto err;
+	}
+
 	last_reads = last_inserts = last_updates = 0;
 	while (!cfg->stop) {
 		for (i = 0; i < cfg->sample_interval; i++) {
@@ -1194,6 +1315,7 @@ monitor(void *arg)
 		    read_avg, read_min, read_max,
 		    insert_avg, insert_min, insert_max,
 		    update_avg, update_min, update_max);
+		latency_hdr_print(cfg, hdr_fp, buf, hdr_last);
 
 		if (latency_max != 0 &&
 		    (read_max > latency_max || insert_max > latency_max ||
@@ -1228,6 +1350,9 @@ err:		cfg->error = cfg->stop = 1;
 
 	if (fp != NULL)
 		(void)fclose(fp);
+	if (hdr_fp != NULL)
+		(void)fclose(hdr_fp);
+	free(hdr_last);
 	free(path);
 
 	return (NULL);
@@ -1496,8 +1621,8 @@ execute_workload(CONFIG *cfg)
 {
 	CONFIG_THREAD *threads;
 	WORKLOAD *workp;
-	uint64_t last_ckpts, last_inserts, last_reads, last_truncates;
-	uint64_t last_updates;
+	uint64_t last_ckpts, last_inserts, last_reads, last_scans;
+	uint64_t last_truncates, last_updates;
 	uint32_t interval, run_ops, run_time;
 	u_int i;
 	int ret, t_ret;
@@ -1505,10 +1630,10 @@ execute_workload(CONFIG *cfg)
 
 	cfg->insert_key = 0;
 	cfg->insert_ops = cfg->read_ops = cfg->truncate_ops = 0;
-	cfg->update_ops = 0;
+	cfg->scan_ops = cfg->update_ops = 0;
 
 	last_ckpts = last_inserts = last_reads = last_truncates = 0;
-	last_updates = 0;
+	last_scans = last_updates = 0;
 	ret = 0;
 
 	if (cfg->warmup != 0)
@@ -1533,10 +1658,11 @@ execute_workload(CONFIG *cfg)
 	    workp = cfg->workload; i < cfg->workload_cnt; ++i, ++workp) {
 		lprintf(cfg, 0, 1,
 		    "Starting workload #%d: %" PRId64 " threads, inserts=%"
-		    PRId64 ", reads=%" PRId64 ", updates=%" PRId64
+		    PRId64 ", overwrites=%" PRId64 ", reads=%" PRId64
+		    ", scans=%" PRId64 ", updates=%" PRId64
 		    ", truncate=%" PRId64 ", throttle=%" PRId64,
-		    i + 1, workp->threads, workp->insert,
-		    workp->read, workp->update, workp->truncate,
+		    i + 1, workp->threads, workp->insert, workp->overwrite,
+		    workp->read, workp->scan, workp->update, workp->truncate,
 		    workp->throttle);
 
 		/* Figure out the workload's schedule. */
@@ -1576,12 +1702,13 @@ execute_workload(CONFIG *cfg)
 		cfg->ckpt_ops = sum_ckpt_ops(cfg);
 		cfg->insert_ops = sum_insert_ops(cfg);
 		cfg->read_ops = sum_read_ops(cfg);
+		cfg->scan_ops = sum_scan_ops(cfg);
 		cfg->update_ops = sum_update_ops(cfg);
 		cfg->truncate_ops = sum_truncate_ops(cfg);
 
 		/* If we're checking total operations, see if we're done. */
-		if (run_ops != 0 && run_ops <=
-		    cfg->insert_ops + cfg->read_ops + cfg->update_ops)
+		if (run_ops != 0 && run_ops <= cfg->insert_ops +
+		    cfg->read_ops + cfg->scan_ops + cfg->update_ops)
 			break;
 
 		/* If writing out throughput information, see if it's time. */
@@ -1592,17 +1719,20 @@ execute_workload(CONFIG *cfg)
 
 		lprintf(cfg, 0, 1,
 		    "%" PRIu64 " reads, %" PRIu64 " inserts, %" PRIu64
-		    " updates, %" PRIu64 " truncates, %" PRIu64
-		    " checkpoints in %" PRIu32 " secs (%" PRIu32 " total secs)",
+		    " updates, %" PRIu64 " scans, %" PRIu64 " truncates, %"
+		    PRIu64 " checkpoints in %" PRIu32 " secs (%" PRIu32
+		    " total secs)",
 		    cfg->read_ops - last_reads,
 		    cfg->insert_ops - last_inserts,
 		    cfg->update_ops - last_updates,
+		    cfg->scan_ops - last_scans,
 		    cfg->truncate_ops - last_truncates,
 		    cfg->ckpt_ops - last_ckpts,
 		    cfg->report_interval, cfg->totalsec);
 		last_reads = cfg->read_ops;
 		last_inserts = cfg->insert_ops;
 		last_updates = cfg->update_ops;
+		last_scans = cfg->scan_ops;
 		last_truncates = cfg->truncate_ops;
 		last_ckpts = cfg->ckpt_ops;
 	}
@@ -1986,10 +2116,12 @@ start_run(CONFIG *cfg)
 		/* One final summation of the operations we've completed. */
 		cfg->read_ops = sum_read_ops(cfg);
 		cfg->insert_ops = sum_insert_ops(cfg);
+		cfg->scan_ops = sum_scan_ops(cfg);
 		cfg->truncate_ops = sum_truncate_ops(cfg);
 		cfg->update_ops = sum_update_ops(cfg);
 		cfg->ckpt_ops = sum_ckpt_ops(cfg);
-		total_ops = cfg->read_ops + cfg->insert_ops + cfg->update_ops;
+		total_ops = cfg->read_ops +
+		    cfg->insert_ops + cfg->scan_ops + cfg->update_ops;
 
 		lprintf(cfg, 0, 1,
 		    "Executed %" PRIu64 " read operations (%" PRIu64
@@ -2001,6 +2133,11 @@ start_run(CONFIG *cfg)
 		    "%%) %" PRIu64 " ops/sec",
 		    cfg->insert_ops, (cfg->insert_ops * 100) / total_ops,
 		    cfg->insert_ops / cfg->run_time);
+		lprintf(cfg, 0, 1,
+		    "Executed %" PRIu64 " scan operations (%" PRIu64
+		    "%%) %" PRIu64 " ops/sec",
+		    cfg->scan_ops, (cfg->scan_ops * 100) / total_ops,
+		    cfg->scan_ops / cfg->run_time);
 		lprintf(cfg, 0, 1,
 		    "Executed %" PRIu64 " truncate operations (%" PRIu64
 		    "%%) %" PRIu64 " ops/sec",
@@ -2169,6 +2306,10 @@ main(int argc, char *argv[])
 			lprintf(cfg, 1, 0, "Cannot run truncate and async\n");
 			goto err;
 		}
+		if (cfg->open_loop) {
+			lprintf(cfg, 1, 0, "Cannot run open_loop and async\n");
+			goto err;
+		}
 		cfg->use_asyncops = 1;
 	}
 	if (cfg->compact && cfg->async_threads == 0)
@@ -2191,6 +2332,8 @@ main(int argc, char *argv[])
 	}
 	if ((ret = config_compress(cfg)) != 0)
 		goto err;
+	if ((ret = config_distribution(cfg)) != 0)
+		goto err;
 
 	/* You can't have truncate on a random collection. */
 	if (cfg->has_truncate && cfg->random_range) {
@@ -2358,9 +2501,11 @@ start_threads(CONFIG *cfg,
 		 */
 		thread->ckpt.min_latency =
 		thread->insert.min_latency = thread->read.min_latency =
-		thread->update.min_latency = UINT32_MAX;
+		thread->scan.min_latency = thread->update.min_latency =
+		    UINT32_MAX;
 		thread->ckpt.max_latency = thread->insert.max_latency =
-		thread->read.max_latency = thread->update.max_latency = 0;
+		thread->read.max_latency = thread->scan.max_latency =
+		thread->update.max_latency = 0;
 	}
 
 	/* Start the threads. */
@@ -2438,6 +2583,43 @@ worker_throttle(int64_t throttle, int64_t *ops, struct timespec *interval)
 	*interval = now;
 }
 
+/*
+ * worker_open_loop --
+ *	Wait for an open-loop operation's scheduled start time and return the
+ * time the operation's latency is measured from.  Operations are scheduled at
+ * fixed intervals regardless of how long earlier operations took: if the
+ * thread is running behind, the operation starts immediately and the delay is
+ * included in its latency.
+ */
+static int
+worker_open_loop(
+    uint64_t *next_startp, uint64_t interval, struct timespec *start)
+{
+	struct timespec now;
+	uint64_t now_ns;
+	int ret;
+
+	if ((ret = __wt_epoch(NULL, &now)) != 0)
+		return (ret);
+	now_ns = sec_to_ns((uint64_t)now.tv_sec) + (uint64_t)now.tv_nsec;
+	if (*next_startp == 0)
+		*next_startp = now_ns;
+	if (*next_startp > now_ns) {
+		/*
+		 * We're ahead of schedule: sleep, and measure from when we
+		 * wake up, oversleeping isn't a delay caused by the system.
+		 */
+		(void)usleep((useconds_t)ns_to_us(*next_startp - now_ns));
+		if ((ret = __wt_epoch(NULL, start)) != 0)
+			return (ret);
+	} else {
+		start->tv_sec = (time_t)ns_to_sec(*next_startp);
+		start->tv_nsec = (long)(*next_startp % NSEC_PER_SEC);
+	}
+	*next_startp += interval;
+	return (0);
+}
+
 static int
 drop_all_tables(CONFIG *cfg)
 {
@@ -2488,15 +2670,118 @@ wtperf_value_range(CONFIG *cfg)
 	return (cfg->icount + cfg->insert_key - (u_int)(cfg->workers_cnt + 1));
 }
 
+/*
+ * zipfian_zeta --
+ *	Return the zeta constant for n items: the sum of 1 / i^theta for i from
+ * 1 to n.  Key spaces are too large to sum at every insert, so only the first
+ * ZIPFIAN_EXACT terms are summed and the rest approximated by their integral,
+ * which is accurate once the terms are this small.
+ */
+#define	ZIPFIAN_EXACT	1000
+static double
+zipfian_zeta(ZIPFIAN *zipf, uint64_t n)
+{
+	double sum;
+	uint64_t i;
+
+	if (n > ZIPFIAN_EXACT && zipf->zetam != 0)
+		return (zipf->zetam + (pow(n + 0.5, 1 - zipf->theta) -
+		    pow(ZIPFIAN_EXACT + 0.5, 1 - zipf->theta)) /
+		    (1 - zipf->theta));
+
+	for (sum = 0, i = 1; i <= n; ++i)
+		sum += 1 / pow((double)i, zipf->theta);
+	return (sum);
+}
+
+/*
+ * zipfian_rand --
+ *	Return a zipfian distributed value between 0 and n - 1, where 0 is the
+ * most popular value.
+ */
+static uint64_t
+zipfian_rand(CONFIG_THREAD *thread, ZIPFIAN *zipf, uint64_t n)
+{
+	double u, uz;
+	uint64_t rval;
+
+	if (zipf->zetam == 0) {
+		zipf->theta = thread->cfg->zipfian_skew / 100.0;
+		zipf->alpha = 1 / (1 - zipf->theta);
+		zipf->zeta2 = zipfian_zeta(zipf, 2);
+		zipf->zetam = zipfian_zeta(zipf, ZIPFIAN_EXACT);
+	}
+	if (zipf->n != n) {
+		zipf->n = n;
+		zipf->zetan = zipfian_zeta(zipf, n);
+		zipf->eta = n <= 2 ? 0 :
+		    (1 - pow(2.0 / n, 1 - zipf->theta)) /
+		    (1 - zipf->zeta2 / zipf->zetan);
+	}
+
+	u = (double)__wt_random(&thread->rnd) / UINT32_MAX;
+	uz = u * zipf->zetan;
+	if (uz < 1)
+		rval = 0;
+	else if (uz < 1 + pow(0.5, zipf->theta))
+		rval = 1;
+	else
+		rval = (uint64_t)
+		    (n * pow(zipf->eta * u - zipf->eta + 1, zipf->alpha));
+	return (rval < n ? rval : n - 1);
+}
+
+/*
+ * zipfian_scramble --
+ *	Scatter zipfian values across the key space, otherwise the popular keys
+ * are all at the start of the table.  This is the 64-bit FNV-1a hash, as used
+ * by YCSB.
+ */
+static inline uint64_t
+zipfian_scramble(uint64_t v)
+{
+	uint64_t h;
+	int i;
+
+	for (h = 0xcbf29ce484222325ULL, i = 0; i < 8; ++i, v >>= 8) {
+		h ^= v & 0xff;
+		h *= 0x100000001b3ULL;
+	}
+	return (h);
+}
+
 static uint64_t
 wtperf_rand(CONFIG_THREAD *thread)
 {
 	CONFIG *cfg;
 	double S1, S2, U;
-	uint64_t rval;
+	uint64_t hot, range, rval;
 
 	cfg = thread->cfg;
 
+	switch (cfg->key_dist) {
+	case DIST_HOTSPOT:
+		/*
+		 * The hot set is the start of the key space, choose which set
+		 * then a key from within it.
+		 */
+		range = wtperf_value_range(cfg);
+		if ((hot = (range * cfg->hotspot_keys) / 100) == 0)
+			hot = 1;
+		if (hot == range ||
+		    __wt_random(&thread->rnd) % 100 < cfg->hotspot_ops)
+			return (__wt_random(&thread->rnd) % hot + 1);
+		return (hot + __wt_random(&thread->rnd) % (range - hot) + 1);
+	case DIST_LATEST:
+		/* The most recently inserted keys are the most popular. */
+		range = wtperf_value_range(cfg);
+		return (range - zipfian_rand(thread, &thread->zipf_key, range));
+	case DIST_ZIPFIAN:
+		range = wtperf_value_range(cfg);
+		return (zipfian_scramble(zipfian_rand(
+		    thread, &thread->zipf_key, range)) % range + 1);
+	}
+
 	/*
 	 * Use WiredTiger's random number routine: it's lock-free and fairly
 	 * good.
@@ -2526,3 +2811,21 @@ wtperf_rand(CONFIG_THREAD *thread)
 	rval = (rval % wtperf_value_range(cfg)) + 1;
 	return (rval);
 }
+
+/*
+ * wtperf_scan_length --
+ *	Return the number of records to read in a scan.
+ */
+static uint32_t
+wtperf_scan_length(CONFIG_THREAD *thread)
+{
+	CONFIG *cfg;
+
+	cfg = thread->cfg;
+
+	/* Zipfian scan lengths make short scans the most common. */
+	if (cfg->scan_dist == DIST_ZIPFIAN)
+		return ((uint32_t)zipfian_rand(
+		    thread, &thread->zipf_scan, cfg->scan_length) + 1);
+	return (__wt_random(&thread->rnd) % cfg->scan_length + 1);
+}
@@ -88,7 +88,9 @@ typedef struct __config_thread CONFIG_THREAD;
 typedef struct {
 	int64_t threads;		/* Thread count */
 	int64_t insert;			/* Insert ratio */
+	int64_t overwrite;		/* Overwrite ratio */
 	int64_t read;			/* Read ratio */
+	int64_t scan;			/* Scan ratio */
 	int64_t update;			/* Update ratio */
 	int64_t throttle;		/* Maximum operations/second */
 		/* Number of operations per transaction. Zero for autocommit */
@@ -99,9 +101,11 @@ typedef struct {
 
 #define	WORKER_INSERT		1	/* Insert */
 #define	WORKER_INSERT_RMW	2	/* Insert with read-modify-write */
-#define	WORKER_READ		3	/* Read */
-#define	WORKER_TRUNCATE		4	/* Truncate */
-#define	WORKER_UPDATE		5	/* Update */
+#define	WORKER_OVERWRITE	3	/* Update without a read */
+#define	WORKER_READ		4	/* Read */
+#define	WORKER_SCAN		5	/* Scan */
+#define	WORKER_TRUNCATE		6	/* Truncate */
+#define	WORKER_UPDATE		7	/* Update with read-modify-write */
 	uint8_t ops[100];		/* Operation schedule */
 } WORKLOAD;
 
@@ -149,6 +153,13 @@ struct __config {			/* Configuration structure */
 	const char *compress_ext;	/* Compression extension for conn */
 	const char *compress_table;	/* Compression arg to table create */
 
+#define	DIST_HOTSPOT	1		/* Hot set of keys */
+#define	DIST_LATEST	2		/* Zipfian, recent keys popular */
+#define	DIST_UNIFORM	3		/* Uniform */
+#define	DIST_ZIPFIAN	4		/* Zipfian, scattered popular keys */
+	u_int key_dist;			/* Key distribution */
+	u_int scan_dist;		/* Scan length distribution */
+
 	CONFIG_THREAD *ckptthreads, *popthreads;
 
 #define	WORKLOAD_MAX	50
@@ -164,6 +175,7 @@ struct __config {			/* Configuration structure */
 	uint64_t ckpt_ops;		/* checkpoint operations */
 	uint64_t insert_ops;		/* insert operations */
 	uint64_t read_ops;		/* read operations */
+	uint64_t scan_ops;		/* scan operations */
 	uint64_t truncate_ops;		/* truncate operations */
 	uint64_t update_ops;		/* update operations */
 
@@ -241,8 +253,37 @@ typedef struct {
 	uint32_t us[1000];		/* < 1us ... 1000us */
 	uint32_t ms[1000];		/* < 1ms ... 1000ms */
 	uint32_t sec[100];		/* < 1s 2s ... 100s */
+
+	/*
+	 * HDR-style latency histogram: the first 2 * HDR_SUB buckets are one
+	 * microsecond wide, after that each doubling of the latency is split
+	 * into HDR_SUB buckets, that is, latencies are recorded with better
+	 * than 1% precision, up to 2^HDR_MAX_BITS microseconds.
+	 */
+#define	HDR_SUB_BITS	7
+#define	HDR_SUB		(1 << HDR_SUB_BITS)
+#define	HDR_MAX_BITS	36
+#define	HDR_BUCKETS	((HDR_MAX_BITS - HDR_SUB_BITS + 1) * HDR_SUB)
+#define	HDR_OPS		4		/* Insert, read, scan, update */
+	uint32_t hdr[HDR_BUCKETS];
 } TRACK;
 
+/*
+ * Zipfian random number generation state, using the algorithm from Gray et
+ * al., "Quickly Generating Billion-Record Synthetic Databases", SIGMOD 1994.
+ * The constants depend on the number of items, which grows as a workload
+ * inserts, so they're recalculated when the number of items changes.
+ */
+typedef struct {
+	uint64_t n;			/* Items */
+	double theta;			/* Skew */
+	double alpha;			/* 1 / (1 - theta) */
+	double zeta2;			/* Zeta for 2 items */
+	double zetam;			/* Zeta for the exactly summed items */
+	double zetan;			/* Zeta for n items */
+	double eta;
+} ZIPFIAN;
+
 struct __config_thread {		/* Per-thread structure */
 	CONFIG *cfg;			/* Enclosing configuration */
 
@@ -257,16 +298,21 @@ struct __config_thread {		/* Per-thread structure */
 	TRACK ckpt;			/* Checkpoint operations */
 	TRACK insert;			/* Insert operations */
 	TRACK read;			/* Read operations */
+	TRACK scan;			/* Scan operations */
 	TRACK update;			/* Update operations */
 	TRACK truncate;			/* Truncate operations */
 	TRACK truncate_sleep;		/* Truncate sleep operations */
 	TRUNCATE_CONFIG trunc_cfg;	/* Truncate configuration */
 
+	ZIPFIAN zipf_key;		/* Zipfian key state */
+	ZIPFIAN zipf_scan;		/* Zipfian scan length state */
+
 };
 
 void	 cleanup_truncate_config(CONFIG *);
 int	 config_assign(CONFIG *, const CONFIG *);
 int	 config_compress(CONFIG *);
+int	 config_distribution(CONFIG *);
 void	 config_free(CONFIG *);
 int	 config_opt_file(CONFIG *, const char *);
 int	 config_opt_line(CONFIG *, const char *);
@@ -276,6 +322,7 @@ int	 config_sanity(CONFIG *);
 void	 latency_insert(CONFIG *, uint32_t *, uint32_t *, uint32_t *);
 void	 latency_read(CONFIG *, uint32_t *, uint32_t *, uint32_t *);
 void	 latency_update(CONFIG *, uint32_t *, uint32_t *, uint32_t *);
+void	 latency_hdr_print(CONFIG *, FILE *, const char *, uint64_t *);
 void	 latency_print(CONFIG *);
 int	 enomem(const CONFIG *);
 int	 run_truncate(
@@ -286,6 +333,7 @@ uint64_t sum_ckpt_ops(CONFIG *);
 uint64_t sum_insert_ops(CONFIG *);
 uint64_t sum_pop_ops(CONFIG *);
 uint64_t sum_read_ops(CONFIG *);
+uint64_t sum_scan_ops(CONFIG *);
 uint64_t sum_truncate_ops(CONFIG *);
 uint64_t sum_update_ops(CONFIG *);
 void	 usage(void);
@@ -296,6 +344,24 @@ __attribute__((format (printf, 4, 5)))
 #endif
 ;
 
+/*
+ * hdr_index --
+ *	Return the HDR histogram bucket for a latency.
+ */
+static inline u_int
+hdr_index(uint64_t usecs)
+{
+	u_int k;
+
+	if (usecs < 2 * HDR_SUB)
+		return ((u_int)usecs);
+	for (k = 1; (usecs >> k) >= 2 * HDR_SUB; ++k)
+		;
+	if (k >= HDR_MAX_BITS - HDR_SUB_BITS)
+		return (HDR_BUCKETS - 1);
+	return (k * HDR_SUB + (u_int)(usecs >> k));
+}
+
 static inline void
 generate_key(CONFIG *cfg, char *key_buf, uint64_t keyno)
 {
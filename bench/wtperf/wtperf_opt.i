@@ -107,6 +107,11 @@ DEF_OPT_AS_UINT32(database_count, 1,
 DEF_OPT_AS_UINT32(drop_tables, 0,
     "Whether to drop all tables at the end of the run, and report time taken"
     " to do the drop.")
+DEF_OPT_AS_UINT32(hotspot_keys, 20,
+    "percentage of the keys in the hot set of the 'hotspot' key distribution")
+DEF_OPT_AS_UINT32(hotspot_ops, 80,
+    "percentage of the operations done on the hot set of the 'hotspot' key "
+    "distribution")
 DEF_OPT_AS_UINT32(icount, 5000,
     "number of records to initially populate. If multiple tables are "
     "configured the count is spread evenly across all tables.")
@@ -114,6 +119,13 @@ DEF_OPT_AS_BOOL(index, 0,
     "Whether to create an index on the value field.")
 DEF_OPT_AS_BOOL(insert_rmw, 0,
     "execute a read prior to each insert in workload phase")
+DEF_OPT_AS_STRING(key_distribution, "uniform",
+    "distribution of the keys chosen by read, overwrite, scan and update "
+    "operations.  Allowed configuration values are: 'uniform' (optionally "
+    "skewed by the pareto configuration), 'zipfian' (popular keys are "
+    "scattered across the key space), 'latest' (zipfian, with the most "
+    "recently inserted keys the most popular) and 'hotspot' (see the "
+    "hotspot_keys and hotspot_ops configurations)")
 DEF_OPT_AS_UINT32(key_sz, 20, "key size")
 DEF_OPT_AS_BOOL(log_partial, 0, "perform partial logging on first table only.")
 DEF_OPT_AS_UINT32(min_throughput, 0,
@@ -122,6 +134,13 @@ DEF_OPT_AS_UINT32(min_throughput, 0,
 DEF_OPT_AS_UINT32(max_latency, 0,
     "abort if any latency measured exceeds this number of milliseconds."
     "Requires sample_interval to be configured")
+DEF_OPT_AS_BOOL(open_loop, 0,
+    "start each worker thread's operations at the rate configured by the "
+    "workload's throttle, whether or not earlier operations have "
+    "completed, and measure latency from each operation's scheduled start "
+    "time, which includes any time spent waiting for earlier operations; "
+    "latency is measured for every operation.  Requires a throttle for "
+    "every workload")
 DEF_OPT_AS_UINT32(pareto, 0, "use pareto distribution for random numbers. Zero "
     "to disable, otherwise a percentage indicating how aggressive the "
     "distribution should be.")
@@ -139,7 +158,7 @@ DEF_OPT_AS_BOOL(reopen_connection, 1,
 DEF_OPT_AS_UINT32(report_interval, 2,
     "output throughput information every interval seconds, 0 to disable")
 DEF_OPT_AS_UINT32(run_ops, 0,
-    "total read, insert and update workload operations")
+    "total read, insert, scan and update workload operations")
 DEF_OPT_AS_UINT32(run_time, 0,
     "total workload seconds")
 DEF_OPT_AS_UINT32(sample_interval, 0,
@@ -147,6 +166,12 @@ DEF_OPT_AS_UINT32(sample_interval, 0,
 DEF_OPT_AS_UINT32(sample_rate, 50,
     "how often the latency of operations is measured. One for every operation,"
     "two for every second operation, three for every third operation etc.")
+DEF_OPT_AS_STRING(scan_distribution, "uniform",
+    "distribution of the number of records read by each scan operation, "
+    "between 1 and scan_length.  Allowed configuration values are: "
+    "'uniform' and 'zipfian' (short scans are the most common)")
+DEF_OPT_AS_UINT32(scan_length, 100,
+    "maximum number of records read by each scan operation")
 DEF_OPT_AS_CONFIG_STRING(sess_config, "", "session configuration string")
 DEF_OPT_AS_CONFIG_STRING(table_config,
     "key_format=S,value_format=S,type=lsm,exclusive=true,"
@@ -168,9 +193,12 @@ DEF_OPT_AS_STRING(threads, "", "workload configuration: each 'count' "
     "for example, a more complex threads configuration might be "
     "'threads=((count=2,reads=1)(count=8,reads=1,inserts=2,updates=1))' "
     "which would create 2 threads doing nothing but reads and 8 threads "
-    "each doing 50% inserts and 25% reads and updates.  Allowed configuration "
-    "values are 'count', 'throttle', 'reads', 'inserts', 'updates', 'truncate',"
-    " 'truncate_pct' and 'truncate_count'. There are "
+    "each doing 50% inserts and 25% reads and updates.  Updates read the "
+    "record and write a modified value, 'overwrites' write the record without "
+    "reading it first and 'scans' read a range of records starting at the "
+    "chosen key (see scan_length).  Allowed configuration values are 'count', "
+    "'throttle', 'reads', 'inserts', 'overwrites', 'scans', 'updates', "
+    "'truncate', 'truncate_pct' and 'truncate_count'. There are "
     "also behavior modifiers, supported modifiers are 'ops_per_txn'")
 DEF_OPT_AS_CONFIG_STRING(transaction_config, "",
     "transaction configuration string, relevant when populate_opts_per_txn "
@@ -180,6 +208,9 @@ DEF_OPT_AS_UINT32(value_sz, 100, "value size")
 DEF_OPT_AS_UINT32(verbose, 1, "verbosity")
 DEF_OPT_AS_UINT32(warmup, 0,
     "How long to run the workload phase before starting measurements")
+DEF_OPT_AS_UINT32(zipfian_skew, 99,
+    "skew of the 'zipfian' and 'latest' distributions as a percentage, for "
+    "example, 99 is a zipfian constant of 0.99")
 
 #undef DEF_OPT_AS_BOOL
 #undef DEF_OPT_AS_CONFIG_STRING
@@ -108,6 +108,11 @@ lsm_config = [
             larger than this value.  This overrides the \c memory_page_max
             setting''',
             min='512K', max='500MB'),
+        Config('memtable', 'btree', r'''
+            how the in-memory chunk is written to disk.  A \c btree chunk
+            is reconciled and checkpointed.  A \c skiplist chunk is bulk
+            loaded in key order into a new chunk, which replaces it''',
+            choices=['btree', 'skiplist']),
         Config('merge_max', '15', r'''
             the maximum number of chunks to include in a merge operation''',
             min='2', max='100'),
@@ -211,6 +216,15 @@ file_config = format_meta + [
         constraining the number of keys processed to instantiate a
         random Btree leaf page key''',
         min='0', undoc=True),
+    Config('leaf_delta_max', '0', r'''
+        the maximum number of deltas written for a row-store leaf page
+        before the page is consolidated into a full image.  A delta is a
+        small block holding only the page's changed records and a
+        reference to the page's previous block, reducing the bytes written
+        by update workloads at the cost of additional reads when the page
+        is brought back into memory.  If set to 0, deltas are not
+        written''',
+        min='0', max='16'),
     Config('leaf_key_max', '0', r'''
         the largest key stored in a leaf node, in bytes.  If set, keys
         larger than the specified size are stored as overflow items (which
@@ -340,11 +354,19 @@ connection_runtime_config = [
         Config('ops_max', '1024', r'''
             maximum number of expected simultaneous asynchronous
                 operations''', min='1', max='4096'),
+        Config('ops_per_txn', '1', r'''
+            the maximum number of queued operations on the same object a
+            worker thread executes in a single transaction.  When greater
+            than 1, a transaction's callbacks are called after it commits,
+            and their results are ignored; if any operation in
+            the transaction fails, its operations are retried in separate
+            transactions''',
+                min='1', max='32'), # !!! Must match WT_ASYNC_BATCH_MAX
         Config('threads', '2', r'''
             the number of worker threads to service asynchronous requests.
             Each worker thread uses a session from the configured
             session_max.''',
-                min='1', max='20'), # !!! Must match WT_ASYNC_MAX_WORKERS
+                min='1', max='128'), # !!! Must match WT_ASYNC_MAX_WORKERS
             ]),
     Config('cache_size', '100MB', r'''
         maximum heap memory to allocate for the cache. A database should
@@ -377,6 +399,21 @@ connection_runtime_config = [
             above 0 configures periodic checkpoints''',
             min='0', max='100000'),
         ]),
+    Config('compact', '', r'''
+        compact files in the background, moving blocks from the end of each
+        file into available space earlier in the file and truncating the
+        file, see @ref compact_background.  Enabling the background
+        compaction server uses a session from the configured session_max''',
+        type='category', subconfig=[
+        Config('rate', '0', r'''
+            the megabytes of pages per second the server rewrites; setting
+            this value above 0 configures background compaction''',
+            min='0', max='10000'),
+        Config('wait', '60', r'''
+            seconds to wait between each review of the open files for space
+            to reclaim''',
+            min='1', max='100000'),
+        ]),
     Config('error_prefix', '', r'''
         prefix string for error messages'''),
     Config('eviction_dirty_target', '80', r'''
@@ -467,6 +504,13 @@ connection_runtime_config = [
     Config('eviction', '', r'''
         eviction configuration options.''',
         type='category', subconfig=[
+            Config('policy', 'lru', r'''
+                how pages are chosen for eviction.  With \c lru, pages least
+                recently used are evicted first.  With \c frequency, pages
+                read only once, for example by a scan, are evicted before pages
+                used repeatedly, and pages used more frequently stay in cache
+                longer''',
+                choices=['frequency', 'lru']),
             Config('threads_max', '1', r'''
                 maximum number of threads WiredTiger will start to help evict
                 pages from cache. The number of threads started will vary
@@ -583,6 +627,20 @@ session_config = [
 ]
 
 wiredtiger_open_common = connection_runtime_config + [
+    Config('block_cache', '', r'''
+        keep copies of blocks recently read from and written to data files
+        in a file on fast local storage, for data files on storage with high
+        read latency, see @ref tuning_block_cache''',
+        type='category', subconfig=[
+        Config('path', '"WiredTigerBlockCache"', r'''
+            the path of the block cache file.  If the value is not an
+            absolute path name, the file is created relative to the database
+            home'''),
+        Config('size', '0', r'''
+            maximum size of the block cache file; setting this value above 0
+            configures the block cache''',
+            min='0', max='100TB'),
+        ]),
     Config('buffer_alignment', '-1', r'''
         in-memory alignment (in bytes) for buffers used for I/O.  The
         default value of -1 indicates a platform-specific alignment value
@@ -593,6 +651,30 @@ wiredtiger_open_common = connection_runtime_config + [
         flush files to stable storage when closing or writing
         checkpoints''',
         type='boolean'),
+    Config('cache_warmup', '', r'''
+        record the pages in the cache when the connection is closed, and
+        read them back in the background when it is next opened, see @ref
+        tuning_cache_warmup''',
+        type='category', subconfig=[
+        Config('enabled', 'false', r'''
+            record and restore the cache contents''',
+            type='boolean'),
+        Config('target', '80', r'''
+            stop reading pages back once the cache is this full, as a
+            percentage of the cache size''',
+            min='10', max='100'),
+        ]),
+    Config('compressed_cache', '', r'''
+        keep block images read from data files in a bounded memory region
+        as they appear on disk, usually compressed, so a page evicted from
+        the cache is read back without file I/O, see @ref
+        tuning_compressed_cache''',
+        type='category', subconfig=[
+        Config('size', '0', r'''
+            maximum memory to allocate for the compressed cache; setting
+            this value above 0 configures the compressed cache''',
+            min='0', max='10TB'),
+        ]),
     Config('direct_io', '', r'''
         Use \c O_DIRECT on POSIX systems, and \c FILE_FLAG_NO_BUFFERING on
         Windows to access files.  Options are given as a list, such as
@@ -655,6 +737,18 @@ wiredtiger_open_common = connection_runtime_config + [
         RPC server for primary processes and use RPC for secondary
         processes). <b>Not yet supported in WiredTiger</b>''',
         type='boolean'),
+    Config('open_prefetch', '', r'''
+        configure a pool of threads that, once the connection is open,
+        prefetch the blocks each data file reads when it is first used, so
+        the files' first uses don't wait for those reads one at a time, see
+        @ref tuning_open_prefetch''',
+        type='category', subconfig=[
+        Config('threads', '0', r'''
+            the number of prefetch threads; setting this value above 0
+            configures prefetching.  Each thread uses a session from the
+            configured session_max''',
+            min='0', max='20'),
+        ]),
     Config('session_max', '100', r'''
         maximum expected number of sessions (including server
         threads)''',
@@ -662,6 +756,25 @@ wiredtiger_open_common = connection_runtime_config + [
     Config('session_scratch_max', '2MB', r'''
         maximum memory to cache in each session''',
         type='int', undoc=True),
+    Config('trace', '', r'''
+        configure the per-session ring buffers of timestamped engine events
+        (eviction, reconciliation, splits, log slots, page reads and
+        checkpoint phases), see WT_CONNECTION::trace_dump''',
+        type='category', subconfig=[
+        Config('entries', '1024', r'''
+            the number of events kept in each session's ring buffer,
+            rounded up to a power of two; 0 disables tracing''',
+            min='0', max='1M'),
+        Config('path', '"WiredTigerTrace"', r'''
+            the name of the trace dump files; each dump is written to a new
+            file named by appending a sequence number to this path.  The path
+            is relative to the database home unless it is absolute'''),
+        Config('slow_threshold', '0', r'''
+            dump the ring buffers when an operation timed for the latency
+            statistics takes at least this many milliseconds, at most once
+            per second; 0 disables slow-operation dumps''',
+            min='0', max='100000'),
+        ]),
     Config('transaction_sync', '', r'''
         how to sync log records when the transaction commits''',
         type='category', subconfig=[
@@ -675,6 +788,17 @@ wiredtiger_open_common = connection_runtime_config + [
             @ref tune_durability for more information''',
             choices=['dsync', 'fsync', 'none']),
         ]),
+    Config('write_pool', '', r'''
+        configure a pool of threads to compress, encrypt, checksum and write
+        page images, so reconciliation of a page written as multiple blocks
+        can build the next block while earlier blocks are written''',
+        type='category', subconfig=[
+        Config('threads', '0', r'''
+            the number of write pool threads; setting this value above 0
+            configures the write pool.  Each thread uses a session from the
+            configured session_max''',
+            min='0', max='20'),
+        ]),
     Config('write_through', '', r'''
         Use \c FILE_FLAG_WRITE_THROUGH on Windows to write to files.  Ignored
         on non-Windows systems.  Options are given as a list, such as
@@ -842,6 +966,34 @@ methods = {
         characters are hexadecimal encoded.  These formats are compatible
         with the @ref util_dump and @ref util_load commands''',
         choices=['hex', 'json', 'print']),
+    Config('filter', '', r'''
+        return only records matching all of a list of column comparisons
+        when a table cursor is moved with WT_CURSOR::next or WT_CURSOR::prev.
+        Each entry names a column and either a value the column must equal,
+        or a parenthesized list of comparisons: \c eq, \c ne, \c lt, \c le,
+        \c gt, \c ge and, for string and raw columns, \c prefix.  For
+        example, \c "filter=(price=(ge=10,lt=20),name=(prefix=ab))".
+        Records are compared in their packed form, and column groups not
+        referenced by the filter or the cursor's projection are only read
+        for matching records.  Valid only for tables with named columns.
+        See @ref cursor_filters for details''',
+        type='list'),
+    Config('incremental', '', r'''
+        configure a backup cursor to return the block ranges of each file
+        that changed since a previous backup.  Only valid for a backup data
+        source.  See @ref backup_block for details''',
+        type='category', subconfig=[
+        Config('src_id', '', r'''
+            the identifier of a previous backup: each file's value is the list
+            of block ranges written since that backup.  Files created after
+            that backup, or not part of it, are returned whole'''),
+        Config('this_id', '', r'''
+            an identifier for this backup, which later backups can use as
+            their \c src_id.  A checkpoint named \c WiredTigerBackup.<id> is
+            taken when the cursor is opened, replacing any earlier checkpoint
+            of that name; the checkpoint should be dropped when no later
+            backup will need it'''),
+        ]),
     Config('next_random', 'false', r'''
         configure the cursor to return a pseudo-random record from
         the object; valid only for row-store cursors.  Cursors
@@ -893,6 +1045,12 @@ methods = {
         force salvage even of files that do not appear to be WiredTiger
         files''',
         type='boolean'),
+    Config('threads', '1', r'''
+        the number of threads reading the file; if greater than 1, the
+        file is split into regions read in parallel, and the pages found
+        are merged before the key ranges are resolved and the tree is
+        rebuilt''',
+        min='1', max='64'),
 ]),
 'WT_SESSION.strerror' : Method([]),
 'WT_SESSION.transaction_sync' : Method([
@@ -930,7 +1088,13 @@ methods = {
         Treat any verification problem as an error; by default, verify will
         warn, but not fail, in the case of errors that won't affect future
         behavior (for example, a leaked block)''',
-        type='boolean')
+        type='boolean'),
+    Config('threads', '1', r'''
+        the number of threads verifying each checkpoint; if greater than
+        1, the subtrees referenced by the root page are verified in
+        parallel.  Ignored when dumping addresses, blocks, pages or the
+        tree shape''',
+        min='1', max='64'),
 ]),
 
 'WT_SESSION.begin_transaction' : Method([
@@ -1011,11 +1175,24 @@ methods = {
 'WT_CONNECTION.add_data_source' : Method([]),
 'WT_CONNECTION.add_encryptor' : Method([]),
 'WT_CONNECTION.add_extractor' : Method([]),
+'WT_CONNECTION.async_drain' : Method([
+    Config('max', '0', r'''
+        the maximum number of completed operations to drain, or 0 to
+        drain all of the operations waiting when the call is made''',
+        min='0', type='int'),
+]),
 'WT_CONNECTION.async_new_op' : Method([
     Config('append', 'false', r'''
         append the value as a new record, creating a new record
         number key; valid only for operations with record number keys''',
         type='boolean'),
+    Config('completion_queue', 'false', r'''
+        when the operation completes, post it to the connection's
+        completion queue instead of invoking the callback from a worker
+        thread.  The callback is invoked when the application calls
+        WT_CONNECTION::async_drain, after the operation's transaction
+        has been resolved; see @ref async_completion_queue for details''',
+        type='boolean'),
     Config('overwrite', 'true', r'''
         configures whether the cursor's insert, update and remove
         methods check the existing state of the record.  If \c overwrite
@@ -38,6 +38,7 @@ flags = {
         'READ_PREV',
         'READ_SKIP_INTL',
         'READ_TRUNCATE',
+        'READ_WARMUP',
         'READ_WONT_NEED',
     ],
     'rec_write' : [
@@ -97,10 +98,15 @@ flags = {
         'CONN_PANIC',
         'CONN_SERVER_ASYNC',
         'CONN_SERVER_CHECKPOINT',
+        'CONN_SERVER_COMPACT',
         'CONN_SERVER_LSM',
+        'CONN_SERVER_PREFETCH',
         'CONN_SERVER_RUN',
         'CONN_SERVER_STATISTICS',
         'CONN_SERVER_SWEEP',
+        'CONN_SERVER_TRACE',
+        'CONN_SERVER_WARMUP',
+        'CONN_SERVER_WRITE',
         'CONN_WAS_BACKUP',
     ],
     'session' : [
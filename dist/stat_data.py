@@ -71,6 +71,10 @@ class JoinStat(Stat):
     prefix = ''  # prefix is inserted dynamically
     def __init__(self, name, desc, flags=''):
         Stat.__init__(self, name, JoinStat.prefix, desc, flags)
+class LatencyStat(Stat):
+    prefix = 'latency'
+    def __init__(self, name, desc, flags=''):
+        Stat.__init__(self, name, LatencyStat.prefix, desc, flags)
 class LogStat(Stat):
     prefix = 'log'
     def __init__(self, name, desc, flags=''):
@@ -96,6 +100,20 @@ class YieldStat(Stat):
     def __init__(self, name, desc, flags=''):
         Stat.__init__(self, name, YieldStat.prefix, desc, flags)
 
+##########################################
+# Latency histograms: a statistic per log-scaled latency range, the bucket
+# number is appended to the statistic name.  The ranges must match the
+# WT_STAT_LATENCY_INCR macro in src/include/stat.h.
+##########################################
+latency_buckets = [
+    'under 10us', '10-49us', '50-99us', '100-499us', '500-999us',
+    '1-4ms', '5-9ms', '10-49ms', '50-99ms', '100ms and over']
+
+def latency_histogram(name, desc):
+    return [LatencyStat(name + '_' + str(i),
+        desc + ' histogram (bucket ' + str(i) + ') - ' + b)
+        for i, b in enumerate(latency_buckets)]
+
 ##########################################
 # Groupings of useful statistics:
 # A pre-defined dictionary containing the group name as the key and the
@@ -104,6 +122,7 @@ class YieldStat(Stat):
 groups = {}
 groups['cursor'] = [CursorStat.prefix, SessionStat.prefix]
 groups['evict'] = [CacheStat.prefix, ConnStat.prefix, BlockStat.prefix]
+groups['latency'] = [LatencyStat.prefix]
 groups['lsm'] = [LSMStat.prefix, TxnStat.prefix]
 groups['memory'] = [CacheStat.prefix, ConnStat.prefix, RecStat.prefix]
 groups['system'] = [ConnStat.prefix, DhandleStat.prefix, SessionStat.prefix]
@@ -131,9 +150,16 @@ connection_stats = [
     AsyncStat('async_alloc_race', 'number of allocation state races'),
     AsyncStat('async_alloc_view',
         'number of operation slots viewed for allocation'),
+    AsyncStat('async_complete',
+        'number of operations posted to the completion queue'),
     AsyncStat('async_cur_queue', 'current work queue length'),
+    AsyncStat('async_drain', 'number of completion queue drain calls'),
     AsyncStat('async_flush', 'number of flush calls'),
     AsyncStat('async_full', 'number of times operation allocation failed'),
+    AsyncStat('async_group_ops',
+        'operations executed in transactions with other operations'),
+    AsyncStat('async_group_retry',
+        'grouped operations retried in separate transactions'),
     AsyncStat('async_max_queue',
         'maximum work queue length', 'no_clear,no_scale'),
     AsyncStat('async_nowork', 'number of times worker found no work'),
@@ -143,13 +169,28 @@ connection_stats = [
     AsyncStat('async_op_remove', 'total remove calls'),
     AsyncStat('async_op_search', 'total search calls'),
     AsyncStat('async_op_update', 'total update calls'),
+    AsyncStat('async_worker_batch', 'number of batches of work dequeued'),
+    AsyncStat('async_worker_wait', 'number of times worker waited for work'),
 
     ##########################################
     # Block manager statistics
     ##########################################
     BlockStat('block_byte_map_read', 'mapped bytes read'),
+    BlockStat('block_cache_bypass',
+        'block cache checkpoint writes not cached'),
+    BlockStat('block_cache_error',
+        'block cache read and write errors ignored'),
+    BlockStat('block_cache_hit', 'block cache blocks found'),
+    BlockStat('block_cache_insert', 'block cache blocks inserted'),
+    BlockStat('block_cache_invalid',
+        'block cache blocks overwritten or failing checksum'),
+    BlockStat('block_cache_miss', 'block cache blocks not found'),
     BlockStat('block_byte_read', 'bytes read'),
     BlockStat('block_byte_write', 'bytes written'),
+    BlockStat('block_compact_server_files',
+        'files compacted by the background compaction server'),
+    BlockStat('block_compact_server_rewrite',
+        'bytes of pages rewritten by the background compaction server'),
     BlockStat('block_map_read', 'mapped blocks read'),
     BlockStat('block_preload', 'blocks pre-loaded'),
     BlockStat('block_read', 'blocks read'),
@@ -175,6 +216,12 @@ connection_stats = [
         'no_clear,no_scale'),
     CacheStat('cache_bytes_read', 'bytes read into cache'),
     CacheStat('cache_bytes_write', 'bytes written from cache'),
+    CacheStat('cache_compressed_bytes',
+        'compressed cache bytes held', 'no_clear,no_scale'),
+    CacheStat('cache_compressed_evict', 'compressed cache blocks discarded'),
+    CacheStat('cache_compressed_hit', 'compressed cache blocks found'),
+    CacheStat('cache_compressed_insert', 'compressed cache blocks inserted'),
+    CacheStat('cache_compressed_miss', 'compressed cache blocks not found'),
     CacheStat('cache_eviction_app', 'pages evicted by application threads'),
     CacheStat('cache_eviction_checkpoint', 'checkpoint blocked page eviction'),
     CacheStat('cache_eviction_clean', 'unmodified pages evicted'),
@@ -219,9 +266,22 @@ connection_stats = [
         'tracked dirty pages in the cache', 'no_clear,no_scale'),
     CacheStat('cache_pages_inuse',
         'pages currently held in the cache', 'no_clear,no_scale'),
+    CacheStat('cache_pool_chunk1',
+        'shared cache estimated hits from 1 more chunk'),
+    CacheStat('cache_pool_chunk2',
+        'shared cache estimated hits from 2 more chunks'),
+    CacheStat('cache_pool_chunk4',
+        'shared cache estimated hits from 4 more chunks'),
+    CacheStat('cache_pool_chunk8',
+        'shared cache estimated hits from 8 more chunks'),
     CacheStat('cache_read', 'pages read into cache'),
+    CacheStat('cache_read_delta',
+        'pages read into cache from a chain of deltas'),
     CacheStat('cache_read_lookaside',
         'pages read into cache requiring lookaside entries'),
+    CacheStat('cache_warmup_read', 'pages read into cache by warm-up'),
+    CacheStat('cache_warmup_recorded',
+        'pages recorded for warm-up at close'),
     CacheStat('cache_write', 'pages written from cache'),
     CacheStat('cache_write_lookaside',
         'page written requiring lookaside records'),
@@ -233,6 +293,8 @@ connection_stats = [
     ##########################################
     DhandleStat('dh_conn_handle_count',
         'connection data handles currently active', 'no_clear,no_scale'),
+    DhandleStat('dh_open_prefetch',
+        'connection data files prefetched at open'),
     DhandleStat('dh_sweep_close', 'connection sweep dhandles closed'),
     DhandleStat('dh_sweep_remove',
         'connection sweep dhandles removed from hash list'),
@@ -286,7 +348,11 @@ connection_stats = [
     RecStat('rec_pages', 'page reconciliation calls'),
     RecStat('rec_page_delete', 'pages deleted'),
     RecStat('rec_page_delete_fast', 'fast-path pages deleted'),
+    RecStat('rec_page_delta', 'leaf pages written as deltas'),
     RecStat('rec_pages_eviction', 'page reconciliation calls for eviction'),
+    RecStat('rec_write_pool', 'page images written by the write pool'),
+    RecStat('rec_write_pool_inline',
+        'write pool page images written by the reconciling thread'),
     RecStat('rec_split_stashed_bytes',
         'split bytes currently awaiting free', 'no_clear,no_scale'),
     RecStat('rec_split_stashed_objects',
@@ -338,6 +404,8 @@ connection_stats = [
     LSMStat('lsm_work_queue_max', 'tree queue hit maximum'),
     LSMStat('lsm_work_queue_switch',
         'switch work units currently queued', 'no_clear,no_scale'),
+    LSMStat('lsm_work_queue_wait',
+        'tree maintenance operations time queued (usecs)'),
     LSMStat('lsm_work_units_created', 'tree maintenance operations scheduled'),
     LSMStat('lsm_work_units_discarded',
         'tree maintenance operations discarded'),
@@ -354,8 +422,11 @@ connection_stats = [
     # Total cursor operations
     ##########################################
     CursorStat('cursor_create', 'cursor create calls'),
+    CursorStat('cursor_filter_skip',
+        'table cursor records skipped by filters'),
     CursorStat('cursor_insert', 'cursor insert calls'),
     CursorStat('cursor_next', 'cursor next calls'),
+    CursorStat('cursor_next_batch', 'cursor next_batch calls'),
     CursorStat('cursor_prev', 'cursor prev calls'),
     CursorStat('cursor_remove', 'cursor remove calls'),
     CursorStat('cursor_reset', 'cursor reset calls'),
@@ -375,6 +446,20 @@ connection_stats = [
     YieldStat('page_sleep', 'page acquire time sleeping (usecs)'),
 ]
 
+##########################################
+# Latency histograms
+##########################################
+connection_stats += \
+    latency_histogram('latency_cursor_insert', 'cursor insert') + \
+    latency_histogram('latency_cursor_remove', 'cursor remove') + \
+    latency_histogram('latency_cursor_search', 'cursor search') + \
+    latency_histogram('latency_cursor_update', 'cursor update') + \
+    latency_histogram('latency_evict_stall', 'application eviction stall') + \
+    latency_histogram('latency_log_sync', 'log sync') + \
+    latency_histogram('latency_page_read', 'page read') + \
+    latency_histogram('latency_page_wait', 'page acquire wait') + \
+    latency_histogram('latency_txn_commit', 'transaction commit')
+
 connection_stats = sorted(connection_stats, key=attrgetter('name'))
 
 ##########################################
@@ -397,6 +482,7 @@ dsrc_stats = [
     CursorStat('cursor_insert_bytes',
         'cursor-insert key and value bytes inserted'),
     CursorStat('cursor_next', 'next calls'),
+    CursorStat('cursor_next_batch', 'next_batch calls'),
     CursorStat('cursor_prev', 'prev calls'),
     CursorStat('cursor_remove', 'remove calls'),
     CursorStat('cursor_remove_bytes', 'cursor-remove key bytes removed'),
@@ -460,6 +546,9 @@ dsrc_stats = [
         'queries that could have benefited ' +
         'from a Bloom filter that did not exist'),
     LSMStat('lsm_merge_throttle', 'sleep for LSM merge throttle'),
+    LSMStat('lsm_work_queue_wait',
+        'tree maintenance operations time queued (usecs)'),
+    LSMStat('lsm_work_units_done', 'tree maintenance operations executed'),
 
     ##########################################
     # Block manager statistics
@@ -500,6 +589,8 @@ dsrc_stats = [
     CacheStat('cache_overflow_value',
         'overflow values cached in memory', 'no_scale'),
     CacheStat('cache_read', 'pages read into cache'),
+    CacheStat('cache_read_delta',
+        'pages read into cache from a chain of deltas'),
     CacheStat('cache_read_lookaside',
         'pages read into cache requiring lookaside entries'),
     CacheStat('cache_read_overflow', 'overflow pages read into cache'),
@@ -536,6 +627,7 @@ dsrc_stats = [
     RecStat('rec_overflow_value', 'overflow values written'),
     RecStat('rec_page_delete', 'pages deleted'),
     RecStat('rec_page_delete_fast', 'fast-path pages deleted'),
+    RecStat('rec_page_delta', 'leaf pages written as deltas'),
     RecStat('rec_page_match', 'page checksum matches'),
     RecStat('rec_pages', 'page reconciliation calls'),
     RecStat('rec_pages_eviction', 'page reconciliation calls for eviction'),
@@ -550,6 +642,17 @@ dsrc_stats = [
     TxnStat('txn_update_conflict', 'update conflicts'),
 ]
 
+##########################################
+# Latency histograms
+##########################################
+dsrc_stats += \
+    latency_histogram('latency_cursor_insert', 'cursor insert') + \
+    latency_histogram('latency_cursor_remove', 'cursor remove') + \
+    latency_histogram('latency_cursor_search', 'cursor search') + \
+    latency_histogram('latency_cursor_update', 'cursor update') + \
+    latency_histogram('latency_page_read', 'page read') + \
+    latency_histogram('latency_page_wait', 'page acquire wait')
+
 dsrc_stats = sorted(dsrc_stats, key=attrgetter('name'))
 
 ##########################################
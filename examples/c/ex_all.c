@@ -218,6 +218,28 @@ cursor_ops(WT_SESSION *session)
 	ret = cursor->prev(cursor);
 	/*! [Return the previous record] */
 
+	{
+	/*! [Return a batch of records] */
+	WT_ITEM buf, keys[100], values[100];
+	uint32_t count, i;
+	char mem[64 * 1024];
+
+	memset(&buf, 0, sizeof(buf));
+	buf.mem = mem;
+	buf.memsize = sizeof(mem);
+	for (;;) {
+		count = 100;
+		if ((ret = cursor->next_batch(
+		    cursor, &buf, keys, values, &count)) != 0)
+			break;
+		for (i = 0; i < count; ++i)
+			printf("%.*s: %.*s\n",
+			    (int)keys[i].size, (const char *)keys[i].data,
+			    (int)values[i].size, (const char *)values[i].data);
+	}
+	/*! [Return a batch of records] */
+	}
+
 	/*! [Reset the cursor] */
 	ret = cursor->reset(cursor);
 	/*! [Reset the cursor] */
@@ -921,6 +943,10 @@ connection_ops(WT_CONNECTION *conn)
 	}
 	/*! [Check if the database is newly created] */
 
+	/*! [Dump the event trace] */
+	ret = conn->trace_dump(conn);
+	/*! [Dump the event trace] */
+
 	/*! [Validate a configuration string] */
 	/*
 	 * Validate a configuration string for a WiredTiger function or method.
@@ -1044,6 +1070,46 @@ backup(WT_SESSION *session)
 	ret = session->checkpoint(session, "drop=(from=June01),name=June01");
 	/*! [backup of a checkpoint]*/
 
+	{
+	/*! [incremental block backup]*/
+	uint64_t offset, size;
+	uint32_t type;
+
+	/*
+	 * Copy the blocks changed since the backup named "June01" over the
+	 * copy made by that backup, naming this backup "June02".
+	 */
+	ret = session->open_cursor(session, "backup:", NULL,
+	    "incremental=(src_id=June01,this_id=June02)", &cursor);
+	while (
+	    (ret = cursor->next(cursor)) == 0 &&
+	    (ret = cursor->get_key(cursor, &filename)) == 0 &&
+	    (ret = cursor->get_value(cursor, &offset, &size, &type)) == 0) {
+		if (type == WT_BACKUP_FILE)
+			(void)snprintf(buf, sizeof(buf),
+			    "cp /path/database/%s /path/database.backup/%s",
+			    filename, filename);
+		else if (size == 0)		/* The file hasn't changed. */
+			continue;
+		else				/* Blocks are 512B multiples. */
+			(void)snprintf(buf, sizeof(buf),
+			    "dd if=/path/database/%s "
+			    "of=/path/database.backup/%s bs=512 "
+			    "skip=%" PRIu64 " seek=%" PRIu64
+			    " count=%" PRIu64 " conv=notrunc",
+			    filename, filename,
+			    offset / 512, offset / 512, size / 512);
+		ret = system(buf);
+	}
+	if (ret == WT_NOTFOUND)
+		ret = 0;
+	ret = cursor->close(cursor);
+
+	/* The previous backup's checkpoint is no longer needed. */
+	ret = session->checkpoint(session, "drop=(WiredTigerBackup.June01)");
+	/*! [incremental block backup]*/
+	}
+
 	return (ret);
 }
 
@@ -1151,6 +1217,55 @@ main(void)
 	if (ret == 0)
 		(void)conn->close(conn, NULL);
 
+	/*! [Eviction policy configuration] */
+	/* Keep frequently used pages in cache when scanning */
+	ret = wiredtiger_open(home, NULL,
+	    "create,eviction=(policy=frequency)", &conn);
+	/*! [Eviction policy configuration] */
+	if (ret == 0)
+		(void)conn->close(conn, NULL);
+
+	/*! [Compressed cache configuration] */
+	/* Keep up to 1GB of compressed blocks in memory */
+	ret = wiredtiger_open(home, NULL,
+	    "create,cache_size=500M,compressed_cache=(size=1GB)", &conn);
+	/*! [Compressed cache configuration] */
+	if (ret == 0)
+		(void)conn->close(conn, NULL);
+
+	/*! [Block cache configuration] */
+	/* Keep up to 100GB of blocks in a file on a local SSD */
+	ret = wiredtiger_open(home, NULL,
+	    "create,block_cache=(path=/ssd/WiredTigerBlockCache,size=100GB)",
+	    &conn);
+	/*! [Block cache configuration] */
+	if (ret == 0)
+		(void)conn->close(conn, NULL);
+
+	/*! [Cache warm-up configuration] */
+	/* Restore the cache contents, filling up to half the cache */
+	ret = wiredtiger_open(home, NULL,
+	    "create,cache_warmup=(enabled=true,target=50)", &conn);
+	/*! [Cache warm-up configuration] */
+	if (ret == 0)
+		(void)conn->close(conn, NULL);
+
+	/*! [open_prefetch configuration] */
+	/* Prefetch the blocks read when files are opened, using 4 threads */
+	ret = wiredtiger_open(home, NULL,
+	    "create,open_prefetch=(threads=4)", &conn);
+	/*! [open_prefetch configuration] */
+	if (ret == 0)
+		(void)conn->close(conn, NULL);
+
+	/*! [Configure background compaction] */
+	/* Rewrite up to 10MB of pages per second, review files every minute */
+	ret = wiredtiger_open(home, NULL,
+	    "create,compact=(rate=10,wait=60)", &conn);
+	/*! [Configure background compaction] */
+	if (ret == 0)
+		(void)conn->close(conn, NULL);
+
 	/*! [Statistics configuration] */
 	ret = wiredtiger_open(home, NULL, "create,statistics=(all)", &conn);
 	/*! [Statistics configuration] */
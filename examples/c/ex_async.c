@@ -119,7 +119,7 @@ main(void)
 	WT_ASYNC_OP *op;
 	WT_CONNECTION *conn;
 	WT_SESSION *session;
-	int i, ret;
+	int fd, i, ret;
 	char k[MAX_KEYS][16], v[MAX_KEYS][16];
 
 	/*! [async example connection] */
@@ -212,6 +212,39 @@ main(void)
 		/*! [async search] */
 	}
 
+	/*! [async completion queue descriptor] */
+	/*
+	 * Get the descriptor that is readable while completed operations are
+	 * waiting, to add it to the set of descriptors the application polls.
+	 */
+	ret = conn->async_completion_fd(conn, &fd);
+	/*! [async completion queue descriptor] */
+
+	/* Search for the keys again, using the completion queue. */
+	for (i = 0; i < MAX_KEYS; i++) {
+		while ((ret = conn->async_new_op(conn, "table:async",
+		    "completion_queue=true", &ex_asynckeys.iface, &op)) != 0) {
+			/*
+			 * If we used up all the handles, drain the completion
+			 * queue to release them.
+			 */
+			if (ret == EBUSY)
+				ret = conn->async_drain(conn, NULL);
+			else
+				return (ret);
+		}
+		op->set_key(op, k[i]);
+		ret = op->search(op);
+	}
+
+	/* Wait for the searches, a real application would poll instead. */
+	ret = conn->async_flush(conn);
+
+	/*! [async completion queue drain] */
+	/* Invoke the callbacks of up to 100 completed operations. */
+	ret = conn->async_drain(conn, "max=100");
+	/*! [async completion queue drain] */
+
 	/*
 	 * Connection close automatically does an async_flush so it will wait
 	 * for all queued search operations to complete.
@@ -278,6 +278,20 @@ main(void)
 	/*! [Return a subset of values from the table using raw mode] */
 	ret = cursor->close(cursor);
 
+	/*! [Return the records matching a filter] */
+	/*
+	 * Use a filter to return just the records for years after 1950, with
+	 * a projection of the country and year columns.
+	 */
+	ret = session->open_cursor(session, "table:poptable(country,year)",
+	    NULL, "filter=(year=(gt=1950))", &cursor);
+	while ((ret = cursor->next(cursor)) == 0) {
+		ret = cursor->get_value(cursor, &country, &year);
+		printf("country %s, year %u\n", country, year);
+	}
+	/*! [Return the records matching a filter] */
+	ret = cursor->close(cursor);
+
 	/*! [Return the table's record number key using an index] */
 	/*
 	 * Use a projection to return just the table's record number key
@@ -8,6 +8,7 @@ COPYDOC(__wt_cursor, WT_CURSOR, compare)
 COPYDOC(__wt_cursor, WT_CURSOR, equals)
 COPYDOC(__wt_cursor, WT_CURSOR, next)
 COPYDOC(__wt_cursor, WT_CURSOR, prev)
+COPYDOC(__wt_cursor, WT_CURSOR, next_batch)
 COPYDOC(__wt_cursor, WT_CURSOR, reset)
 COPYDOC(__wt_cursor, WT_CURSOR, search)
 COPYDOC(__wt_cursor, WT_CURSOR, search_near)
@@ -51,10 +52,13 @@ COPYDOC(__wt_session, WT_SESSION, transaction_pinned_range)
 COPYDOC(__wt_session, WT_SESSION, transaction_sync)
 COPYDOC(__wt_connection, WT_CONNECTION, async_flush)
 COPYDOC(__wt_connection, WT_CONNECTION, async_new_op)
+COPYDOC(__wt_connection, WT_CONNECTION, async_drain)
+COPYDOC(__wt_connection, WT_CONNECTION, async_completion_fd)
 COPYDOC(__wt_connection, WT_CONNECTION, close)
 COPYDOC(__wt_connection, WT_CONNECTION, reconfigure)
 COPYDOC(__wt_connection, WT_CONNECTION, configure_method)
 COPYDOC(__wt_connection, WT_CONNECTION, is_new)
+COPYDOC(__wt_connection, WT_CONNECTION, trace_dump)
 COPYDOC(__wt_connection, WT_CONNECTION, open_session)
 COPYDOC(__wt_connection, WT_CONNECTION, load_extension)
 COPYDOC(__wt_connection, WT_CONNECTION, add_data_source)
@@ -303,6 +303,7 @@ WT_CLASS(struct __wt_async_op, WT_ASYNC_OP, op)
 %ignore __wt_cursor::search;
 %ignore __wt_cursor::search_near;
 %ignore __wt_cursor::update;
+%ignore __wt_cursor::next_batch;
 %javamethodmodifiers __wt_cursor::next "protected";
 %rename (next_wrap) __wt_cursor::next;
 %javamethodmodifiers __wt_cursor::prev "protected";
@@ -1832,6 +1833,7 @@ WT_ASYNC_CALLBACK javaApiAsyncHandler = {javaAsyncHandler};
 %ignore __wt_event_handler;
 %ignore __wt_extractor;
 %ignore __wt_connection::add_extractor;
+%ignore __wt_connection::async_completion_fd;
 %ignore __wt_item;
 %ignore __wt_lsn;
 %ignore __wt_session::msg_printf;
@@ -65,6 +65,9 @@ from packing import pack, unpack
 %typemap(in, numinputs=0) WT_CURSOR ** (WT_CURSOR *temp = NULL) {
 	$1 = &temp;
 }
+%typemap(in, numinputs=0) int *fdp (int temp = -1) {
+	$1 = &temp;
+}
 
 %typemap(in) WT_ASYNC_CALLBACK * (PyObject *callback_obj = NULL) %{
 	callback_obj = $input;
@@ -95,6 +98,10 @@ from packing import pack, unpack
 		}
 	}
 }
+/* Return the file descriptor from async_completion_fd. */
+%typemap(argout) int *fdp {
+	$result = SWIG_From_int(*$1);
+}
 %typemap(argout) WT_ASYNC_OP ** {
 	$result = SWIG_NewPointerObj(SWIG_as_voidptr(*$1),
 	    SWIGTYPE_p___wt_async_op, 0);
@@ -429,6 +436,7 @@ COMPARE_NOTFOUND_OK(__wt_cursor::_search_near)
 %exception __wt_cursor::_set_key_str;
 %exception __wt_cursor::_set_value;
 %exception __wt_cursor::_set_value_str;
+%exception __wt_cursor::_next_batch;
 %exception wiredtiger_strerror;
 %exception wiredtiger_version;
 %exception diagnostic_build;
@@ -453,6 +461,7 @@ COMPARE_NOTFOUND_OK(__wt_cursor::_search_near)
 %ignore __wt_cursor::compare(WT_CURSOR *, WT_CURSOR *, int *);
 %ignore __wt_cursor::equals(WT_CURSOR *, WT_CURSOR *, int *);
 %ignore __wt_cursor::search_near(WT_CURSOR *, int *);
+%ignore __wt_cursor::next_batch;
 
 OVERRIDE_METHOD(__wt_cursor, WT_CURSOR, compare, (self, other))
 OVERRIDE_METHOD(__wt_cursor, WT_CURSOR, equals, (self, other))
@@ -768,6 +777,53 @@ typedef int int_void;
 		return ((ret != 0) ? ret : (cmp < 0) ? -1 : (cmp == 0) ? 0 : 1);
 	}
 
+	/*
+	 * next_batch: special handling, return a list of raw (key, value)
+	 * pairs, an empty list at the end of the data.
+	 */
+	PyObject *_next_batch(int count, int bufsize) {
+		WT_ITEM buf, *keys, *values;
+		PyObject *list, *pair;
+		uint32_t i, n;
+		int ret;
+
+		memset(&buf, 0, sizeof(buf));
+		keys = values = NULL;
+		list = NULL;
+		if (count <= 0 || bufsize <= 0)
+			ret = EINVAL;
+		else if ((buf.mem = malloc((size_t)bufsize)) == NULL ||
+		    (keys = calloc((size_t)count, sizeof(WT_ITEM))) == NULL ||
+		    (values = calloc((size_t)count, sizeof(WT_ITEM))) == NULL)
+			ret = ENOMEM;
+		else {
+			buf.memsize = (size_t)bufsize;
+			n = (uint32_t)count;
+			ret = $self->next_batch($self, &buf, keys, values, &n);
+			if (ret == WT_NOTFOUND) {
+				n = 0;
+				ret = 0;
+			}
+		}
+		if (ret == 0 && (list = PyList_New((Py_ssize_t)n)) != NULL)
+			for (i = 0; i < n; ++i) {
+				if ((pair = Py_BuildValue("(s#s#)",
+				    keys[i].data, (int)keys[i].size,
+				    values[i].data, (int)values[i].size)) == NULL) {
+					Py_DECREF(list);
+					list = NULL;
+					break;
+				}
+				PyList_SET_ITEM(list, (Py_ssize_t)i, pair);
+			}
+		free(buf.mem);
+		free(keys);
+		free(values);
+		if (ret != 0)
+			SWIG_SetErrorMsg(wtError, wiredtiger_strerror(ret));
+		return (list);
+	}
+
 	int _freecb() {
 		return (cursorFreeHandler($self));
 	}
@@ -841,6 +897,25 @@ typedef int int_void;
 			self._value = pack(self.value_format, *args)
 			self._set_value(self._value)
 
+	def next_batch(self, count, bufsize=1048576):
+		'''next_batch(self, count, bufsize) -> [[object, ...], ...]
+		
+		@copydoc WT_CURSOR::next_batch
+		Returns a list of up to count records that fit into bufsize bytes,
+		each record a list of its key columns followed by its value
+		columns, as with cursor iteration.  Returns an empty list at the
+		end of the data.'''
+		if self.is_json:
+			raise WiredTigerError('next_batch not supported on JSON cursors')
+		result = []
+		for k, v in self._next_batch(count, bufsize):
+			if self.is_column:
+				k = unpack('r', k)
+			else:
+				k = unpack(self.key_format, k)
+			result.append(k + unpack(self.value_format, v))
+		return result
+
 	def __iter__(self):
 		'''Cursor objects support iteration, equivalent to calling
 		WT_CURSOR::next until it returns ::WT_NOTFOUND.'''
@@ -23,6 +23,7 @@ __async_get_format(WT_CONNECTION_IMPL *conn, const char *uri,
 	WT_SESSION *wt_session;
 	WT_SESSION_IMPL *session;
 	uint64_t cfg_hash, uri_hash;
+	const char *cfg[] = { NULL, NULL };
 
 	async = conn->async;
 	c = NULL;
@@ -57,7 +58,15 @@ __async_get_format(WT_CONNECTION_IMPL *conn, const char *uri,
 	__wt_spin_lock(session, &async->ops_lock);
 	WT_ERR(__wt_calloc_one(session, &af));
 	WT_ERR(__wt_strdup(session, uri, &af->uri));
-	WT_ERR(__wt_strdup(session, config, &af->config));
+	/*
+	 * The configuration is also used to open the workers' cursors, remove
+	 * the items that only apply to the async op.
+	 */
+	if (config != NULL) {
+		cfg[0] = config;
+		WT_ERR(__wt_config_merge(
+		    session, cfg, "completion_queue=", &af->config));
+	}
 	af->uri_hash = uri_hash;
 	af->cfg_hash = cfg_hash;
 	/*
@@ -195,6 +204,11 @@ __async_config(WT_SESSION_IMPL *session,
 	/* Sanity check that api_data.py is in sync with async.h */
 	WT_ASSERT(session, conn->async_workers <= WT_ASYNC_MAX_WORKERS);
 
+	WT_RET(__wt_config_gets(session, cfg, "async.ops_per_txn", &cval));
+	conn->async_ops_per_txn = (uint32_t)cval.val;
+	/* Sanity check that api_data.py is in sync with async.h */
+	WT_ASSERT(session, conn->async_ops_per_txn <= WT_ASYNC_BATCH_MAX);
+
 	return (0);
 }
 
@@ -229,6 +243,7 @@ __async_start(WT_SESSION_IMPL *session)
 {
 	WT_ASYNC *async;
 	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
 	uint32_t i, session_flags;
 
 	conn = S2C(session);
@@ -239,10 +254,16 @@ __async_start(WT_SESSION_IMPL *session)
 	WT_RET(__wt_calloc_one(session, &conn->async));
 	async = conn->async;
 	TAILQ_INIT(&async->formatqh);
-	WT_RET(__wt_spin_init(session, &async->ops_lock, "ops"));
-	WT_RET(__wt_cond_alloc(
+	TAILQ_INIT(&async->completeqh);
+	async->complete_rfd = async->complete_wfd = -1;
+	WT_ERR(__wt_spin_init(session, &async->ops_lock, "ops"));
+	WT_ERR(__wt_spin_init(
+	    session, &async->complete_lock, "async completion"));
+	WT_ERR(__wt_cond_alloc(
 	    session, "async flush", false, &async->flush_cond));
-	WT_RET(__wt_async_op_init(session));
+	WT_ERR(__wt_cond_alloc(
+	    session, "async worker", false, &async->worker_cond));
+	WT_ERR(__wt_async_op_init(session));
 
 	/*
 	 * Start up the worker threads.
@@ -257,18 +278,27 @@ __async_start(WT_SESSION_IMPL *session)
 		 * while leaving the rest running.
 		 */
 		session_flags = WT_SESSION_SERVER_ASYNC;
-		WT_RET(__wt_open_internal_session(conn, "async-worker",
+		WT_ERR(__wt_open_internal_session(conn, "async-worker",
 		    true, session_flags, &async->worker_sessions[i]));
 	}
 	for (i = 0; i < conn->async_workers; i++) {
 		/*
 		 * Start the threads.
 		 */
-		WT_RET(__wt_thread_create(session, &async->worker_tids[i],
+		WT_ERR(__wt_thread_create(session, &async->worker_tids[i],
 		    __wt_async_worker, async->worker_sessions[i]));
 	}
 	__wt_async_stats_update(session);
 	return (0);
+
+	/*
+	 * If we didn't start all of the workers (for example, there may not be
+	 * enough sessions), stop any we did start, a flush could otherwise wait
+	 * forever for workers that don't exist.
+	 */
+err:	WT_TRET(__wt_async_destroy(session));
+	conn->async_cfg = 0;
+	return (ret);
 }
 
 /*
@@ -313,11 +343,15 @@ __wt_async_reconfig(WT_SESSION_IMPL *session, const char *cfg[])
 	tmp_conn.async_cfg = conn->async_cfg;
 	tmp_conn.async_workers = conn->async_workers;
 	tmp_conn.async_size = conn->async_size;
+	tmp_conn.async_ops_per_txn = conn->async_ops_per_txn;
 
 	/* Handle configuration. */
 	run = conn->async_cfg;
 	WT_RET(__async_config(session, &tmp_conn, cfg, &run));
 
+	/* Workers pick up a change to the ops per transaction as they run. */
+	conn->async_ops_per_txn = tmp_conn.async_ops_per_txn;
+
 	/*
 	 * There are some restrictions on the live reconfiguration of async.
 	 * Unlike other subsystems where we simply destroy anything existing
@@ -402,6 +436,7 @@ __wt_async_reconfig(WT_SESSION_IMPL *session, const char *cfg[])
 			WT_ASSERT(session, async->worker_sessions[i] != NULL);
 			F_CLR(async->worker_sessions[i],
 			    WT_SESSION_SERVER_ASYNC);
+			WT_TRET(__wt_cond_signal(session, async->worker_cond));
 			WT_TRET(__wt_thread_join(
 			    session, async->worker_tids[i]));
 			async->worker_tids[i] = 0;
@@ -415,6 +450,61 @@ __wt_async_reconfig(WT_SESSION_IMPL *session, const char *cfg[])
 	return (0);
 }
 
+/*
+ * __async_drain --
+ *	Invoke the callbacks of ops on the completion queue and release them,
+ *	up to a maximum number of ops, or all of the ops queued if zero.
+ */
+static int
+__async_drain(WT_SESSION_IMPL *session, uint32_t max)
+{
+	WT_ASYNC *async;
+	WT_ASYNC_OP *asyncop;
+	WT_ASYNC_OP_IMPL *op;
+	WT_DECL_RET;
+	uint32_t i;
+
+	async = S2C(session)->async;
+
+	/*
+	 * Don't drain more than the ops queued when we started, otherwise we
+	 * might never return while the workers keep posting completions.
+	 */
+	WT_ORDERED_READ(i, async->complete_count);
+	if (max == 0 || max > i)
+		max = i;
+
+	for (i = 0; i < max; ++i) {
+		/*
+		 * Take the op at the head of the queue.  If that empties the
+		 * queue, make the notification descriptor unreadable.
+		 */
+		__wt_spin_lock(session, &async->complete_lock);
+		if ((op = TAILQ_FIRST(&async->completeqh)) != NULL) {
+			TAILQ_REMOVE(&async->completeqh, op, q);
+			if (--async->complete_count == 0 &&
+			    async->complete_rfd != -1)
+				WT_TRET(__wt_notify_clear(
+				    session, async->complete_rfd));
+		}
+		__wt_spin_unlock(session, &async->complete_lock);
+		if (op == NULL)
+			break;
+
+		/*
+		 * The op's transaction is already resolved, the callback's
+		 * return value is ignored.
+		 */
+		WT_ASSERT(session, op->state == WT_ASYNCOP_COMPLETE);
+		asyncop = (WT_ASYNC_OP *)op;
+		if (op->cb != NULL && op->cb->notify != NULL)
+			(void)op->cb->notify(op->cb, asyncop, op->op_ret, 0);
+		F_CLR(&asyncop->c, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
+		WT_PUBLISH(op->state, WT_ASYNCOP_FREE);
+	}
+	return (ret);
+}
+
 /*
  * __wt_async_destroy --
  *	Destroy the async worker threads and async subsystem.
@@ -439,11 +529,13 @@ __wt_async_destroy(WT_SESSION_IMPL *session)
 	F_CLR(conn, WT_CONN_SERVER_ASYNC);
 	for (i = 0; i < conn->async_workers; i++)
 		if (async->worker_tids[i] != 0) {
+			WT_TRET(__wt_cond_signal(session, async->worker_cond));
 			WT_TRET(__wt_thread_join(
 			    session, async->worker_tids[i]));
 			async->worker_tids[i] = 0;
 		}
 	WT_TRET(__wt_cond_destroy(session, &async->flush_cond));
+	WT_TRET(__wt_cond_destroy(session, &async->worker_cond));
 
 	/* Close the server threads' sessions. */
 	for (i = 0; i < conn->async_workers; i++)
@@ -452,8 +544,16 @@ __wt_async_destroy(WT_SESSION_IMPL *session)
 			WT_TRET(wt_session->close(wt_session, NULL));
 			async->worker_sessions[i] = NULL;
 		}
+
+	/*
+	 * Invoke the callbacks for any completions the application didn't
+	 * drain, the same as if the workers had invoked them.
+	 */
+	WT_TRET(__async_drain(session, 0));
+	WT_TRET(__wt_notify_close(
+	    session, &async->complete_rfd, &async->complete_wfd));
 	/* Free any op key/value buffers. */
-	for (i = 0; i < conn->async_size; i++) {
+	for (i = 0; async->async_ops != NULL && i < conn->async_size; i++) {
 		op = (WT_ASYNC_OP *)&async->async_ops[i];
 		if (op->c.key.data != NULL)
 			__wt_buf_free(session, &op->c.key);
@@ -475,6 +575,7 @@ __wt_async_destroy(WT_SESSION_IMPL *session)
 	__wt_free(session, async->async_queue);
 	__wt_free(session, async->async_ops);
 	__wt_spin_destroy(session, &async->ops_lock);
+	__wt_spin_destroy(session, &async->complete_lock);
 	__wt_free(session, conn->async);
 
 	return (ret);
@@ -540,6 +641,61 @@ err:
 	return (ret);
 }
 
+/*
+ * __wt_async_drain --
+ *	Implementation of the WT_CONN->async_drain method.
+ */
+int
+__wt_async_drain(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_CONFIG_ITEM cval;
+
+	if (!S2C(session)->async_cfg)
+		return (ENOTSUP);
+
+	WT_STAT_FAST_CONN_INCR(session, async_drain);
+	WT_RET(__wt_config_gets(session, cfg, "max", &cval));
+	return (__async_drain(session, (uint32_t)cval.val));
+}
+
+/*
+ * __wt_async_completion_fd --
+ *	Implementation of the WT_CONN->async_completion_fd method.
+ */
+int
+__wt_async_completion_fd(WT_SESSION_IMPL *session, int *fdp)
+{
+	WT_ASYNC *async;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+
+	*fdp = -1;
+
+	conn = S2C(session);
+	if (!conn->async_cfg)
+		return (ENOTSUP);
+	async = conn->async;
+
+	/*
+	 * Open the notification descriptors the first time they're needed.
+	 * Completions may already be queued, in which case the descriptor
+	 * starts out readable.
+	 */
+	__wt_spin_lock(session, &async->complete_lock);
+	if (async->complete_rfd == -1) {
+		ret = __wt_notify_open(
+		    session, &async->complete_rfd, &async->complete_wfd);
+		if (ret == 0 && async->complete_count != 0)
+			ret = __wt_notify_signal(session, async->complete_wfd);
+		if (ret != 0)
+			WT_TRET(__wt_notify_close(session,
+			    &async->complete_rfd, &async->complete_wfd));
+	}
+	*fdp = async->complete_rfd;
+	__wt_spin_unlock(session, &async->complete_lock);
+	return (ret);
+}
+
 /*
  * __async_runtime_config --
  *	Configure runtime fields at allocation.
@@ -568,6 +724,12 @@ __async_runtime_config(WT_ASYNC_OP_IMPL *op, const char *cfg[])
 		F_SET(&asyncop->c, WT_CURSTD_RAW);
 	else
 		F_CLR(&asyncop->c, WT_CURSTD_RAW);
+	WT_RET(__wt_config_gets_def(
+	    session, cfg, "completion_queue", 0, &cval));
+	if (cval.val)
+		F_SET(op, WT_ASYNCOP_QUEUE_COMPLETION);
+	else
+		F_CLR(op, WT_ASYNCOP_QUEUE_COMPLETION);
 	return (0);
 
 }
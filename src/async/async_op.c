@@ -254,12 +254,9 @@ int
 __wt_async_op_enqueue(WT_SESSION_IMPL *session, WT_ASYNC_OP_IMPL *op)
 {
 	WT_ASYNC *async;
+	WT_ASYNC_QSLOT *slot;
 	WT_CONNECTION_IMPL *conn;
-	WT_DECL_RET;
-	uint64_t cur_head, cur_tail, my_alloc, my_slot;
-#ifdef	HAVE_DIAGNOSTIC
-	WT_ASYNC_OP_IMPL *my_op;
-#endif
+	uint64_t pos, seq;
 
 	conn = S2C(session);
 	async = conn->async;
@@ -273,42 +270,40 @@ __wt_async_op_enqueue(WT_SESSION_IMPL *session, WT_ASYNC_OP_IMPL *op)
 		    "application error: WT_ASYNC_OP already in use");
 
 	/*
-	 * Enqueue op at the tail of the work queue.
-	 * We get our slot in the ring buffer to use.
-	 */
-	my_alloc = __wt_atomic_add64(&async->alloc_head, 1);
-	my_slot = my_alloc % async->async_qsize;
-
-	/*
-	 * Make sure we haven't wrapped around the queue.
-	 * If so, wait for the tail to advance off this slot.
+	 * Claim the slot at the head of the work queue.  The queue is sized
+	 * so it can't fill, but if the slot hasn't yet been emptied from the
+	 * previous lap around the ring, wait for a worker to empty it.
 	 */
-	WT_ORDERED_READ(cur_tail, async->tail_slot);
-	while (cur_tail == my_slot) {
-		__wt_yield();
-		WT_ORDERED_READ(cur_tail, async->tail_slot);
+	for (;;) {
+		WT_ORDERED_READ(pos, async->head);
+		slot = &async->async_queue[pos % async->async_qsize];
+		WT_ORDERED_READ(seq, slot->seq);
+		if (seq == pos) {
+			if (__wt_atomic_cas64(&async->head, pos, pos + 1))
+				break;
+		} else if (seq < pos)
+			__wt_yield();
 	}
 
 #ifdef	HAVE_DIAGNOSTIC
-	WT_ORDERED_READ(my_op, async->async_queue[my_slot]);
-	if (my_op != NULL)
+	if (slot->op != NULL)
 		return (__wt_panic(session));
 #endif
-	WT_PUBLISH(async->async_queue[my_slot], op);
 	op->state = WT_ASYNCOP_ENQUEUED;
 	if (__wt_atomic_add32(&async->cur_queue, 1) > async->max_queue)
 		WT_PUBLISH(async->max_queue, async->cur_queue);
+	slot->op = op;
+	WT_PUBLISH(slot->seq, pos + 1);
+
 	/*
-	 * Multiple threads may be adding ops to the queue.  We need to wait
-	 * our turn to make our slot visible to workers.
+	 * Wake any waiting workers.  Workers increment the waiting count and
+	 * then check the queue, the barrier orders our check of the count
+	 * after publishing the op, so one of us sees the other's change.
 	 */
-	WT_ORDERED_READ(cur_head, async->head);
-	while (cur_head != (my_alloc - 1)) {
-		__wt_yield();
-		WT_ORDERED_READ(cur_head, async->head);
-	}
-	WT_PUBLISH(async->head, my_alloc);
-	return (ret);
+	WT_FULL_BARRIER();
+	if (async->worker_waiters != 0)
+		WT_RET(__wt_cond_signal(session, async->worker_cond));
+	return (0);
 }
 
 /*
@@ -340,6 +335,8 @@ __wt_async_op_init(WT_SESSION_IMPL *session)
 	async->async_qsize = conn->async_size + 2;
 	WT_RET(__wt_calloc_def(
 	    session, async->async_qsize, &async->async_queue));
+	for (i = 0; i < async->async_qsize; i++)
+		async->async_queue[i].seq = i;
 	/*
 	 * Allocate and initialize all the user ops.
 	 */
@@ -8,93 +8,139 @@
 
 #include "wt_internal.h"
 
+/*
+ * __async_queue_ready --
+ *	Return if there's work for a worker: an op at the tail of the queue or
+ * a flush to join.
+ */
+static inline bool
+__async_queue_ready(WT_ASYNC *async)
+{
+	uint64_t pos, seq;
+
+	WT_ORDERED_READ(pos, async->tail);
+	WT_ORDERED_READ(seq, async->async_queue[pos % async->async_qsize].seq);
+	return (seq == pos + 1 || async->flush_state == WT_ASYNC_FLUSHING);
+}
+
 /*
  * __async_op_dequeue --
- *	Wait for work to be available.  Then atomically take it off
- *	the work queue.
+ *	Wait for work to be available.  Then atomically take a batch of ops
+ *	off the work queue.
  */
 static int
 __async_op_dequeue(WT_CONNECTION_IMPL *conn, WT_SESSION_IMPL *session,
-    WT_ASYNC_OP_IMPL **op)
+    WT_ASYNC_OP_IMPL **batch, uint32_t *countp)
 {
 	WT_ASYNC *async;
-	uint64_t cur_tail, last_consume, my_consume, my_slot, prev_slot;
-	uint64_t sleep_usec;
-	uint32_t tries;
+	WT_ASYNC_OP_IMPL *op;
+	WT_ASYNC_QSLOT *slot;
+	WT_DECL_RET;
+	uint64_t head, pos, seq;
+	uint32_t i, max, n, tries;
 
 	async = conn->async;
-	*op = NULL;
-	/*
-	 * Wait for work to do.  Work is available when async->head moves.
-	 * Then grab the slot containing the work.  If we lose, try again.
-	 */
-retry:
-	tries = 0;
-	sleep_usec = 100;
-	WT_ORDERED_READ(last_consume, async->alloc_tail);
+	*countp = 0;
+
 	/*
-	 * We stay in this loop until there is work to do.
+	 * Wait for work to do.  Work is available when the slot at the tail of
+	 * the queue is full.  Spin briefly, then block until a producer signals
+	 * new work.
 	 */
-	while (last_consume == async->head &&
-	    async->flush_state != WT_ASYNC_FLUSHING) {
+	for (tries = 0; !__async_queue_ready(async);) {
 		WT_STAT_FAST_CONN_INCR(session, async_nowork);
-		if (++tries < MAX_ASYNC_YIELD)
-			/*
-			 * Initially when we find no work, allow other
-			 * threads to run.
-			 */
-			__wt_yield();
-		else {
-			/*
-			 * If we haven't found work in a while, start sleeping
-			 * to wait for work to arrive instead of spinning.
-			 */
-			__wt_sleep(0, sleep_usec);
-			sleep_usec = WT_MIN(sleep_usec * 2,
-			    MAX_ASYNC_SLEEP_USECS);
-		}
 		if (!F_ISSET(session, WT_SESSION_SERVER_ASYNC))
 			return (0);
 		if (!F_ISSET(conn, WT_CONN_SERVER_ASYNC))
 			return (0);
 		WT_RET(WT_SESSION_CHECK_PANIC(session));
-		WT_ORDERED_READ(last_consume, async->alloc_tail);
+		if (++tries < MAX_ASYNC_YIELD) {
+			__wt_yield();
+			continue;
+		}
+
+		/*
+		 * Producers publish an op and then check the waiting count, we
+		 * increment the waiting count and then check the queue, so one
+		 * of us sees the other's change.  The timeout bounds the wait
+		 * in case of a missed wakeup.
+		 */
+		WT_STAT_FAST_CONN_INCR(session, async_worker_wait);
+		(void)__wt_atomic_add32(&async->worker_waiters, 1);
+		if (!__async_queue_ready(async))
+			WT_TRET(__wt_cond_wait(session,
+			    async->worker_cond, MAX_ASYNC_SLEEP_USECS));
+		(void)__wt_atomic_sub32(&async->worker_waiters, 1);
+		WT_RET(ret);
+		tries = 0;
 	}
 	if (async->flush_state == WT_ASYNC_FLUSHING)
 		return (0);
+
+	/*
+	 * Take a fair share of the queued work, so a worker doesn't take a
+	 * batch of work when other workers are idle, but at least enough to
+	 * group operations into transactions.
+	 */
+	WT_ORDERED_READ(head, async->head);
+	WT_ORDERED_READ(pos, async->tail);
+	max = (uint32_t)WT_MIN(WT_ASYNC_BATCH_MAX,
+	    (head - pos) / conn->async_workers + 1);
+	max = WT_MAX(max, conn->async_ops_per_txn);
+
 	/*
-	 * Try to increment the tail to claim this slot.  If we lose
-	 * a race, try again.
+	 * Gather the full slots at the tail, then try to claim them by moving
+	 * the tail past them.  If we lose a race, try again.  The flush op is
+	 * never batched with other ops: it's taken by itself, after workers
+	 * have taken all of the ops enqueued before it.
 	 */
-	my_consume = last_consume + 1;
-	if (!__wt_atomic_cas64(&async->alloc_tail, last_consume, my_consume))
+retry:	WT_ORDERED_READ(pos, async->tail);
+	for (n = 0; n < max; ++n) {
+		slot = &async->async_queue[(pos + n) % async->async_qsize];
+		WT_ORDERED_READ(seq, slot->seq);
+		if (seq != pos + n + 1)
+			break;
+		op = slot->op;
+		if (op == &async->flush_op && n > 0)
+			break;
+		batch[n] = op;
+		if (op == &async->flush_op) {
+			++n;
+			break;
+		}
+	}
+	if (n == 0)
+		return (0);
+	if (!__wt_atomic_cas64(&async->tail, pos, pos + n))
 		goto retry;
+
 	/*
-	 * This item of work is ours to process.  Clear it out of the
-	 * queue and return.
+	 * These items of work are ours to process.  Clear them out of the queue
+	 * and mark their slots empty for the next lap around the ring.
 	 */
-	my_slot = my_consume % async->async_qsize;
-	prev_slot = last_consume % async->async_qsize;
-	*op = async->async_queue[my_slot];
-	async->async_queue[my_slot] = NULL;
-
-	WT_ASSERT(session, async->cur_queue > 0);
-	WT_ASSERT(session, *op != NULL);
-	WT_ASSERT(session, (*op)->state == WT_ASYNCOP_ENQUEUED);
-	(void)__wt_atomic_sub32(&async->cur_queue, 1);
-	(*op)->state = WT_ASYNCOP_WORKING;
-
-	if (*op == &async->flush_op)
-		/*
-		 * We're the worker to take the flush op off the queue.
-		 */
+	for (i = 0; i < n; ++i) {
+		slot = &async->async_queue[(pos + i) % async->async_qsize];
+		slot->op = NULL;
+		WT_PUBLISH(slot->seq, pos + i + async->async_qsize);
+
+		op = batch[i];
+		WT_ASSERT(session, async->cur_queue > 0);
+		WT_ASSERT(session, op != NULL);
+		WT_ASSERT(session, op->state == WT_ASYNCOP_ENQUEUED);
+		(void)__wt_atomic_sub32(&async->cur_queue, 1);
+		op->state = WT_ASYNCOP_WORKING;
+	}
+	WT_STAT_FAST_CONN_INCR(session, async_worker_batch);
+	*countp = n;
+
+	/*
+	 * If we took the flush op off the queue, wake the other workers to
+	 * join the flush.
+	 */
+	if (batch[0] == &async->flush_op) {
 		WT_PUBLISH(async->flush_state, WT_ASYNC_FLUSHING);
-	WT_ORDERED_READ(cur_tail, async->tail_slot);
-	while (cur_tail != prev_slot) {
-		__wt_yield();
-		WT_ORDERED_READ(cur_tail, async->tail_slot);
+		WT_RET(__wt_cond_signal(session, async->worker_cond));
 	}
-	WT_PUBLISH(async->tail_slot, my_slot);
 	return (0);
 }
 
@@ -209,11 +255,14 @@ __async_worker_execop(WT_SESSION_IMPL *session, WT_ASYNC_OP_IMPL *op,
 		case WT_AOP_SEARCH:
 			WT_RET(cursor->search(cursor));
 			/*
-			 * Get the value from the cursor and put it into
-			 * the op for op->get_value.
+			 * Get the value from the cursor and copy it into
+			 * the op for op->get_value: the cursor may be reset
+			 * or repositioned before the callback runs.
 			 */
 			WT_RET(__wt_cursor_get_raw_value(cursor, &val));
-			__wt_cursor_set_raw_value(&asyncop->c, &val);
+			WT_RET(__wt_buf_set(
+			    session, &asyncop->c.value, val.data, val.size));
+			F_SET(&asyncop->c, WT_CURSTD_VALUE_EXT);
 			break;
 		case WT_AOP_NONE:
 		default:
@@ -223,6 +272,33 @@ __async_worker_execop(WT_SESSION_IMPL *session, WT_ASYNC_OP_IMPL *op,
 	return (0);
 }
 
+/*
+ * __async_complete --
+ *	Post a completed op to the completion queue.
+ */
+static int
+__async_complete(WT_SESSION_IMPL *session, WT_ASYNC_OP_IMPL *op, int op_ret)
+{
+	WT_ASYNC *async;
+	WT_DECL_RET;
+
+	async = S2C(session)->async;
+	WT_STAT_FAST_CONN_INCR(session, async_complete);
+
+	/*
+	 * The op keeps its key and value until the application drains it.
+	 * If the queue was empty, make the notification descriptor readable.
+	 */
+	op->op_ret = op_ret;
+	op->state = WT_ASYNCOP_COMPLETE;
+	__wt_spin_lock(session, &async->complete_lock);
+	TAILQ_INSERT_TAIL(&async->completeqh, op, q);
+	if (async->complete_count++ == 0 && async->complete_wfd != -1)
+		ret = __wt_notify_signal(session, async->complete_wfd);
+	__wt_spin_unlock(session, &async->complete_lock);
+	return (ret);
+}
+
 /*
  * __async_worker_op --
  *	A worker thread handles an individual op.
@@ -245,12 +321,15 @@ __async_worker_op(WT_SESSION_IMPL *session, WT_ASYNC_OP_IMPL *op,
 	if (op->optype != WT_AOP_COMPACT)
 		WT_RET(wt_session->begin_transaction(wt_session, NULL));
 	WT_ASSERT(session, op->state == WT_ASYNCOP_WORKING);
-	WT_RET(__async_worker_cursor(session, op, worker, &cursor));
+
 	/*
-	 * Perform op and invoke the callback.
+	 * Perform op and invoke the callback.  If we can't get a cursor, the
+	 * op fails: it still has to be resolved and released.
 	 */
-	ret = __async_worker_execop(session, op, cursor);
-	if (op->cb != NULL && op->cb->notify != NULL)
+	if ((ret = __async_worker_cursor(session, op, worker, &cursor)) == 0)
+		ret = __async_worker_execop(session, op, cursor);
+	if (!F_ISSET(op, WT_ASYNCOP_QUEUE_COMPLETION) &&
+	    op->cb != NULL && op->cb->notify != NULL)
 		cb_ret = op->cb->notify(op->cb, asyncop, ret, 0);
 
 	/*
@@ -264,18 +343,143 @@ __async_worker_op(WT_SESSION_IMPL *session, WT_ASYNC_OP_IMPL *op,
 		else
 			WT_TRET(wt_session->rollback_transaction(
 			    wt_session, NULL));
-		F_CLR(&asyncop->c, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
-		WT_TRET(cursor->reset(cursor));
+		if (cursor != NULL)
+			WT_TRET(cursor->reset(cursor));
 	}
+
+	/*
+	 * With the transaction resolved, post the op to the completion queue
+	 * if it's configured to use it: it's released when it's drained.
+	 */
+	if (F_ISSET(op, WT_ASYNCOP_QUEUE_COMPLETION)) {
+		WT_TRET(__async_complete(session, op, ret));
+		return (ret);
+	}
+
 	/*
 	 * After the callback returns, and the transaction resolved release
 	 * the op back to the free pool.  We do this regardless of
 	 * success or failure.
 	 */
+	F_CLR(&asyncop->c, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
 	WT_PUBLISH(op->state, WT_ASYNCOP_FREE);
 	return (ret);
 }
 
+/*
+ * __async_worker_group --
+ *	A worker thread handles a group of ops on the same object, executing
+ *	them with a single cursor in a single transaction.
+ */
+static int
+__async_worker_group(WT_SESSION_IMPL *session, WT_ASYNC_OP_IMPL **group,
+    uint32_t count, WT_ASYNC_WORKER_STATE *worker)
+{
+	WT_ASYNC_OP *asyncop;
+	WT_ASYNC_OP_IMPL *op;
+	WT_CURSOR *cursor;
+	WT_DECL_RET;
+	WT_SESSION *wt_session;
+	uint32_t i;
+	int op_ret[WT_ASYNC_BATCH_MAX];
+
+	wt_session = &session->iface;
+	WT_RET(wt_session->begin_transaction(wt_session, NULL));
+	ret = __async_worker_cursor(session, group[0], worker, &cursor);
+	for (i = 0; ret == 0 && i < count; ++i) {
+		WT_ASSERT(session, group[i]->state == WT_ASYNCOP_WORKING);
+		op_ret[i] = __async_worker_execop(session, group[i], cursor);
+		if (op_ret[i] != 0 && op_ret[i] != WT_NOTFOUND)
+			ret = op_ret[i];
+	}
+	if (ret == 0)
+		ret = wt_session->commit_transaction(wt_session, NULL);
+	else
+		WT_TRET(wt_session->rollback_transaction(wt_session, NULL));
+	if (cursor != NULL)
+		WT_TRET(cursor->reset(cursor));
+
+	/*
+	 * If an operation or the commit failed, retry the operations one at a
+	 * time, so the failure only affects the operation that caused it.
+	 */
+	if (ret != 0) {
+		WT_STAT_FAST_CONN_INCRV(session, async_group_retry, count);
+		ret = 0;
+		for (i = 0; i < count; ++i)
+			WT_TRET(__async_worker_op(session, group[i], worker));
+		return (ret);
+	}
+
+	/*
+	 * The transaction committed: invoke the callbacks and release the ops
+	 * back to the free pool, or post them to the completion queue.
+	 */
+	WT_STAT_FAST_CONN_INCRV(session, async_group_ops, count);
+	for (i = 0; i < count; ++i) {
+		op = group[i];
+		if (F_ISSET(op, WT_ASYNCOP_QUEUE_COMPLETION)) {
+			WT_TRET(__async_complete(session, op, op_ret[i]));
+			continue;
+		}
+		asyncop = (WT_ASYNC_OP *)op;
+		if (op->cb != NULL && op->cb->notify != NULL)
+			(void)op->cb->notify(op->cb, asyncop, op_ret[i], 0);
+		F_CLR(&asyncop->c, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
+		WT_PUBLISH(op->state, WT_ASYNCOP_FREE);
+	}
+	return (ret);
+}
+
+/*
+ * __async_worker_batch --
+ *	A worker thread handles a batch of ops, grouping ops on the same object
+ *	into transactions.
+ */
+static int
+__async_worker_batch(WT_SESSION_IMPL *session, WT_ASYNC_OP_IMPL **batch,
+    uint32_t count, WT_ASYNC_WORKER_STATE *worker)
+{
+	WT_ASYNC_OP_IMPL *group[WT_ASYNC_BATCH_MAX], *next, *op;
+	uint32_t grouped, i, j, max;
+
+	max = S2C(session)->async_ops_per_txn;
+	for (i = 0; i < count; ++i) {
+		if ((op = batch[i]) == NULL)
+			continue;
+
+		/*
+		 * Gather later ops in the batch on the same object, in order.
+		 * Compact doesn't use a cursor or a transaction.
+		 */
+		group[0] = op;
+		grouped = 1;
+		for (j = i + 1;
+		    op->optype != WT_AOP_COMPACT && j < count && grouped < max;
+		    ++j) {
+			if ((next = batch[j]) == NULL ||
+			    next->optype == WT_AOP_COMPACT ||
+			    next->format->uri_hash != op->format->uri_hash ||
+			    next->format->cfg_hash != op->format->cfg_hash)
+				continue;
+			group[grouped++] = next;
+			batch[j] = NULL;
+		}
+
+		/*
+		 * If an operation fails, we want the worker thread to keep
+		 * running, unless there is a panic.
+		 */
+		if (grouped == 1)
+			(void)__async_worker_op(session, op, worker);
+		else
+			(void)__async_worker_group(
+			    session, group, grouped, worker);
+		WT_RET(WT_SESSION_CHECK_PANIC(session));
+	}
+	return (0);
+}
+
 /*
  * __wt_async_worker --
  *	The async worker threads.
@@ -285,12 +489,13 @@ __wt_async_worker(void *arg)
 {
 	WT_ASYNC *async;
 	WT_ASYNC_CURSOR *ac, *acnext;
-	WT_ASYNC_OP_IMPL *op;
+	WT_ASYNC_OP_IMPL *batch[WT_ASYNC_BATCH_MAX];
 	WT_ASYNC_WORKER_STATE worker;
 	WT_CONNECTION_IMPL *conn;
 	WT_DECL_RET;
 	WT_SESSION_IMPL *session;
 	uint64_t flush_gen;
+	uint32_t count;
 
 	session = arg;
 	conn = S2C(session);
@@ -300,15 +505,11 @@ __wt_async_worker(void *arg)
 	TAILQ_INIT(&worker.cursorqh);
 	while (F_ISSET(conn, WT_CONN_SERVER_ASYNC) &&
 	    F_ISSET(session, WT_SESSION_SERVER_ASYNC)) {
-		WT_ERR(__async_op_dequeue(conn, session, &op));
-		if (op != NULL && op != &async->flush_op) {
-			/*
-			 * If an operation fails, we want the worker thread to
-			 * keep running, unless there is a panic.
-			 */
-			(void)__async_worker_op(session, op, &worker);
-			WT_ERR(WT_SESSION_CHECK_PANIC(session));
-		} else if (async->flush_state == WT_ASYNC_FLUSHING) {
+		WT_ERR(__async_op_dequeue(conn, session, batch, &count));
+		if (count != 0 && batch[0] != &async->flush_op)
+			WT_ERR(__async_worker_batch(
+			    session, batch, count, &worker));
+		else if (async->flush_state == WT_ASYNC_FLUSHING) {
 			/*
 			 * Worker flushing going on.  Last worker to the party
 			 * needs to clear the FLUSHING flag and signal the cond.
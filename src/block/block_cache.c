@@ -0,0 +1,512 @@
+/*-
+ * Copyright (c) 2014-2015 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * The block cache keeps copies of blocks read from and written to data files
+ * in a bounded file on fast local storage, for data files on storage with
+ * high read latency.
+ *
+ * The cache file is written as a ring: each image is written, with a header,
+ * at the next write offset, and when the ring wraps, the oldest images are
+ * overwritten.  An in-memory index maps a block's file name hash, offset, size
+ * and checksum to its place in the cache file.  The block checksum is part of
+ * the key, so when a block is freed and its space reused, the new block never
+ * matches the old image.
+ *
+ * Images are read from the cache file without holding the index lock, so an
+ * image can be overwritten while it's read.  Every image carries a header
+ * naming the block and a checksum of the image, both checked before the image
+ * is used; an image that fails the check is treated as a miss.
+ *
+ * The cache is only a copy of the data files, it never fails data file I/O:
+ * an error reading the cache file is a miss, and an error writing it skips
+ * the insert.  The entry is discarded in both cases.
+ *
+ * The index is written to a separate file when the connection is closed, and
+ * read back (and removed) when it's next opened.  After a crash there's no
+ * index, and the cache starts empty.
+ */
+
+/*
+ * __bcache_bucket --
+ *	Return the hash bucket for a block.
+ */
+static inline uint32_t
+__bcache_bucket(WT_BCACHE *bcache, uint64_t name_hash, wt_off_t offset)
+{
+	return ((uint32_t)((name_hash ^ (uint64_t)offset) % bcache->buckets));
+}
+
+/*
+ * __bcache_search --
+ *	Search the index for a block.
+ */
+static WT_BCACHE_ENTRY *
+__bcache_search(WT_BCACHE *bcache,
+    uint64_t name_hash, wt_off_t offset, uint32_t size, uint32_t cksum)
+{
+	WT_BCACHE_ENTRY *e;
+
+	TAILQ_FOREACH(e, &bcache->hash[
+	    __bcache_bucket(bcache, name_hash, offset)], hashq)
+		if (e->name_hash == name_hash && e->offset == offset &&
+		    e->size == size && e->cksum == cksum)
+			return (e);
+	return (NULL);
+}
+
+/*
+ * __bcache_entry_remove --
+ *	Remove an entry from the index and free it.
+ */
+static void
+__bcache_entry_remove(
+    WT_SESSION_IMPL *session, WT_BCACHE *bcache, WT_BCACHE_ENTRY *e)
+{
+	TAILQ_REMOVE(&bcache->hash[
+	    __bcache_bucket(bcache, e->name_hash, e->offset)], e, hashq);
+	TAILQ_REMOVE(&bcache->qh, e, q);
+	--bcache->entries;
+	__wt_free(session, e);
+}
+
+/*
+ * __bcache_entry_add --
+ *	Add an entry to the index.
+ */
+static int
+__bcache_entry_add(WT_SESSION_IMPL *session, WT_BCACHE *bcache,
+    uint64_t name_hash, wt_off_t offset, uint32_t size, uint32_t cksum,
+    wt_off_t coff, bool ready)
+{
+	WT_BCACHE_ENTRY *e;
+
+	WT_RET(__wt_calloc_one(session, &e));
+	e->name_hash = name_hash;
+	e->offset = offset;
+	e->size = size;
+	e->cksum = cksum;
+	e->coff = coff;
+	e->ready = ready;
+	TAILQ_INSERT_HEAD(&bcache->hash[
+	    __bcache_bucket(bcache, name_hash, offset)], e, hashq);
+	TAILQ_INSERT_TAIL(&bcache->qh, e, q);
+	++bcache->entries;
+	return (0);
+}
+
+/*
+ * __bcache_entry_discard --
+ *	Discard an entry, if it's still the image at a cache file offset.
+ */
+static void
+__bcache_entry_discard(WT_SESSION_IMPL *session, WT_BCACHE *bcache,
+    uint64_t name_hash, wt_off_t offset, uint32_t size, uint32_t cksum,
+    wt_off_t coff)
+{
+	WT_BCACHE_ENTRY *e;
+
+	__wt_spin_lock(session, &bcache->lock);
+	if ((e = __bcache_search(
+	    bcache, name_hash, offset, size, cksum)) != NULL && e->coff == coff)
+		__bcache_entry_remove(session, bcache, e);
+	__wt_spin_unlock(session, &bcache->lock);
+}
+
+/*
+ * __wt_bcache_read --
+ *	Read a block from the block cache, if it's there.
+ */
+void
+__wt_bcache_read(WT_SESSION_IMPL *session, WT_BLOCK *block,
+    WT_ITEM *buf, wt_off_t offset, uint32_t size, uint32_t cksum,
+    bool *foundp)
+{
+	WT_BCACHE *bcache;
+	WT_BCACHE_ENTRY *e;
+	WT_BCACHE_HDR hdr;
+	WT_BLOCK_HEADER *blk;
+	wt_off_t coff;
+	bool found;
+
+	*foundp = false;
+
+	bcache = S2C(session)->bcache;
+
+	__wt_spin_lock(session, &bcache->lock);
+	e = __bcache_search(bcache, block->name_hash, offset, size, cksum);
+	found = e != NULL && e->ready;
+	coff = found ? e->coff : 0;
+	__wt_spin_unlock(session, &bcache->lock);
+
+	if (!found) {
+		WT_STAT_FAST_CONN_INCR(session, block_cache_miss);
+		return;
+	}
+
+	/*
+	 * Read the header and image, then check they're the block we want: the
+	 * image may have been overwritten since we looked it up.
+	 */
+	if (__wt_read(session,
+	    bcache->fh, coff, WT_BCACHE_HDR_SIZE, &hdr) != 0 ||
+	    __wt_read(session,
+	    bcache->fh, coff + WT_BCACHE_HDR_SIZE, size, buf->mem) != 0) {
+		__bcache_entry_discard(session,
+		    bcache, block->name_hash, offset, size, cksum, coff);
+		WT_STAT_FAST_CONN_INCR(session, block_cache_error);
+		return;
+	}
+	if (hdr.magic != WT_BCACHE_MAGIC ||
+	    hdr.name_hash != block->name_hash ||
+	    hdr.offset != (uint64_t)offset ||
+	    hdr.size != size || hdr.block_cksum != cksum ||
+	    hdr.cksum != __wt_cksum(buf->mem, size)) {
+		__bcache_entry_discard(session,
+		    bcache, block->name_hash, offset, size, cksum, coff);
+		WT_STAT_FAST_CONN_INCR(session, block_cache_invalid);
+		return;
+	}
+
+	/*
+	 * Images written from the write path still have the block checksum
+	 * set, clear it the way a read from the data file does.
+	 */
+	blk = WT_BLOCK_HEADER_REF(buf->mem);
+	blk->cksum = 0;
+	buf->size = size;
+
+	*foundp = true;
+	WT_STAT_FAST_CONN_INCR(session, block_cache_hit);
+}
+
+/*
+ * __wt_bcache_insert --
+ *	Add a block read from or written to a data file to the block cache.
+ */
+void
+__wt_bcache_insert(WT_SESSION_IMPL *session, WT_BLOCK *block,
+    const void *image, wt_off_t offset, uint32_t size, uint32_t cksum)
+{
+	WT_BCACHE *bcache;
+	WT_BCACHE_ENTRY *e;
+	WT_BCACHE_HDR hdr;
+	WT_DECL_RET;
+	wt_off_t coff, len;
+
+	bcache = S2C(session)->bcache;
+	len = WT_BCACHE_HDR_SIZE + (wt_off_t)size;
+
+	/* Don't let a single image flush the cache. */
+	if (len > bcache->size / 4)
+		return;
+
+	/* Build the header before acquiring the lock. */
+	hdr.magic = WT_BCACHE_MAGIC;
+	hdr.cksum = __wt_cksum(image, size);
+	hdr.name_hash = block->name_hash;
+	hdr.offset = (uint64_t)offset;
+	hdr.size = size;
+	hdr.block_cksum = cksum;
+
+	__wt_spin_lock(session, &bcache->lock);
+
+	/* Another thread may have read the same block. */
+	if (__bcache_search(bcache,
+	    block->name_hash, offset, size, cksum) != NULL) {
+		__wt_spin_unlock(session, &bcache->lock);
+		return;
+	}
+
+	/*
+	 * Reserve space at the write offset, wrapping to the start of the file
+	 * if the image doesn't fit.  The oldest entries are those following the
+	 * write offset, discard any we overwrite.
+	 */
+	if (bcache->woff + len > bcache->size) {
+		while ((e = TAILQ_FIRST(&bcache->qh)) != NULL &&
+		    e->coff >= bcache->woff)
+			__bcache_entry_remove(session, bcache, e);
+		bcache->woff = 0;
+	}
+	coff = bcache->woff;
+	while ((e = TAILQ_FIRST(&bcache->qh)) != NULL &&
+	    e->coff >= coff && e->coff < coff + len)
+		__bcache_entry_remove(session, bcache, e);
+	bcache->woff += len;
+
+	/*
+	 * Add the entry, but don't return it from searches until the image is
+	 * written.
+	 */
+	ret = __bcache_entry_add(session, bcache,
+	    block->name_hash, offset, size, cksum, coff, false);
+	__wt_spin_unlock(session, &bcache->lock);
+	if (ret != 0) {
+		WT_STAT_FAST_CONN_INCR(session, block_cache_error);
+		return;
+	}
+
+	/* If the image can't be written, discard the entry. */
+	if (__wt_write(session,
+	    bcache->fh, coff, WT_BCACHE_HDR_SIZE, &hdr) != 0 ||
+	    __wt_write(session,
+	    bcache->fh, coff + WT_BCACHE_HDR_SIZE, size, image) != 0) {
+		__bcache_entry_discard(session,
+		    bcache, block->name_hash, offset, size, cksum, coff);
+		WT_STAT_FAST_CONN_INCR(session, block_cache_error);
+		return;
+	}
+
+	/* The entry may have been discarded while the image was written. */
+	__wt_spin_lock(session, &bcache->lock);
+	if ((e = __bcache_search(bcache,
+	    block->name_hash, offset, size, cksum)) != NULL && e->coff == coff)
+		e->ready = true;
+	__wt_spin_unlock(session, &bcache->lock);
+
+	WT_STAT_FAST_CONN_INCR(session, block_cache_insert);
+}
+
+/*
+ * __wt_bcache_discard --
+ *	Discard a file's blocks from the block cache when the file is created,
+ * truncated or dropped.
+ */
+void
+__wt_bcache_discard(WT_SESSION_IMPL *session, const char *filename)
+{
+	WT_BCACHE *bcache;
+	WT_BCACHE_ENTRY *e, *next;
+	uint64_t name_hash;
+
+	if ((bcache = S2C(session)->bcache) == NULL)
+		return;
+
+	name_hash = __wt_hash_city64(filename, strlen(filename));
+
+	__wt_spin_lock(session, &bcache->lock);
+	for (e = TAILQ_FIRST(&bcache->qh); e != NULL; e = next) {
+		next = TAILQ_NEXT(e, q);
+		if (e->name_hash == name_hash)
+			__bcache_entry_remove(session, bcache, e);
+	}
+	__wt_spin_unlock(session, &bcache->lock);
+}
+
+/*
+ * __bcache_index_read --
+ *	Read the index saved when the connection was last closed.
+ */
+static int
+__bcache_index_read(WT_SESSION_IMPL *session, WT_BCACHE *bcache)
+{
+	WT_BCACHE_INDEX idx;
+	WT_BCACHE_INDEX_ENTRY *ie;
+	WT_DECL_ITEM(tmp);
+	WT_DECL_RET;
+	WT_FH *fh;
+	wt_off_t off, size;
+	uint64_t i, n;
+	bool exist;
+
+	fh = NULL;
+
+	WT_RET(__wt_exist(session, bcache->index_name, &exist));
+	if (!exist)
+		return (0);
+
+	WT_ERR(__wt_open(session, bcache->index_name, false, false, 0, &fh));
+	WT_ERR(__wt_filesize(session, fh, &size));
+	if (size < (wt_off_t)sizeof(idx))
+		goto done;
+	WT_ERR(__wt_read(session, fh, 0, sizeof(idx), &idx));
+
+	/*
+	 * If the cache file's size has changed, the index may name images past
+	 * the end of the file; start over.
+	 */
+	if (idx.magic != WT_BCACHE_INDEX_MAGIC ||
+	    idx.version != WT_BCACHE_INDEX_VERSION ||
+	    idx.size != (uint64_t)bcache->size || idx.woff > idx.size ||
+	    idx.entries !=
+	    (uint64_t)(size - (wt_off_t)sizeof(idx)) / sizeof(*ie))
+		goto done;
+
+	WT_ERR(__wt_scr_alloc(session, 1000 * sizeof(*ie), &tmp));
+	for (i = 0, off = sizeof(idx); i < idx.entries; i += n) {
+		n = WT_MIN(idx.entries - i, 1000);
+		WT_ERR(__wt_read(session, fh, off, n * sizeof(*ie), tmp->mem));
+		off += (wt_off_t)(n * sizeof(*ie));
+		for (ie = tmp->mem; ie < (WT_BCACHE_INDEX_ENTRY *)tmp->mem + n;
+		    ++ie)
+			WT_ERR(__bcache_entry_add(session, bcache,
+			    ie->name_hash, (wt_off_t)ie->offset, ie->size,
+			    ie->cksum, (wt_off_t)ie->coff, true));
+	}
+	bcache->woff = (wt_off_t)idx.woff;
+
+done:	WT_ERR(__wt_close(session, &fh));
+
+	/*
+	 * Remove the index: it describes the cache file only until the cache
+	 * is next written, and after a crash we have nothing better.
+	 */
+	WT_ERR(__wt_remove(session, bcache->index_name));
+
+err:	if (fh != NULL)
+		WT_TRET(__wt_close(session, &fh));
+	__wt_scr_free(session, &tmp);
+	return (ret);
+}
+
+/*
+ * __bcache_index_write --
+ *	Save the index for the next time the connection is opened.
+ */
+static int
+__bcache_index_write(WT_SESSION_IMPL *session, WT_BCACHE *bcache)
+{
+	WT_BCACHE_ENTRY *e;
+	WT_BCACHE_INDEX idx;
+	WT_BCACHE_INDEX_ENTRY *ie;
+	WT_DECL_ITEM(tmp);
+	WT_DECL_RET;
+	WT_FH *fh;
+	wt_off_t off;
+	size_t n;
+
+	WT_RET(__wt_scr_alloc(session, 1000 * sizeof(*ie), &tmp));
+	WT_ERR(__wt_open(session, bcache->index_name, true, false, 0, &fh));
+	WT_ERR(__wt_ftruncate(session, fh, 0));
+
+	/* Write the entries oldest first, the header last. */
+	idx.entries = 0;
+	off = sizeof(idx);
+	ie = tmp->mem;
+	n = 0;
+	TAILQ_FOREACH(e, &bcache->qh, q) {
+		if (!e->ready)
+			continue;
+		ie->name_hash = e->name_hash;
+		ie->offset = (uint64_t)e->offset;
+		ie->size = e->size;
+		ie->cksum = e->cksum;
+		ie->coff = (uint64_t)e->coff;
+		++ie;
+		++idx.entries;
+		if (++n == 1000) {
+			WT_ERR(__wt_write(
+			    session, fh, off, n * sizeof(*ie), tmp->mem));
+			off += (wt_off_t)(n * sizeof(*ie));
+			ie = tmp->mem;
+			n = 0;
+		}
+	}
+	if (n != 0)
+		WT_ERR(__wt_write(session, fh, off, n * sizeof(*ie), tmp->mem));
+
+	idx.magic = WT_BCACHE_INDEX_MAGIC;
+	idx.version = WT_BCACHE_INDEX_VERSION;
+	idx.size = (uint64_t)bcache->size;
+	idx.woff = (uint64_t)bcache->woff;
+	WT_ERR(__wt_write(session, fh, 0, sizeof(idx), &idx));
+
+	/* The cache file must be durable before the index naming it is. */
+	WT_ERR(__wt_fsync(session, bcache->fh));
+	WT_ERR(__wt_fsync(session, fh));
+
+err:	WT_TRET(__wt_close(session, &fh));
+	__wt_scr_free(session, &tmp);
+	return (ret);
+}
+
+/*
+ * __wt_bcache_create --
+ *	Open the block cache, if configured.
+ */
+int
+__wt_bcache_create(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_BCACHE *bcache;
+	WT_CONFIG_ITEM cval;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	size_t len;
+	uint32_t i;
+
+	conn = S2C(session);
+
+	WT_RET(__wt_config_gets(session, cfg, "block_cache.size", &cval));
+	if (cval.val == 0 || F_ISSET(conn, WT_CONN_IN_MEMORY))
+		return (0);
+
+	WT_RET(__wt_calloc_one(session, &bcache));
+	bcache->size = (wt_off_t)cval.val;
+
+	/* Size the hash table for 4KB images. */
+	bcache->buckets = (uint32_t)WT_MAX(WT_MIN(
+	    (uint64_t)bcache->size / (4 * WT_KILOBYTE), 4 * WT_MEGABYTE), 64);
+	WT_ERR(__wt_calloc_def(session, bcache->buckets, &bcache->hash));
+	for (i = 0; i < bcache->buckets; ++i)
+		TAILQ_INIT(&bcache->hash[i]);
+	TAILQ_INIT(&bcache->qh);
+	WT_ERR(__wt_spin_init(session, &bcache->lock, "block cache"));
+
+	WT_ERR(__wt_config_gets(session, cfg, "block_cache.path", &cval));
+	len = cval.len + sizeof(".idx");
+	WT_ERR(__wt_calloc_def(session, len, &bcache->index_name));
+	(void)snprintf(bcache->index_name,
+	    len, "%.*s", (int)cval.len, cval.str);
+	WT_ERR(__wt_open(session,
+	    bcache->index_name, true, false, 0, &bcache->fh));
+	(void)snprintf(bcache->index_name,
+	    len, "%.*s.idx", (int)cval.len, cval.str);
+
+	WT_ERR(__bcache_index_read(session, bcache));
+
+	conn->bcache = bcache;
+	return (0);
+
+err:	conn->bcache = bcache;
+	WT_TRET(__wt_bcache_destroy(session, false));
+	return (ret);
+}
+
+/*
+ * __wt_bcache_destroy --
+ *	Close the block cache, optionally saving its index.
+ */
+int
+__wt_bcache_destroy(WT_SESSION_IMPL *session, bool save)
+{
+	WT_BCACHE *bcache;
+	WT_BCACHE_ENTRY *e;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+
+	conn = S2C(session);
+	if ((bcache = conn->bcache) == NULL)
+		return (0);
+	conn->bcache = NULL;
+
+	if (save && bcache->fh != NULL)
+		WT_TRET(__bcache_index_write(session, bcache));
+
+	while ((e = TAILQ_FIRST(&bcache->qh)) != NULL)
+		__bcache_entry_remove(session, bcache, e);
+	if (bcache->fh != NULL)
+		WT_TRET(__wt_close(session, &bcache->fh));
+	__wt_spin_destroy(session, &bcache->lock);
+	__wt_free(session, bcache->hash);
+	__wt_free(session, bcache->index_name);
+	__wt_free(session, bcache);
+	return (ret);
+}
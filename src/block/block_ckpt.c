@@ -252,7 +252,7 @@ __wt_block_checkpoint(WT_SESSION_IMPL *session,
 	} else
 		WT_ERR(__wt_block_write_off(session, block, buf,
 		    &ci->root_offset, &ci->root_size, &ci->root_cksum,
-		    data_cksum, false));
+		    data_cksum, true, false));
 
 	/*
 	 * Checkpoints are potentially reading/writing/merging lots of blocks,
@@ -796,6 +796,141 @@ __wt_block_checkpoint_resolve(WT_SESSION_IMPL *session, WT_BLOCK *block)
 	return (ret);
 }
 
+/*
+ * __ckpt_changes_append --
+ *	Append a file range to a list of changes.
+ */
+static int
+__ckpt_changes_append(WT_SESSION_IMPL *session,
+    WT_ITEM *ranges, size_t *np, wt_off_t off, wt_off_t size)
+{
+	uint64_t *p;
+
+	if (off == WT_BLOCK_INVALID_OFFSET || size == 0)
+		return (0);
+
+	p = ranges->mem;
+	WT_RET(__wt_realloc_def(session, &ranges->memsize, 2 * (*np + 1), &p));
+	ranges->mem = p;
+	p[2 * *np] = (uint64_t)off;
+	p[2 * *np + 1] = (uint64_t)size;
+	++*np;
+	return (0);
+}
+
+/*
+ * __ckpt_changes_compare --
+ *	Qsort function: sort file ranges by offset.
+ */
+static int WT_CDECL
+__ckpt_changes_compare(const void *a, const void *b)
+{
+	uint64_t aoff, boff;
+
+	aoff = *(const uint64_t *)a;
+	boff = *(const uint64_t *)b;
+	return (aoff < boff ? -1 : (aoff > boff ? 1 : 0));
+}
+
+/*
+ * __wt_block_checkpoint_changes --
+ *	Return the file ranges written by the checkpoints following a named
+ * checkpoint: copying them over a copy of the file made at the named
+ * checkpoint brings the copy up to the file's last checkpoint.
+ */
+int
+__wt_block_checkpoint_changes(WT_SESSION_IMPL *session, WT_BLOCK *block,
+    WT_CKPT *ckptbase, const char *name, WT_ITEM *ranges, bool *foundp)
+{
+	WT_BLOCK_CKPT *ci, _ci;
+	WT_CKPT *ckpt, *prev;
+	WT_DECL_RET;
+	WT_EXT *ext;
+	size_t i, n;
+	uint64_t *last, *p;
+	bool later;
+
+	*foundp = false;
+	ranges->size = 0;
+	n = 0;
+
+	WT_CKPT_FOREACH(ckptbase, ckpt)
+		if (strcmp(ckpt->name, name) == 0)
+			break;
+	if (ckpt->name == NULL)
+		return (0);
+	*foundp = true;
+
+	/*
+	 * Every block a later checkpoint references but the named checkpoint
+	 * didn't was allocated after the named checkpoint, and appears on the
+	 * allocation list of a later checkpoint: deleted checkpoints roll their
+	 * allocation lists forward into the next checkpoint, never back into
+	 * the named one.  The blocks holding extent lists are never on an
+	 * allocation list, and deleting a checkpoint rewrites the extent lists
+	 * of the checkpoint that follows it, including the named checkpoint or
+	 * one before it: add the extent lists of every checkpoint.
+	 */
+	ci = &_ci;
+	later = false;
+	for (prev = NULL, ckpt = ckptbase; ckpt->name != NULL; prev = ckpt++) {
+		if (prev != NULL && strcmp(prev->name, name) == 0)
+			later = true;
+
+		/*
+		 * Checkpoints of empty trees have no blocks, checkpoints of
+		 * clean trees share the previous checkpoint's blocks.
+		 */
+		if (ckpt->raw.data == NULL)
+			continue;
+		if (prev != NULL && ckpt->raw.size == prev->raw.size &&
+		    memcmp(ckpt->raw.data, prev->raw.data, ckpt->raw.size) == 0)
+			continue;
+
+		WT_RET(__wt_block_ckpt_init(session, ci, ckpt->name));
+		WT_ERR(__wt_block_buffer_to_ckpt(
+		    session, block, ckpt->raw.data, ci));
+		WT_ERR(__ckpt_changes_append(session, ranges, &n,
+		    ci->alloc.offset, (wt_off_t)ci->alloc.size));
+		WT_ERR(__ckpt_changes_append(session, ranges, &n,
+		    ci->avail.offset, (wt_off_t)ci->avail.size));
+		WT_ERR(__ckpt_changes_append(session, ranges, &n,
+		    ci->discard.offset, (wt_off_t)ci->discard.size));
+		if (later) {
+			WT_ERR(__ckpt_changes_append(session, ranges, &n,
+			    ci->root_offset, (wt_off_t)ci->root_size));
+			WT_ERR(__wt_block_extlist_read(
+			    session, block, &ci->alloc, ci->file_size));
+			WT_EXT_FOREACH(ext, ci->alloc.off)
+				WT_ERR(__ckpt_changes_append(session,
+				    ranges, &n, ext->off, ext->size));
+		}
+		__wt_block_ckpt_destroy(session, ci);
+	}
+
+	/* Sort the ranges and merge any that overlap or abut. */
+	if (n == 0)
+		return (0);
+	p = ranges->mem;
+	qsort(p, n, 2 * sizeof(uint64_t), __ckpt_changes_compare);
+	for (i = 1, last = p; i < n; ++i) {
+		if (p[2 * i] <= last[0] + last[1]) {
+			last[1] = WT_MAX(
+			    last[1], p[2 * i] + p[2 * i + 1] - last[0]);
+			continue;
+		}
+		last += 2;
+		last[0] = p[2 * i];
+		last[1] = p[2 * i + 1];
+	}
+	ranges->data = p;
+	ranges->size = WT_PTRDIFF(last + 2, p);
+	return (0);
+
+err:	__wt_block_ckpt_destroy(session, ci);
+	return (ret);
+}
+
 /*
  * __ckpt_string --
  *	Return a printable string representation of a checkpoint address cookie.
@@ -46,10 +46,12 @@ __wt_block_compact_end(WT_SESSION_IMPL *session, WT_BLOCK *block)
 
 /*
  * __wt_block_compact_skip --
- *	Return if compaction will shrink the file.
+ *	Return if compaction will shrink the file, and optionally, how much
+ * space compaction is expected to reclaim.
  */
 int
-__wt_block_compact_skip(WT_SESSION_IMPL *session, WT_BLOCK *block, bool *skipp)
+__wt_block_compact_skip(WT_SESSION_IMPL *session,
+    WT_BLOCK *block, bool *skipp, wt_off_t *reclaimp)
 {
 	WT_DECL_RET;
 	WT_EXT *ext;
@@ -58,6 +60,8 @@ __wt_block_compact_skip(WT_SESSION_IMPL *session, WT_BLOCK *block, bool *skipp)
 	wt_off_t avail_eighty, avail_ninety, eighty, ninety;
 
 	*skipp = true;				/* Return a default skip. */
+	if (reclaimp != NULL)
+		*reclaimp = 0;
 
 	fh = block->fh;
 
@@ -127,6 +131,15 @@ __wt_block_compact_skip(WT_SESSION_IMPL *session, WT_BLOCK *block, bool *skipp)
 		block->compact_pct_tenths = 1;
 	}
 
+	/*
+	 * Compaction can reclaim at most the available space before the part
+	 * of the file being compacted, and at most that part of the file.
+	 */
+	if (!*skipp && reclaimp != NULL)
+		*reclaimp = WT_MIN(block->compact_pct_tenths == 2 ?
+		    avail_eighty : avail_ninety,
+		    (fh->size / 10) * block->compact_pct_tenths);
+
 err:	__wt_spin_unlock(session, &block->live_lock);
 
 	return (ret);
@@ -1316,8 +1316,8 @@ __wt_block_extlist_write(WT_SESSION_IMPL *session,
 #endif
 
 	/* Write the extent list to disk. */
-	WT_ERR(__wt_block_write_off(session,
-	    block, tmp, &el->offset, &el->size, &el->cksum, true, true));
+	WT_ERR(__wt_block_write_off(session, block,
+	    tmp, &el->offset, &el->size, &el->cksum, true, true, true));
 
 	/*
 	 * Remove the allocated blocks from the system's allocation list, extent
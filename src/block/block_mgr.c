@@ -68,6 +68,18 @@ __bm_checkpoint(WT_BM *bm,
 	    session, bm->block, buf, ckptbase, data_cksum));
 }
 
+/*
+ * __bm_checkpoint_changes --
+ *	Return the file ranges written since a named checkpoint.
+ */
+static int
+__bm_checkpoint_changes(WT_BM *bm, WT_SESSION_IMPL *session,
+    WT_CKPT *ckptbase, const char *name, WT_ITEM *ranges, bool *foundp)
+{
+	return (__wt_block_checkpoint_changes(
+	    session, bm->block, ckptbase, name, ranges, foundp));
+}
+
 /*
  * __bm_sync --
  *	Flush a file to disk.
@@ -194,9 +206,10 @@ __bm_compact_page_skip(WT_BM *bm, WT_SESSION_IMPL *session,
  *	Return if a file can be compacted.
  */
 static int
-__bm_compact_skip(WT_BM *bm, WT_SESSION_IMPL *session, bool *skipp)
+__bm_compact_skip(WT_BM *bm,
+    WT_SESSION_IMPL *session, bool *skipp, wt_off_t *reclaimp)
 {
-	return (__wt_block_compact_skip(session, bm->block, skipp));
+	return (__wt_block_compact_skip(session, bm->block, skipp, reclaimp));
 }
 
 /*
@@ -209,6 +222,19 @@ __bm_compact_end(WT_BM *bm, WT_SESSION_IMPL *session)
 	return (__wt_block_compact_end(session, bm->block));
 }
 
+/*
+ * __bm_first_fit --
+ *	Switch first-fit allocation on or off.
+ */
+static int
+__bm_first_fit(WT_BM *bm, WT_SESSION_IMPL *session, bool on)
+{
+	WT_UNUSED(session);
+
+	__wt_block_configure_first_fit(bm->block, on);
+	return (0);
+}
+
 /*
  * __bm_free --
  *	Free a block of space to the underlying file.
@@ -236,11 +262,11 @@ __bm_stat(WT_BM *bm, WT_SESSION_IMPL *session, WT_DSRC_STATS *stats)
  *	Write a buffer into a block, returning the block's address cookie.
  */
 static int
-__bm_write(WT_BM *bm, WT_SESSION_IMPL *session,
-    WT_ITEM *buf, uint8_t *addr, size_t *addr_sizep, bool data_cksum)
+__bm_write(WT_BM *bm, WT_SESSION_IMPL *session, WT_ITEM *buf,
+    uint8_t *addr, size_t *addr_sizep, bool data_cksum, bool checkpoint_io)
 {
-	return (__wt_block_write(
-	    session, bm->block, buf, addr, addr_sizep, data_cksum));
+	return (__wt_block_write(session, bm->block,
+	    buf, addr, addr_sizep, data_cksum, checkpoint_io));
 }
 
 /*
@@ -287,6 +313,54 @@ __bm_salvage_next(WT_BM *bm,
 	    session, bm->block, addr, addr_sizep, eofp));
 }
 
+/*
+ * __bm_salvage_region --
+ *	Set up a scan of a region of the file.
+ */
+static int
+__bm_salvage_region(WT_BM *bm, WT_SESSION_IMPL *session,
+    u_int region, u_int regions, WT_BLOCK_SLVG_SCAN *scan)
+{
+	return (__wt_block_salvage_region(
+	    session, bm->block, region, regions, scan));
+}
+
+/*
+ * __bm_salvage_region_next --
+ *	Return the next block from a region of the file.
+ */
+static int
+__bm_salvage_region_next(WT_BM *bm, WT_SESSION_IMPL *session,
+    WT_BLOCK_SLVG_SCAN *scan, uint8_t *addr, size_t *addr_sizep, bool *eofp)
+{
+	return (__wt_block_salvage_region_next(
+	    session, bm->block, scan, addr, addr_sizep, eofp));
+}
+
+/*
+ * __bm_salvage_region_valid --
+ *	Inform a region scan a block is valid.
+ */
+static int
+__bm_salvage_region_valid(WT_BM *bm, WT_SESSION_IMPL *session,
+    WT_BLOCK_SLVG_SCAN *scan, uint8_t *addr, size_t addr_size, bool valid)
+{
+	return (__wt_block_salvage_region_valid(
+	    session, bm->block, scan, addr, addr_size, valid));
+}
+
+/*
+ * __bm_salvage_merge --
+ *	Merge a block found by a region scan into the salvage.
+ */
+static int
+__bm_salvage_merge(WT_BM *bm, WT_SESSION_IMPL *session,
+    WT_BLOCK_SLVG_SCAN *scan, uint8_t *addr, size_t addr_size, bool *skipp)
+{
+	return (__wt_block_salvage_merge(
+	    session, bm->block, scan, addr, addr_size, skipp));
+}
+
 /*
  * __bm_salvage_end --
  *	End a block manager salvage.
@@ -342,6 +416,7 @@ __bm_method_set(WT_BM *bm, bool readonly)
 		bm->block_header = __bm_block_header;
 		bm->checkpoint = (int (*)(WT_BM *, WT_SESSION_IMPL *,
 		    WT_ITEM *, WT_CKPT *, bool))__bm_readonly;
+		bm->checkpoint_changes = __bm_checkpoint_changes;
 		bm->checkpoint_load = __bm_checkpoint_load;
 		bm->checkpoint_resolve =
 		    (int (*)(WT_BM *, WT_SESSION_IMPL *))__bm_readonly;
@@ -351,18 +426,31 @@ __bm_method_set(WT_BM *bm, bool readonly)
 		    (int (*)(WT_BM *, WT_SESSION_IMPL *))__bm_readonly;
 		bm->compact_page_skip = (int (*)(WT_BM *, WT_SESSION_IMPL *,
 		    const uint8_t *, size_t, bool *))__bm_readonly;
-		bm->compact_skip = (int (*)
-		    (WT_BM *, WT_SESSION_IMPL *, bool *))__bm_readonly;
+		bm->compact_skip = (int (*)(WT_BM *,
+		    WT_SESSION_IMPL *, bool *, wt_off_t *))__bm_readonly;
 		bm->compact_start =
 		    (int (*)(WT_BM *, WT_SESSION_IMPL *))__bm_readonly;
+		bm->first_fit = (int (*)
+		    (WT_BM *, WT_SESSION_IMPL *, bool))__bm_readonly;
 		bm->free = (int (*)(WT_BM *,
 		    WT_SESSION_IMPL *, const uint8_t *, size_t))__bm_readonly;
 		bm->preload = __wt_bm_preload;
 		bm->read = __wt_bm_read;
 		bm->salvage_end = (int (*)
 		    (WT_BM *, WT_SESSION_IMPL *))__bm_readonly;
+		bm->salvage_merge = (int (*)(WT_BM *, WT_SESSION_IMPL *,
+		    WT_BLOCK_SLVG_SCAN *, uint8_t *, size_t, bool *))
+		    __bm_readonly;
 		bm->salvage_next = (int (*)(WT_BM *, WT_SESSION_IMPL *,
 		    uint8_t *, size_t *, bool *))__bm_readonly;
+		bm->salvage_region = (int (*)(WT_BM *, WT_SESSION_IMPL *,
+		    u_int, u_int, WT_BLOCK_SLVG_SCAN *))__bm_readonly;
+		bm->salvage_region_next = (int (*)(WT_BM *, WT_SESSION_IMPL *,
+		    WT_BLOCK_SLVG_SCAN *, uint8_t *, size_t *, bool *))
+		    __bm_readonly;
+		bm->salvage_region_valid = (int (*)(WT_BM *, WT_SESSION_IMPL *,
+		    WT_BLOCK_SLVG_SCAN *, uint8_t *, size_t, bool))
+		    __bm_readonly;
 		bm->salvage_start = (int (*)
 		    (WT_BM *, WT_SESSION_IMPL *))__bm_readonly;
 		bm->salvage_valid = (int (*)(WT_BM *,
@@ -374,7 +462,7 @@ __bm_method_set(WT_BM *bm, bool readonly)
 		bm->verify_end = __bm_verify_end;
 		bm->verify_start = __bm_verify_start;
 		bm->write = (int (*)(WT_BM *, WT_SESSION_IMPL *,
-		    WT_ITEM *, uint8_t *, size_t *, bool))__bm_readonly;
+		    WT_ITEM *, uint8_t *, size_t *, bool, bool))__bm_readonly;
 		bm->write_size = (int (*)
 		    (WT_BM *, WT_SESSION_IMPL *, size_t *))__bm_readonly;
 	} else {
@@ -382,6 +470,7 @@ __bm_method_set(WT_BM *bm, bool readonly)
 		bm->addr_string = __bm_addr_string;
 		bm->block_header = __bm_block_header;
 		bm->checkpoint = __bm_checkpoint;
+		bm->checkpoint_changes = __bm_checkpoint_changes;
 		bm->checkpoint_load = __bm_checkpoint_load;
 		bm->checkpoint_resolve = __bm_checkpoint_resolve;
 		bm->checkpoint_unload = __bm_checkpoint_unload;
@@ -390,11 +479,16 @@ __bm_method_set(WT_BM *bm, bool readonly)
 		bm->compact_page_skip = __bm_compact_page_skip;
 		bm->compact_skip = __bm_compact_skip;
 		bm->compact_start = __bm_compact_start;
+		bm->first_fit = __bm_first_fit;
 		bm->free = __bm_free;
 		bm->preload = __wt_bm_preload;
 		bm->read = __wt_bm_read;
 		bm->salvage_end = __bm_salvage_end;
+		bm->salvage_merge = __bm_salvage_merge;
 		bm->salvage_next = __bm_salvage_next;
+		bm->salvage_region = __bm_salvage_region;
+		bm->salvage_region_next = __bm_salvage_region_next;
+		bm->salvage_region_valid = __bm_salvage_region_valid;
 		bm->salvage_start = __bm_salvage_start;
 		bm->salvage_valid = __bm_salvage_valid;
 		bm->stat = __bm_stat;
@@ -21,6 +21,9 @@ __wt_block_manager_truncate(
 	WT_DECL_RET;
 	WT_FH *fh;
 
+	/* Discard any of the file's blocks from the block cache. */
+	__wt_bcache_discard(session, filename);
+
 	/* Open the underlying file handle. */
 	WT_RET(__wt_open(
 	    session, filename, false, false, WT_FILE_TYPE_DATA, &fh));
@@ -58,6 +61,12 @@ __wt_block_manager_create(
 	bool exists;
 	char *path;
 
+	/*
+	 * Discard any blocks from a previous file with the same name from the
+	 * block cache.
+	 */
+	__wt_bcache_discard(session, filename);
+
 	/*
 	 * Create the underlying file and open a handle.
 	 *
@@ -119,6 +128,73 @@ err:	__wt_scr_free(session, &tmp);
 	return (ret);
 }
 
+/*
+ * __block_prefetch_range --
+ *	Ask the system to read a range of a file in the background.
+ */
+static int
+__block_prefetch_range(
+    WT_SESSION_IMPL *session, WT_FH *fh, wt_off_t offset, uint32_t size)
+{
+	WT_DECL_RET;
+
+	ret = EINVAL;		/* Play games due to conditional compilation */
+
+#ifdef HAVE_POSIX_FADVISE
+	ret = posix_fadvise(
+	    fh->fd, offset, (wt_off_t)size, POSIX_FADV_WILLNEED);
+#endif
+	if (ret != 0) {
+		WT_DECL_ITEM(tmp);
+		WT_RET(__wt_scr_alloc(session, size, &tmp));
+		ret = __wt_read(session, fh, offset, size, tmp->mem);
+		__wt_scr_free(session, &tmp);
+	}
+	return (ret);
+}
+
+/*
+ * __wt_block_manager_prefetch --
+ *	Prefetch the blocks read when a file is opened at a checkpoint: the
+ * description block, the checkpoint's root page and its avail list.
+ */
+int
+__wt_block_manager_prefetch(WT_SESSION_IMPL *session,
+    const char *filename, uint32_t allocsize,
+    const uint8_t *addr, size_t addr_size)
+{
+	WT_BLOCK block;
+	WT_BLOCK_CKPT ci;
+	WT_DECL_RET;
+	WT_FH *fh;
+
+	/* Cracking the checkpoint cookie only requires the allocation size. */
+	WT_CLEAR(block);
+	block.allocsize = allocsize;
+
+	/*
+	 * The file handle is shared: if the file is opened while we hold it,
+	 * opening it is cheap.
+	 */
+	WT_RET(__wt_open(
+	    session, filename, false, false, WT_FILE_TYPE_DATA, &fh));
+
+	WT_ERR(__block_prefetch_range(session, fh, (wt_off_t)0, allocsize));
+
+	if (addr != NULL && addr_size != 0) {
+		WT_ERR(__wt_block_buffer_to_ckpt(session, &block, addr, &ci));
+		if (ci.root_offset != WT_BLOCK_INVALID_OFFSET)
+			WT_ERR(__block_prefetch_range(
+			    session, fh, ci.root_offset, ci.root_size));
+		if (ci.avail.offset != WT_BLOCK_INVALID_OFFSET)
+			WT_ERR(__block_prefetch_range(
+			    session, fh, ci.avail.offset, ci.avail.size));
+	}
+
+err:	WT_TRET(__wt_close(session, &fh));
+	return (ret);
+}
+
 /*
  * __block_destroy --
  *	Destroy a block handle.
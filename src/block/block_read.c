@@ -164,6 +164,7 @@ __wt_block_read_off(WT_SESSION_IMPL *session, WT_BLOCK *block,
 	WT_BLOCK_HEADER *blk;
 	size_t bufsize;
 	uint32_t page_cksum;
+	bool bcache, found;
 
 	WT_RET(__wt_verbose(session, WT_VERB_READ,
 	    "off %" PRIuMAX ", size %" PRIu32 ", cksum %" PRIu32,
@@ -188,6 +189,22 @@ __wt_block_read_off(WT_SESSION_IMPL *session, WT_BLOCK *block,
 		bufsize = WT_MAX(size, buf->memsize + 10);
 	}
 	WT_RET(__wt_buf_init(session, buf, bufsize));
+
+	/*
+	 * Check the block cache, unless verifying the file: verify must read
+	 * the data file.  Blocks read from the data file are added to the block
+	 * cache once their checksum is confirmed, unless read while holding the
+	 * checkpoint lock: those blocks (for example, the extent lists merged
+	 * by a checkpoint) aren't likely to be read again soon.
+	 */
+	bcache = S2C(session)->bcache != NULL && !block->verify;
+	if (bcache) {
+		__wt_bcache_read(
+		    session, block, buf, offset, size, cksum, &found);
+		if (found)
+			return (0);
+	}
+
 	WT_RET(__wt_read(session, block->fh, offset, size, buf->mem));
 	buf->size = size;
 
@@ -197,8 +214,13 @@ __wt_block_read_off(WT_SESSION_IMPL *session, WT_BLOCK *block,
 		page_cksum = __wt_cksum(buf->mem,
 		    F_ISSET(blk, WT_BLOCK_DATA_CKSUM) ?
 		    size : WT_BLOCK_COMPRESS_SKIP);
-		if (page_cksum == cksum)
+		if (page_cksum == cksum) {
+			if (bcache &&
+			    !F_ISSET(session, WT_SESSION_LOCKED_CHECKPOINT))
+				__wt_bcache_insert(session,
+				    block, buf->mem, offset, size, cksum);
 			return (0);
+		}
 
 		if (!F_ISSET(session, WT_SESSION_QUIET_CORRUPT_FILE))
 			__wt_errx(session,
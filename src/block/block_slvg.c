@@ -88,6 +88,45 @@ __wt_block_offset_invalid(WT_BLOCK *block, wt_off_t offset, uint32_t size)
 	return (false);
 }
 
+/*
+ * __block_salvage_probe --
+ *	Return if there's a possible block at a file offset.
+ */
+static int
+__block_salvage_probe(WT_SESSION_IMPL *session, WT_BLOCK *block,
+    WT_ITEM *tmp, wt_off_t offset, uint32_t *sizep, uint32_t *cksump,
+    bool *foundp)
+{
+	WT_BLOCK_HEADER *blk;
+	uint32_t cksum, size;
+
+	*foundp = false;
+
+	/*
+	 * Read the start of a possible page (an allocation-size block),
+	 * and get a page length from it.
+	 */
+	WT_RET(__wt_read(
+	    session, block->fh, offset, (size_t)block->allocsize, tmp->mem));
+	blk = WT_BLOCK_HEADER_REF(tmp->mem);
+	size = blk->disk_size;
+	cksum = blk->cksum;
+
+	/*
+	 * Check the block size: if it's not insane, read the block.
+	 * Reading the block validates any checksum; if reading the
+	 * block succeeds, return its address as a possible page.
+	 */
+	if (!__wt_block_offset_invalid(block, offset, size) &&
+	    __wt_block_read_off(
+	    session, block, tmp, offset, size, cksum) == 0) {
+		*sizep = size;
+		*cksump = cksum;
+		*foundp = true;
+	}
+	return (0);
+}
+
 /*
  * __wt_block_salvage_next --
  *	Return the address for the next potential block from the file.
@@ -96,22 +135,20 @@ int
 __wt_block_salvage_next(WT_SESSION_IMPL *session,
     WT_BLOCK *block, uint8_t *addr, size_t *addr_sizep, bool *eofp)
 {
-	WT_BLOCK_HEADER *blk;
 	WT_DECL_ITEM(tmp);
 	WT_DECL_RET;
-	WT_FH *fh;
 	wt_off_t max, offset;
 	uint32_t allocsize, cksum, size;
 	uint8_t *endp;
+	bool found;
 
 	*eofp = 0;
 
-	fh = block->fh;
 	allocsize = block->allocsize;
 	WT_ERR(__wt_scr_alloc(session, allocsize, &tmp));
 
 	/* Read through the file, looking for pages. */
-	for (max = fh->size;;) {
+	for (max = block->fh->size;;) {
 		offset = block->slvg_off;
 		if (offset >= max) {			/* Check eof. */
 			*eofp = 1;
@@ -119,25 +156,13 @@ __wt_block_salvage_next(WT_SESSION_IMPL *session,
 		}
 
 		/*
-		 * Read the start of a possible page (an allocation-size block),
-		 * and get a page length from it.  Move to the next allocation
-		 * sized boundary, we'll never consider this one again.
+		 * If there's no block at this offset, move to the next
+		 * allocation sized boundary, we'll never consider this one
+		 * again.
 		 */
-		WT_ERR(__wt_read(
-		    session, fh, offset, (size_t)allocsize, tmp->mem));
-		blk = WT_BLOCK_HEADER_REF(tmp->mem);
-		size = blk->disk_size;
-		cksum = blk->cksum;
-
-		/*
-		 * Check the block size: if it's not insane, read the block.
-		 * Reading the block validates any checksum; if reading the
-		 * block succeeds, return its address as a possible page,
-		 * otherwise, move past it.
-		 */
-		if (!__wt_block_offset_invalid(block, offset, size) &&
-		    __wt_block_read_off(
-		    session, block, tmp, offset, size, cksum) == 0)
+		WT_ERR(__block_salvage_probe(
+		    session, block, tmp, offset, &size, &cksum, &found));
+		if (found)
 			break;
 
 		/* Free the allocation-size block. */
@@ -189,3 +214,164 @@ __wt_block_salvage_valid(WT_SESSION_IMPL *session,
 
 	return (0);
 }
+
+/*
+ * __wt_block_salvage_region --
+ *	Set up a scan of one of a set of equally-sized regions of the file.
+ */
+int
+__wt_block_salvage_region(WT_SESSION_IMPL *session,
+    WT_BLOCK *block, u_int region, u_int regions, WT_BLOCK_SLVG_SCAN *scan)
+{
+	uint64_t units;
+	uint32_t allocsize;
+
+	WT_UNUSED(session);
+
+	/*
+	 * Regions start on allocation-size boundaries, after the description
+	 * information in the file's first block; the last region ends at the
+	 * end of the file.
+	 */
+	allocsize = block->allocsize;
+	units = block->fh->size <= allocsize ?
+	    0 : (uint64_t)(block->fh->size - allocsize) / allocsize;
+	scan->start = allocsize +
+	    (wt_off_t)((units * region) / regions) * allocsize;
+	scan->stop = allocsize +
+	    (wt_off_t)((units * (region + 1)) / regions) * allocsize;
+	scan->offset = scan->readahead = scan->start;
+	return (0);
+}
+
+/*
+ * __wt_block_salvage_region_next --
+ *	Return the address for the next potential block from a region of the
+ * file.  Unlike a sequential salvage, nothing is freed: the region scans
+ * overlap if a block crosses a region boundary, the blocks are resolved as
+ * the regions are merged.
+ */
+int
+__wt_block_salvage_region_next(WT_SESSION_IMPL *session, WT_BLOCK *block,
+    WT_BLOCK_SLVG_SCAN *scan, uint8_t *addr, size_t *addr_sizep, bool *eofp)
+{
+	WT_DECL_ITEM(tmp);
+	WT_DECL_RET;
+	wt_off_t offset;
+	uint32_t allocsize, cksum, size;
+	uint8_t *endp;
+	bool found;
+
+	*eofp = 0;
+
+	allocsize = block->allocsize;
+	WT_ERR(__wt_scr_alloc(session, allocsize, &tmp));
+
+	for (;;) {
+		offset = scan->offset;
+		if (offset >= scan->stop) {	/* Check end of region. */
+			*eofp = 1;
+			goto done;
+		}
+
+		/*
+		 * The threads scanning regions of the file share a file handle,
+		 * the operating system won't recognize any of them as reading
+		 * sequentially.  Schedule read-ahead for the region explicitly,
+		 * staying a window ahead of the scan.
+		 */
+#define	WT_SALVAGE_READAHEAD	(4 * WT_MEGABYTE)
+#ifdef HAVE_POSIX_FADVISE
+		if (scan->readahead < scan->stop &&
+		    offset + WT_SALVAGE_READAHEAD > scan->readahead) {
+			scan->readahead = WT_MAX(scan->readahead, offset);
+			(void)posix_fadvise(block->fh->fd, scan->readahead,
+			    WT_MIN(WT_SALVAGE_READAHEAD,
+			    scan->stop - scan->readahead), POSIX_FADV_WILLNEED);
+			scan->readahead += WT_SALVAGE_READAHEAD;
+		}
+#endif
+
+		WT_ERR(__block_salvage_probe(
+		    session, block, tmp, offset, &size, &cksum, &found));
+		if (found)
+			break;
+		scan->offset += allocsize;
+	}
+
+	/* Re-create the address cookie that should reference this block. */
+	endp = addr;
+	WT_ERR(__wt_block_addr_to_buffer(block, &endp, offset, size, cksum));
+	*addr_sizep = WT_PTRDIFF(endp, addr);
+
+done:
+err:	__wt_scr_free(session, &tmp);
+	return (ret);
+}
+
+/*
+ * __wt_block_salvage_region_valid --
+ *	Let a region scan know if a block is valid.
+ */
+int
+__wt_block_salvage_region_valid(WT_SESSION_IMPL *session, WT_BLOCK *block,
+    WT_BLOCK_SLVG_SCAN *scan, uint8_t *addr, size_t addr_size, bool valid)
+{
+	wt_off_t offset;
+	uint32_t size, cksum;
+
+	WT_UNUSED(session);
+	WT_UNUSED(addr_size);
+
+	/*
+	 * Crack the cookie.
+	 * If the upper layer took the block, move past it; if the upper layer
+	 * rejected the block, move past an allocation size chunk.
+	 */
+	WT_RET(__wt_block_buffer_to_addr(block, addr, &offset, &size, &cksum));
+	scan->offset = offset + (valid ? size : block->allocsize);
+	return (0);
+}
+
+/*
+ * __wt_block_salvage_merge --
+ *	Merge a block the upper layer took from a region scan into the salvage,
+ * or with a NULL address, the end of the region.  Blocks starting inside an
+ * earlier block are skipped, anything between blocks is freed.
+ */
+int
+__wt_block_salvage_merge(WT_SESSION_IMPL *session, WT_BLOCK *block,
+    WT_BLOCK_SLVG_SCAN *scan, uint8_t *addr, size_t addr_size, bool *skipp)
+{
+	wt_off_t offset;
+	uint32_t size, cksum;
+
+	WT_UNUSED(addr_size);
+
+	*skipp = false;
+
+	if (addr == NULL) {
+		offset = scan->stop;
+		size = 0;
+	} else {
+		WT_RET(__wt_block_buffer_to_addr(
+		    block, addr, &offset, &size, &cksum));
+		if (offset < block->slvg_off) {
+			*skipp = true;
+			return (0);
+		}
+	}
+
+	if (offset > block->slvg_off) {
+		WT_RET(__wt_verbose(session, WT_VERB_SALVAGE,
+		    "skipping %" PRIuMAX "B at file offset %" PRIuMAX,
+		    (uintmax_t)(offset - block->slvg_off),
+		    (uintmax_t)block->slvg_off));
+		WT_RET(__wt_block_off_free(session,
+		    block, block->slvg_off, offset - block->slvg_off));
+		block->slvg_off = offset;
+	}
+	if (addr != NULL)
+		block->slvg_off = offset + size;
+	return (0);
+}
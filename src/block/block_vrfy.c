@@ -317,6 +317,7 @@ int
 __wt_block_verify_addr(WT_SESSION_IMPL *session,
     WT_BLOCK *block, const uint8_t *addr, size_t addr_size)
 {
+	WT_DECL_RET;
 	wt_off_t offset;
 	uint32_t cksum, size;
 
@@ -325,8 +326,15 @@ __wt_block_verify_addr(WT_SESSION_IMPL *session,
 	/* Crack the cookie. */
 	WT_RET(__wt_block_buffer_to_addr(block, addr, &offset, &size, &cksum));
 
+	/*
+	 * The btree layer may verify a checkpoint's subtrees in parallel,
+	 * serialize updates of the fragment lists.  Verify has the handle
+	 * exclusively, there's no contention for the live lock otherwise.
+	 */
+	__wt_spin_lock(session, &block->live_lock);
+
 	/* Add to the per-file list. */ 
-	WT_RET(
+	WT_ERR(
 	    __verify_filefrag_add(session, block, NULL, offset, size, false));
 
 	/*
@@ -344,9 +352,10 @@ __wt_block_verify_addr(WT_SESSION_IMPL *session,
 	 *
 	 * Add the block to the per-checkpoint list.
 	 */
-	WT_RET(__verify_ckptfrag_add(session, block, offset, size));
+	WT_ERR(__verify_ckptfrag_add(session, block, offset, size));
 
-	return (0);
+err:	__wt_spin_unlock(session, &block->live_lock);
+	return (ret);
 }
 
 /*
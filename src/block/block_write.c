@@ -171,15 +171,15 @@ __wt_block_write_size(WT_SESSION_IMPL *session, WT_BLOCK *block, size_t *sizep)
  *	Write a buffer into a block, returning the block's address cookie.
  */
 int
-__wt_block_write(WT_SESSION_IMPL *session, WT_BLOCK *block,
-    WT_ITEM *buf, uint8_t *addr, size_t *addr_sizep, bool data_cksum)
+__wt_block_write(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf,
+    uint8_t *addr, size_t *addr_sizep, bool data_cksum, bool checkpoint_io)
 {
 	wt_off_t offset;
 	uint32_t size, cksum;
 	uint8_t *endp;
 
-	WT_RET(__wt_block_write_off(
-	    session, block, buf, &offset, &size, &cksum, data_cksum, false));
+	WT_RET(__wt_block_write_off(session, block, buf,
+	    &offset, &size, &cksum, data_cksum, checkpoint_io, false));
 
 	endp = addr;
 	WT_RET(__wt_block_addr_to_buffer(block, &endp, offset, size, cksum));
@@ -191,12 +191,13 @@ __wt_block_write(WT_SESSION_IMPL *session, WT_BLOCK *block,
 /*
  * __wt_block_write_off --
  *	Write a buffer into a block, returning the block's offset, size and
- * checksum.
+ * checksum.  Blocks written by checkpoints aren't added to the block cache,
+ * they're rarely read before they're replaced.
  */
 int
 __wt_block_write_off(WT_SESSION_IMPL *session, WT_BLOCK *block,
     WT_ITEM *buf, wt_off_t *offsetp, uint32_t *sizep, uint32_t *cksump,
-    bool data_cksum, bool caller_locked)
+    bool data_cksum, bool checkpoint_io, bool caller_locked)
 {
 	WT_BLOCK_HEADER *blk;
 	WT_DECL_RET;
@@ -297,6 +298,15 @@ __wt_block_write_off(WT_SESSION_IMPL *session, WT_BLOCK *block,
 		WT_RET(ret);
 	}
 
+	/* Optionally add the block to the block cache. */
+	if (S2C(session)->bcache != NULL) {
+		if (checkpoint_io)
+			WT_STAT_FAST_CONN_INCR(session, block_cache_bypass);
+		else
+			__wt_bcache_insert(session, block, buf->mem,
+			    offset, (uint32_t)align_size, blk->cksum);
+	}
+
 #ifdef HAVE_SYNC_FILE_RANGE
 	/*
 	 * Optionally schedule writes for dirty pages in the system buffer
@@ -20,6 +20,7 @@ __compact_rewrite(WT_SESSION_IMPL *session, WT_REF *ref, bool *skipp)
 	WT_PAGE *page;
 	WT_PAGE_MODIFY *mod;
 	size_t addr_size;
+	uint32_t i;
 	const uint8_t *addr;
 
 	*skipp = true;					/* Default skip. */
@@ -63,6 +64,26 @@ __compact_rewrite(WT_SESSION_IMPL *session, WT_REF *ref, bool *skipp)
 		WT_TRET(__wt_fair_unlock(session, &page->page_lock));
 		WT_RET(ret);
 	}
+
+	/*
+	 * If the page was written as a delta, test the blocks in the page's
+	 * delta chain as well.  A page that's rewritten must be written as a
+	 * full image, otherwise it would continue to reference its chain.
+	 */
+	if (mod != NULL && mod->delta_chain_entries != 0) {
+		WT_RET(__wt_fair_lock(session, &page->page_lock));
+
+		for (i = 0; *skipp && i < mod->delta_chain_entries; ++i)
+			if ((ret = bm->compact_page_skip(bm, session,
+			    mod->delta_chain[i].addr,
+			    mod->delta_chain[i].size, skipp)) != 0)
+				break;
+		if (!*skipp)
+			mod->delta_consolidate = 1;
+
+		WT_TRET(__wt_fair_unlock(session, &page->page_lock));
+		WT_RET(ret);
+	}
 	return (0);
 }
 
@@ -75,6 +96,7 @@ __wt_compact(WT_SESSION_IMPL *session, const char *cfg[])
 {
 	WT_BM *bm;
 	WT_BTREE *btree;
+	WT_COMPACT *compact;
 	WT_DECL_RET;
 	WT_REF *ref;
 	bool block_manager_begin, skip;
@@ -88,15 +110,6 @@ __wt_compact(WT_SESSION_IMPL *session, const char *cfg[])
 
 	WT_STAT_FAST_DATA_INCR(session, session_compact);
 
-	/*
-	 * Check if compaction might be useful -- the API layer will quit trying
-	 * to compact the data source if we make no progress, set a flag if the
-	 * block layer thinks compaction is possible.
-	 */
-	WT_RET(bm->compact_skip(bm, session, &skip));
-	if (skip)
-		return (0);
-
 	/*
 	 * Reviewing in-memory pages requires looking at page reconciliation
 	 * results, because we care about where the page is stored now, not
@@ -122,6 +135,17 @@ __wt_compact(WT_SESSION_IMPL *session, const char *cfg[])
 	WT_ERR(bm->compact_start(bm, session));
 	block_manager_begin = true;
 
+	/*
+	 * Check if compaction might be useful -- the API layer will quit trying
+	 * to compact the data source if we make no progress, set a flag if the
+	 * block layer thinks compaction is possible.  Check after starting
+	 * compaction, starting compaction resets the part of the file the
+	 * check chooses to compact.
+	 */
+	WT_ERR(bm->compact_skip(bm, session, &skip, NULL));
+	if (skip)
+		goto err;
+
 	/* Walk the tree reviewing pages to see if they should be re-written. */
 	for (;;) {
 		/*
@@ -145,6 +169,19 @@ __wt_compact(WT_SESSION_IMPL *session, const char *cfg[])
 		__wt_page_modify_set(session, ref->page);
 
 		WT_STAT_FAST_DATA_INCR(session, btree_compact_rewrite);
+
+		/*
+		 * Background compaction limits the bytes rewritten by a pass,
+		 * quit when the limit is reached.
+		 */
+		if ((compact = session->compact) != NULL) {
+			compact->bytes += ref->page->dsk == NULL ?
+			    ref->page->memory_footprint :
+			    ref->page->dsk->mem_size;
+			if (compact->max_bytes != 0 &&
+			    compact->bytes >= compact->max_bytes)
+				break;
+		}
 	}
 
 err:	if (ref != NULL)
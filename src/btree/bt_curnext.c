@@ -527,6 +527,9 @@ __wt_btcur_next(WT_CURSOR_BTREE *cbt, bool truncating)
 			__wt_page_evict_soon(page);
 		cbt->page_deleted_count = 0;
 
+		/* Any run of insert list entries belongs to the old page. */
+		cbt->prev_run_slot = 0;
+
 		WT_ERR(__wt_tree_walk(session, &cbt->ref, NULL, flags));
 		WT_ERR_TEST(cbt->ref == NULL, WT_NOTFOUND);
 	}
@@ -28,6 +28,60 @@
 #define	PREV_INS(cbt, i)						\
 	PREV_ITEM((cbt)->ins_head, (cbt)->ins_stack[(i)], (i))
 
+/*
+ * Reverse iteration materializes a run of insert list entries starting at the
+ * current entry's predecessor at this skiplist depth, with skiplist entries
+ * promoted with 1-in-4 probability, that's about 64 entries per search.
+ */
+#define	WT_SKIP_PREV_RUN_DEPTH	3
+
+/*
+ * __cursor_skip_prev_run --
+ *	Build a run of the insert list entries preceding the current entry and
+ * move back to the last of them.  The search stack must point at the current
+ * entry.  Clears the moved flag if there's nothing to materialize.
+ */
+static inline int
+__cursor_skip_prev_run(WT_CURSOR_BTREE *cbt, bool *movedp)
+{
+	WT_INSERT *current, *ins;
+	WT_SESSION_IMPL *session;
+	uint32_t n;
+
+	*movedp = false;
+
+	session = (WT_SESSION_IMPL *)cbt->iface.session;
+	current = cbt->ins;
+
+	/*
+	 * Start at the predecessor at the run depth: if the stack doesn't have
+	 * one, the current entry is close to the start of the list.  Walk the
+	 * bottom level from there, collecting entries until we reach the
+	 * current entry.  If we don't reach it, there's no run to build, the
+	 * caller falls back to stepping the search stack.
+	 */
+	if ((ins = PREV_INS(cbt, WT_SKIP_PREV_RUN_DEPTH)) == NULL)
+		ins = cbt->ins_head->head[0];
+	for (n = 0; ins != NULL && ins != current; ins = ins->next[0]) {
+		WT_RET(__wt_realloc_def(session,
+		    &cbt->prev_run_allocated, n + 2, &cbt->prev_run));
+		cbt->prev_run[n++] = ins;
+	}
+	if (ins == NULL || n == 0)
+		return (0);
+	cbt->prev_run[n] = current;
+
+	/*
+	 * Move to the last entry of the run.  The search stack still points at
+	 * the entry following the cursor's new position, which is where the
+	 * stack-based code expects it to be.
+	 */
+	cbt->prev_run_slot = n - 1;
+	cbt->ins = cbt->prev_run[n - 1];
+	*movedp = true;
+	return (0);
+}
+
 /*
  * __cursor_skip_prev --
  *	Move back one position in a skip list stack (aka "finger").
@@ -39,9 +93,30 @@ __cursor_skip_prev(WT_CURSOR_BTREE *cbt)
 	WT_ITEM key;
 	WT_SESSION_IMPL *session;
 	int i;
+	bool moved;
 
 	session = (WT_SESSION_IMPL *)cbt->iface.session;
 
+	/*
+	 * If the cursor is positioned in a run of insert list entries, step
+	 * back through the run.  Entries are never removed from an insert list
+	 * while we hold the page, so the only thing that can change is a new
+	 * entry being inserted between the run's entries.  If the previous
+	 * entry in the run still links to the current entry, nothing has been
+	 * inserted between them and the previous entry is our predecessor.
+	 */
+	current = cbt->ins;
+	if (cbt->prev_run_slot > 0 &&
+	    cbt->prev_run[cbt->prev_run_slot] == current) {
+		ins = cbt->prev_run[cbt->prev_run_slot - 1];
+		if (ins->next[0] == current) {
+			--cbt->prev_run_slot;
+			cbt->ins = ins;
+			return (0);
+		}
+	}
+	cbt->prev_run_slot = 0;
+
 restart:
 	/*
 	 * If the search stack does not point at the current item, fill it in
@@ -58,6 +133,14 @@ restart:
 			    WT_INSERT_RECNO(current));
 	}
 
+	/*
+	 * We have a search stack, build a run of the preceding entries so
+	 * subsequent steps don't need to search.
+	 */
+	WT_RET(__cursor_skip_prev_run(cbt, &moved));
+	if (moved)
+		return (0);
+
 	/*
 	 * Find the first node up the search stack that does not move.
 	 *
@@ -615,6 +698,9 @@ __wt_btcur_prev(WT_CURSOR_BTREE *cbt, bool truncating)
 			__wt_page_evict_soon(page);
 		cbt->page_deleted_count = 0;
 
+		/* Any run of insert list entries belongs to the old page. */
+		cbt->prev_run_slot = 0;
+
 		WT_ERR(__wt_tree_walk(session, &cbt->ref, NULL, flags));
 		WT_ERR_TEST(cbt->ref == NULL, WT_NOTFOUND);
 	}
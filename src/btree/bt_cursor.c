@@ -291,6 +291,7 @@ __wt_btcur_reset(WT_CURSOR_BTREE *cbt)
 int
 __wt_btcur_search(WT_CURSOR_BTREE *cbt)
 {
+	struct timespec start;
 	WT_BTREE *btree;
 	WT_CURSOR *cursor;
 	WT_DECL_RET;
@@ -305,6 +306,7 @@ __wt_btcur_search(WT_CURSOR_BTREE *cbt)
 
 	WT_STAT_FAST_CONN_INCR(session, cursor_search);
 	WT_STAT_FAST_DATA_INCR(session, cursor_search);
+	WT_STAT_LATENCY_START(session, start);
 
 	/*
 	 * If we have a page pinned, search it; if we don't have a page pinned,
@@ -346,6 +348,7 @@ __wt_btcur_search(WT_CURSOR_BTREE *cbt)
 
 err:	if (ret != 0)
 		WT_TRET(__cursor_reset(cbt));
+	WT_STAT_LATENCY_CONN_DATA(session, latency_cursor_search, start);
 	return (ret);
 }
 
@@ -468,6 +471,7 @@ err:	if (ret != 0)
 int
 __wt_btcur_insert(WT_CURSOR_BTREE *cbt)
 {
+	struct timespec start;
 	WT_BTREE *btree;
 	WT_CURSOR *cursor;
 	WT_DECL_RET;
@@ -481,6 +485,7 @@ __wt_btcur_insert(WT_CURSOR_BTREE *cbt)
 	WT_STAT_FAST_DATA_INCR(session, cursor_insert);
 	WT_STAT_FAST_DATA_INCRV(session,
 	    cursor_insert_bytes, cursor->key.size + cursor->value.size);
+	WT_STAT_LATENCY_START(session, start);
 
 	if (btree->type == BTREE_ROW)
 		WT_RET(__cursor_size_chk(session, &cursor->key));
@@ -555,6 +560,7 @@ err:	if (ret == WT_RESTART) {
 		WT_TRET(__curfile_leave(cbt));
 	if (ret != 0)
 		WT_TRET(__cursor_reset(cbt));
+	WT_STAT_LATENCY_CONN_DATA(session, latency_cursor_insert, start);
 	return (ret);
 }
 
@@ -641,6 +647,7 @@ err:	if (ret == WT_RESTART) {
 int
 __wt_btcur_remove(WT_CURSOR_BTREE *cbt)
 {
+	struct timespec start;
 	WT_BTREE *btree;
 	WT_CURSOR *cursor;
 	WT_DECL_RET;
@@ -653,6 +660,7 @@ __wt_btcur_remove(WT_CURSOR_BTREE *cbt)
 	WT_STAT_FAST_CONN_INCR(session, cursor_remove);
 	WT_STAT_FAST_DATA_INCR(session, cursor_remove);
 	WT_STAT_FAST_DATA_INCRV(session, cursor_remove_bytes, cursor->key.size);
+	WT_STAT_LATENCY_START(session, start);
 
 retry:	WT_RET(__cursor_func_init(cbt, true));
 
@@ -716,6 +724,7 @@ err:	if (ret == WT_RESTART) {
 	if (ret != 0)
 		WT_TRET(__cursor_reset(cbt));
 
+	WT_STAT_LATENCY_CONN_DATA(session, latency_cursor_remove, start);
 	return (ret);
 }
 
@@ -726,6 +735,7 @@ err:	if (ret == WT_RESTART) {
 int
 __wt_btcur_update(WT_CURSOR_BTREE *cbt)
 {
+	struct timespec start;
 	WT_BTREE *btree;
 	WT_CURSOR *cursor;
 	WT_DECL_RET;
@@ -739,6 +749,7 @@ __wt_btcur_update(WT_CURSOR_BTREE *cbt)
 	WT_STAT_FAST_DATA_INCR(session, cursor_update);
 	WT_STAT_FAST_DATA_INCRV(
 	    session, cursor_update_bytes, cursor->value.size);
+	WT_STAT_LATENCY_START(session, start);
 
 	if (btree->type == BTREE_ROW)
 		WT_RET(__cursor_size_chk(session, &cursor->key));
@@ -811,6 +822,7 @@ err:	if (ret == WT_RESTART) {
 
 	if (ret != 0)
 		WT_TRET(__cursor_reset(cbt));
+	WT_STAT_LATENCY_CONN_DATA(session, latency_cursor_update, start);
 	return (ret);
 }
 
@@ -1192,6 +1204,7 @@ __wt_btcur_close(WT_CURSOR_BTREE *cbt, bool lowlevel)
 
 	__wt_buf_free(session, &cbt->_row_key);
 	__wt_buf_free(session, &cbt->_tmp);
+	__wt_free(session, cbt->prev_run);
 
 	return (ret);
 }
@@ -331,6 +331,7 @@ __wt_debug_disk(
 		/* FALLTHROUGH */
 	case WT_PAGE_ROW_INT:
 	case WT_PAGE_ROW_LEAF:
+	case WT_PAGE_ROW_LEAF_DELTA:
 		__dmsg(ds, ", entries %" PRIu32, dsk->u.entries);
 		break;
 	case WT_PAGE_OVFL:
@@ -362,6 +363,7 @@ __wt_debug_disk(
 	case WT_PAGE_COL_VAR:
 	case WT_PAGE_ROW_INT:
 	case WT_PAGE_ROW_LEAF:
+	case WT_PAGE_ROW_LEAF_DELTA:
 		ret = __debug_dsk_cell(ds, dsk);
 		break;
 	default:
@@ -0,0 +1,379 @@
+/*-
+ * Copyright (c) 2014-2015 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * Row-store leaf page deltas.
+ *
+ * When a row-store leaf page with few changes is reconciled, reconciliation
+ * can write a delta instead of a full page image: a WT_PAGE_ROW_LEAF_DELTA
+ * block whose first cell is the address of the page's previous block, followed
+ * by a key/value pair for each record changed since that block was written (a
+ * WT_CELL_DEL cell takes the place of the value of a removed record).  Keys on
+ * delta pages are never prefix-compressed, and delta pages never reference
+ * overflow items.
+ *
+ * The previous block is either another delta or a full row-store leaf page, the
+ * base of the chain.  When a delta is read, the chain is followed back to its
+ * base and the deltas are applied, oldest first, building a full row-store leaf
+ * page image from which the in-memory page is instantiated.
+ */
+
+/*
+ * WT_DELTA_ITER --
+ *	Iterate the key/value pairs on a row-store leaf page or delta image.
+ */
+typedef struct {
+	const WT_PAGE_HEADER *dsk;	/* Page image */
+	WT_CELL *cell;			/* Next cell */
+	uint32_t remain;		/* Cells remaining */
+
+	WT_ITEM *key;			/* Current key */
+	WT_ITEM	 value;			/* Current value */
+	bool	 deleted;		/* Current value is a remove */
+	bool	 done;			/* Iteration complete */
+} WT_DELTA_ITER;
+
+/*
+ * __delta_iter_init --
+ *	Initialize an iterator over a page image.
+ */
+static void
+__delta_iter_init(WT_BTREE *btree,
+    WT_DELTA_ITER *iter, const WT_PAGE_HEADER *dsk, WT_ITEM *key)
+{
+	WT_CELL_UNPACK unpack;
+
+	iter->dsk = dsk;
+	iter->cell = WT_PAGE_HEADER_BYTE(btree, dsk);
+	iter->remain = dsk->u.entries;
+	iter->key = key;
+	iter->key->size = 0;
+	iter->deleted = iter->done = false;
+
+	/* Skip a delta's leading address cell. */
+	if (dsk->type == WT_PAGE_ROW_LEAF_DELTA && iter->remain != 0) {
+		__wt_cell_unpack(iter->cell, &unpack);
+		iter->cell = (WT_CELL *)((uint8_t *)iter->cell + unpack.__len);
+		--iter->remain;
+	}
+}
+
+/*
+ * __delta_iter_next --
+ *	Move an iterator to the next key/value pair.
+ */
+static int
+__delta_iter_next(WT_SESSION_IMPL *session, WT_DELTA_ITER *iter)
+{
+	WT_CELL_UNPACK unpack;
+
+	if (iter->remain == 0) {
+		iter->done = true;
+		return (0);
+	}
+
+	/*
+	 * Build the key: the key buffer holds the last key, which supplies any
+	 * prefix-compressed bytes.
+	 */
+	__wt_cell_unpack(iter->cell, &unpack);
+	if (unpack.type != WT_CELL_KEY || unpack.prefix > iter->key->size)
+		goto corrupt;
+	WT_RET(__wt_buf_grow(session, iter->key, unpack.prefix + unpack.size));
+	iter->key->data = iter->key->mem;
+	memcpy((uint8_t *)iter->key->mem + unpack.prefix,
+	    unpack.data, unpack.size);
+	iter->key->size = unpack.prefix + unpack.size;
+	iter->cell = (WT_CELL *)((uint8_t *)iter->cell + unpack.__len);
+	--iter->remain;
+
+	/*
+	 * Get the value: a key without a following value cell has a
+	 * zero-length value.
+	 */
+	iter->value.data = NULL;
+	iter->value.size = 0;
+	iter->deleted = false;
+	if (iter->remain == 0)
+		return (0);
+	__wt_cell_unpack(iter->cell, &unpack);
+	switch (unpack.type) {
+	case WT_CELL_KEY:
+		return (0);
+	case WT_CELL_DEL:
+		if (iter->dsk->type != WT_PAGE_ROW_LEAF_DELTA)
+			goto corrupt;
+		iter->deleted = true;
+		break;
+	case WT_CELL_VALUE:
+		iter->value.data = unpack.data;
+		iter->value.size = unpack.size;
+		break;
+	default:
+		goto corrupt;
+	}
+	iter->cell = (WT_CELL *)((uint8_t *)iter->cell + unpack.__len);
+	--iter->remain;
+	return (0);
+
+corrupt:
+	WT_RET_MSG(session, WT_ERROR,
+	    "unexpected %s cell building a row-store leaf page from a %s page",
+	    __wt_cell_type_string(unpack.raw),
+	    __wt_page_type_string(iter->dsk->type));
+}
+
+/*
+ * __delta_image_append --
+ *	Append a key/value pair to a row-store leaf page image.
+ */
+static int
+__delta_image_append(WT_SESSION_IMPL *session, WT_ITEM *image,
+    WT_ITEM *last, WT_ITEM *key, WT_ITEM *value, uint32_t *entriesp)
+{
+	WT_BTREE *btree;
+	WT_CELL cell;
+	size_t cell_len, pfx, pfx_max;
+	uint8_t *p;
+	const uint8_t *a, *b;
+
+	btree = S2BT(session);
+
+	/* Prefix-compress the key against the last key, if configured. */
+	pfx = 0;
+	if (btree->prefix_compression && last->size != 0) {
+		pfx_max = WT_MIN(UINT8_MAX, WT_MIN(last->size, key->size));
+		for (a = last->data, b = key->data;
+		    pfx < pfx_max && *a == *b; ++a, ++b)
+			++pfx;
+		if (pfx < btree->prefix_compression_min)
+			pfx = 0;
+	}
+
+	WT_RET(__wt_buf_grow(session, image,
+	    image->size + 2 * sizeof(WT_CELL) + key->size + value->size));
+	p = (uint8_t *)image->mem + image->size;
+
+	cell_len =
+	    __wt_cell_pack_leaf_key(&cell, (uint8_t)pfx, key->size - pfx);
+	memcpy(p, &cell, cell_len);
+	p += cell_len;
+	memcpy(p, (uint8_t *)key->data + pfx, key->size - pfx);
+	p += key->size - pfx;
+	++*entriesp;
+
+	/* Zero-length values are not written. */
+	if (value->size != 0) {
+		cell_len = __wt_cell_pack_data(&cell, 0, value->size);
+		memcpy(p, &cell, cell_len);
+		p += cell_len;
+		memcpy(p, value->data, value->size);
+		p += value->size;
+		++*entriesp;
+	}
+	image->size = WT_PTRDIFF(p, image->mem);
+
+	return (__wt_buf_set(session, last, key->data, key->size));
+}
+
+/*
+ * __delta_apply --
+ *	Apply a delta to a row-store leaf page image, building a new image.
+ */
+static int
+__delta_apply(WT_SESSION_IMPL *session,
+    const WT_PAGE_HEADER *base, const WT_PAGE_HEADER *delta, WT_ITEM *image)
+{
+	WT_BTREE *btree;
+	WT_DECL_ITEM(base_key);
+	WT_DECL_ITEM(delta_key);
+	WT_DECL_ITEM(last);
+	WT_DECL_RET;
+	WT_DELTA_ITER b, d;
+	WT_PAGE_HEADER *dsk;
+	uint32_t entries;
+	int cmp;
+
+	btree = S2BT(session);
+	entries = 0;
+
+	WT_ERR(__wt_scr_alloc(session, 0, &base_key));
+	WT_ERR(__wt_scr_alloc(session, 0, &delta_key));
+	WT_ERR(__wt_scr_alloc(session, 0, &last));
+
+	/* The new image starts with a copy of the base image's header. */
+	WT_ERR(__wt_buf_init(session, image, base->mem_size + delta->mem_size));
+	memcpy(image->mem, base, WT_PAGE_HEADER_BYTE_SIZE(btree));
+	image->size = WT_PAGE_HEADER_BYTE_SIZE(btree);
+
+	/*
+	 * Merge the two sorted sets of key/value pairs: a record in the delta
+	 * replaces any record in the base image with the same key, removed
+	 * records are skipped.
+	 */
+	__delta_iter_init(btree, &b, base, base_key);
+	__delta_iter_init(btree, &d, delta, delta_key);
+	WT_ERR(__delta_iter_next(session, &b));
+	WT_ERR(__delta_iter_next(session, &d));
+	while (!b.done || !d.done) {
+		if (b.done)
+			cmp = 1;
+		else if (d.done)
+			cmp = -1;
+		else
+			WT_ERR(__wt_compare(
+			    session, btree->collator, b.key, d.key, &cmp));
+
+		if (cmp < 0) {
+			WT_ERR(__delta_image_append(
+			    session, image, last, b.key, &b.value, &entries));
+			WT_ERR(__delta_iter_next(session, &b));
+			continue;
+		}
+		if (!d.deleted)
+			WT_ERR(__delta_image_append(
+			    session, image, last, d.key, &d.value, &entries));
+		if (cmp == 0)
+			WT_ERR(__delta_iter_next(session, &b));
+		WT_ERR(__delta_iter_next(session, &d));
+	}
+
+	dsk = image->mem;
+	dsk->write_gen = delta->write_gen;
+	dsk->mem_size = WT_STORE_SIZE(image->size);
+	dsk->u.entries = entries;
+	dsk->type = WT_PAGE_ROW_LEAF;
+	dsk->flags = 0;
+
+err:	__wt_scr_free(session, &base_key);
+	__wt_scr_free(session, &delta_key);
+	__wt_scr_free(session, &last);
+	return (ret);
+}
+
+/*
+ * __wt_delta_build --
+ *	Build a row-store leaf page image from a delta and the chain of blocks
+ * it depends on, returning the addresses of those blocks.
+ */
+int
+__wt_delta_build(WT_SESSION_IMPL *session,
+    WT_ITEM *buf, WT_ADDR **chainp, uint32_t *entriesp)
+{
+	WT_ADDR *chain;
+	WT_BM *bm;
+	WT_BTREE *btree;
+	WT_CELL_UNPACK unpack;
+	WT_DECL_RET;
+	WT_ITEM image[WT_BTREE_DELTA_MAX + 1], merged;
+	const WT_PAGE_HEADER *dsk, *prev;
+	size_t allocated;
+	uint32_t entries, i;
+
+	*chainp = NULL;
+	*entriesp = 0;
+
+	btree = S2BT(session);
+	bm = btree->bm;
+	chain = NULL;
+	allocated = 0;
+	entries = 0;
+	memset(image, 0, sizeof(image));
+	WT_CLEAR(merged);
+
+	/* Take ownership of the delta's image. */
+	image[0] = *buf;
+	WT_CLEAR(*buf);
+
+	/*
+	 * Follow the chain of previous block addresses back to the base image.
+	 * The chain length is bounded, a longer chain means a corrupted file.
+	 * Every block in the chain was written before the block that follows
+	 * it: a block with a newer write generation than its successor was
+	 * freed and reused after the chain was replaced.
+	 */
+	for (i = 0;; ++i) {
+		dsk = image[i].data;
+		if (dsk->type == WT_PAGE_ROW_LEAF)
+			break;
+		if (dsk->type != WT_PAGE_ROW_LEAF_DELTA ||
+		    i == WT_BTREE_DELTA_MAX)
+			goto corrupt;
+
+		__wt_cell_unpack(WT_PAGE_HEADER_BYTE(btree, dsk), &unpack);
+		if (unpack.raw != WT_CELL_ADDR_LEAF || bm->addr_invalid(
+		    bm, session, unpack.data, unpack.size) != 0)
+			goto corrupt;
+
+		WT_ERR(__wt_realloc_def(
+		    session, &allocated, entries + 1, &chain));
+		WT_ERR(__wt_strndup(
+		    session, unpack.data, unpack.size, &chain[entries].addr));
+		chain[entries].size = (uint8_t)unpack.size;
+		++entries;
+
+		WT_ERR(__wt_bt_read(
+		    session, &image[i + 1], unpack.data, unpack.size));
+		prev = image[i + 1].data;
+		if (prev->write_gen >= dsk->write_gen)
+			goto corrupt;
+		chain[entries - 1].type = prev->type == WT_PAGE_ROW_LEAF ?
+		    WT_ADDR_LEAF_NO : WT_ADDR_LEAF;
+	}
+
+	/* Apply the deltas, oldest first. */
+	for (; i > 0; --i) {
+		WT_ERR(__delta_apply(
+		    session, image[i].data, image[i - 1].data, &merged));
+		__wt_buf_free(session, &image[i - 1]);
+		image[i - 1] = merged;
+		WT_CLEAR(merged);
+	}
+	WT_STAT_FAST_CONN_INCR(session, cache_read_delta);
+	WT_STAT_FAST_DATA_INCR(session, cache_read_delta);
+
+	*buf = image[0];
+	WT_CLEAR(image[0]);
+	*chainp = chain;
+	*entriesp = entries;
+	chain = NULL;
+
+	if (0) {
+corrupt:	/* Salvage expects to find corrupted chains, don't complain. */
+		ret = WT_ERROR;
+		if (!F_ISSET(session, WT_SESSION_QUIET_CORRUPT_FILE))
+			__wt_errx(session,
+			    "corrupted row-store leaf page delta chain");
+	}
+
+err:	for (i = 0; i < WT_ELEMENTS(image); ++i)
+		__wt_buf_free(session, &image[i]);
+	__wt_buf_free(session, &merged);
+	__wt_delta_chain_free(session, &chain, entries);
+	return (ret);
+}
+
+/*
+ * __wt_delta_chain_free --
+ *	Discard a list of delta chain addresses.
+ */
+void
+__wt_delta_chain_free(
+    WT_SESSION_IMPL *session, WT_ADDR **chainp, uint32_t entries)
+{
+	WT_ADDR *chain;
+	uint32_t i;
+
+	if ((chain = *chainp) == NULL)
+		return;
+	for (i = 0; i < entries; ++i)
+		__wt_free(session, chain[i].addr);
+	__wt_free(session, *chainp);
+}
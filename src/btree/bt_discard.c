@@ -183,6 +183,10 @@ __free_page_modify(WT_SESSION_IMPL *session, WT_PAGE *page)
 		break;
 	}
 
+	/* Free the delta chain addresses. */
+	__wt_delta_chain_free(
+	    session, &mod->delta_chain, mod->delta_chain_entries);
+
 	switch (page->type) {
 	case WT_PAGE_COL_FIX:
 	case WT_PAGE_COL_VAR:
@@ -283,6 +283,7 @@ __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt)
 	 * Reconciliation configuration:
 	 *	Block compression (all)
 	 *	Dictionary compression (variable-length column-store, row-store)
+	 *	Leaf page deltas (row-store)
 	 *	Page-split percentage
 	 *	Prefix compression (row-store)
 	 *	Suffix compression (row-store)
@@ -295,6 +296,9 @@ __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt)
 		    session, cfg, "internal_key_truncate", &cval));
 		btree->internal_key_truncate = cval.val != 0;
 
+		WT_RET(__wt_config_gets(session, cfg, "leaf_delta_max", &cval));
+		btree->leaf_delta_max = (u_int)cval.val;
+
 		WT_RET(__wt_config_gets(
 		    session, cfg, "prefix_compression", &cval));
 		btree->prefix_compression = cval.val != 0;
@@ -26,6 +26,7 @@ __wt_bt_read(WT_SESSION_IMPL *session,
 	const WT_PAGE_HEADER *dsk;
 	const char *fail_msg;
 	size_t result_len;
+	bool ccache, found;
 
 	btree = S2BT(session);
 	bm = btree->bm;
@@ -41,8 +42,24 @@ __wt_bt_read(WT_SESSION_IMPL *session,
 		dsk = buf->data;
 		ip = NULL;
 	} else {
+		/*
+		 * Check the compressed cache before reading the block, and add
+		 * blocks read from the file to it. Verify handles skip it, they
+		 * must check what's in the file.
+		 */
 		WT_RET(__wt_scr_alloc(session, 0, &tmp));
-		WT_ERR(bm->read(bm, session, tmp, addr, addr_size));
+		ccache = S2C(session)->cache->ccache != NULL &&
+		    !F_ISSET(btree, WT_BTREE_VERIFY);
+		found = false;
+		if (ccache)
+			WT_ERR(__wt_ccache_read(
+			    session, tmp, addr, addr_size, &found));
+		if (!found) {
+			WT_ERR(bm->read(bm, session, tmp, addr, addr_size));
+			if (ccache)
+				WT_ERR(__wt_ccache_insert(session,
+				    addr, addr_size, tmp->data, tmp->size));
+		}
 		dsk = tmp->data;
 		ip = tmp;
 	}
@@ -167,8 +184,8 @@ err:	__wt_scr_free(session, &tmp);
  * checksum.
  */
 int
-__wt_bt_write(WT_SESSION_IMPL *session, WT_ITEM *buf,
-    uint8_t *addr, size_t *addr_sizep, bool checkpoint, bool compressed)
+__wt_bt_write(WT_SESSION_IMPL *session, WT_ITEM *buf, uint8_t *addr,
+    size_t *addr_sizep, bool checkpoint, bool checkpoint_io, bool compressed)
 {
 	WT_BM *bm;
 	WT_BTREE *btree;
@@ -356,10 +373,15 @@ __wt_bt_write(WT_SESSION_IMPL *session, WT_ITEM *buf,
 		break;
 	}
 
-	/* Call the block manager to write the block. */
+	/*
+	 * Call the block manager to write the block.  Tell it if the write is
+	 * part of a checkpoint, the caller decides: a write pool thread writes
+	 * on behalf of another session.
+	 */
 	WT_ERR(checkpoint ?
 	    bm->checkpoint(bm, session, ip, btree->ckpt, data_cksum) :
-	    bm->write(bm, session, ip, addr, addr_sizep, data_cksum));
+	    bm->write(bm, session,
+	    ip, addr, addr_sizep, data_cksum, checkpoint_io));
 
 	WT_STAT_FAST_CONN_INCR(session, cache_write);
 	WT_STAT_FAST_DATA_INCR(session, cache_write);
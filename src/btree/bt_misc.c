@@ -32,6 +32,8 @@ __wt_page_type_string(u_int type)
 		return ("row-store internal");
 	case WT_PAGE_ROW_LEAF:
 		return ("row-store leaf");
+	case WT_PAGE_ROW_LEAF_DELTA:
+		return ("row-store leaf delta");
 	default:
 		return ("unknown");
 	}
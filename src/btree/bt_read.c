@@ -341,17 +341,21 @@ __evict_force_check(WT_SESSION_IMPL *session, WT_REF *ref)
 static int
 __page_read(WT_SESSION_IMPL *session, WT_REF *ref)
 {
+	struct timespec start;
 	const WT_PAGE_HEADER *dsk;
+	WT_ADDR *chain;
 	WT_BTREE *btree;
 	WT_DECL_RET;
 	WT_ITEM tmp;
 	WT_PAGE *page;
 	size_t addr_size;
-	uint32_t previous_state;
+	uint32_t chain_entries, previous_state;
 	const uint8_t *addr;
 
 	btree = S2BT(session);
 	page = NULL;
+	chain = NULL;
+	chain_entries = 0;
 
 	/*
 	 * Don't pass an allocated buffer to the underlying block read function,
@@ -370,6 +374,8 @@ __page_read(WT_SESSION_IMPL *session, WT_REF *ref)
 		previous_state = WT_REF_DELETED;
 	else
 		return (0);
+	WT_STAT_LATENCY_START(session, start);
+	WT_TRACE(session, WT_TRACE_PAGE_READ_START, 0);
 
 	/*
 	 * Get the address: if there is no address, the page was deleted, but a
@@ -386,9 +392,20 @@ __page_read(WT_SESSION_IMPL *session, WT_REF *ref)
 
 	/*
 	 * There's an address, read or map the backing disk page and build an
-	 * in-memory version of the page.
+	 * in-memory version of the page. A shared cache wants to know if the
+	 * page was recently evicted.
 	 */
+	__wt_cache_pool_ghost_check(session, addr, addr_size);
 	WT_ERR(__wt_bt_read(session, &tmp, addr, addr_size));
+
+	/*
+	 * If the block is a row-store leaf page delta, follow the delta chain
+	 * back to its base and build a full page image.
+	 */
+	dsk = tmp.data;
+	if (dsk->type == WT_PAGE_ROW_LEAF_DELTA)
+		WT_ERR(__wt_delta_build(session, &tmp, &chain, &chain_entries));
+
 	WT_ERR(__wt_page_inmem(session, ref, tmp.data, tmp.memsize,
 	    WT_DATA_IN_ITEM(&tmp) ?
 	    WT_PAGE_DISK_ALLOC : WT_PAGE_DISK_MAPPED, &page));
@@ -406,6 +423,17 @@ __page_read(WT_SESSION_IMPL *session, WT_REF *ref)
 	if (session->dhandle->checkpoint != NULL)
 		goto done;
 
+	/*
+	 * The page's delta chain is discarded when the page is next written as
+	 * a full image, track it in the page's modify structure.
+	 */
+	if (chain != NULL) {
+		WT_ERR(__wt_page_modify_init(session, page));
+		page->modify->delta_chain = chain;
+		page->modify->delta_chain_entries = chain_entries;
+		chain = NULL;
+	}
+
 	/* If the page was deleted, instantiate that information. */
 	if (previous_state == WT_REF_DELETED)
 		WT_ERR(__wt_delete_page_instantiate(session, ref));
@@ -425,7 +453,10 @@ __page_read(WT_SESSION_IMPL *session, WT_REF *ref)
 		    session, ref, btree->id, addr, addr_size));
 	}
 
-done:	WT_PUBLISH(ref->state, WT_REF_MEM);
+done:	__wt_delta_chain_free(session, &chain, chain_entries);
+	WT_PUBLISH(ref->state, WT_REF_MEM);
+	WT_TRACE(session, WT_TRACE_PAGE_READ_STOP, 0);
+	WT_STAT_LATENCY_CONN_DATA(session, latency_page_read, start);
 	return (0);
 
 err:	/*
@@ -438,7 +469,9 @@ err:	/*
 	WT_PUBLISH(ref->state, previous_state);
 
 	__wt_buf_free(session, &tmp);
+	__wt_delta_chain_free(session, &chain, chain_entries);
 
+	WT_TRACE(session, WT_TRACE_PAGE_READ_STOP, ret);
 	return (ret);
 }
 
@@ -454,6 +487,7 @@ __wt_page_in_func(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags
 #endif
     )
 {
+	struct timespec start;
 	WT_BTREE *btree;
 	WT_DECL_RET;
 	WT_PAGE *page;
@@ -463,6 +497,11 @@ __wt_page_in_func(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags
 
 	btree = S2BT(session);
 
+	/*
+	 * The wait for the page is timed from the first time we fail to get it
+	 * without waiting.
+	 */
+	start.tv_sec = 0;
 	for (oldgen = stalled = false,
 	    force_attempts = 0, sleep_cnt = wait_cnt = 0;;) {
 		switch (ref->state) {
@@ -480,6 +519,8 @@ __wt_page_in_func(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags
 			 * allowed to do eviction work, check for space in the
 			 * cache.
 			 */
+			if (start.tv_sec == 0)
+				WT_STAT_LATENCY_START(session, start);
 			if (!LF_ISSET(WT_READ_NO_EVICT))
 				WT_RET(__wt_cache_eviction_check(
 				    session, 1, NULL));
@@ -586,8 +627,13 @@ __wt_page_in_func(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags
 			    page->read_gen != WT_READGEN_OLDEST &&
 			    page->read_gen < __wt_cache_read_gen(session))
 				page->read_gen =
-				    __wt_cache_read_gen_bump(session);
+				    __wt_cache_read_gen_access(session, page);
 skip_evict:
+			WT_STAT_LATENCY_CONN_DATA(
+			    session, latency_page_wait, start);
+			if (wait_cnt != 0)
+				WT_TRACE(session, WT_TRACE_PAGE_WAIT, wait_cnt);
+
 			/*
 			 * Check if we need an autocommit transaction.
 			 * Starting a transaction can trigger eviction, so skip
@@ -603,6 +649,8 @@ skip_evict:
 		 * we've yielded enough times, start sleeping so we don't burn
 		 * CPU to no purpose.
 		 */
+		if (start.tv_sec == 0)
+			WT_STAT_LATENCY_START(session, start);
 		if (stalled)
 			wait_cnt += WT_THOUSAND;
 		else if (++wait_cnt < WT_THOUSAND) {
@@ -8,6 +8,8 @@
 
 #include "wt_internal.h"
 
+struct __wt_slvg_block;	  typedef struct __wt_slvg_block WT_SLVG_BLOCK;
+struct __wt_slvg_region;  typedef struct __wt_slvg_region WT_SLVG_REGION;
 struct __wt_stuff;	  typedef struct __wt_stuff WT_STUFF;
 struct __wt_track;	  typedef struct __wt_track WT_TRACK;
 struct __wt_track_shared; typedef struct __wt_track_shared WT_TRACK_SHARED;
@@ -40,6 +42,37 @@ struct __wt_stuff {
 	uint64_t fcnt;				/* Progress counter */
 };
 
+/*
+ * WT_SLVG_BLOCK --
+ *	A block taken by a region scan.  Leaf and overflow pages reference their
+ * slot in the region's tracking arrays, other pages are discarded when the
+ * regions are merged.
+ */
+struct __wt_slvg_block {
+	WT_ADDR  addr;				/* Block address */
+	uint32_t slot;				/* Tracking slot */
+	uint8_t  page_type;			/* Page type */
+};
+
+/*
+ * WT_SLVG_REGION --
+ *	A region of the file read by a salvage thread.
+ */
+struct __wt_slvg_region {
+	WT_STUFF *ss;				/* Salvage */
+	WT_STUFF  stuff;			/* Region's pages */
+
+	WT_BLOCK_SLVG_SCAN scan;		/* Block manager scan */
+
+	WT_SLVG_BLOCK *blocks;			/* Blocks, in file order */
+	uint32_t   blocks_next;			/* Next empty slot */
+	size_t     blocks_allocated;		/* Bytes allocated */
+
+	wt_thread_t tid;			/* Thread */
+	bool	    tid_set;
+	int	    thread_ret;			/* Thread return */
+};
+
 /*
  * WT_TRACK_SHARED --
  *	Information shared between pages being merged.
@@ -110,6 +143,7 @@ struct __wt_track {
 #define	WT_TRACK_CHECK_STOP	0x02		/* Row: last key updated */
 #define	WT_TRACK_MERGE		0x04		/* Page requires merging */
 #define	WT_TRACK_OVFL_REFD	0x08		/* Overflow page referenced */
+#define	WT_TRACK_DELTA		0x10		/* Row: built from deltas */
 	u_int flags;
 };
 
@@ -120,6 +154,7 @@ static int  __slvg_col_ovfl(
 		WT_SESSION_IMPL *, WT_TRACK *, WT_PAGE *, uint64_t, uint64_t);
 static int  __slvg_col_range(WT_SESSION_IMPL *, WT_STUFF *);
 static int  __slvg_col_range_missing(WT_SESSION_IMPL *, WT_STUFF *);
+static int  __slvg_delta_rewrite(WT_SESSION_IMPL *, WT_STUFF *);
 static int  __slvg_col_range_overlap(
 		WT_SESSION_IMPL *, uint32_t, uint32_t, WT_STUFF *);
 static void __slvg_col_trk_update_start(uint32_t, WT_STUFF *);
@@ -130,6 +165,12 @@ static int  __slvg_ovfl_reconcile(WT_SESSION_IMPL *, WT_STUFF *);
 static int  __slvg_ovfl_ref(WT_SESSION_IMPL *, WT_TRACK *, bool);
 static int  __slvg_ovfl_ref_all(WT_SESSION_IMPL *, WT_TRACK *);
 static int  __slvg_read(WT_SESSION_IMPL *, WT_STUFF *);
+static int  __slvg_read_block(WT_SESSION_IMPL *, WT_STUFF *,
+		WT_ITEM *, WT_ITEM *, uint8_t *, size_t, bool *, uint8_t *);
+static int  __slvg_read_merge(
+		WT_SESSION_IMPL *, WT_STUFF *, WT_SLVG_REGION *, bool *);
+static int  __slvg_read_parallel(WT_SESSION_IMPL *, WT_STUFF *, u_int);
+static int  __slvg_read_region(WT_SESSION_IMPL *, WT_SLVG_REGION *);
 static int  __slvg_row_build_internal(WT_SESSION_IMPL *, uint32_t, WT_STUFF *);
 static int  __slvg_row_build_leaf(
 		WT_SESSION_IMPL *, WT_TRACK *, WT_REF *, WT_STUFF *);
@@ -163,15 +204,18 @@ __wt_bt_salvage(WT_SESSION_IMPL *session, WT_CKPT *ckptbase, const char *cfg[])
 {
 	WT_BM *bm;
 	WT_BTREE *btree;
+	WT_CONFIG_ITEM cval;
 	WT_DECL_RET;
 	WT_STUFF *ss, stuff;
 	uint32_t i, leaf_cnt;
-
-	WT_UNUSED(cfg);
+	u_int threads;
 
 	btree = S2BT(session);
 	bm = btree->bm;
 
+	WT_RET(__wt_config_gets(session, cfg, "threads", &cval));
+	threads = (u_int)cval.val;
+
 	WT_CLEAR(stuff);
 	ss = &stuff;
 	ss->session = session;
@@ -195,12 +239,25 @@ __wt_bt_salvage(WT_SESSION_IMPL *session, WT_CKPT *ckptbase, const char *cfg[])
 	 *
 	 * Turn off read checksum and verification error messages while we're
 	 * reading the file, we expect to see corrupted blocks.
+	 *
+	 * If configured for multiple threads, the file is split into regions
+	 * read in parallel, and the pages found are merged into a single list,
+	 * in file order, before the rest of the salvage.
 	 */
 	F_SET(session, WT_SESSION_QUIET_CORRUPT_FILE);
-	ret = __slvg_read(session, ss);
+	ret = threads > 1 ? __slvg_read_parallel(session, ss, threads) :
+	    __slvg_read(session, ss);
 	F_CLR(session, WT_SESSION_QUIET_CORRUPT_FILE);
 	WT_ERR(ret);
 
+	/*
+	 * Row-store leaf pages built from delta chains are written as full
+	 * page images before anything else happens: later steps free the
+	 * blocks of pages that aren't used, including the blocks the deltas
+	 * were applied to.
+	 */
+	WT_ERR(__slvg_delta_rewrite(session, ss));
+
 	/*
 	 * Step 3:
 	 * Discard any page referencing a non-existent overflow page.  We do
@@ -362,9 +419,8 @@ __slvg_read(WT_SESSION_IMPL *session, WT_STUFF *ss)
 	WT_DECL_ITEM(as);
 	WT_DECL_ITEM(buf);
 	WT_DECL_RET;
-	const WT_PAGE_HEADER *dsk;
 	size_t addr_size;
-	uint8_t addr[WT_BTREE_MAX_ADDR_COOKIE];
+	uint8_t addr[WT_BTREE_MAX_ADDR_COOKIE], page_type;
 	bool eof, valid;
 
 	bm = S2BT(session)->bm;
@@ -383,99 +439,471 @@ __slvg_read(WT_SESSION_IMPL *session, WT_STUFF *ss)
 			WT_ERR(__wt_progress(session, NULL, ss->fcnt));
 
 		/*
-		 * Read (and potentially decompress) the block; the underlying
-		 * block manager might return only good blocks if checksums are
-		 * configured, or both good and bad blocks if we're relying on
-		 * compression.
-		 *
-		 * Report the block's status to the block manager.
+		 * Read and track the block, then report the block's status to
+		 * the block manager.  We only care about leaf and overflow
+		 * pages from here on out, discard all of the others.  We put
+		 * them on the free list now, because we might as well overwrite
+		 * them, we want the file to grow as little as possible, or
+		 * shrink, and future salvage calls don't need them either.
 		 */
-		if ((ret = __wt_bt_read(session, buf, addr, addr_size)) == 0)
-			valid = true;
-		else {
-			valid = false;
-			if (ret == WT_ERROR)
-				ret = 0;
-			WT_ERR(ret);
-		}
+		WT_ERR(__slvg_read_block(session,
+		    ss, as, buf, addr, addr_size, &valid, &page_type));
 		WT_ERR(bm->salvage_valid(bm, session, addr, addr_size, valid));
-		if (!valid)
-			continue;
+		if (valid && page_type == WT_PAGE_INVALID)
+			WT_ERR(bm->free(bm, session, addr, addr_size));
+	}
 
-		/* Create a printable version of the address. */
-		WT_ERR(bm->addr_string(bm, session, as, addr, addr_size));
+err:	__wt_scr_free(session, &as);
+	__wt_scr_free(session, &buf);
+
+	return (ret);
+}
+
+/*
+ * __slvg_read_block --
+ *	Read a possible page and track it if it's a leaf or overflow page,
+ * returning if the block is valid, and if it was tracked, its page type.
+ */
+static int
+__slvg_read_block(WT_SESSION_IMPL *session, WT_STUFF *ss, WT_ITEM *as,
+    WT_ITEM *buf, uint8_t *addr, size_t addr_size, bool *validp,
+    uint8_t *page_typep)
+{
+	WT_ADDR *chain;
+	WT_BM *bm;
+	WT_DECL_RET;
+	WT_ITEM image;
+	const WT_PAGE_HEADER *dsk;
+	uint32_t chain_entries;
+	bool delta;
+
+	bm = S2BT(session)->bm;
+	*validp = false;
+	*page_typep = WT_PAGE_INVALID;
+
+	/*
+	 * Read (and potentially decompress) the block; the underlying
+	 * block manager might return only good blocks if checksums are
+	 * configured, or both good and bad blocks if we're relying on
+	 * compression.
+	 */
+	if ((ret = __wt_bt_read(session, buf, addr, addr_size)) != 0)
+		return (ret == WT_ERROR ? 0 : ret);
+	*validp = true;
+
+	/* Create a printable version of the address. */
+	WT_RET(bm->addr_string(bm, session, as, addr, addr_size));
+
+	/* Make sure it's an expected page type for the file. */
+	dsk = buf->data;
+	switch (dsk->type) {
+	case WT_PAGE_BLOCK_MANAGER:
+	case WT_PAGE_COL_INT:
+	case WT_PAGE_ROW_INT:
+		return (__wt_verbose(session, WT_VERB_SALVAGE,
+		    "%s page ignored %s",
+		    __wt_page_type_string(dsk->type),
+		    (const char *)as->data));
+	}
+
+	/*
+	 * Verify the page.  It's unlikely a page could have a valid
+	 * checksum and still be broken, but paranoia is healthy in
+	 * salvage.  Regardless, verify does return failure because
+	 * it detects failures we'd expect to see in a corrupted file,
+	 * like overflow references past the end of the file or
+	 * overflow references to non-existent pages, might as well
+	 * discard these pages now.
+	 */
+	if (__wt_verify_dsk(session, as->data, buf) != 0)
+		return (__wt_verbose(session, WT_VERB_SALVAGE,
+		    "%s page failed verify %s",
+		    __wt_page_type_string(dsk->type),
+		    (const char *)as->data));
+
+	/*
+	 * A row-store leaf page delta is tracked as the page built from its
+	 * delta chain, with the write generation of the delta, the newest
+	 * block in the chain.  If the chain can't be followed back to its base
+	 * image, the delta is discarded, and the newest block in the chain
+	 * that survived is salvaged instead.
+	 */
+	delta = dsk->type == WT_PAGE_ROW_LEAF_DELTA;
+	if (delta) {
+		WT_CLEAR(image);
+		chain = NULL;
+		chain_entries = 0;
+		if ((ret = __wt_buf_set(
+		    session, &image, buf->data, buf->size)) == 0 &&
+		    (ret = __wt_delta_build(
+		    session, &image, &chain, &chain_entries)) == 0)
+			ret = __wt_buf_set(
+			    session, buf, image.data, image.size);
+		__wt_buf_free(session, &image);
+		__wt_delta_chain_free(session, &chain, chain_entries);
+		if (ret == WT_ERROR)
+			return (__wt_verbose(session, WT_VERB_SALVAGE,
+			    "%s page ignored, delta chain unavailable %s",
+			    __wt_page_type_string(dsk->type),
+			    (const char *)as->data));
+		WT_RET(ret);
 
-		/*
-		 * Make sure it's an expected page type for the file.
-		 *
-		 * We only care about leaf and overflow pages from here on out;
-		 * discard all of the others.  We put them on the free list now,
-		 * because we might as well overwrite them, we want the file to
-		 * grow as little as possible, or shrink, and future salvage
-		 * calls don't need them either.
-		 */
 		dsk = buf->data;
-		switch (dsk->type) {
-		case WT_PAGE_BLOCK_MANAGER:
-		case WT_PAGE_COL_INT:
-		case WT_PAGE_ROW_INT:
-			WT_ERR(__wt_verbose(session, WT_VERB_SALVAGE,
-			    "%s page ignored %s",
+		if (__wt_verify_dsk(session, as->data, buf) != 0)
+			return (__wt_verbose(session, WT_VERB_SALVAGE,
+			    "%s page built from deltas failed verify %s",
 			    __wt_page_type_string(dsk->type),
 			    (const char *)as->data));
-			WT_ERR(bm->free(bm, session, addr, addr_size));
-			continue;
-		}
+	}
+
+	WT_RET(__wt_verbose(session, WT_VERB_SALVAGE,
+	    "tracking %s page%s, generation %" PRIu64 " %s",
+	    __wt_page_type_string(dsk->type),
+	    delta ? " built from deltas" : "", dsk->write_gen,
+	    (const char *)as->data));
+
+	switch (dsk->type) {
+	case WT_PAGE_COL_FIX:
+	case WT_PAGE_COL_VAR:
+	case WT_PAGE_ROW_LEAF:
+		if (ss->page_type == WT_PAGE_INVALID)
+			ss->page_type = dsk->type;
+		if (ss->page_type != dsk->type)
+			WT_RET_MSG(session, WT_ERROR,
+			    "file contains multiple file formats (both "
+			    "%s and %s), and cannot be salvaged",
+			    __wt_page_type_string(ss->page_type),
+			    __wt_page_type_string(dsk->type));
+
+		WT_RET(__slvg_trk_leaf(session, dsk, addr, addr_size, ss));
+		if (delta)
+			F_SET(ss->pages[ss->pages_next - 1], WT_TRACK_DELTA);
+		break;
+	case WT_PAGE_OVFL:
+		WT_RET(__slvg_trk_ovfl(session, dsk, addr, addr_size, ss));
+		break;
+	}
+	*page_typep = dsk->type;
+	return (0);
+}
+
+/*
+ * __slvg_read_region --
+ *	Read a region of the file, tracking the pages we can use.
+ */
+static int
+__slvg_read_region(WT_SESSION_IMPL *session, WT_SLVG_REGION *r)
+{
+	WT_BM *bm;
+	WT_DECL_ITEM(as);
+	WT_DECL_ITEM(buf);
+	WT_DECL_RET;
+	WT_SLVG_BLOCK *b;
+	WT_STUFF *rs;
+	uint64_t fcnt;
+	size_t addr_size;
+	uint8_t addr[WT_BTREE_MAX_ADDR_COOKIE], page_type;
+	bool eof, valid;
+
+	bm = S2BT(session)->bm;
+	rs = &r->stuff;
+	WT_ERR(__wt_scr_alloc(session, 0, &as));
+	WT_ERR(__wt_scr_alloc(session, 0, &buf));
+
+	for (;;) {
+		WT_ERR(bm->salvage_region_next(
+		    bm, session, &r->scan, addr, &addr_size, &eof));
+		if (eof)
+			break;
+
+		/* Report progress occasionally, from the salvage session. */
+		fcnt = __wt_atomic_add64(&r->ss->fcnt, 1);
+		if (session == r->ss->session &&
+		    fcnt % WT_SALVAGE_PROGRESS_INTERVAL == 0)
+			WT_ERR(__wt_progress(session, NULL, fcnt));
 
 		/*
-		 * Verify the page.  It's unlikely a page could have a valid
-		 * checksum and still be broken, but paranoia is healthy in
-		 * salvage.  Regardless, verify does return failure because
-		 * it detects failures we'd expect to see in a corrupted file,
-		 * like overflow references past the end of the file or
-		 * overflow references to non-existent pages, might as well
-		 * discard these pages now.
+		 * Read and track the block.  Nothing is freed until the regions
+		 * are merged, a block in this region might be part of a block
+		 * found by the scan of the region before it.
 		 */
-		if (__wt_verify_dsk(session, as->data, buf) != 0) {
-			WT_ERR(__wt_verbose(session, WT_VERB_SALVAGE,
-			    "%s page failed verify %s",
-			    __wt_page_type_string(dsk->type),
-			    (const char *)as->data));
-			WT_ERR(bm->free(bm, session, addr, addr_size));
+		WT_ERR(__slvg_read_block(session,
+		    rs, as, buf, addr, addr_size, &valid, &page_type));
+		WT_ERR(bm->salvage_region_valid(
+		    bm, session, &r->scan, addr, addr_size, valid));
+		if (!valid)
 			continue;
-		}
 
-		WT_ERR(__wt_verbose(session, WT_VERB_SALVAGE,
-		    "tracking %s page, generation %" PRIu64 " %s",
-		    __wt_page_type_string(dsk->type), dsk->write_gen,
-		    (const char *)as->data));
+		WT_ERR(__wt_realloc_def(session,
+		    &r->blocks_allocated, r->blocks_next + 1, &r->blocks));
+		b = &r->blocks[r->blocks_next];
+		WT_ERR(__wt_strndup(session, addr, addr_size, &b->addr.addr));
+		b->addr.size = (uint8_t)addr_size;
+		b->page_type = page_type;
+		b->slot = page_type == WT_PAGE_OVFL ?
+		    rs->ovfl_next - 1 : rs->pages_next - 1;
+		++r->blocks_next;
+	}
 
-		switch (dsk->type) {
-		case WT_PAGE_COL_FIX:
-		case WT_PAGE_COL_VAR:
-		case WT_PAGE_ROW_LEAF:
+err:	__wt_scr_free(session, &as);
+	__wt_scr_free(session, &buf);
+
+	return (ret);
+}
+
+/*
+ * __slvg_read_worker --
+ *	Salvage region read thread.
+ */
+static WT_THREAD_RET
+__slvg_read_worker(void *arg)
+{
+	WT_SLVG_REGION *r;
+
+	r = arg;
+	r->thread_ret = __slvg_read_region(r->stuff.session, r);
+	return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * __slvg_read_merge --
+ *	Merge the pages found in a region of the file into the salvage.
+ */
+static int
+__slvg_read_merge(
+    WT_SESSION_IMPL *session, WT_STUFF *ss, WT_SLVG_REGION *r, bool *skipp)
+{
+	WT_BM *bm;
+	WT_SLVG_BLOCK *b;
+	WT_STUFF *rs;
+	WT_TRACK *trk;
+	uint32_t i;
+
+	bm = S2BT(session)->bm;
+	rs = &r->stuff;
+
+	for (i = 0; i < r->blocks_next; ++i) {
+		b = &r->blocks[i];
+
+		/*
+		 * If the block starts inside a block we've already taken, the
+		 * region's scan started in the middle of a block, and may have
+		 * skipped blocks a sequential read of the file would find.
+		 * Stop, the caller reads the rest of the file sequentially.
+		 */
+		WT_RET(bm->salvage_merge(bm,
+		    session, &r->scan, b->addr.addr, b->addr.size, skipp));
+		if (*skipp)
+			return (0);
+
+		switch (b->page_type) {
+		case WT_PAGE_INVALID:
+			WT_RET(bm->free(
+			    bm, session, b->addr.addr, b->addr.size));
+			break;
+		case WT_PAGE_OVFL:
+			WT_RET(__wt_realloc_def(session,
+			    &ss->ovfl_allocated, ss->ovfl_next + 1, &ss->ovfl));
+			trk = rs->ovfl[b->slot];
+			rs->ovfl[b->slot] = NULL;
+			trk->ss = ss;
+			ss->ovfl[ss->ovfl_next++] = trk;
+			break;
+		default:
 			if (ss->page_type == WT_PAGE_INVALID)
-				ss->page_type = dsk->type;
-			if (ss->page_type != dsk->type)
-				WT_ERR_MSG(session, WT_ERROR,
+				ss->page_type = b->page_type;
+			if (ss->page_type != b->page_type)
+				WT_RET_MSG(session, WT_ERROR,
 				    "file contains multiple file formats (both "
 				    "%s and %s), and cannot be salvaged",
 				    __wt_page_type_string(ss->page_type),
-				    __wt_page_type_string(dsk->type));
-
-			WT_ERR(__slvg_trk_leaf(
-			    session, dsk, addr, addr_size, ss));
-			break;
-		case WT_PAGE_OVFL:
-			WT_ERR(__slvg_trk_ovfl(
-			    session, dsk, addr, addr_size, ss));
+				    __wt_page_type_string(b->page_type));
+
+			WT_RET(__wt_realloc_def(session,
+			    &ss->pages_allocated, ss->pages_next + 1,
+			    &ss->pages));
+			trk = rs->pages[b->slot];
+			rs->pages[b->slot] = NULL;
+			trk->ss = ss;
+			ss->pages[ss->pages_next++] = trk;
 			break;
 		}
 	}
 
-err:	__wt_scr_free(session, &as);
-	__wt_scr_free(session, &buf);
+	/* Free anything after the last block we took in the region. */
+	return (bm->salvage_merge(bm, session, &r->scan, NULL, 0, skipp));
+}
+
+/*
+ * __slvg_read_parallel --
+ *	Read regions of the file in parallel, then merge the pages found into
+ * a single table, as if the file had been read sequentially.
+ */
+static int
+__slvg_read_parallel(WT_SESSION_IMPL *session, WT_STUFF *ss, u_int threads)
+{
+	WT_BM *bm;
+	WT_DECL_RET;
+	WT_SESSION *wt_session;
+	WT_SESSION_IMPL *rsession;
+	WT_SLVG_REGION *r, *regions;
+	uint32_t j;
+	u_int i;
+	bool skip;
+
+	bm = S2BT(session)->bm;
+	skip = false;
+
+	WT_RET(__wt_calloc_def(session, threads, &regions));
+
+	/*
+	 * The calling thread reads the first region, the others get their own
+	 * sessions, sharing the caller's exclusive handle.
+	 */
+	for (i = 0; i < threads; ++i) {
+		r = &regions[i];
+		r->ss = ss;
+		r->stuff.page_type = WT_PAGE_INVALID;
+		if (i == 0)
+			rsession = session;
+		else {
+			WT_ERR(__wt_open_internal_session(S2C(session),
+			    "salvage-worker", false, 0, &rsession));
+			rsession->dhandle = session->dhandle;
+			F_SET(rsession, WT_SESSION_QUIET_CORRUPT_FILE);
+		}
+		r->stuff.session = rsession;
+		WT_ERR(__wt_scr_alloc(rsession, 0, &r->stuff.tmp1));
+		WT_ERR(__wt_scr_alloc(rsession, 0, &r->stuff.tmp2));
+		WT_ERR(bm->salvage_region(bm, session, i, threads, &r->scan));
+	}
+	for (i = 1; i < threads; ++i) {
+		r = &regions[i];
+		WT_ERR(__wt_thread_create(
+		    session, &r->tid, __slvg_read_worker, r));
+		r->tid_set = true;
+	}
+	ret = __slvg_read_region(session, &regions[0]);
+
+err:	for (i = 1; i < threads; ++i) {
+		r = &regions[i];
+		if (r->tid_set) {
+			WT_TRET(__wt_thread_join(session, r->tid));
+			WT_TRET(r->thread_ret);
+		}
+	}
+
+	/*
+	 * Merge the regions in file order.  If a region's blocks can't be
+	 * merged, read the rest of the file sequentially.
+	 */
+	for (i = 0; ret == 0 && i < threads && !skip; ++i)
+		ret = __slvg_read_merge(session, ss, &regions[i], &skip);
+	if (ret == 0 && skip) {
+		WT_TRET(__wt_verbose(session, WT_VERB_SALVAGE,
+		    "block found inside another block, reading the rest of "
+		    "the file sequentially"));
+		WT_TRET(__slvg_read(session, ss));
+	}
+
+	for (i = 0; i < threads; ++i) {
+		r = &regions[i];
+		rsession = r->stuff.session;
+		if (rsession == NULL)
+			continue;
+		WT_TRET(__slvg_cleanup(rsession, &r->stuff));
+		__wt_scr_free(rsession, &r->stuff.tmp1);
+		__wt_scr_free(rsession, &r->stuff.tmp2);
+		for (j = 0; j < r->blocks_next; ++j)
+			__wt_free(rsession, r->blocks[j].addr.addr);
+		__wt_free(rsession, r->blocks);
+		if (i != 0) {
+			rsession->dhandle = NULL;
+			wt_session = &rsession->iface;
+			WT_TRET(wt_session->close(wt_session, NULL));
+		}
+	}
+	__wt_free(session, regions);
+
+	return (ret);
+}
+
+/*
+ * __slvg_delta_rewrite --
+ *	Write the row-store leaf pages built from delta chains as full page
+ * images.
+ */
+static int
+__slvg_delta_rewrite(WT_SESSION_IMPL *session, WT_STUFF *ss)
+{
+	WT_ADDR *chain, *deltas;
+	WT_BM *bm;
+	WT_DECL_ITEM(tmp);
+	WT_DECL_RET;
+	WT_ITEM image;
+	WT_TRACK *trk;
+	size_t addr_size, allocated, size;
+	uint32_t chain_entries, entries, i;
+	uint8_t addr[WT_BTREE_MAX_ADDR_COOKIE];
+
+	bm = S2BT(session)->bm;
+	chain = deltas = NULL;
+	chain_entries = entries = 0;
+	allocated = 0;
+	WT_CLEAR(image);
+	WT_RET(__wt_scr_alloc(session, 0, &tmp));
+
+	/*
+	 * Every block in the file that might be part of a delta chain is
+	 * still allocated, it's safe to write.  The delta blocks are freed
+	 * once all of the pages are written, a delta block might be part of
+	 * a newer delta's chain.  The new image keeps the delta's write
+	 * generation.
+	 */
+	for (i = 0; i < ss->pages_next; ++i) {
+		if ((trk = ss->pages[i]) == NULL ||
+		    !F_ISSET(trk, WT_TRACK_DELTA))
+			continue;
+
+		WT_ERR(__wt_bt_read(
+		    session, &image, trk->trk_addr, trk->trk_addr_size));
+		WT_ERR(__wt_delta_build(
+		    session, &image, &chain, &chain_entries));
+		__wt_delta_chain_free(session, &chain, chain_entries);
+
+		/* Write buffers must be aligned, copy into a scratch buffer. */
+		size = image.size;
+		WT_ERR(bm->write_size(bm, session, &size));
+		WT_ERR(__wt_buf_init(session, tmp, size));
+		memcpy(tmp->mem, image.data, image.size);
+		tmp->size = image.size;
+		__wt_buf_free(session, &image);
+		WT_ERR(__wt_bt_write(session, tmp, addr, &addr_size,
+		    false, __wt_btree_checkpoint_io(session), false));
+
+		WT_ERR(__wt_verbose(session, WT_VERB_SALVAGE,
+		    "%s page built from deltas written to %s",
+		    __wt_addr_string(session,
+		    trk->trk_addr, trk->trk_addr_size, ss->tmp1),
+		    __wt_addr_string(session, addr, addr_size, ss->tmp2)));
+
+		WT_ERR(__wt_realloc_def(
+		    session, &allocated, entries + 1, &deltas));
+		deltas[entries].addr = trk->trk_addr;
+		deltas[entries].size = trk->trk_addr_size;
+		++entries;
+		trk->trk_addr = NULL;
+		WT_ERR(__wt_strndup(session, addr, addr_size, &trk->trk_addr));
+		trk->trk_addr_size = (uint8_t)addr_size;
+		F_CLR(trk, WT_TRACK_DELTA);
+	}
+
+	for (i = 0; i < entries; ++i)
+		WT_ERR(bm->free(bm, session, deltas[i].addr, deltas[i].size));
 
+err:	__wt_buf_free(session, &image);
+	__wt_scr_free(session, &tmp);
+	__wt_delta_chain_free(session, &deltas, entries);
 	return (ret);
 }
 
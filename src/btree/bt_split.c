@@ -1897,11 +1897,13 @@ __wt_split_insert(WT_SESSION_IMPL *session, WT_REF *ref)
 
 	WT_RET(__wt_verbose(
 	    session, WT_VERB_SPLIT, "%p: split-insert", ref->page));
+	WT_TRACE(session,
+	    WT_TRACE_SPLIT_INSERT_START, ref->page->memory_footprint);
 
-	WT_RET(__split_internal_lock(session, ref, true, &parent, &hazard));
+	WT_ERR(__split_internal_lock(session, ref, true, &parent, &hazard));
 	if ((ret = __split_insert(session, ref)) != 0) {
 		WT_TRET(__split_internal_unlock(session, parent, hazard));
-		return (ret);
+		goto err;
 	}
 
 	/*
@@ -1909,7 +1911,10 @@ __wt_split_insert(WT_SESSION_IMPL *session, WT_REF *ref)
 	 * parent page locked, note the functions we call are responsible for
 	 * releasing that lock.
 	 */
-	return (__split_parent_climb(session, parent, hazard));
+	ret = __split_parent_climb(session, parent, hazard);
+
+err:	WT_TRACE(session, WT_TRACE_SPLIT_INSERT_STOP, ret);
+	return (ret);
 }
 
 /*
@@ -1989,11 +1994,13 @@ __wt_split_multi(WT_SESSION_IMPL *session, WT_REF *ref, int closing)
 
 	WT_RET(__wt_verbose(
 	    session, WT_VERB_SPLIT, "%p: split-multi", ref->page));
+	WT_TRACE(session,
+	    WT_TRACE_SPLIT_MULTI_START, ref->page->memory_footprint);
 
-	WT_RET(__split_internal_lock(session, ref, false, &parent, &hazard));
+	WT_ERR(__split_internal_lock(session, ref, false, &parent, &hazard));
 	if ((ret = __split_multi(session, ref, closing)) != 0 || closing) {
 		WT_TRET(__split_internal_unlock(session, parent, hazard));
-		return (ret);
+		goto err;
 	}
 
 	/*
@@ -2001,7 +2008,10 @@ __wt_split_multi(WT_SESSION_IMPL *session, WT_REF *ref, int closing)
 	 * parent page locked, note the functions we call are responsible for
 	 * releasing that lock.
 	 */
-	return (__split_parent_climb(session, parent, hazard));
+	ret = __split_parent_climb(session, parent, hazard);
+
+err:	WT_TRACE(session, WT_TRACE_SPLIT_MULTI_STOP, ret);
+	return (ret);
 }
 
 /*
@@ -2018,10 +2028,13 @@ __wt_split_reverse(WT_SESSION_IMPL *session, WT_REF *ref)
 
 	WT_RET(__wt_verbose(
 	    session, WT_VERB_SPLIT, "%p: reverse-split", ref->page));
+	WT_TRACE(session, WT_TRACE_SPLIT_REVERSE_START, 0);
 
-	WT_RET(__split_internal_lock(session, ref, false, &parent, &hazard));
+	WT_ERR(__split_internal_lock(session, ref, false, &parent, &hazard));
 	ret = __split_parent(session, ref, NULL, 0, 0, false, true);
 	WT_TRET(__split_internal_unlock(session, parent, hazard));
+
+err:	WT_TRACE(session, WT_TRACE_SPLIT_REVERSE_STOP, ret);
 	return (ret);
 }
 
@@ -2042,6 +2055,8 @@ __wt_split_rewrite(WT_SESSION_IMPL *session, WT_REF *ref)
 
 	WT_RET(__wt_verbose(
 	    session, WT_VERB_SPLIT, "%p: split-rewrite", ref->page));
+	WT_TRACE(session,
+	    WT_TRACE_SPLIT_REWRITE_START, page->memory_footprint);
 
 	/*
 	 * This isn't a split: a reconciliation failed because we couldn't write
@@ -2077,8 +2092,10 @@ __wt_split_rewrite(WT_SESSION_IMPL *session, WT_REF *ref)
 	ref->page = new.page;
 	WT_PUBLISH(ref->state, WT_REF_MEM);
 
+	WT_TRACE(session, WT_TRACE_SPLIT_REWRITE_STOP, 0);
 	return (0);
 
 err:	__split_multi_inmem_fail(session, page, &new);
+	WT_TRACE(session, WT_TRACE_SPLIT_REWRITE_STOP, ret);
 	return (ret);
 }
@@ -20,6 +20,10 @@ typedef struct {
 
 	uint64_t fcnt;				/* Progress counter */
 
+	u_int threads;				/* Configure: threads */
+	struct __wt_vparallel *parallel;	/* Parallel verification */
+	bool report;				/* Report progress */
+
 #define	WT_VRFY_DUMP(vs)						\
 	((vs)->dump_address ||						\
 	    (vs)->dump_blocks || (vs)->dump_pages || (vs)->dump_shape)
@@ -34,7 +38,43 @@ typedef struct {
 	WT_ITEM *tmp2;				/* Temporary buffer */
 } WT_VSTUFF;
 
+/*
+ * Parallel verification: the subtrees referenced by the root page are verified
+ * by a set of threads, each with its own verification state.  A depth-first
+ * traversal checks each subtree against the subtrees before it (key order and
+ * record numbers), those checks are done once all of the subtrees have been
+ * verified, using the results saved for each subtree.
+ */
+typedef struct {
+	WT_ITEM max_key;			/* Largest key */
+	WT_ITEM max_addr;			/* Largest key page */
+	uint64_t record_total;			/* Total record count */
+} WT_VSUBTREE;
+
+typedef struct __wt_vparallel {
+	WT_PAGE *page;				/* Root page */
+	WT_PAGE_INDEX *pindex;			/* Root page's children */
+	WT_VSUBTREE *subtree;			/* Per-child results */
+
+	uint32_t next;				/* Next child to verify */
+	volatile bool error;			/* A thread failed */
+
+	uint64_t fcnt;				/* Progress counter */
+} WT_VPARALLEL;
+
+typedef struct {
+	WT_VPARALLEL *vp;			/* Shared information */
+	WT_SESSION_IMPL *session;		/* Thread's session */
+	WT_VSTUFF vstuff;			/* Thread's verify state */
+
+	wt_thread_t tid;			/* Thread ID */
+	bool tid_set;
+	int thread_ret;				/* Thread's return */
+} WT_VWORKER;
+
 static void __verify_checkpoint_reset(WT_VSTUFF *);
+static int  __verify_col_int_recno(
+	WT_SESSION_IMPL *, WT_REF *, uint32_t, WT_VSTUFF *);
 static int  __verify_overflow(
 	WT_SESSION_IMPL *, const uint8_t *, size_t, WT_VSTUFF *);
 static int  __verify_overflow_cell(
@@ -44,6 +84,7 @@ static int  __verify_row_int_key_order(
 static int  __verify_row_leaf_key_order(
 	WT_SESSION_IMPL *, WT_REF *, WT_VSTUFF *);
 static int  __verify_tree(WT_SESSION_IMPL *, WT_REF *, WT_VSTUFF *);
+static int  __verify_tree_parallel(WT_SESSION_IMPL *, WT_REF *, WT_VSTUFF *);
 
 /*
  * __verify_config --
@@ -66,6 +107,10 @@ __verify_config(WT_SESSION_IMPL *session, const char *cfg[], WT_VSTUFF *vs)
 	WT_RET(__wt_config_gets(session, cfg, "dump_shape", &cval));
 	vs->dump_shape = cval.val != 0;
 
+	WT_RET(__wt_config_gets(session, cfg, "threads", &cval));
+	vs->threads = (u_int)cval.val;
+	vs->report = true;
+
 #if !defined(HAVE_DIAGNOSTIC)
 	if (vs->dump_blocks || vs->dump_pages)
 		WT_RET_MSG(session, ENOTSUP,
@@ -292,7 +337,7 @@ __verify_tree(WT_SESSION_IMPL *session, WT_REF *ref, WT_VSTUFF *vs)
 	WT_DECL_RET;
 	WT_PAGE *page;
 	WT_REF *child_ref;
-	uint64_t recno;
+	uint64_t fcnt, recno;
 	uint32_t entry, i;
 	bool found;
 
@@ -344,8 +389,10 @@ __verify_tree(WT_SESSION_IMPL *session, WT_REF *ref, WT_VSTUFF *vs)
 	 * Report progress occasionally.
 	 */
 #define	WT_VERIFY_PROGRESS_INTERVAL	100
-	if (++vs->fcnt % WT_VERIFY_PROGRESS_INTERVAL == 0)
-		WT_RET(__wt_progress(session, NULL, vs->fcnt));
+	fcnt = vs->parallel == NULL ?
+	    ++vs->fcnt : __wt_atomic_add64(&vs->parallel->fcnt, 1);
+	if (vs->report && fcnt % WT_VERIFY_PROGRESS_INTERVAL == 0)
+		WT_RET(__wt_progress(session, NULL, fcnt));
 
 #ifdef HAVE_DIAGNOSTIC
 	/* Optionally dump the blocks or page in debugging mode. */
@@ -355,6 +402,23 @@ __verify_tree(WT_SESSION_IMPL *session, WT_REF *ref, WT_VSTUFF *vs)
 		WT_RET(__wt_debug_page(session, page, NULL));
 #endif
 
+	/*
+	 * If a row-store leaf page was read from a delta, verify the addresses
+	 * of the blocks in the page's delta chain, the parent page references
+	 * only the most recent delta.  Each block in the chain was physically
+	 * verified as it was read, verify the page image built from them.
+	 */
+	if (page->type == WT_PAGE_ROW_LEAF && page->modify != NULL &&
+	    page->modify->delta_chain_entries != 0) {
+		for (i = 0; i < page->modify->delta_chain_entries; ++i)
+			WT_RET(bm->verify_addr(bm, session,
+			    page->modify->delta_chain[i].addr,
+			    page->modify->delta_chain[i].size));
+		WT_RET(__wt_verify_dsk_image(session,
+		    __wt_page_addr_string(session, ref, vs->tmp1),
+		    page->dsk, page->dsk->mem_size, false));
+	}
+
 	/*
 	 * Column-store key order checks: check the page's record number and
 	 * then update the total record count.
@@ -470,30 +534,23 @@ celltype_err:			WT_RET_MSG(session, WT_ERROR,
 		break;
 	}
 
+	/*
+	 * Optionally verify the subtrees of the root page in parallel (the
+	 * debugging output is ordered, it's done on a single thread).
+	 */
+	if (vs->threads > 1 && __wt_ref_is_root(ref) &&
+	    WT_PAGE_IS_INTERNAL(page) && !WT_VRFY_DUMP(vs))
+		return (__verify_tree_parallel(session, ref, vs));
+
 	/* Check tree connections and recursively descend the tree. */
 	switch (page->type) {
 	case WT_PAGE_COL_INT:
 		/* For each entry in an internal page, verify the subtree. */
 		entry = 0;
 		WT_INTL_FOREACH_BEGIN(session, page, child_ref) {
-			/*
-			 * It's a depth-first traversal: this entry's starting
-			 * record number should be 1 more than the total records
-			 * reviewed to this point.
-			 */
 			++entry;
-			if (child_ref->key.recno != vs->record_total + 1) {
-				WT_RET_MSG(session, WT_ERROR,
-				    "the starting record number in entry %"
-				    PRIu32 " of the column internal page at "
-				    "%s is %" PRIu64 " and the expected "
-				    "starting record number is %" PRIu64,
-				    entry,
-				    __wt_page_addr_string(
-				    session, child_ref, vs->tmp1),
-				    child_ref->key.recno,
-				    vs->record_total + 1);
-			}
+			WT_RET(__verify_col_int_recno(
+			    session, child_ref, entry, vs));
 
 			/* Verify the subtree. */
 			++vs->depth;
@@ -542,6 +599,271 @@ celltype_err:			WT_RET_MSG(session, WT_ERROR,
 	return (0);
 }
 
+/*
+ * __verify_vstuff_init --
+ *	Initialize a verification thread's state.
+ */
+static int
+__verify_vstuff_init(
+    WT_SESSION_IMPL *session, WT_VPARALLEL *vp, WT_VSTUFF *vs, bool report)
+{
+	WT_RET(__wt_scr_alloc(session, 0, &vs->max_key));
+	WT_RET(__wt_scr_alloc(session, 0, &vs->max_addr));
+	WT_RET(__wt_scr_alloc(session, 0, &vs->tmp1));
+	WT_RET(__wt_scr_alloc(session, 0, &vs->tmp2));
+
+	vs->parallel = vp;
+	vs->report = report;
+	return (0);
+}
+
+/*
+ * __verify_vstuff_free --
+ *	Discard a verification thread's state.
+ */
+static void
+__verify_vstuff_free(WT_SESSION_IMPL *session, WT_VSTUFF *vs)
+{
+	__wt_scr_free(session, &vs->max_key);
+	__wt_scr_free(session, &vs->max_addr);
+	__wt_scr_free(session, &vs->tmp1);
+	__wt_scr_free(session, &vs->tmp2);
+}
+
+/*
+ * __verify_subtrees --
+ *	Verify subtrees of the root page until there are none left.
+ */
+static int
+__verify_subtrees(WT_SESSION_IMPL *session, WT_VPARALLEL *vp, WT_VSTUFF *vs)
+{
+	WT_BM *bm;
+	WT_CELL_UNPACK unpack;
+	WT_DECL_RET;
+	WT_ITEM item;
+	WT_REF *ref;
+	WT_VSUBTREE *st;
+	uint32_t i;
+
+	bm = S2BT(session)->bm;
+
+	while (!vp->error &&
+	    (i = __wt_atomic_add32(&vp->next, 1) - 1) < vp->pindex->entries) {
+		ref = vp->pindex->index[i];
+		st = &vp->subtree[i];
+
+		/*
+		 * Start from the state a depth-first traversal would be in
+		 * after checking this child's entry in the root page: the
+		 * root page's first child starts the tree, the others start
+		 * with their entry's key or starting record number.
+		 */
+		vs->depth = 2;
+		vs->record_total = 0;
+		vs->max_addr->size = 0;
+		if (i != 0)
+			switch (vp->page->type) {
+			case WT_PAGE_COL_INT:
+				vs->record_total = ref->key.recno - 1;
+				break;
+			case WT_PAGE_ROW_INT:
+				__wt_ref_key(
+				    vp->page, ref, &item.data, &item.size);
+				WT_RET(__wt_buf_set(session,
+				    vs->max_key, item.data, item.size));
+				(void)__wt_page_addr_string(
+				    session, ref, vs->max_addr);
+				break;
+			}
+
+		/* Verify the subtree. */
+		WT_RET(__wt_page_in(session, ref, 0));
+		ret = __verify_tree(session, ref, vs);
+		WT_TRET(__wt_page_release(session, ref, 0));
+		WT_RET(ret);
+
+		__wt_cell_unpack(ref->addr, &unpack);
+		WT_RET(bm->verify_addr(bm, session, unpack.data, unpack.size));
+
+		/* Save the results for the checks against the next subtree. */
+		st->record_total = vs->record_total;
+		if (vs->max_addr->size != 0) {
+			WT_RET(__wt_buf_set(session, &st->max_key,
+			    vs->max_key->data, vs->max_key->size));
+			WT_RET(__wt_buf_fmt(session,
+			    &st->max_addr, "%s", (char *)vs->max_addr->data));
+		}
+	}
+	return (0);
+}
+
+/*
+ * __verify_worker --
+ *	Parallel verification thread.
+ */
+static WT_THREAD_RET
+__verify_worker(void *arg)
+{
+	WT_SESSION_IMPL *session;
+	WT_VWORKER *w;
+
+	w = arg;
+	session = w->session;
+
+	WT_WITH_PAGE_INDEX(session,
+	    w->thread_ret = __verify_subtrees(session, w->vp, &w->vstuff));
+	if (w->thread_ret != 0)
+		w->vp->error = true;
+	return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * __verify_tree_parallel --
+ *	Verify the subtrees of the root page in parallel, then check them
+ * against each other.
+ */
+static int
+__verify_tree_parallel(WT_SESSION_IMPL *session, WT_REF *ref, WT_VSTUFF *vs)
+{
+	WT_DECL_RET;
+	WT_PAGE *page;
+	WT_REF *child_ref;
+	WT_SESSION *wt_session;
+	WT_VPARALLEL *vp, _vparallel;
+	WT_VSUBTREE *st;
+	WT_VWORKER *w, *workers;
+	size_t j;
+	uint32_t i, nworkers;
+
+	page = ref->page;
+	workers = NULL;
+
+	WT_CLEAR(_vparallel);
+	vp = &_vparallel;
+	vp->page = page;
+	WT_INTL_INDEX_GET(session, page, vp->pindex);
+	vp->fcnt = vs->fcnt;
+
+	nworkers = WT_MIN(vs->threads, vp->pindex->entries);
+	WT_ERR(__wt_calloc_def(session, vp->pindex->entries, &vp->subtree));
+	WT_ERR(__wt_calloc_def(session, nworkers, &workers));
+
+	/*
+	 * The calling thread is the first worker, the others get their own
+	 * sessions, sharing the caller's exclusive handle.
+	 */
+	for (i = 0; i < nworkers; ++i) {
+		w = &workers[i];
+		w->vp = vp;
+		if (i == 0)
+			w->session = session;
+		else {
+			WT_ERR(__wt_open_internal_session(S2C(session),
+			    "verify-worker", false, 0, &w->session));
+			w->session->dhandle = session->dhandle;
+		}
+		WT_ERR(__verify_vstuff_init(
+		    w->session, vp, &w->vstuff, vs->report && i == 0));
+	}
+	for (i = 1; i < nworkers; ++i) {
+		w = &workers[i];
+		WT_ERR(__wt_thread_create(
+		    session, &w->tid, __verify_worker, w));
+		w->tid_set = true;
+	}
+	ret = __verify_subtrees(session, vp, &workers[0].vstuff);
+
+err:	if (ret != 0)
+		vp->error = true;
+	if (workers != NULL)
+		for (i = 0; i < nworkers; ++i) {
+			w = &workers[i];
+			if (w->tid_set) {
+				WT_TRET(__wt_thread_join(session, w->tid));
+				WT_TRET(w->thread_ret);
+			}
+		}
+
+	/*
+	 * Check each subtree against the subtrees before it, the same checks
+	 * as a depth-first traversal, then merge the threads' tree shapes.
+	 */
+	for (i = 0; ret == 0 && i < vp->pindex->entries; ++i) {
+		child_ref = vp->pindex->index[i];
+		st = &vp->subtree[i];
+		switch (page->type) {
+		case WT_PAGE_COL_INT:
+			WT_TRET(__verify_col_int_recno(
+			    session, child_ref, i + 1, vs));
+			vs->record_total = st->record_total;
+			break;
+		case WT_PAGE_ROW_INT:
+			if (i != 0)
+				WT_TRET(__verify_row_int_key_order(
+				    session, page, child_ref, i + 1, vs));
+			if (ret == 0 && st->max_addr.size != 0) {
+				WT_TRET(__wt_buf_set(session, vs->max_key,
+				    st->max_key.data, st->max_key.size));
+				WT_TRET(__wt_buf_fmt(session, vs->max_addr,
+				    "%s", (char *)st->max_addr.data));
+			}
+			break;
+		}
+	}
+	vs->fcnt = vp->fcnt;
+
+	if (workers != NULL)
+		for (i = 0; i < nworkers; ++i) {
+			w = &workers[i];
+			for (j = 0; j < WT_ELEMENTS(vs->depth_internal); ++j) {
+				vs->depth_internal[j] +=
+				    w->vstuff.depth_internal[j];
+				vs->depth_leaf[j] += w->vstuff.depth_leaf[j];
+			}
+			if (w->session == NULL)
+				continue;
+			__verify_vstuff_free(w->session, &w->vstuff);
+			if (i != 0) {
+				w->session->dhandle = NULL;
+				wt_session = &w->session->iface;
+				WT_TRET(wt_session->close(wt_session, NULL));
+			}
+		}
+	__wt_free(session, workers);
+
+	if (vp->subtree != NULL)
+		for (i = 0; i < vp->pindex->entries; ++i) {
+			__wt_buf_free(session, &vp->subtree[i].max_key);
+			__wt_buf_free(session, &vp->subtree[i].max_addr);
+		}
+	__wt_free(session, vp->subtree);
+
+	return (ret);
+}
+
+/*
+ * __verify_col_int_recno --
+ *	Compare the starting record number of an entry on a column-store
+ * internal page to the total records reviewed so far.
+ */
+static int
+__verify_col_int_recno(
+    WT_SESSION_IMPL *session, WT_REF *ref, uint32_t entry, WT_VSTUFF *vs)
+{
+	/*
+	 * It's a depth-first traversal: this entry's starting record number
+	 * should be 1 more than the total records reviewed to this point.
+	 */
+	if (ref->key.recno != vs->record_total + 1)
+		WT_RET_MSG(session, WT_ERROR,
+		    "the starting record number in entry %" PRIu32 " of the "
+		    "column internal page at %s is %" PRIu64 " and the "
+		    "expected starting record number is %" PRIu64,
+		    entry, __wt_page_addr_string(session, ref, vs->tmp1),
+		    ref->key.recno, vs->record_total + 1);
+	return (0);
+}
+
 /*
  * __verify_row_int_key_order --
  *	Compare a key on an internal page to the largest key we've seen so
@@ -24,6 +24,8 @@ static int __verify_dsk_memsize(
 	WT_SESSION_IMPL *, const char *, const WT_PAGE_HEADER *, WT_CELL *);
 static int __verify_dsk_row(
 	WT_SESSION_IMPL *, const char *, const WT_PAGE_HEADER *);
+static int __verify_dsk_row_delta(
+	WT_SESSION_IMPL *, const char *, const WT_PAGE_HEADER *);
 
 #define	WT_ERR_VRFY(session, ...) do {					\
 	if (!(F_ISSET(session, WT_SESSION_QUIET_CORRUPT_FILE)))		\
@@ -58,6 +60,7 @@ __wt_verify_dsk_image(WT_SESSION_IMPL *session,
 	case WT_PAGE_OVFL:
 	case WT_PAGE_ROW_INT:
 	case WT_PAGE_ROW_LEAF:
+	case WT_PAGE_ROW_LEAF_DELTA:
 		break;
 	case WT_PAGE_INVALID:
 	default:
@@ -80,6 +83,7 @@ __wt_verify_dsk_image(WT_SESSION_IMPL *session,
 	case WT_PAGE_OVFL:
 	case WT_PAGE_ROW_INT:
 	case WT_PAGE_ROW_LEAF:
+	case WT_PAGE_ROW_LEAF_DELTA:
 		if (dsk->recno == WT_RECNO_OOB)
 			break;
 		WT_RET_VRFY(session,
@@ -142,6 +146,7 @@ __wt_verify_dsk_image(WT_SESSION_IMPL *session,
 	case WT_PAGE_COL_VAR:
 	case WT_PAGE_ROW_INT:
 	case WT_PAGE_ROW_LEAF:
+	case WT_PAGE_ROW_LEAF_DELTA:
 		if (!empty_page_ok && dsk->u.entries == 0)
 			WT_RET_VRFY(session, "%s page at %s has no entries",
 			    __wt_page_type_string(dsk->type), tag);
@@ -163,6 +168,8 @@ __wt_verify_dsk_image(WT_SESSION_IMPL *session,
 	case WT_PAGE_ROW_INT:
 	case WT_PAGE_ROW_LEAF:
 		return (__verify_dsk_row(session, tag, dsk));
+	case WT_PAGE_ROW_LEAF_DELTA:
+		return (__verify_dsk_row_delta(session, tag, dsk));
 	case WT_PAGE_BLOCK_MANAGER:
 	case WT_PAGE_OVFL:
 		return (__verify_dsk_chunk(session, tag, dsk, dsk->u.datalen));
@@ -467,6 +474,127 @@ err:		if (ret == 0)
 	return (ret);
 }
 
+/*
+ * __verify_dsk_row_delta --
+ *	Walk a WT_PAGE_ROW_LEAF_DELTA disk page and verify it.
+ */
+static int
+__verify_dsk_row_delta(
+    WT_SESSION_IMPL *session, const char *tag, const WT_PAGE_HEADER *dsk)
+{
+	WT_BM *bm;
+	WT_BTREE *btree;
+	WT_CELL *cell;
+	WT_CELL_UNPACK *unpack, _unpack;
+	WT_DECL_ITEM(current);
+	WT_DECL_ITEM(last);
+	WT_DECL_RET;
+	enum { FIRST, WAS_ADDR, WAS_KEY, WAS_VALUE } last_cell_type;
+	uint32_t cell_num, i;
+	uint8_t *end;
+	int cmp;
+
+	btree = S2BT(session);
+	bm = btree->bm;
+	unpack = &_unpack;
+
+	WT_ERR(__wt_scr_alloc(session, 0, &current));
+	WT_ERR(__wt_scr_alloc(session, 0, &last));
+
+	end = (uint8_t *)dsk + dsk->mem_size;
+
+	/*
+	 * A delta page is the address of the previous block followed by sorted
+	 * keys, each followed by an optional value or remove cell.  Keys are
+	 * never prefix-compressed and items are never overflow items.
+	 */
+	last_cell_type = FIRST;
+	cell_num = 0;
+	WT_CELL_FOREACH(btree, dsk, cell, unpack, i) {
+		++cell_num;
+
+		/* Carefully unpack the cell. */
+		if (__wt_cell_unpack_safe(cell, unpack, dsk, end) != 0) {
+			ret = __err_cell_corrupt(session, cell_num, tag);
+			goto err;
+		}
+
+		/* Check the raw cell type. */
+		WT_ERR(__err_cell_type(
+		    session, cell_num, tag, unpack->raw, dsk->type));
+
+		switch (unpack->type) {
+		case WT_CELL_ADDR_LEAF:
+			if (last_cell_type != FIRST)
+				WT_ERR_VRFY(session,
+				    "cell %" PRIu32 " on page at %s is an "
+				    "address cell that is not the first cell "
+				    "on the page",
+				    cell_num, tag);
+			last_cell_type = WAS_ADDR;
+
+			ret = bm->addr_invalid(
+			    bm, session, unpack->data, unpack->size);
+			WT_RET_ERROR_OK(ret, EINVAL);
+			if (ret == EINVAL) {
+				ret = __err_cell_corrupt_or_eof(
+				    session, cell_num, tag);
+				goto err;
+			}
+			break;
+		case WT_CELL_DEL:
+		case WT_CELL_VALUE:
+			if (last_cell_type != WAS_KEY)
+				WT_ERR_VRFY(session,
+				    "cell %" PRIu32 " on page at %s is a value "
+				    "that does not follow a key",
+				    cell_num, tag);
+			last_cell_type = WAS_VALUE;
+			break;
+		case WT_CELL_KEY:
+			if (last_cell_type == FIRST)
+				WT_ERR_VRFY(session,
+				    "page at %s does not begin with an address",
+				    tag);
+			if (unpack->prefix != 0)
+				WT_ERR_VRFY(session,
+				    "key %" PRIu32 " on page at %s has a "
+				    "non-zero prefix compression value",
+				    cell_num, tag);
+
+			/* Compare the current key against the last key. */
+			WT_ERR(__wt_buf_set(
+			    session, current, unpack->data, unpack->size));
+			if (last_cell_type != WAS_ADDR) {
+				WT_ERR(__wt_compare(session,
+				    btree->collator, last, current, &cmp));
+				if (cmp >= 0)
+					WT_ERR_VRFY(session,
+					    "the keys before cell %" PRIu32
+					    " on page at %s are incorrectly "
+					    "sorted",
+					    cell_num, tag);
+			}
+			WT_ERR(__wt_buf_set(
+			    session, last, current->data, current->size));
+			last_cell_type = WAS_KEY;
+			break;
+		}
+	}
+	if (last_cell_type == FIRST)
+		WT_ERR_VRFY(session,
+		    "page at %s does not begin with an address", tag);
+	WT_ERR(__verify_dsk_memsize(session, tag, dsk, cell));
+
+	if (0) {
+err:		if (ret == 0)
+			ret = WT_ERROR;
+	}
+	__wt_scr_free(session, &current);
+	__wt_scr_free(session, &last);
+	return (ret);
+}
+
 /*
  * __verify_dsk_col_int --
  *	Walk a WT_PAGE_COL_INT disk page and verify it.
@@ -720,19 +848,30 @@ __err_cell_type(WT_SESSION_IMPL *session,
 	switch (cell_type) {
 	case WT_CELL_ADDR_DEL:
 	case WT_CELL_ADDR_INT:
-	case WT_CELL_ADDR_LEAF:
 	case WT_CELL_ADDR_LEAF_NO:
 		if (dsk_type == WT_PAGE_COL_INT ||
 		    dsk_type == WT_PAGE_ROW_INT)
 			return (0);
 		break;
+	case WT_CELL_ADDR_LEAF:
+		if (dsk_type == WT_PAGE_COL_INT ||
+		    dsk_type == WT_PAGE_ROW_INT ||
+		    dsk_type == WT_PAGE_ROW_LEAF_DELTA)
+			return (0);
+		break;
 	case WT_CELL_DEL:
-		if (dsk_type == WT_PAGE_COL_VAR)
+		if (dsk_type == WT_PAGE_COL_VAR ||
+		    dsk_type == WT_PAGE_ROW_LEAF_DELTA)
 			return (0);
 		break;
 	case WT_CELL_KEY:
-	case WT_CELL_KEY_OVFL:
 	case WT_CELL_KEY_SHORT:
+		if (dsk_type == WT_PAGE_ROW_INT ||
+		    dsk_type == WT_PAGE_ROW_LEAF ||
+		    dsk_type == WT_PAGE_ROW_LEAF_DELTA)
+			return (0);
+		break;
+	case WT_CELL_KEY_OVFL:
 		if (dsk_type == WT_PAGE_ROW_INT ||
 		    dsk_type == WT_PAGE_ROW_LEAF)
 			return (0);
@@ -750,9 +889,14 @@ __err_cell_type(WT_SESSION_IMPL *session,
 		 */
 		break;
 	case WT_CELL_VALUE:
+	case WT_CELL_VALUE_SHORT:
+		if (dsk_type == WT_PAGE_COL_VAR ||
+		    dsk_type == WT_PAGE_ROW_LEAF ||
+		    dsk_type == WT_PAGE_ROW_LEAF_DELTA)
+			return (0);
+		break;
 	case WT_CELL_VALUE_COPY:
 	case WT_CELL_VALUE_OVFL:
-	case WT_CELL_VALUE_SHORT:
 		if (dsk_type == WT_PAGE_COL_VAR ||
 		    dsk_type == WT_PAGE_ROW_LEAF)
 			return (0);
@@ -295,6 +295,20 @@ ascend:	/*
 					if (skip)
 						break;
 				}
+			} else if (LF_ISSET(WT_READ_WARMUP)) {
+				/*
+				 * Cache warm-up reads the pages recorded when
+				 * the file was closed, it doesn't read deleted
+				 * pages.
+				 */
+				if (ref->state == WT_REF_DELETED)
+					break;
+				if (ref->state == WT_REF_DISK) {
+					WT_ERR(__wt_warmup_page_skip(
+					    session, ref, &skip));
+					if (skip)
+						break;
+				}
 			} else {
 				/*
 				 * Try to skip deleted pages visible to us.
@@ -0,0 +1,270 @@
+/*-
+ * Copyright (c) 2014-2015 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * The compressed cache holds compressed block images read from data files,
+ * so a page evicted from the cache and read again costs a copy and
+ * decompression rather than a read from the file.
+ *
+ * Blocks are found by file ID and address cookie. The address cookie includes
+ * the block's checksum, so if a block is freed and its space reused, the new
+ * block has a different cookie and the stale image is never found again; it
+ * ages out of the cache like any other unused image.
+ */
+
+/*
+ * __ccache_hash --
+ *	Hash a file ID and address cookie.
+ */
+static inline uint64_t
+__ccache_hash(uint32_t id, const uint8_t *addr, size_t addr_size)
+{
+	return (__wt_hash_city64(addr, addr_size) ^ ((uint64_t)id << 32));
+}
+
+/*
+ * __ccache_search --
+ *	Search a partition's hash bucket for a block.
+ */
+static inline WT_CCACHE_ENTRY *
+__ccache_search(WT_CCACHE_PART *part, uint32_t bucket,
+    uint64_t hash, uint32_t id, const uint8_t *addr, size_t addr_size)
+{
+	WT_CCACHE_ENTRY *e;
+
+	TAILQ_FOREACH(e, &part->hash[bucket], hashq)
+		if (e->hash == hash && e->id == id &&
+		    e->addr_size == addr_size &&
+		    memcmp(WT_CCACHE_ADDR(e), addr, addr_size) == 0)
+			return (e);
+	return (NULL);
+}
+
+/*
+ * __wt_ccache_read --
+ *	Copy a block from the compressed cache, if it's there.
+ */
+int
+__wt_ccache_read(WT_SESSION_IMPL *session,
+    WT_ITEM *buf, const uint8_t *addr, size_t addr_size, bool *foundp)
+{
+	WT_CCACHE *ccache;
+	WT_CCACHE_ENTRY *e;
+	WT_CCACHE_PART *part;
+	WT_DECL_RET;
+	uint64_t hash;
+	uint32_t id;
+
+	*foundp = false;
+
+	ccache = S2C(session)->cache->ccache;
+	id = S2BT(session)->id;
+	hash = __ccache_hash(id, addr, addr_size);
+	part = &ccache->part[hash % WT_CCACHE_PARTS];
+
+	__wt_spin_lock(session, &part->lock);
+	if ((e = __ccache_search(part,
+	    (uint32_t)((hash / WT_CCACHE_PARTS) % ccache->buckets),
+	    hash, id, addr, addr_size)) != NULL) {
+		/* Move the entry to the head of the LRU list. */
+		TAILQ_REMOVE(&part->qh, e, q);
+		TAILQ_INSERT_HEAD(&part->qh, e, q);
+
+		ret = __wt_buf_set(session, buf, WT_CCACHE_IMAGE(e), e->size);
+		*foundp = ret == 0;
+	}
+	__wt_spin_unlock(session, &part->lock);
+
+	if (*foundp)
+		WT_STAT_FAST_CONN_INCR(session, cache_compressed_hit);
+	else
+		WT_STAT_FAST_CONN_INCR(session, cache_compressed_miss);
+	return (ret);
+}
+
+/*
+ * __wt_ccache_insert --
+ *	Add a block read from a data file to the compressed cache.
+ */
+int
+__wt_ccache_insert(WT_SESSION_IMPL *session,
+    const uint8_t *addr, size_t addr_size, const void *image, size_t size)
+{
+	WT_CCACHE *ccache;
+	WT_CCACHE_ENTRY *e, *evict, *next;
+	WT_CCACHE_PART *part;
+	uint64_t hash, evicted;
+	uint32_t bucket, id;
+
+	ccache = S2C(session)->cache->ccache;
+
+	/* Don't let a single image flush a partition. */
+	if (sizeof(WT_CCACHE_ENTRY) + addr_size + size > ccache->bytes_max / 4)
+		return (0);
+
+	id = S2BT(session)->id;
+	hash = __ccache_hash(id, addr, addr_size);
+	part = &ccache->part[hash % WT_CCACHE_PARTS];
+	bucket = (uint32_t)((hash / WT_CCACHE_PARTS) % ccache->buckets);
+
+	/* Build the entry before acquiring the lock. */
+	WT_RET(__wt_calloc(session,
+	    1, sizeof(WT_CCACHE_ENTRY) + addr_size + size, &e));
+	e->hash = hash;
+	e->id = id;
+	e->addr_size = (uint32_t)addr_size;
+	e->size = size;
+	memcpy(WT_CCACHE_ADDR(e), addr, addr_size);
+	memcpy(WT_CCACHE_IMAGE(e), image, size);
+
+	evict = NULL;
+	evicted = 0;
+	__wt_spin_lock(session, &part->lock);
+
+	/* Another thread may have read the same block. */
+	if (__ccache_search(part, bucket, hash, id, addr, addr_size) != NULL) {
+		__wt_spin_unlock(session, &part->lock);
+		__wt_free(session, e);
+		return (0);
+	}
+
+	TAILQ_INSERT_HEAD(&part->hash[bucket], e, hashq);
+	TAILQ_INSERT_HEAD(&part->qh, e, q);
+	part->bytes += sizeof(WT_CCACHE_ENTRY) + e->addr_size + e->size;
+
+	/*
+	 * Discard the least recently used images until the partition fits,
+	 * chaining them through their LRU links to be freed after the lock is
+	 * released.
+	 */
+	while (part->bytes > ccache->bytes_max) {
+		next = TAILQ_LAST(&part->qh, __wt_ccache_qh);
+		TAILQ_REMOVE(&part->qh, next, q);
+		TAILQ_REMOVE(&part->hash[(next->hash / WT_CCACHE_PARTS) %
+		    ccache->buckets], next, hashq);
+		part->bytes -=
+		    sizeof(WT_CCACHE_ENTRY) + next->addr_size + next->size;
+		next->q.tqe_next = evict;
+		evict = next;
+		++evicted;
+	}
+	__wt_spin_unlock(session, &part->lock);
+
+	for (; evict != NULL; evict = next) {
+		next = evict->q.tqe_next;
+		__wt_free(session, evict);
+	}
+
+	WT_STAT_FAST_CONN_INCR(session, cache_compressed_insert);
+	WT_STAT_FAST_CONN_INCRV(session, cache_compressed_evict, evicted);
+	return (0);
+}
+
+/*
+ * __wt_ccache_stats_update --
+ *	Update the compressed cache statistics for return to the application.
+ */
+void
+__wt_ccache_stats_update(WT_SESSION_IMPL *session)
+{
+	WT_CCACHE *ccache;
+	WT_CONNECTION_IMPL *conn;
+	uint64_t bytes;
+	u_int i;
+
+	conn = S2C(session);
+	if ((ccache = conn->cache->ccache) == NULL)
+		return;
+
+	/* The partition byte counts are read without locking. */
+	for (bytes = 0, i = 0; i < WT_CCACHE_PARTS; ++i)
+		bytes += ccache->part[i].bytes;
+	WT_STAT_SET(session, conn->stats, cache_compressed_bytes, bytes);
+}
+
+/*
+ * __wt_ccache_create --
+ *	Create the compressed cache, if configured.
+ */
+int
+__wt_ccache_create(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_CACHE *cache;
+	WT_CCACHE *ccache;
+	WT_CCACHE_PART *part;
+	WT_CONFIG_ITEM cval;
+	WT_DECL_RET;
+	uint32_t buckets, i;
+
+	cache = S2C(session)->cache;
+
+	WT_RET(__wt_config_gets(session, cfg, "compressed_cache.size", &cval));
+	if (cval.val == 0)
+		return (0);
+
+	WT_RET(__wt_calloc_one(session, &ccache));
+	ccache->bytes_max = (uint64_t)cval.val / WT_CCACHE_PARTS;
+
+	/*
+	 * Size the hash table for 4KB images, the hash chains grow if images
+	 * are smaller than that.
+	 */
+	buckets = (uint32_t)
+	    WT_MIN(ccache->bytes_max / (4 * WT_KILOBYTE), 64 * WT_KILOBYTE);
+	ccache->buckets = WT_MAX(buckets, 64);
+
+	for (i = 0; i < WT_CCACHE_PARTS; ++i) {
+		part = &ccache->part[i];
+		WT_ERR(__wt_spin_init(
+		    session, &part->lock, "compressed cache"));
+		WT_ERR(__wt_calloc_def(session, ccache->buckets, &part->hash));
+		for (buckets = 0; buckets < ccache->buckets; ++buckets)
+			TAILQ_INIT(&part->hash[buckets]);
+		TAILQ_INIT(&part->qh);
+	}
+
+	cache->ccache = ccache;
+	return (0);
+
+err:	cache->ccache = ccache;
+	WT_TRET(__wt_ccache_destroy(session));
+	return (ret);
+}
+
+/*
+ * __wt_ccache_destroy --
+ *	Discard the compressed cache.
+ */
+int
+__wt_ccache_destroy(WT_SESSION_IMPL *session)
+{
+	WT_CACHE *cache;
+	WT_CCACHE *ccache;
+	WT_CCACHE_ENTRY *e;
+	WT_CCACHE_PART *part;
+	u_int i;
+
+	cache = S2C(session)->cache;
+	if ((ccache = cache->ccache) == NULL)
+		return (0);
+
+	for (i = 0; i < WT_CCACHE_PARTS; ++i) {
+		part = &ccache->part[i];
+		while ((e = TAILQ_FIRST(&part->qh)) != NULL) {
+			TAILQ_REMOVE(&part->qh, e, q);
+			__wt_free(session, e);
+		}
+		__wt_free(session, part->hash);
+		__wt_spin_destroy(session, &part->lock);
+	}
+
+	__wt_free(session, cache->ccache);
+	return (0);
+}
@@ -2,8 +2,14 @@
 
 #include "wt_internal.h"
 
+static const WT_CONFIG_CHECK confchk_WT_CONNECTION_async_drain[] = {
+	{ "max", "int", NULL, "min=0", NULL, 0 },
+	{ NULL, NULL, NULL, NULL, NULL, 0 }
+};
+
 static const WT_CONFIG_CHECK confchk_WT_CONNECTION_async_new_op[] = {
 	{ "append", "boolean", NULL, NULL, NULL, 0 },
+	{ "completion_queue", "boolean", NULL, NULL, NULL, 0 },
 	{ "overwrite", "boolean", NULL, NULL, NULL, 0 },
 	{ "raw", "boolean", NULL, NULL, NULL, 0 },
 	{ "timeout", "int", NULL, NULL, NULL, 0 },
@@ -34,7 +40,8 @@ static const WT_CONFIG_CHECK
     confchk_wiredtiger_open_async_subconfigs[] = {
 	{ "enabled", "boolean", NULL, NULL, NULL, 0 },
 	{ "ops_max", "int", NULL, "min=1,max=4096", NULL, 0 },
-	{ "threads", "int", NULL, "min=1,max=20", NULL, 0 },
+	{ "ops_per_txn", "int", NULL, "min=1,max=32", NULL, 0 },
+	{ "threads", "int", NULL, "min=1,max=128", NULL, 0 },
 	{ NULL, NULL, NULL, NULL, NULL, 0 }
 };
 
@@ -46,8 +53,18 @@ static const WT_CONFIG_CHECK
 	{ NULL, NULL, NULL, NULL, NULL, 0 }
 };
 
+static const WT_CONFIG_CHECK
+    confchk_wiredtiger_open_compact_subconfigs[] = {
+	{ "rate", "int", NULL, "min=0,max=10000", NULL, 0 },
+	{ "wait", "int", NULL, "min=1,max=100000", NULL, 0 },
+	{ NULL, NULL, NULL, NULL, NULL, 0 }
+};
+
 static const WT_CONFIG_CHECK
     confchk_wiredtiger_open_eviction_subconfigs[] = {
+	{ "policy", "string",
+	    NULL, "choices=[\"frequency\",\"lru\"]",
+	    NULL, 0 },
 	{ "threads_max", "int", NULL, "min=1,max=20", NULL, 0 },
 	{ "threads_min", "int", NULL, "min=1,max=20", NULL, 0 },
 	{ NULL, NULL, NULL, NULL, NULL, 0 }
@@ -110,16 +127,19 @@ static const WT_CONFIG_CHECK
 static const WT_CONFIG_CHECK confchk_WT_CONNECTION_reconfigure[] = {
 	{ "async", "category",
 	    NULL, NULL,
-	    confchk_wiredtiger_open_async_subconfigs, 3 },
+	    confchk_wiredtiger_open_async_subconfigs, 4 },
 	{ "cache_overhead", "int", NULL, "min=0,max=30", NULL, 0 },
 	{ "cache_size", "int", NULL, "min=1MB,max=10TB", NULL, 0 },
 	{ "checkpoint", "category",
 	    NULL, NULL,
 	    confchk_wiredtiger_open_checkpoint_subconfigs, 3 },
+	{ "compact", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_compact_subconfigs, 2 },
 	{ "error_prefix", "string", NULL, NULL, NULL, 0 },
 	{ "eviction", "category",
 	    NULL, NULL,
-	    confchk_wiredtiger_open_eviction_subconfigs, 2 },
+	    confchk_wiredtiger_open_eviction_subconfigs, 3 },
 	{ "eviction_dirty_target", "int",
 	    NULL, "min=5,max=99",
 	    NULL, 0 },
@@ -220,6 +240,9 @@ static const WT_CONFIG_CHECK
 	{ "chunk_count_limit", "int", NULL, NULL, NULL, 0 },
 	{ "chunk_max", "int", NULL, "min=100MB,max=10TB", NULL, 0 },
 	{ "chunk_size", "int", NULL, "min=512K,max=500MB", NULL, 0 },
+	{ "memtable", "string",
+	    NULL, "choices=[\"btree\",\"skiplist\"]",
+	    NULL, 0 },
 	{ "merge_max", "int", NULL, "min=2,max=100", NULL, 0 },
 	{ "merge_min", "int", NULL, "max=100", NULL, 0 },
 	{ NULL, NULL, NULL, NULL, NULL, 0 }
@@ -259,6 +282,7 @@ static const WT_CONFIG_CHECK confchk_WT_SESSION_create[] = {
 	    NULL, 0 },
 	{ "key_format", "format", __wt_struct_confchk, NULL, NULL, 0 },
 	{ "key_gap", "int", NULL, "min=0", NULL, 0 },
+	{ "leaf_delta_max", "int", NULL, "min=0,max=16", NULL, 0 },
 	{ "leaf_item_max", "int", NULL, "min=0", NULL, 0 },
 	{ "leaf_key_max", "int", NULL, "min=0", NULL, 0 },
 	{ "leaf_page_max", "int",
@@ -270,7 +294,7 @@ static const WT_CONFIG_CHECK confchk_WT_SESSION_create[] = {
 	    confchk_WT_SESSION_create_log_subconfigs, 1 },
 	{ "lsm", "category",
 	    NULL, NULL,
-	    confchk_WT_SESSION_create_lsm_subconfigs, 11 },
+	    confchk_WT_SESSION_create_lsm_subconfigs, 12 },
 	{ "memory_page_max", "int",
 	    NULL, "min=512B,max=10TB",
 	    NULL, 0 },
@@ -315,6 +339,13 @@ static const WT_CONFIG_CHECK confchk_WT_SESSION_log_flush[] = {
 	{ NULL, NULL, NULL, NULL, NULL, 0 }
 };
 
+static const WT_CONFIG_CHECK
+    confchk_WT_SESSION_open_cursor_incremental_subconfigs[] = {
+	{ "src_id", "string", NULL, NULL, NULL, 0 },
+	{ "this_id", "string", NULL, NULL, NULL, 0 },
+	{ NULL, NULL, NULL, NULL, NULL, 0 }
+};
+
 static const WT_CONFIG_CHECK confchk_WT_SESSION_open_cursor[] = {
 	{ "append", "boolean", NULL, NULL, NULL, 0 },
 	{ "bulk", "string", NULL, NULL, NULL, 0 },
@@ -322,6 +353,10 @@ static const WT_CONFIG_CHECK confchk_WT_SESSION_open_cursor[] = {
 	{ "dump", "string",
 	    NULL, "choices=[\"hex\",\"json\",\"print\"]",
 	    NULL, 0 },
+	{ "filter", "list", NULL, NULL, NULL, 0 },
+	{ "incremental", "category",
+	    NULL, NULL,
+	    confchk_WT_SESSION_open_cursor_incremental_subconfigs, 2 },
 	{ "next_random", "boolean", NULL, NULL, NULL, 0 },
 	{ "overwrite", "boolean", NULL, NULL, NULL, 0 },
 	{ "raw", "boolean", NULL, NULL, NULL, 0 },
@@ -344,6 +379,7 @@ static const WT_CONFIG_CHECK confchk_WT_SESSION_reconfigure[] = {
 
 static const WT_CONFIG_CHECK confchk_WT_SESSION_salvage[] = {
 	{ "force", "boolean", NULL, NULL, NULL, 0 },
+	{ "threads", "int", NULL, "min=1,max=64", NULL, 0 },
 	{ NULL, NULL, NULL, NULL, NULL, 0 }
 };
 
@@ -376,6 +412,7 @@ static const WT_CONFIG_CHECK confchk_WT_SESSION_verify[] = {
 	{ "dump_pages", "boolean", NULL, NULL, NULL, 0 },
 	{ "dump_shape", "boolean", NULL, NULL, NULL, 0 },
 	{ "strict", "boolean", NULL, NULL, NULL, 0 },
+	{ "threads", "int", NULL, "min=1,max=64", NULL, 0 },
 	{ NULL, NULL, NULL, NULL, NULL, 0 }
 };
 
@@ -421,6 +458,7 @@ static const WT_CONFIG_CHECK confchk_file_meta[] = {
 	    NULL, 0 },
 	{ "key_format", "format", __wt_struct_confchk, NULL, NULL, 0 },
 	{ "key_gap", "int", NULL, "min=0", NULL, 0 },
+	{ "leaf_delta_max", "int", NULL, "min=0,max=16", NULL, 0 },
 	{ "leaf_item_max", "int", NULL, "min=0", NULL, 0 },
 	{ "leaf_key_max", "int", NULL, "min=0", NULL, 0 },
 	{ "leaf_page_max", "int",
@@ -475,6 +513,26 @@ static const WT_CONFIG_CHECK confchk_table_meta[] = {
 	{ NULL, NULL, NULL, NULL, NULL, 0 }
 };
 
+static const WT_CONFIG_CHECK
+    confchk_wiredtiger_open_block_cache_subconfigs[] = {
+	{ "path", "string", NULL, NULL, NULL, 0 },
+	{ "size", "int", NULL, "min=0,max=100TB", NULL, 0 },
+	{ NULL, NULL, NULL, NULL, NULL, 0 }
+};
+
+static const WT_CONFIG_CHECK
+    confchk_wiredtiger_open_cache_warmup_subconfigs[] = {
+	{ "enabled", "boolean", NULL, NULL, NULL, 0 },
+	{ "target", "int", NULL, "min=10,max=100", NULL, 0 },
+	{ NULL, NULL, NULL, NULL, NULL, 0 }
+};
+
+static const WT_CONFIG_CHECK
+    confchk_wiredtiger_open_compressed_cache_subconfigs[] = {
+	{ "size", "int", NULL, "min=0,max=10TB", NULL, 0 },
+	{ NULL, NULL, NULL, NULL, NULL, 0 }
+};
+
 static const WT_CONFIG_CHECK
     confchk_wiredtiger_open_encryption_subconfigs[] = {
 	{ "keyid", "string", NULL, NULL, NULL, 0 },
@@ -483,6 +541,20 @@ static const WT_CONFIG_CHECK
 	{ NULL, NULL, NULL, NULL, NULL, 0 }
 };
 
+static const WT_CONFIG_CHECK
+    confchk_wiredtiger_open_open_prefetch_subconfigs[] = {
+	{ "threads", "int", NULL, "min=0,max=20", NULL, 0 },
+	{ NULL, NULL, NULL, NULL, NULL, 0 }
+};
+
+static const WT_CONFIG_CHECK
+    confchk_wiredtiger_open_trace_subconfigs[] = {
+	{ "entries", "int", NULL, "min=0,max=1M", NULL, 0 },
+	{ "path", "string", NULL, NULL, NULL, 0 },
+	{ "slow_threshold", "int", NULL, "min=0,max=100000", NULL, 0 },
+	{ NULL, NULL, NULL, NULL, NULL, 0 }
+};
+
 static const WT_CONFIG_CHECK
     confchk_wiredtiger_open_transaction_sync_subconfigs[] = {
 	{ "enabled", "boolean", NULL, NULL, NULL, 0 },
@@ -492,17 +564,35 @@ static const WT_CONFIG_CHECK
 	{ NULL, NULL, NULL, NULL, NULL, 0 }
 };
 
+static const WT_CONFIG_CHECK
+    confchk_wiredtiger_open_write_pool_subconfigs[] = {
+	{ "threads", "int", NULL, "min=0,max=20", NULL, 0 },
+	{ NULL, NULL, NULL, NULL, NULL, 0 }
+};
+
 static const WT_CONFIG_CHECK confchk_wiredtiger_open[] = {
 	{ "async", "category",
 	    NULL, NULL,
-	    confchk_wiredtiger_open_async_subconfigs, 3 },
+	    confchk_wiredtiger_open_async_subconfigs, 4 },
+	{ "block_cache", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_block_cache_subconfigs, 2 },
 	{ "buffer_alignment", "int", NULL, "min=-1,max=1MB", NULL, 0 },
 	{ "cache_overhead", "int", NULL, "min=0,max=30", NULL, 0 },
 	{ "cache_size", "int", NULL, "min=1MB,max=10TB", NULL, 0 },
+	{ "cache_warmup", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_cache_warmup_subconfigs, 2 },
 	{ "checkpoint", "category",
 	    NULL, NULL,
 	    confchk_wiredtiger_open_checkpoint_subconfigs, 3 },
 	{ "checkpoint_sync", "boolean", NULL, NULL, NULL, 0 },
+	{ "compact", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_compact_subconfigs, 2 },
+	{ "compressed_cache", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_compressed_cache_subconfigs, 1 },
 	{ "config_base", "boolean", NULL, NULL, NULL, 0 },
 	{ "create", "boolean", NULL, NULL, NULL, 0 },
 	{ "direct_io", "list",
@@ -514,7 +604,7 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open[] = {
 	{ "error_prefix", "string", NULL, NULL, NULL, 0 },
 	{ "eviction", "category",
 	    NULL, NULL,
-	    confchk_wiredtiger_open_eviction_subconfigs, 2 },
+	    confchk_wiredtiger_open_eviction_subconfigs, 3 },
 	{ "eviction_dirty_target", "int",
 	    NULL, "min=5,max=99",
 	    NULL, 0 },
@@ -542,6 +632,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open[] = {
 	{ "lsm_merge", "boolean", NULL, NULL, NULL, 0 },
 	{ "mmap", "boolean", NULL, NULL, NULL, 0 },
 	{ "multiprocess", "boolean", NULL, NULL, NULL, 0 },
+	{ "open_prefetch", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_open_prefetch_subconfigs, 1 },
 	{ "session_max", "int", NULL, "min=1", NULL, 0 },
 	{ "session_scratch_max", "int", NULL, NULL, NULL, 0 },
 	{ "shared_cache", "category",
@@ -553,6 +646,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open[] = {
 	{ "statistics_log", "category",
 	    NULL, NULL,
 	    confchk_wiredtiger_open_statistics_log_subconfigs, 5 },
+	{ "trace", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_trace_subconfigs, 3 },
 	{ "transaction_sync", "category",
 	    NULL, NULL,
 	    confchk_wiredtiger_open_transaction_sync_subconfigs, 2 },
@@ -566,6 +662,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open[] = {
 	    "\"split\",\"temporary\",\"transaction\",\"verify\",\"version\","
 	    "\"write\"]",
 	    NULL, 0 },
+	{ "write_pool", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_write_pool_subconfigs, 1 },
 	{ "write_through", "list",
 	    NULL, "choices=[\"data\",\"log\"]",
 	    NULL, 0 },
@@ -575,14 +674,26 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open[] = {
 static const WT_CONFIG_CHECK confchk_wiredtiger_open_all[] = {
 	{ "async", "category",
 	    NULL, NULL,
-	    confchk_wiredtiger_open_async_subconfigs, 3 },
+	    confchk_wiredtiger_open_async_subconfigs, 4 },
+	{ "block_cache", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_block_cache_subconfigs, 2 },
 	{ "buffer_alignment", "int", NULL, "min=-1,max=1MB", NULL, 0 },
 	{ "cache_overhead", "int", NULL, "min=0,max=30", NULL, 0 },
 	{ "cache_size", "int", NULL, "min=1MB,max=10TB", NULL, 0 },
+	{ "cache_warmup", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_cache_warmup_subconfigs, 2 },
 	{ "checkpoint", "category",
 	    NULL, NULL,
 	    confchk_wiredtiger_open_checkpoint_subconfigs, 3 },
 	{ "checkpoint_sync", "boolean", NULL, NULL, NULL, 0 },
+	{ "compact", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_compact_subconfigs, 2 },
+	{ "compressed_cache", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_compressed_cache_subconfigs, 1 },
 	{ "config_base", "boolean", NULL, NULL, NULL, 0 },
 	{ "create", "boolean", NULL, NULL, NULL, 0 },
 	{ "direct_io", "list",
@@ -594,7 +705,7 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_all[] = {
 	{ "error_prefix", "string", NULL, NULL, NULL, 0 },
 	{ "eviction", "category",
 	    NULL, NULL,
-	    confchk_wiredtiger_open_eviction_subconfigs, 2 },
+	    confchk_wiredtiger_open_eviction_subconfigs, 3 },
 	{ "eviction_dirty_target", "int",
 	    NULL, "min=5,max=99",
 	    NULL, 0 },
@@ -622,6 +733,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_all[] = {
 	{ "lsm_merge", "boolean", NULL, NULL, NULL, 0 },
 	{ "mmap", "boolean", NULL, NULL, NULL, 0 },
 	{ "multiprocess", "boolean", NULL, NULL, NULL, 0 },
+	{ "open_prefetch", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_open_prefetch_subconfigs, 1 },
 	{ "session_max", "int", NULL, "min=1", NULL, 0 },
 	{ "session_scratch_max", "int", NULL, NULL, NULL, 0 },
 	{ "shared_cache", "category",
@@ -633,6 +747,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_all[] = {
 	{ "statistics_log", "category",
 	    NULL, NULL,
 	    confchk_wiredtiger_open_statistics_log_subconfigs, 5 },
+	{ "trace", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_trace_subconfigs, 3 },
 	{ "transaction_sync", "category",
 	    NULL, NULL,
 	    confchk_wiredtiger_open_transaction_sync_subconfigs, 2 },
@@ -647,6 +764,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_all[] = {
 	    "\"write\"]",
 	    NULL, 0 },
 	{ "version", "string", NULL, NULL, NULL, 0 },
+	{ "write_pool", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_write_pool_subconfigs, 1 },
 	{ "write_through", "list",
 	    NULL, "choices=[\"data\",\"log\"]",
 	    NULL, 0 },
@@ -656,14 +776,26 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_all[] = {
 static const WT_CONFIG_CHECK confchk_wiredtiger_open_basecfg[] = {
 	{ "async", "category",
 	    NULL, NULL,
-	    confchk_wiredtiger_open_async_subconfigs, 3 },
+	    confchk_wiredtiger_open_async_subconfigs, 4 },
+	{ "block_cache", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_block_cache_subconfigs, 2 },
 	{ "buffer_alignment", "int", NULL, "min=-1,max=1MB", NULL, 0 },
 	{ "cache_overhead", "int", NULL, "min=0,max=30", NULL, 0 },
 	{ "cache_size", "int", NULL, "min=1MB,max=10TB", NULL, 0 },
+	{ "cache_warmup", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_cache_warmup_subconfigs, 2 },
 	{ "checkpoint", "category",
 	    NULL, NULL,
 	    confchk_wiredtiger_open_checkpoint_subconfigs, 3 },
 	{ "checkpoint_sync", "boolean", NULL, NULL, NULL, 0 },
+	{ "compact", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_compact_subconfigs, 2 },
+	{ "compressed_cache", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_compressed_cache_subconfigs, 1 },
 	{ "direct_io", "list",
 	    NULL, "choices=[\"checkpoint\",\"data\",\"log\"]",
 	    NULL, 0 },
@@ -673,7 +805,7 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_basecfg[] = {
 	{ "error_prefix", "string", NULL, NULL, NULL, 0 },
 	{ "eviction", "category",
 	    NULL, NULL,
-	    confchk_wiredtiger_open_eviction_subconfigs, 2 },
+	    confchk_wiredtiger_open_eviction_subconfigs, 3 },
 	{ "eviction_dirty_target", "int",
 	    NULL, "min=5,max=99",
 	    NULL, 0 },
@@ -699,6 +831,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_basecfg[] = {
 	{ "lsm_merge", "boolean", NULL, NULL, NULL, 0 },
 	{ "mmap", "boolean", NULL, NULL, NULL, 0 },
 	{ "multiprocess", "boolean", NULL, NULL, NULL, 0 },
+	{ "open_prefetch", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_open_prefetch_subconfigs, 1 },
 	{ "session_max", "int", NULL, "min=1", NULL, 0 },
 	{ "session_scratch_max", "int", NULL, NULL, NULL, 0 },
 	{ "shared_cache", "category",
@@ -710,6 +845,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_basecfg[] = {
 	{ "statistics_log", "category",
 	    NULL, NULL,
 	    confchk_wiredtiger_open_statistics_log_subconfigs, 5 },
+	{ "trace", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_trace_subconfigs, 3 },
 	{ "transaction_sync", "category",
 	    NULL, NULL,
 	    confchk_wiredtiger_open_transaction_sync_subconfigs, 2 },
@@ -722,6 +860,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_basecfg[] = {
 	    "\"write\"]",
 	    NULL, 0 },
 	{ "version", "string", NULL, NULL, NULL, 0 },
+	{ "write_pool", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_write_pool_subconfigs, 1 },
 	{ "write_through", "list",
 	    NULL, "choices=[\"data\",\"log\"]",
 	    NULL, 0 },
@@ -731,14 +872,26 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_basecfg[] = {
 static const WT_CONFIG_CHECK confchk_wiredtiger_open_usercfg[] = {
 	{ "async", "category",
 	    NULL, NULL,
-	    confchk_wiredtiger_open_async_subconfigs, 3 },
+	    confchk_wiredtiger_open_async_subconfigs, 4 },
+	{ "block_cache", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_block_cache_subconfigs, 2 },
 	{ "buffer_alignment", "int", NULL, "min=-1,max=1MB", NULL, 0 },
 	{ "cache_overhead", "int", NULL, "min=0,max=30", NULL, 0 },
 	{ "cache_size", "int", NULL, "min=1MB,max=10TB", NULL, 0 },
+	{ "cache_warmup", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_cache_warmup_subconfigs, 2 },
 	{ "checkpoint", "category",
 	    NULL, NULL,
 	    confchk_wiredtiger_open_checkpoint_subconfigs, 3 },
 	{ "checkpoint_sync", "boolean", NULL, NULL, NULL, 0 },
+	{ "compact", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_compact_subconfigs, 2 },
+	{ "compressed_cache", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_compressed_cache_subconfigs, 1 },
 	{ "direct_io", "list",
 	    NULL, "choices=[\"checkpoint\",\"data\",\"log\"]",
 	    NULL, 0 },
@@ -748,7 +901,7 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_usercfg[] = {
 	{ "error_prefix", "string", NULL, NULL, NULL, 0 },
 	{ "eviction", "category",
 	    NULL, NULL,
-	    confchk_wiredtiger_open_eviction_subconfigs, 2 },
+	    confchk_wiredtiger_open_eviction_subconfigs, 3 },
 	{ "eviction_dirty_target", "int",
 	    NULL, "min=5,max=99",
 	    NULL, 0 },
@@ -774,6 +927,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_usercfg[] = {
 	{ "lsm_merge", "boolean", NULL, NULL, NULL, 0 },
 	{ "mmap", "boolean", NULL, NULL, NULL, 0 },
 	{ "multiprocess", "boolean", NULL, NULL, NULL, 0 },
+	{ "open_prefetch", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_open_prefetch_subconfigs, 1 },
 	{ "session_max", "int", NULL, "min=1", NULL, 0 },
 	{ "session_scratch_max", "int", NULL, NULL, NULL, 0 },
 	{ "shared_cache", "category",
@@ -785,6 +941,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_usercfg[] = {
 	{ "statistics_log", "category",
 	    NULL, NULL,
 	    confchk_wiredtiger_open_statistics_log_subconfigs, 5 },
+	{ "trace", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_trace_subconfigs, 3 },
 	{ "transaction_sync", "category",
 	    NULL, NULL,
 	    confchk_wiredtiger_open_transaction_sync_subconfigs, 2 },
@@ -796,6 +955,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_usercfg[] = {
 	    "\"split\",\"temporary\",\"transaction\",\"verify\",\"version\","
 	    "\"write\"]",
 	    NULL, 0 },
+	{ "write_pool", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_write_pool_subconfigs, 1 },
 	{ "write_through", "list",
 	    NULL, "choices=[\"data\",\"log\"]",
 	    NULL, 0 },
@@ -823,9 +985,13 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  "",
 	  NULL, 0
 	},
+	{ "WT_CONNECTION.async_drain",
+	  "max=0",
+	  confchk_WT_CONNECTION_async_drain, 1
+	},
 	{ "WT_CONNECTION.async_new_op",
-	  "append=0,overwrite=,raw=0,timeout=1200",
-	  confchk_WT_CONNECTION_async_new_op, 4
+	  "append=0,completion_queue=0,overwrite=,raw=0,timeout=1200",
+	  confchk_WT_CONNECTION_async_new_op, 5
 	},
 	{ "WT_CONNECTION.close",
 	  "leak_memory=0",
@@ -841,12 +1007,13 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  confchk_WT_CONNECTION_open_session, 1
 	},
 	{ "WT_CONNECTION.reconfigure",
-	  "async=(enabled=0,ops_max=1024,threads=2),cache_overhead=8,"
-	  "cache_size=100MB,checkpoint=(log_size=0,"
-	  "name=\"WiredTigerCheckpoint\",wait=0),error_prefix=,"
-	  "eviction=(threads_max=1,threads_min=1),eviction_dirty_target=80,"
-	  "eviction_dirty_trigger=95,eviction_target=80,eviction_trigger=95"
-	  ",file_manager=(close_handle_minimum=250,close_idle_time=30,"
+	  "async=(enabled=0,ops_max=1024,ops_per_txn=1,threads=2),"
+	  "cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
+	  "name=\"WiredTigerCheckpoint\",wait=0),compact=(rate=0,wait=60),"
+	  "error_prefix=,eviction=(policy=lru,threads_max=1,threads_min=1),"
+	  "eviction_dirty_target=80,eviction_dirty_trigger=95,"
+	  "eviction_target=80,eviction_trigger=95,"
+	  "file_manager=(close_handle_minimum=250,close_idle_time=30,"
 	  "close_scan_interval=10),log=(archive=,compressor=,enabled=0,"
 	  "file_max=100MB,path=,prealloc=,recover=on,zero_fill=0),"
 	  "lsm_manager=(merge=,worker_thread_max=4),lsm_merge=,"
@@ -854,7 +1021,7 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  "statistics=none,statistics_log=(on_close=0,"
 	  "path=\"WiredTigerStat.%d.%H\",sources=,"
 	  "timestamp=\"%b %d %H:%M:%S\",wait=0),verbose=",
-	  confchk_WT_CONNECTION_reconfigure, 18
+	  confchk_WT_CONNECTION_reconfigure, 19
 	},
 	{ "WT_CURSOR.close",
 	  "",
@@ -891,16 +1058,16 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  "name=),exclusive=0,extractor=,format=btree,huffman_key=,"
 	  "huffman_value=,immutable=0,internal_item_max=0,"
 	  "internal_key_max=0,internal_key_truncate=,internal_page_max=4KB,"
-	  "key_format=u,key_gap=10,leaf_item_max=0,leaf_key_max=0,"
-	  "leaf_page_max=32KB,leaf_value_max=0,log=(enabled=),"
-	  "lsm=(auto_throttle=,bloom=,bloom_bit_count=16,bloom_config=,"
-	  "bloom_hash_count=8,bloom_oldest=0,chunk_count_limit=0,"
-	  "chunk_max=5GB,chunk_size=10MB,merge_max=15,merge_min=0),"
-	  "memory_page_max=5MB,os_cache_dirty_max=0,os_cache_max=0,"
-	  "prefix_compression=0,prefix_compression_min=4,source=,"
-	  "split_deepen_min_child=0,split_deepen_per_child=0,split_pct=75,"
-	  "type=file,value_format=u",
-	  confchk_WT_SESSION_create, 40
+	  "key_format=u,key_gap=10,leaf_delta_max=0,leaf_item_max=0,"
+	  "leaf_key_max=0,leaf_page_max=32KB,leaf_value_max=0,"
+	  "log=(enabled=),lsm=(auto_throttle=,bloom=,bloom_bit_count=16,"
+	  "bloom_config=,bloom_hash_count=8,bloom_oldest=0,"
+	  "chunk_count_limit=0,chunk_max=5GB,chunk_size=10MB,memtable=btree"
+	  ",merge_max=15,merge_min=0),memory_page_max=5MB,"
+	  "os_cache_dirty_max=0,os_cache_max=0,prefix_compression=0,"
+	  "prefix_compression_min=4,source=,split_deepen_min_child=0,"
+	  "split_deepen_per_child=0,split_pct=75,type=file,value_format=u",
+	  confchk_WT_SESSION_create, 41
 	},
 	{ "WT_SESSION.drop",
 	  "force=0,remove_files=",
@@ -920,9 +1087,10 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  NULL, 0
 	},
 	{ "WT_SESSION.open_cursor",
-	  "append=0,bulk=0,checkpoint=,dump=,next_random=0,overwrite=,raw=0"
-	  ",readonly=0,skip_sort_check=0,statistics=,target=",
-	  confchk_WT_SESSION_open_cursor, 11
+	  "append=0,bulk=0,checkpoint=,dump=,filter=,incremental=(src_id=,"
+	  "this_id=),next_random=0,overwrite=,raw=0,readonly=0,"
+	  "skip_sort_check=0,statistics=,target=",
+	  confchk_WT_SESSION_open_cursor, 13
 	},
 	{ "WT_SESSION.reconfigure",
 	  "isolation=read-committed",
@@ -941,8 +1109,8 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  NULL, 0
 	},
 	{ "WT_SESSION.salvage",
-	  "force=0",
-	  confchk_WT_SESSION_salvage, 1
+	  "force=0,threads=1",
+	  confchk_WT_SESSION_salvage, 2
 	},
 	{ "WT_SESSION.snapshot",
 	  "drop=(all=0,before=,names=,to=),name=",
@@ -966,8 +1134,8 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	},
 	{ "WT_SESSION.verify",
 	  "dump_address=0,dump_blocks=0,dump_offsets=,dump_pages=0,"
-	  "dump_shape=0,strict=0",
-	  confchk_WT_SESSION_verify, 6
+	  "dump_shape=0,strict=0,threads=1",
+	  confchk_WT_SESSION_verify, 7
 	},
 	{ "colgroup.meta",
 	  "app_metadata=,collator=,columns=,source=,type=file",
@@ -980,13 +1148,13 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  "encryption=(keyid=,name=),format=btree,huffman_key=,"
 	  "huffman_value=,id=,internal_item_max=0,internal_key_max=0,"
 	  "internal_key_truncate=,internal_page_max=4KB,key_format=u,"
-	  "key_gap=10,leaf_item_max=0,leaf_key_max=0,leaf_page_max=32KB,"
-	  "leaf_value_max=0,log=(enabled=),memory_page_max=5MB,"
-	  "os_cache_dirty_max=0,os_cache_max=0,prefix_compression=0,"
-	  "prefix_compression_min=4,split_deepen_min_child=0,"
-	  "split_deepen_per_child=0,split_pct=75,value_format=u,"
-	  "version=(major=0,minor=0)",
-	  confchk_file_meta, 37
+	  "key_gap=10,leaf_delta_max=0,leaf_item_max=0,leaf_key_max=0,"
+	  "leaf_page_max=32KB,leaf_value_max=0,log=(enabled=),"
+	  "memory_page_max=5MB,os_cache_dirty_max=0,os_cache_max=0,"
+	  "prefix_compression=0,prefix_compression_min=4,"
+	  "split_deepen_min_child=0,split_deepen_per_child=0,split_pct=75,"
+	  "value_format=u,version=(major=0,minor=0)",
+	  confchk_file_meta, 38
 	},
 	{ "index.meta",
 	  "app_metadata=,collator=,columns=,extractor=,immutable=0,"
@@ -999,87 +1167,108 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  confchk_table_meta, 6
 	},
 	{ "wiredtiger_open",
-	  "async=(enabled=0,ops_max=1024,threads=2),buffer_alignment=-1,"
-	  "cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
+	  "async=(enabled=0,ops_max=1024,ops_per_txn=1,threads=2),"
+	  "block_cache=(path=\"WiredTigerBlockCache\",size=0),"
+	  "buffer_alignment=-1,cache_overhead=8,cache_size=100MB,"
+	  "cache_warmup=(enabled=0,target=80),checkpoint=(log_size=0,"
 	  "name=\"WiredTigerCheckpoint\",wait=0),checkpoint_sync=,"
-	  "config_base=,create=0,direct_io=,encryption=(keyid=,name=,"
-	  "secretkey=),error_prefix=,eviction=(threads_max=1,threads_min=1)"
-	  ",eviction_dirty_target=80,eviction_dirty_trigger=95,"
+	  "compact=(rate=0,wait=60),compressed_cache=(size=0),config_base=,"
+	  "create=0,direct_io=,encryption=(keyid=,name=,secretkey=),"
+	  "error_prefix=,eviction=(policy=lru,threads_max=1,threads_min=1),"
+	  "eviction_dirty_target=80,eviction_dirty_trigger=95,"
 	  "eviction_target=80,eviction_trigger=95,exclusive=0,extensions=,"
 	  "file_extend=,file_manager=(close_handle_minimum=250,"
 	  "close_idle_time=30,close_scan_interval=10),hazard_max=1000,"
 	  "in_memory=0,log=(archive=,compressor=,enabled=0,file_max=100MB,"
 	  "path=,prealloc=,recover=on,zero_fill=0),lsm_manager=(merge=,"
 	  "worker_thread_max=4),lsm_merge=,mmap=,multiprocess=0,"
-	  "session_max=100,session_scratch_max=2MB,shared_cache=(chunk=10MB"
-	  ",name=,quota=0,reserve=0,size=500MB),statistics=none,"
-	  "statistics_log=(on_close=0,path=\"WiredTigerStat.%d.%H\","
-	  "sources=,timestamp=\"%b %d %H:%M:%S\",wait=0),"
+	  "open_prefetch=(threads=0),session_max=100,"
+	  "session_scratch_max=2MB,shared_cache=(chunk=10MB,name=,quota=0,"
+	  "reserve=0,size=500MB),statistics=none,statistics_log=(on_close=0"
+	  ",path=\"WiredTigerStat.%d.%H\",sources=,"
+	  "timestamp=\"%b %d %H:%M:%S\",wait=0),trace=(entries=1024,"
+	  "path=\"WiredTigerTrace\",slow_threshold=0),"
 	  "transaction_sync=(enabled=0,method=fsync),use_environment=,"
-	  "use_environment_priv=0,verbose=,write_through=",
-	  confchk_wiredtiger_open, 37
+	  "use_environment_priv=0,verbose=,write_pool=(threads=0),"
+	  "write_through=",
+	  confchk_wiredtiger_open, 44
 	},
 	{ "wiredtiger_open_all",
-	  "async=(enabled=0,ops_max=1024,threads=2),buffer_alignment=-1,"
-	  "cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
+	  "async=(enabled=0,ops_max=1024,ops_per_txn=1,threads=2),"
+	  "block_cache=(path=\"WiredTigerBlockCache\",size=0),"
+	  "buffer_alignment=-1,cache_overhead=8,cache_size=100MB,"
+	  "cache_warmup=(enabled=0,target=80),checkpoint=(log_size=0,"
 	  "name=\"WiredTigerCheckpoint\",wait=0),checkpoint_sync=,"
-	  "config_base=,create=0,direct_io=,encryption=(keyid=,name=,"
-	  "secretkey=),error_prefix=,eviction=(threads_max=1,threads_min=1)"
-	  ",eviction_dirty_target=80,eviction_dirty_trigger=95,"
+	  "compact=(rate=0,wait=60),compressed_cache=(size=0),config_base=,"
+	  "create=0,direct_io=,encryption=(keyid=,name=,secretkey=),"
+	  "error_prefix=,eviction=(policy=lru,threads_max=1,threads_min=1),"
+	  "eviction_dirty_target=80,eviction_dirty_trigger=95,"
 	  "eviction_target=80,eviction_trigger=95,exclusive=0,extensions=,"
 	  "file_extend=,file_manager=(close_handle_minimum=250,"
 	  "close_idle_time=30,close_scan_interval=10),hazard_max=1000,"
 	  "in_memory=0,log=(archive=,compressor=,enabled=0,file_max=100MB,"
 	  "path=,prealloc=,recover=on,zero_fill=0),lsm_manager=(merge=,"
 	  "worker_thread_max=4),lsm_merge=,mmap=,multiprocess=0,"
-	  "session_max=100,session_scratch_max=2MB,shared_cache=(chunk=10MB"
-	  ",name=,quota=0,reserve=0,size=500MB),statistics=none,"
-	  "statistics_log=(on_close=0,path=\"WiredTigerStat.%d.%H\","
-	  "sources=,timestamp=\"%b %d %H:%M:%S\",wait=0),"
+	  "open_prefetch=(threads=0),session_max=100,"
+	  "session_scratch_max=2MB,shared_cache=(chunk=10MB,name=,quota=0,"
+	  "reserve=0,size=500MB),statistics=none,statistics_log=(on_close=0"
+	  ",path=\"WiredTigerStat.%d.%H\",sources=,"
+	  "timestamp=\"%b %d %H:%M:%S\",wait=0),trace=(entries=1024,"
+	  "path=\"WiredTigerTrace\",slow_threshold=0),"
 	  "transaction_sync=(enabled=0,method=fsync),use_environment=,"
 	  "use_environment_priv=0,verbose=,version=(major=0,minor=0),"
-	  "write_through=",
-	  confchk_wiredtiger_open_all, 38
+	  "write_pool=(threads=0),write_through=",
+	  confchk_wiredtiger_open_all, 45
 	},
 	{ "wiredtiger_open_basecfg",
-	  "async=(enabled=0,ops_max=1024,threads=2),buffer_alignment=-1,"
-	  "cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
+	  "async=(enabled=0,ops_max=1024,ops_per_txn=1,threads=2),"
+	  "block_cache=(path=\"WiredTigerBlockCache\",size=0),"
+	  "buffer_alignment=-1,cache_overhead=8,cache_size=100MB,"
+	  "cache_warmup=(enabled=0,target=80),checkpoint=(log_size=0,"
 	  "name=\"WiredTigerCheckpoint\",wait=0),checkpoint_sync=,"
-	  "direct_io=,encryption=(keyid=,name=,secretkey=),error_prefix=,"
-	  "eviction=(threads_max=1,threads_min=1),eviction_dirty_target=80,"
-	  "eviction_dirty_trigger=95,eviction_target=80,eviction_trigger=95"
-	  ",extensions=,file_extend=,file_manager=(close_handle_minimum=250"
-	  ",close_idle_time=30,close_scan_interval=10),hazard_max=1000,"
-	  "log=(archive=,compressor=,enabled=0,file_max=100MB,path=,"
-	  "prealloc=,recover=on,zero_fill=0),lsm_manager=(merge=,"
-	  "worker_thread_max=4),lsm_merge=,mmap=,multiprocess=0,"
-	  "session_max=100,session_scratch_max=2MB,shared_cache=(chunk=10MB"
-	  ",name=,quota=0,reserve=0,size=500MB),statistics=none,"
-	  "statistics_log=(on_close=0,path=\"WiredTigerStat.%d.%H\","
-	  "sources=,timestamp=\"%b %d %H:%M:%S\",wait=0),"
+	  "compact=(rate=0,wait=60),compressed_cache=(size=0),direct_io=,"
+	  "encryption=(keyid=,name=,secretkey=),error_prefix=,"
+	  "eviction=(policy=lru,threads_max=1,threads_min=1),"
+	  "eviction_dirty_target=80,eviction_dirty_trigger=95,"
+	  "eviction_target=80,eviction_trigger=95,extensions=,file_extend=,"
+	  "file_manager=(close_handle_minimum=250,close_idle_time=30,"
+	  "close_scan_interval=10),hazard_max=1000,log=(archive=,"
+	  "compressor=,enabled=0,file_max=100MB,path=,prealloc=,recover=on,"
+	  "zero_fill=0),lsm_manager=(merge=,worker_thread_max=4),lsm_merge="
+	  ",mmap=,multiprocess=0,open_prefetch=(threads=0),session_max=100,"
+	  "session_scratch_max=2MB,shared_cache=(chunk=10MB,name=,quota=0,"
+	  "reserve=0,size=500MB),statistics=none,statistics_log=(on_close=0"
+	  ",path=\"WiredTigerStat.%d.%H\",sources=,"
+	  "timestamp=\"%b %d %H:%M:%S\",wait=0),trace=(entries=1024,"
+	  "path=\"WiredTigerTrace\",slow_threshold=0),"
 	  "transaction_sync=(enabled=0,method=fsync),verbose=,"
-	  "version=(major=0,minor=0),write_through=",
-	  confchk_wiredtiger_open_basecfg, 32
+	  "version=(major=0,minor=0),write_pool=(threads=0),write_through=",
+	  confchk_wiredtiger_open_basecfg, 39
 	},
 	{ "wiredtiger_open_usercfg",
-	  "async=(enabled=0,ops_max=1024,threads=2),buffer_alignment=-1,"
-	  "cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
+	  "async=(enabled=0,ops_max=1024,ops_per_txn=1,threads=2),"
+	  "block_cache=(path=\"WiredTigerBlockCache\",size=0),"
+	  "buffer_alignment=-1,cache_overhead=8,cache_size=100MB,"
+	  "cache_warmup=(enabled=0,target=80),checkpoint=(log_size=0,"
 	  "name=\"WiredTigerCheckpoint\",wait=0),checkpoint_sync=,"
-	  "direct_io=,encryption=(keyid=,name=,secretkey=),error_prefix=,"
-	  "eviction=(threads_max=1,threads_min=1),eviction_dirty_target=80,"
-	  "eviction_dirty_trigger=95,eviction_target=80,eviction_trigger=95"
-	  ",extensions=,file_extend=,file_manager=(close_handle_minimum=250"
-	  ",close_idle_time=30,close_scan_interval=10),hazard_max=1000,"
-	  "log=(archive=,compressor=,enabled=0,file_max=100MB,path=,"
-	  "prealloc=,recover=on,zero_fill=0),lsm_manager=(merge=,"
-	  "worker_thread_max=4),lsm_merge=,mmap=,multiprocess=0,"
-	  "session_max=100,session_scratch_max=2MB,shared_cache=(chunk=10MB"
-	  ",name=,quota=0,reserve=0,size=500MB),statistics=none,"
-	  "statistics_log=(on_close=0,path=\"WiredTigerStat.%d.%H\","
-	  "sources=,timestamp=\"%b %d %H:%M:%S\",wait=0),"
+	  "compact=(rate=0,wait=60),compressed_cache=(size=0),direct_io=,"
+	  "encryption=(keyid=,name=,secretkey=),error_prefix=,"
+	  "eviction=(policy=lru,threads_max=1,threads_min=1),"
+	  "eviction_dirty_target=80,eviction_dirty_trigger=95,"
+	  "eviction_target=80,eviction_trigger=95,extensions=,file_extend=,"
+	  "file_manager=(close_handle_minimum=250,close_idle_time=30,"
+	  "close_scan_interval=10),hazard_max=1000,log=(archive=,"
+	  "compressor=,enabled=0,file_max=100MB,path=,prealloc=,recover=on,"
+	  "zero_fill=0),lsm_manager=(merge=,worker_thread_max=4),lsm_merge="
+	  ",mmap=,multiprocess=0,open_prefetch=(threads=0),session_max=100,"
+	  "session_scratch_max=2MB,shared_cache=(chunk=10MB,name=,quota=0,"
+	  "reserve=0,size=500MB),statistics=none,statistics_log=(on_close=0"
+	  ",path=\"WiredTigerStat.%d.%H\",sources=,"
+	  "timestamp=\"%b %d %H:%M:%S\",wait=0),trace=(entries=1024,"
+	  "path=\"WiredTigerTrace\",slow_threshold=0),"
 	  "transaction_sync=(enabled=0,method=fsync),verbose=,"
-	  "write_through=",
-	  confchk_wiredtiger_open_usercfg, 31
+	  "write_pool=(threads=0),write_through=",
+	  confchk_wiredtiger_open_usercfg, 38
 	},
 	{ NULL, NULL, NULL, 0 }
 };
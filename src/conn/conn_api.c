@@ -735,6 +735,42 @@ __conn_async_new_op(WT_CONNECTION *wt_conn, const char *uri, const char *config,
 err:	API_END_RET_NOTFOUND_MAP(session, ret);
 }
 
+/*
+ * __conn_async_drain --
+ *	WT_CONNECTION.async_drain method.
+ */
+static int
+__conn_async_drain(WT_CONNECTION *wt_conn, const char *config)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	conn = (WT_CONNECTION_IMPL *)wt_conn;
+	CONNECTION_API_CALL(conn, session, async_drain, config, cfg);
+	WT_ERR(__wt_async_drain(session, cfg));
+
+err:	API_END_RET_NOTFOUND_MAP(session, ret);
+}
+
+/*
+ * __conn_async_completion_fd --
+ *	WT_CONNECTION.async_completion_fd method.
+ */
+static int
+__conn_async_completion_fd(WT_CONNECTION *wt_conn, int *fdp)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	conn = (WT_CONNECTION_IMPL *)wt_conn;
+	CONNECTION_API_CALL_NOCONF(conn, session, async_completion_fd);
+	WT_ERR(__wt_async_completion_fd(session, fdp));
+
+err:	API_END_RET_NOTFOUND_MAP(session, ret);
+}
+
 /*
  * __conn_get_extension_api --
  *	WT_CONNECTION.get_extension_api method.
@@ -949,6 +985,24 @@ __conn_is_new(WT_CONNECTION *wt_conn)
 	return (((WT_CONNECTION_IMPL *)wt_conn)->is_new);
 }
 
+/*
+ * __conn_trace_dump --
+ *	WT_CONNECTION->trace_dump method.
+ */
+static int
+__conn_trace_dump(WT_CONNECTION *wt_conn)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	conn = (WT_CONNECTION_IMPL *)wt_conn;
+	CONNECTION_API_CALL_NOCONF(conn, session, trace_dump);
+	WT_ERR(__wt_trace_dump(session));
+
+err:	API_END_RET(session, ret);
+}
+
 /*
  * __conn_close --
  *	WT_CONNECTION->close method.
@@ -1051,6 +1105,7 @@ __conn_reconfigure(WT_CONNECTION *wt_conn, const char *config)
 	WT_ERR(__wt_async_reconfig(session, cfg));
 	WT_ERR(__wt_cache_config(session, true, cfg));
 	WT_ERR(__wt_checkpoint_server_create(session, cfg));
+	WT_ERR(__wt_compact_server_create(session, cfg));
 	WT_ERR(__wt_logmgr_reconfig(session, cfg));
 	WT_ERR(__wt_lsm_manager_reconfig(session, cfg));
 	WT_ERR(__wt_statlog_create(session, cfg));
@@ -1775,11 +1830,14 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler,
 	static const WT_CONNECTION stdc = {
 		__conn_async_flush,
 		__conn_async_new_op,
+		__conn_async_drain,
+		__conn_async_completion_fd,
 		__conn_close,
 		__conn_reconfigure,
 		__conn_get_home,
 		__conn_configure_method,
 		__conn_is_new,
+		__conn_trace_dump,
 		__conn_open_session,
 		__conn_load_extension,
 		__conn_add_data_source,
@@ -1935,6 +1993,8 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler,
 	WT_ERR(__wt_config_gets(session, cfg, "session_scratch_max", &cval));
 	conn->session_scratch_max = (size_t)cval.val;
 
+	WT_ERR(__wt_trace_config(session, cfg));
+
 	WT_ERR(__wt_config_gets(session, cfg, "in_memory", &cval));
 	if (cval.val != 0)
 		F_SET(conn, WT_CONN_IN_MEMORY);
@@ -48,6 +48,12 @@ __cache_config_local(WT_SESSION_IMPL *session, bool shared, const char *cfg[])
 	WT_RET(__wt_config_gets(session, cfg, "eviction_dirty_trigger", &cval));
 	cache->eviction_dirty_trigger = (u_int)cval.val;
 
+	WT_RET(__wt_config_gets(session, cfg, "eviction.policy", &cval));
+	if (WT_STRING_MATCH("frequency", cval.str, cval.len))
+		F_SET(cache, WT_CACHE_EVICT_FREQUENCY);
+	else
+		F_CLR(cache, WT_CACHE_EVICT_FREQUENCY);
+
 	/*
 	 * The eviction thread configuration options include the main eviction
 	 * thread and workers. Our implementation splits them out. Adjust for
@@ -159,6 +165,8 @@ __wt_cache_create(WT_SESSION_IMPL *session, const char *cfg[])
 	WT_ERR(__wt_calloc_def(session,
 	    cache->evict_slots, &cache->evict_queue));
 
+	WT_ERR(__wt_ccache_create(session, cfg));
+
 	/*
 	 * We get/set some values in the cache statistics (rather than have
 	 * two copies), configure them.
@@ -211,6 +219,8 @@ __wt_cache_stats_update(WT_SESSION_IMPL *session)
 	WT_STAT_SET(
 	    session, stats, cache_bytes_overflow, cache->bytes_overflow);
 	WT_STAT_SET(session, stats, cache_bytes_leaf, leaf);
+
+	__wt_ccache_stats_update(session);
 }
 
 /*
@@ -251,6 +261,8 @@ __wt_cache_destroy(WT_SESSION_IMPL *session)
 	__wt_spin_destroy(session, &cache->evict_lock);
 	__wt_spin_destroy(session, &cache->evict_walk_lock);
 
+	WT_TRET(__wt_ccache_destroy(session));
+	__wt_free(session, cache->cp_ghost);
 	__wt_free(session, cache->evict_queue);
 	__wt_free(session, conn->cache);
 	return (ret);
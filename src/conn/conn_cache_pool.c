@@ -34,9 +34,18 @@
 #define	WT_CACHE_POOL_APP_WAIT_MULTIPLIER	6
 #define	WT_CACHE_POOL_READ_MULTIPLIER	1
 
-static int __cache_pool_adjust(
-    WT_SESSION_IMPL *, uint64_t, uint64_t, bool, bool *);
-static int __cache_pool_assess(WT_SESSION_IMPL *, uint64_t *);
+/*
+ * Once re-reads of recently evicted pages show a connection would gain hits
+ * from more cache, cache moves to the connections with the largest estimated
+ * gain. A connection gives up cache when another would gain this many times
+ * more hits from a chunk than this one would from another chunk: that's a
+ * lower bound on what its last chunk is worth.
+ */
+#define	WT_CACHE_POOL_GAIN_MARGIN	2
+
+static int __cache_pool_adjust(WT_SESSION_IMPL *,
+    uint64_t, uint64_t, uint64_t, bool, bool *);
+static int __cache_pool_assess(WT_SESSION_IMPL *, uint64_t *, uint64_t *);
 static int __cache_pool_balance(WT_SESSION_IMPL *, bool);
 
 /*
@@ -208,6 +217,7 @@ __wt_cache_pool_config(WT_SESSION_IMPL *session, const char **cfg)
 	cp->chunk = chunk;
 	cp->quota = quota;
 
+	conn->cache->cp_chunk = chunk;
 	conn->cache->cp_reserved = reserve;
 	conn->cache->cp_quota = quota;
 
@@ -240,6 +250,7 @@ int
 __wt_conn_cache_pool_open(WT_SESSION_IMPL *session)
 {
 	WT_CACHE *cache;
+	WT_CACHE_GHOST *ghost;
 	WT_CACHE_POOL *cp;
 	WT_CONNECTION_IMPL *conn;
 	WT_DECL_RET;
@@ -249,6 +260,16 @@ __wt_conn_cache_pool_open(WT_SESSION_IMPL *session)
 	cache = conn->cache;
 	cp = __wt_process.cache_pool;
 
+	/*
+	 * Allocate the table of recently evicted pages used to estimate how
+	 * many hits more cache would get us. The table outlives our membership
+	 * of the pool: eviction and reads may be using it.
+	 */
+	if (cache->cp_ghost == NULL) {
+		WT_RET(__wt_calloc_def(session, WT_CACHE_GHOST_SLOTS, &ghost));
+		WT_PUBLISH(cache->cp_ghost, ghost);
+	}
+
 	/*
 	 * Create a session that can be used by the cache pool thread, do
 	 * it in the main thread to avoid shutdown races
@@ -420,11 +441,11 @@ __cache_pool_balance(WT_SESSION_IMPL *session, bool forward)
 	WT_CACHE_POOL *cp;
 	WT_DECL_RET;
 	bool adjusted;
-	uint64_t bump_threshold, highest;
+	uint64_t bump_threshold, highest, highest_gain;
 
 	cp = __wt_process.cache_pool;
 	adjusted = false;
-	highest = 0;
+	highest = highest_gain = 0;
 
 	__wt_spin_lock(NULL, &cp->cache_pool_lock);
 
@@ -432,7 +453,7 @@ __cache_pool_balance(WT_SESSION_IMPL *session, bool forward)
 	if (TAILQ_FIRST(&cp->cache_pool_qh) == NULL)
 		goto err;
 
-	WT_ERR(__cache_pool_assess(session, &highest));
+	WT_ERR(__cache_pool_assess(session, &highest, &highest_gain));
 	bump_threshold = WT_CACHE_POOL_BUMP_THRESHOLD;
 
 	/*
@@ -442,8 +463,8 @@ __cache_pool_balance(WT_SESSION_IMPL *session, bool forward)
 	 */
 	while (F_ISSET(cp, WT_CACHE_POOL_ACTIVE) &&
 	    F_ISSET(S2C(session)->cache, WT_CACHE_POOL_RUN)) {
-		WT_ERR(__cache_pool_adjust(
-		    session, highest, bump_threshold, forward, &adjusted));
+		WT_ERR(__cache_pool_adjust(session,
+		    highest, highest_gain, bump_threshold, forward, &adjusted));
 		/*
 		 * Stop if the amount of cache being used is stable, and we
 		 * aren't over capacity.
@@ -463,17 +484,19 @@ err:	__wt_spin_unlock(NULL, &cp->cache_pool_lock);
  *	Assess the usage of the cache pool.
  */
 static int
-__cache_pool_assess(WT_SESSION_IMPL *session, uint64_t *phighest)
+__cache_pool_assess(
+    WT_SESSION_IMPL *session, uint64_t *phighest, uint64_t *phighest_gain)
 {
 	WT_CACHE_POOL *cp;
 	WT_CACHE *cache;
 	WT_CONNECTION_IMPL *entry;
-	uint64_t app_evicts, app_waits, reads;
-	uint64_t balanced_size, entries, highest, tmp;
+	uint64_t app_evicts, app_waits, ghost_hits, reads;
+	uint64_t balanced_size, entries, highest, highest_gain, tmp;
 
 	cp = __wt_process.cache_pool;
 	balanced_size = entries = 0;
 	highest = 1; /* Avoid divide by zero */
+	highest_gain = 0;
 
 	TAILQ_FOREACH(entry, &cp->cache_pool_qh, cpq) {
 		if (entry->cache_size == 0 || entry->cache == NULL)
@@ -538,16 +561,41 @@ __cache_pool_assess(WT_SESSION_IMPL *session, uint64_t *phighest)
 		if (cache->cp_pass_pressure > highest)
 			highest = cache->cp_pass_pressure;
 
+		/*
+		 * Estimate the hits another chunk of cache would get this
+		 * member: the pages read back less than a chunk of eviction
+		 * after they were evicted. The chunk size can be changed by
+		 * any member, keep each member's copy current.
+		 *
+		 * Smooth over history, in hundredths of a hit so a member
+		 * with a few hits each pass doesn't round down to nothing.
+		 */
+		cache->cp_chunk = cp->chunk;
+		tmp = cache->cp_ghost_hits;
+		if (tmp >= cache->cp_saved_ghost_hits)
+			ghost_hits = tmp - cache->cp_saved_ghost_hits;
+		else
+			ghost_hits = tmp;
+		cache->cp_saved_ghost_hits = tmp;
+		cache->cp_hit_gain =
+		    (9 * cache->cp_hit_gain + 100 * ghost_hits) / 10;
+
+		if (cache->cp_hit_gain > highest_gain)
+			highest_gain = cache->cp_hit_gain;
+
 		WT_RET(__wt_verbose(session, WT_VERB_SHARED_CACHE,
 		    "Assess entry. reads: %" PRIu64 ", app evicts: %" PRIu64
-		    ", app waits: %" PRIu64 ", pressure: %" PRIu64,
-		    reads, app_evicts, app_waits, cache->cp_pass_pressure));
+		    ", app waits: %" PRIu64 ", pressure: %" PRIu64
+		    ", ghost hits: %" PRIu64 ", hit gain: %" PRIu64,
+		    reads, app_evicts, app_waits, cache->cp_pass_pressure,
+		    ghost_hits, cache->cp_hit_gain));
 	}
 	WT_RET(__wt_verbose(session, WT_VERB_SHARED_CACHE,
-	    "Highest eviction count: %" PRIu64 ", entries: %" PRIu64,
-	    highest, entries));
+	    "Highest eviction count: %" PRIu64 ", highest hit gain: %" PRIu64
+	    ", entries: %" PRIu64, highest, highest_gain, entries));
 
 	*phighest = highest;
+	*phighest_gain = highest_gain;
 	return (0);
 }
 
@@ -558,15 +606,16 @@ __cache_pool_assess(WT_SESSION_IMPL *session, uint64_t *phighest)
  *	connection allocated more than their reserved size.
  */
 static int
-__cache_pool_adjust(WT_SESSION_IMPL *session,
-    uint64_t highest, uint64_t bump_threshold, bool forward, bool *adjustedp)
+__cache_pool_adjust(WT_SESSION_IMPL *session, uint64_t highest,
+    uint64_t highest_gain, uint64_t bump_threshold, bool forward,
+    bool *adjustedp)
 {
 	WT_CACHE_POOL *cp;
 	WT_CACHE *cache;
 	WT_CONNECTION_IMPL *entry;
 	uint64_t adjustment, highest_percentile, pressure, reserved, smallest;
 	u_int pct_full;
-	bool busy, pool_full, grow;
+	bool busy, pool_full, grow, most_gain;
 
 	*adjustedp = false;
 	cp = __wt_process.cache_pool;
@@ -578,8 +627,8 @@ __cache_pool_adjust(WT_SESSION_IMPL *session,
 	if (WT_VERBOSE_ISSET(session, WT_VERB_SHARED_CACHE)) {
 		WT_RET(__wt_verbose(session,
 		    WT_VERB_SHARED_CACHE, "Cache pool distribution: "));
-		WT_RET(__wt_verbose(session, WT_VERB_SHARED_CACHE,
-		    "\t" "cache (MB), pressure, skips, busy, %% full:"));
+		WT_RET(__wt_verbose(session, WT_VERB_SHARED_CACHE, "\t"
+		    "cache (MB), pressure, hit gain, skips, busy, %% full:"));
 	}
 
 	for (entry = forward ? TAILQ_FIRST(&cp->cache_pool_qh) :
@@ -601,10 +650,19 @@ __cache_pool_adjust(WT_SESSION_IMPL *session,
 		pressure = cache->cp_pass_pressure / highest_percentile;
 		busy = __wt_eviction_needed(entry->default_session, &pct_full);
 
+		/*
+		 * If any member would gain hits from more cache, that decides
+		 * where cache goes, rather than the read pressure: the members
+		 * with close to the largest gain are candidates for more cache,
+		 * members gaining much less than that give cache up.
+		 */
+		most_gain = cache->cp_hit_gain * WT_CACHE_POOL_GAIN_MARGIN >=
+		    highest_gain;
+
 		WT_RET(__wt_verbose(session, WT_VERB_SHARED_CACHE,
-		    "\t%5" PRIu64 ", %3" PRIu64 ", %2" PRIu32 ", %d, %2u",
-		    entry->cache_size >> 20, pressure, cache->cp_skip_count,
-		    busy, pct_full));
+		    "\t%5" PRIu64 ", %3" PRIu64 ", %3" PRIu64 ", %2" PRIu32
+		    ", %d, %2u", entry->cache_size >> 20, pressure,
+		    cache->cp_hit_gain, cache->cp_skip_count, busy, pct_full));
 
 		/* Allow to stabilize after changes. */
 		if (cache->cp_skip_count > 0 && --cache->cp_skip_count > 0)
@@ -626,14 +684,16 @@ __cache_pool_adjust(WT_SESSION_IMPL *session,
 		 *  - application threads are not busy doing eviction already,
 		 *  - this entry has more than the minimum amount of space in
 		 *    use,
-		 *  - the read pressure in this entry is below the threshold,
-		 *    other entries need more cache, the entry has more than
-		 *    the minimum space and there is no available space in the
-		 *    pool.
+		 *  - another entry would gain many more hits from the space,
+		 *    or without hit estimates, the read pressure in this entry
+		 *    is below the threshold, other entries need more cache,
+		 *    the entry has more than the minimum space and there is
+		 *    no available space in the pool.
 		 */
 		} else if (pool_full && !busy &&
-		    entry->cache_size > reserved &&
-		    pressure < WT_CACHE_POOL_REDUCE_THRESHOLD && highest > 1) {
+		    entry->cache_size > reserved && (highest_gain > 0 ?
+		    !most_gain : pressure < WT_CACHE_POOL_REDUCE_THRESHOLD &&
+		    highest > 1)) {
 			grow = false;
 			/*
 			 * Don't drop the size down too much - or it can
@@ -657,7 +717,9 @@ __cache_pool_adjust(WT_SESSION_IMPL *session,
 		 *  - the connection is using enough cache to require eviction
 		 *  - there was some activity across the pool
 		 *  - this entry is using less than the entire cache pool
-		 *  - additional cache would benefit the connection OR
+		 *  - additional cache would gain this entry as many hits as
+		 *    any other entry, or without hit estimates, additional
+		 *    cache would benefit the connection OR
 		 *  - the pool is less than half distributed
 		 */
 		} else if (!pool_full &&
@@ -665,7 +727,8 @@ __cache_pool_adjust(WT_SESSION_IMPL *session,
 		    entry->cache_size < cache->cp_quota) &&
 		    __wt_cache_bytes_inuse(cache) >=
 		    (entry->cache_size * cache->eviction_target) / 100 &&
-		    (pressure > bump_threshold ||
+		    ((highest_gain > 0 ?
+		    most_gain : pressure > bump_threshold) ||
 		    cp->currently_used < cp->size * 0.5)) {
 			grow = true;
 			adjustment = WT_MIN(WT_MIN(cp->chunk,
@@ -766,3 +829,99 @@ err:		WT_PANIC_MSG(session, ret, "cache pool manager server error");
 	}
 	return (WT_THREAD_RET_VALUE);
 }
+
+/*
+ * __cache_pool_ghost --
+ *	Return the ghost table entry for a page address, and the address' hash.
+ */
+static inline WT_CACHE_GHOST *
+__cache_pool_ghost(WT_SESSION_IMPL *session,
+    WT_CACHE_GHOST *ghost, const uint8_t *addr, size_t addr_size,
+    uint64_t *hashp)
+{
+	uint64_t hash;
+
+	/*
+	 * Different files can have the same address cookies, mix in the file
+	 * ID. Zero marks an empty entry.
+	 */
+	hash = __wt_hash_city64(addr, addr_size) ^
+	    ((uint64_t)S2BT(session)->id << 32);
+	if (hash == 0)
+		hash = 1;
+
+	*hashp = hash;
+	return (&ghost[hash % WT_CACHE_GHOST_SLOTS]);
+}
+
+/*
+ * __wt_cache_pool_ghost_insert --
+ *	Remember a page being evicted from a shared cache.
+ */
+void
+__wt_cache_pool_ghost_insert(
+    WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr_size)
+{
+	WT_CACHE *cache;
+	WT_CACHE_GHOST *ghost;
+	uint64_t hash;
+
+	cache = S2C(session)->cache;
+	if (cache->cp_ghost == NULL || addr == NULL)
+		return;
+
+	/*
+	 * The table is a cache of its own: newer pages replace older pages
+	 * with the same slot. There's no locking, a racing update can leave
+	 * an entry's fields from different pages, which costs us a sample.
+	 */
+	ghost = __cache_pool_ghost(
+	    session, cache->cp_ghost, addr, addr_size, &hash);
+	ghost->evict_bytes = cache->bytes_evict;
+	ghost->hash = hash;
+}
+
+/*
+ * __wt_cache_pool_ghost_check --
+ *	Check whether a page being read into a shared cache was recently
+ *	evicted, and if so, how much more cache would have kept it.
+ */
+void
+__wt_cache_pool_ghost_check(
+    WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr_size)
+{
+	WT_CACHE *cache;
+	WT_CACHE_GHOST *ghost;
+	uint64_t chunks, evict_bytes, hash;
+
+	cache = S2C(session)->cache;
+	if (cache->cp_ghost == NULL || cache->cp_chunk == 0)
+		return;
+
+	ghost = __cache_pool_ghost(
+	    session, cache->cp_ghost, addr, addr_size, &hash);
+	if (ghost->hash != hash)
+		return;
+	evict_bytes = ghost->evict_bytes;
+	ghost->hash = 0;
+	if (evict_bytes > cache->bytes_evict)
+		return;
+
+	/*
+	 * The bytes evicted since the page was evicted is how much larger the
+	 * cache would have had to be for this read to hit: count the read as a
+	 * hit for every cache size at least that much larger. The balancing
+	 * thread only needs the hits from the next chunk.
+	 */
+	chunks = (cache->bytes_evict - evict_bytes) / cache->cp_chunk;
+	if (chunks < 1) {
+		(void)__wt_atomic_add64(&cache->cp_ghost_hits, 1);
+		WT_STAT_FAST_CONN_INCR(session, cache_pool_chunk1);
+	}
+	if (chunks < 2)
+		WT_STAT_FAST_CONN_INCR(session, cache_pool_chunk2);
+	if (chunks < 4)
+		WT_STAT_FAST_CONN_INCR(session, cache_pool_chunk4);
+	if (chunks < 8)
+		WT_STAT_FAST_CONN_INCR(session, cache_pool_chunk8);
+}
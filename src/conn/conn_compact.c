@@ -0,0 +1,419 @@
+/*-
+ * Copyright (c) 2014-2015 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * The background compaction server does the same work as WT_SESSION::compact
+ * (see session_compact.c for a description of the process), one file at a
+ * time and at a configured rate.  Each pass rewrites at most a second's worth
+ * of pages from the end of the file, then checkpoints the file to make the
+ * original blocks available and truncate the file; the server waits after
+ * each pass until the bytes rewritten fit the configured rate.
+ *
+ * The server only considers files with open handles, files that aren't in
+ * use aren't growing, and are left to WT_SESSION::compact.  Files are chosen
+ * in order of the space the block manager expects compaction to reclaim.
+ */
+
+/*
+ * __compact_server_config --
+ *	Parse and setup the background compaction server options.
+ */
+static int
+__compact_server_config(
+    WT_SESSION_IMPL *session, const char **cfg, bool *startp)
+{
+	WT_CONFIG_ITEM cval;
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+
+	WT_RET(__wt_config_gets(session, cfg, "compact.rate", &cval));
+	conn->compact_rate = (uint64_t)cval.val * WT_MEGABYTE;
+
+	WT_RET(__wt_config_gets(session, cfg, "compact.wait", &cval));
+	conn->compact_usecs = (uint64_t)cval.val * WT_MILLION;
+
+	/* Compaction requires checkpoints, and a rate to run at all. */
+	if (conn->compact_rate != 0) {
+		WT_RET(__wt_config_gets(session, cfg, "in_memory", &cval));
+		if (cval.val != 0)
+			WT_RET_MSG(session, EINVAL,
+			    "In memory configuration incompatible with "
+			    "background compaction");
+	}
+
+	*startp = conn->compact_rate != 0;
+	return (0);
+}
+
+/*
+ * __compact_server_running --
+ *	Return if the background compaction server should keep running.
+ */
+static inline bool
+__compact_server_running(WT_CONNECTION_IMPL *conn)
+{
+	return (F_ISSET(conn, WT_CONN_SERVER_RUN) &&
+	    F_ISSET(conn, WT_CONN_SERVER_COMPACT));
+}
+
+/*
+ * __compact_server_candidates --
+ *	Copy the names of the files with open handles.
+ */
+static int
+__compact_server_candidates(
+    WT_SESSION_IMPL *session, char ***namesp, size_t *allocatedp, u_int *np)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DATA_HANDLE *dhandle;
+	u_int n;
+
+	conn = S2C(session);
+	n = 0;
+
+	TAILQ_FOREACH(dhandle, &conn->dhqh, q) {
+		if (WT_IS_METADATA(dhandle) ||
+		    dhandle->checkpoint != NULL ||
+		    !F_ISSET(dhandle, WT_DHANDLE_OPEN) ||
+		    F_ISSET(dhandle, WT_DHANDLE_DEAD) ||
+		    !WT_PREFIX_MATCH(dhandle->name, "file:") ||
+		    strcmp(dhandle->name, WT_LAS_URI) == 0)
+			continue;
+
+		WT_RET(__wt_realloc_def(session, allocatedp, n + 1, namesp));
+		WT_RET(__wt_strdup(session, dhandle->name, &(*namesp)[n]));
+		*np = ++n;
+	}
+	return (0);
+}
+
+/*
+ * __compact_server_reclaim --
+ *	Return the space the block manager expects compaction of a file to
+ * reclaim.
+ */
+static int
+__compact_server_reclaim(
+    WT_SESSION_IMPL *session, const char *uri, wt_off_t *reclaimp)
+{
+	WT_BM *bm;
+	WT_DECL_RET;
+	bool skip;
+
+	*reclaimp = 0;
+
+	/* The file may have been dropped or be busy, skip it. */
+	if ((ret = __wt_session_get_btree(session, uri, NULL, NULL, 0)) != 0)
+		return (ret == ENOENT || ret == EBUSY ? 0 : ret);
+
+	bm = S2BT(session)->bm;
+	if (!F_ISSET(S2BT(session), WT_BTREE_BULK))
+		ret = bm->compact_skip(bm, session, &skip, reclaimp);
+
+	WT_TRET(__wt_session_release_btree(session));
+	return (ret);
+}
+
+/*
+ * __compact_server_pass --
+ *	Rewrite pages from the end of a file and checkpoint it.
+ */
+static int
+__compact_server_pass(WT_SESSION_IMPL *session,
+    const char *uri, const char *checkpoint_cfg[], bool *progressp)
+{
+	WT_DECL_RET;
+	const char *compact_cfg[] = {
+	    WT_CONFIG_BASE(session, WT_SESSION_compact), NULL };
+
+	*progressp = false;
+
+	session->compaction = false;
+	WT_WITH_SCHEMA_LOCK(session,
+	    ret = __wt_schema_worker(
+	    session, uri, __wt_compact, NULL, compact_cfg, 0));
+	if (ret == ENOENT || ret == EBUSY)
+		return (0);
+	WT_RET(ret);
+	if (!session->compaction)
+		return (0);
+	*progressp = true;
+
+	/* Make the original blocks available, truncate the file. */
+	WT_RET(__wt_txn_checkpoint(session, checkpoint_cfg));
+	return (__wt_txn_checkpoint(session, checkpoint_cfg));
+}
+
+/*
+ * __compact_server_file --
+ *	Compact a file at the configured rate.
+ */
+static int
+__compact_server_file(WT_SESSION_IMPL *session, const char *uri)
+{
+	struct timespec start, stop;
+	WT_BM *bm;
+	WT_COMPACT compact;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_ITEM(tmp);
+	WT_DECL_RET;
+	uint64_t elapsed, required;
+	bool progress;
+	const char *checkpoint_cfg[] = {
+	    WT_CONFIG_BASE(session, WT_SESSION_checkpoint), NULL, NULL };
+
+	conn = S2C(session);
+
+	/* Force the checkpoints, the work is done in the block manager. */
+	WT_RET(__wt_scr_alloc(session, 128, &tmp));
+	WT_ERR(__wt_buf_fmt(session, tmp, "target=(\"%s\"),force=1", uri));
+	checkpoint_cfg[1] = tmp->data;
+
+	memset(&compact, 0, sizeof(compact));
+	compact.file_count = 1;
+	compact.max_bytes = conn->compact_rate;
+	session->compact = &compact;
+
+	WT_STAT_FAST_CONN_INCR(session, block_compact_server_files);
+	WT_ERR(__wt_verbose(session, WT_VERB_COMPACT,
+	    "%s: background compaction starting", uri));
+
+	while (__compact_server_running(conn)) {
+		WT_ERR(__wt_epoch(session, &start));
+		WT_ERR(__wt_txn_checkpoint(session, checkpoint_cfg));
+
+		/* The file may have been dropped or be busy, we're done. */
+		if ((ret = __wt_session_get_btree(
+		    session, uri, NULL, NULL, 0)) != 0) {
+			if (ret == ENOENT || ret == EBUSY)
+				ret = 0;
+			break;
+		}
+
+		/*
+		 * Unlike WT_SESSION::compact, the application is writing the
+		 * file while we compact it: hold the block manager's first-fit
+		 * allocation until the pass is checkpointed, otherwise pages
+		 * rewritten by the checkpoint, or by the application, can be
+		 * written back into the end of the file.  Don't start or end a
+		 * block manager compaction here: that resets the compaction
+		 * state an application's WT_SESSION::compact of the same file
+		 * may be using, and we don't hold the schema lock.
+		 */
+		compact.bytes = 0;
+		progress = false;
+		bm = S2BT(session)->bm;
+		if ((ret = bm->first_fit(bm, session, true)) == 0) {
+			WT_WITHOUT_DHANDLE(session,
+			    ret = __compact_server_pass(
+			    session, uri, checkpoint_cfg, &progress));
+			WT_TRET(bm->first_fit(bm, session, false));
+		}
+		WT_TRET(__wt_session_release_btree(session));
+		WT_ERR(ret);
+		if (!progress)
+			break;
+
+		WT_STAT_FAST_CONN_INCRV(
+		    session, block_compact_server_rewrite, compact.bytes);
+
+		/*
+		 * Wait until the pass fits the rate: the wait returns early if
+		 * the server is shut down or reconfigured.
+		 */
+		WT_ERR(__wt_epoch(session, &stop));
+		elapsed = WT_TIMEDIFF_US(stop, start);
+		required = (compact.bytes * WT_MILLION) / conn->compact_rate;
+		if (required > elapsed)
+			WT_ERR(__wt_cond_wait(
+			    session, conn->compact_cond, required - elapsed));
+	}
+
+	WT_ERR(__wt_verbose(session, WT_VERB_COMPACT,
+	    "%s: background compaction finished", uri));
+
+err:	session->compact = NULL;
+	__wt_scr_free(session, &tmp);
+	WT_TRET(__wt_session_release_resources(session));
+	return (ret);
+}
+
+/*
+ * __compact_server_run --
+ *	Compact the files with reclaimable space, largest first.
+ */
+static int
+__compact_server_run(WT_SESSION_IMPL *session)
+{
+	WT_DECL_RET;
+	wt_off_t best_reclaim, reclaim;
+	size_t allocated;
+	u_int best, i, n;
+	char **names;
+
+	names = NULL;
+	allocated = 0;
+	n = 0;
+
+	WT_WITH_HANDLE_LIST_LOCK(session,
+	    ret = __compact_server_candidates(
+	    session, &names, &allocated, &n));
+	WT_ERR(ret);
+
+	/*
+	 * Compact the file with the most reclaimable space, then review the
+	 * rest again: the workload may have moved on while compacting.
+	 */
+	while (__compact_server_running(S2C(session))) {
+		best = 0;
+		best_reclaim = 0;
+		for (i = 0; i < n; ++i) {
+			if (names[i] == NULL)
+				continue;
+			WT_ERR(__compact_server_reclaim(
+			    session, names[i], &reclaim));
+			if (reclaim == 0)
+				__wt_free(session, names[i]);
+			else if (reclaim > best_reclaim) {
+				best = i;
+				best_reclaim = reclaim;
+			}
+		}
+		if (best_reclaim == 0)
+			break;
+
+		WT_ERR(__compact_server_file(session, names[best]));
+		__wt_free(session, names[best]);
+	}
+
+err:	for (i = 0; i < n; ++i)
+		__wt_free(session, names[i]);
+	__wt_free(session, names);
+	return (ret);
+}
+
+/*
+ * __compact_server --
+ *	The background compaction server thread.
+ */
+static WT_THREAD_RET
+__compact_server(void *arg)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	session = arg;
+	conn = S2C(session);
+
+	while (__compact_server_running(conn)) {
+		WT_ERR(__wt_cond_wait(
+		    session, conn->compact_cond, conn->compact_usecs));
+		if (!__compact_server_running(conn))
+			break;
+
+		WT_ERR(__compact_server_run(session));
+	}
+
+	if (0) {
+err:		WT_PANIC_MSG(
+		    session, ret, "background compaction server error");
+	}
+	return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * __compact_server_start --
+ *	Start the background compaction server thread.
+ */
+static int
+__compact_server_start(WT_CONNECTION_IMPL *conn)
+{
+	WT_SESSION_IMPL *session;
+
+	/* Nothing to do if the server is already running. */
+	if (conn->compact_session != NULL)
+		return (0);
+
+	F_SET(conn, WT_CONN_SERVER_COMPACT);
+
+	/*
+	 * The server gets its own session, and does enough I/O it may be
+	 * called upon to perform slow operations for the block manager.
+	 */
+	WT_RET(__wt_open_internal_session(conn, "compact-server",
+	    true, WT_SESSION_CAN_WAIT, &conn->compact_session));
+	session = conn->compact_session;
+
+	WT_RET(__wt_cond_alloc(
+	    session, "compact server", false, &conn->compact_cond));
+
+	WT_RET(__wt_thread_create(
+	    session, &conn->compact_tid, __compact_server, session));
+	conn->compact_tid_set = true;
+
+	return (0);
+}
+
+/*
+ * __wt_compact_server_create --
+ *	Configure and start the background compaction server.
+ */
+int
+__wt_compact_server_create(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_CONNECTION_IMPL *conn;
+	bool start;
+
+	conn = S2C(session);
+	start = false;
+
+	/* If there is already a server running, shut it down. */
+	if (conn->compact_session != NULL)
+		WT_RET(__wt_compact_server_destroy(session));
+
+	WT_RET(__compact_server_config(session, cfg, &start));
+	if (start)
+		WT_RET(__compact_server_start(conn));
+
+	return (0);
+}
+
+/*
+ * __wt_compact_server_destroy --
+ *	Destroy the background compaction server thread.
+ */
+int
+__wt_compact_server_destroy(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_SESSION *wt_session;
+
+	conn = S2C(session);
+
+	F_CLR(conn, WT_CONN_SERVER_COMPACT);
+	if (conn->compact_tid_set) {
+		WT_TRET(__wt_cond_signal(session, conn->compact_cond));
+		WT_TRET(__wt_thread_join(session, conn->compact_tid));
+		conn->compact_tid_set = false;
+	}
+	WT_TRET(__wt_cond_destroy(session, &conn->compact_cond));
+
+	/* Close the server thread's session. */
+	if (conn->compact_session != NULL) {
+		wt_session = &conn->compact_session->iface;
+		WT_TRET(wt_session->close(wt_session, NULL));
+	}
+	conn->compact_session = NULL;
+
+	return (ret);
+}
@@ -40,6 +40,7 @@ __wt_connection_init(WT_CONNECTION_IMPL *conn)
 	TAILQ_INIT(&conn->lsm_manager.switchqh);
 	TAILQ_INIT(&conn->lsm_manager.appqh);
 	TAILQ_INIT(&conn->lsm_manager.managerqh);
+	TAILQ_INIT(&conn->writeqh);		/* Write pool list */
 
 	/* Configuration. */
 	WT_RET(__wt_conn_config_init(session));
@@ -59,7 +60,9 @@ __wt_connection_init(WT_CONNECTION_IMPL *conn)
 	WT_RET(__wt_spin_init(session, &conn->reconfig_lock, "reconfigure"));
 	WT_RET(__wt_spin_init(session, &conn->schema_lock, "schema"));
 	WT_RET(__wt_spin_init(session, &conn->table_lock, "table creation"));
+	WT_RET(__wt_spin_init(session, &conn->trace_lock, "trace dump"));
 	WT_RET(__wt_spin_init(session, &conn->turtle_lock, "turtle file"));
+	WT_RET(__wt_spin_init(session, &conn->write_lock, "write pool"));
 
 	WT_RET(__wt_calloc_def(session, WT_PAGE_LOCKS, &conn->page_lock));
 	WT_CACHE_LINE_ALIGNMENT_VERIFY(session, conn->page_lock);
@@ -146,7 +149,9 @@ __wt_connection_destroy(WT_CONNECTION_IMPL *conn)
 	__wt_spin_destroy(session, &conn->reconfig_lock);
 	__wt_spin_destroy(session, &conn->schema_lock);
 	__wt_spin_destroy(session, &conn->table_lock);
+	__wt_spin_destroy(session, &conn->trace_lock);
 	__wt_spin_destroy(session, &conn->turtle_lock);
+	__wt_spin_destroy(session, &conn->write_lock);
 	for (i = 0; i < WT_PAGE_LOCKS; ++i)
 		__wt_spin_destroy(session, &conn->page_lock[i]);
 	__wt_free(session, conn->page_lock);
@@ -155,6 +160,7 @@ __wt_connection_destroy(WT_CONNECTION_IMPL *conn)
 	__wt_free(session, conn->cfg);
 	__wt_free(session, conn->home);
 	__wt_free(session, conn->error_prefix);
+	__wt_free(session, conn->trace_path);
 	__wt_free(session, conn->sessions);
 
 	__wt_free(NULL, conn);
@@ -60,6 +60,9 @@ __wt_connection_open(WT_CONNECTION_IMPL *conn, const char *cfg[])
 	/* Create the cache. */
 	WT_RET(__wt_cache_create(session, cfg));
 
+	/* Open the block cache. */
+	WT_RET(__wt_bcache_create(session, cfg));
+
 	/* Initialize transaction support. */
 	WT_RET(__wt_txn_global_init(session, cfg));
 
@@ -116,6 +119,9 @@ __wt_connection_close(WT_CONNECTION_IMPL *conn)
 
 	F_SET(conn, WT_CONN_CLOSING);
 
+	WT_TRET(__wt_compact_server_destroy(session));
+	WT_TRET(__wt_warmup_destroy(session));
+	WT_TRET(__wt_prefetch_destroy(session));
 	WT_TRET(__wt_checkpoint_server_destroy(session));
 	WT_TRET(__wt_statlog_destroy(session, true));
 	WT_TRET(__wt_evict_destroy(session));
@@ -126,6 +132,15 @@ __wt_connection_close(WT_CONNECTION_IMPL *conn)
 	/* Close open data handles. */
 	WT_TRET(__wt_conn_dhandle_discard(session));
 
+	/* Save the pages recorded for cache warm-up. */
+	WT_TRET(__wt_warmup_save(session, ret == 0));
+
+	/* Shut down the write pool, after all data handles are closed. */
+	WT_TRET(__wt_write_pool_destroy(session));
+
+	/* Close the block cache, after all data files are closed. */
+	WT_TRET(__wt_bcache_destroy(session, ret == 0));
+
 	/* Shut down metadata tracking, required before creating tables. */
 	WT_TRET(__wt_meta_track_destroy(session));
 
@@ -143,6 +158,9 @@ __wt_connection_close(WT_CONNECTION_IMPL *conn)
 	F_CLR(conn, WT_CONN_LOG_SERVER_RUN);
 	WT_TRET(__wt_logmgr_destroy(session));
 
+	/* Shut down the trace dump thread, after all other threads. */
+	WT_TRET(__wt_trace_server_destroy(session));
+
 	/* Free memory for collators, compressors, data sources. */
 	WT_TRET(__wt_conn_remove_collator(session));
 	WT_TRET(__wt_conn_remove_compressor(session));
@@ -201,9 +219,9 @@ __wt_connection_close(WT_CONNECTION_IMPL *conn)
 			__wt_split_stash_discard_all(session, s);
 
 	/*
-	 * The session's hazard pointer memory isn't discarded during normal
-	 * session close because access to it isn't serialized.  Discard it
-	 * now.
+	 * The session's hazard pointer memory and trace ring buffer aren't
+	 * discarded during normal session close because access to them isn't
+	 * serialized.  Discard them now.
 	 */
 	if ((s = conn->sessions) != NULL)
 		for (i = 0; i < conn->session_size; ++s, ++i) {
@@ -215,6 +233,7 @@ __wt_connection_close(WT_CONNECTION_IMPL *conn)
 			if (s->tablehash != NULL)
 				__wt_free(session, s->tablehash);
 			__wt_free(session, s->hazard);
+			__wt_free(session, s->trace);
 		}
 
 	/* Destroy the handle. */
@@ -230,6 +249,12 @@ __wt_connection_close(WT_CONNECTION_IMPL *conn)
 int
 __wt_connection_workers(WT_SESSION_IMPL *session, const char *cfg[])
 {
+	/*
+	 * Start the optional trace dump thread first, slow operations during
+	 * recovery are dumped too.
+	 */
+	WT_RET(__wt_trace_server_create(session));
+
 	/*
 	 * Start the optional statistics thread.  Start statistics first so that
 	 * other optional threads can know if statistics are enabled or not.
@@ -261,6 +286,12 @@ __wt_connection_workers(WT_SESSION_IMPL *session, const char *cfg[])
 	/* Create the lookaside table. */
 	WT_RET(__wt_las_create(session));
 
+	/*
+	 * Start the optional write pool threads.
+	 * NOTE: The write pool is started before eviction, which uses it.
+	 */
+	WT_RET(__wt_write_pool_create(session, cfg));
+
 	/*
 	 * Start eviction threads.
 	 * NOTE: Eviction must be started after the lookaside table is created.
@@ -276,5 +307,14 @@ __wt_connection_workers(WT_SESSION_IMPL *session, const char *cfg[])
 	/* Start the optional checkpoint thread. */
 	WT_RET(__wt_checkpoint_server_create(session, cfg));
 
+	/* Start the optional background compaction thread. */
+	WT_RET(__wt_compact_server_create(session, cfg));
+
+	/* Start the optional cache warm-up thread. */
+	WT_RET(__wt_warmup_create(session, cfg));
+
+	/* Start the optional open prefetch threads. */
+	WT_RET(__wt_prefetch_create(session, cfg));
+
 	return (0);
 }
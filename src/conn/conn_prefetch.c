@@ -0,0 +1,208 @@
+/*-
+ * Copyright (c) 2014-2015 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * Data handles are opened when a file is first used, not when the connection
+ * is opened; recovery only opens the files named in the log records it
+ * applies.  With many files, the cost moves to the files' first uses: each
+ * open reads the file's description block, its checkpoint's root page and
+ * avail list, and opens serialize on the schema and handle list locks.
+ *
+ * The open prefetch pool takes the reads out of the opens: once recovery is
+ * done, the pool threads work through the files in the metadata, asking the
+ * block manager to prefetch the blocks each file's open will read.  The
+ * metadata reads are done in parallel.  The prefetch itself holds the schema
+ * lock: it briefly holds the file's handle, and must not race with the file
+ * being dropped and created again.  The system reads the blocks in the
+ * background, the lock isn't held for the I/O.
+ */
+
+/*
+ * __prefetch_file --
+ *	Prefetch the blocks read when a file is opened.
+ */
+static int
+__prefetch_file(WT_SESSION_IMPL *session, const char *uri)
+{
+	WT_CKPT ckpt;
+	WT_CONFIG_ITEM cval;
+	WT_DECL_RET;
+	char *config;
+	const char *filename;
+
+	WT_CLEAR(ckpt);
+	config = NULL;
+
+	/* The file may have been dropped since we looked. */
+	if ((ret = __wt_metadata_search(session, uri, &config)) != 0)
+		return (ret == WT_NOTFOUND ? 0 : ret);
+
+	WT_ERR(__wt_config_getones(session, config, "allocation_size", &cval));
+	WT_ERR(__wt_meta_checkpoint(session, uri, NULL, &ckpt));
+
+	filename = uri;
+	(void)WT_PREFIX_SKIP(filename, "file:");
+	WT_WITH_SCHEMA_LOCK(session,
+	    ret = __wt_block_manager_prefetch(session, filename,
+	    (uint32_t)cval.val, ckpt.raw.data, ckpt.raw.size));
+	WT_ERR(ret);
+	WT_STAT_FAST_CONN_INCR(session, dh_open_prefetch);
+
+err:	__wt_meta_checkpoint_free(session, &ckpt);
+	__wt_free(session, config);
+	return (ret);
+}
+
+/*
+ * __prefetch_server --
+ *	The open prefetch thread.
+ */
+static WT_THREAD_RET
+__prefetch_server(void *arg)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_SESSION_IMPL *session;
+	uint32_t i;
+
+	session = arg;
+	conn = S2C(session);
+
+	while (F_ISSET(conn, WT_CONN_SERVER_PREFETCH)) {
+		i = __wt_atomic_add32(&conn->prefetch_next, 1) - 1;
+		if (i >= conn->prefetch_entries)
+			break;
+
+		/*
+		 * Prefetching is advisory: a file that can't be prefetched is
+		 * read when it's opened, and that's where errors are reported.
+		 */
+		(void)__prefetch_file(session, conn->prefetch_uris[i]);
+	}
+	return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * __prefetch_candidates --
+ *	Copy the names of the files in the metadata.
+ */
+static int
+__prefetch_candidates(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_CURSOR *cursor;
+	WT_DECL_RET;
+	size_t allocated;
+	int cmp;
+	const char *uri;
+
+	conn = S2C(session);
+	allocated = 0;
+
+	WT_RET(__wt_metadata_cursor(session, NULL, &cursor));
+	cursor->set_key(cursor, "file:");
+	if ((ret = cursor->search_near(cursor, &cmp)) == 0 && cmp < 0)
+		ret = cursor->next(cursor);
+	for (; ret == 0; ret = cursor->next(cursor)) {
+		WT_ERR(cursor->get_key(cursor, &uri));
+		if (!WT_PREFIX_MATCH(uri, "file:"))
+			break;
+		if (strcmp(uri, WT_METAFILE_URI) == 0 ||
+		    strcmp(uri, WT_LAS_URI) == 0)
+			continue;
+
+		WT_ERR(__wt_realloc_def(session, &allocated,
+		    conn->prefetch_entries + 1, &conn->prefetch_uris));
+		WT_ERR(__wt_strdup(session,
+		    uri, &conn->prefetch_uris[conn->prefetch_entries]));
+		++conn->prefetch_entries;
+	}
+	WT_ERR_NOTFOUND_OK(ret);
+
+err:	WT_TRET(cursor->close(cursor));
+	return (ret);
+}
+
+/*
+ * __wt_prefetch_create --
+ *	Start the optional open prefetch threads.
+ */
+int
+__wt_prefetch_create(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_CONFIG_ITEM cval;
+	WT_CONNECTION_IMPL *conn;
+	uint32_t i;
+
+	conn = S2C(session);
+
+	/*
+	 * There's nothing to prefetch without files, or if reads bypass the
+	 * system buffer cache.
+	 */
+	WT_RET(__wt_config_gets(session, cfg, "open_prefetch.threads", &cval));
+	if (cval.val == 0 || F_ISSET(conn, WT_CONN_IN_MEMORY) ||
+	    FLD_ISSET(conn->direct_io, WT_FILE_TYPE_DATA))
+		return (0);
+
+	WT_RET(__prefetch_candidates(session));
+	if (conn->prefetch_entries == 0)
+		return (0);
+
+	WT_RET(__wt_calloc_def(
+	    session, (size_t)cval.val, &conn->prefetch_sessions));
+	WT_RET(__wt_calloc_def(
+	    session, (size_t)cval.val, &conn->prefetch_tids));
+
+	/* Set first, the threads might run before we finish up. */
+	F_SET(conn, WT_CONN_SERVER_PREFETCH);
+
+	for (i = 0; i < (uint32_t)cval.val; ++i) {
+		WT_RET(__wt_open_internal_session(conn, "open-prefetch",
+		    true, 0, &conn->prefetch_sessions[i]));
+		WT_RET(__wt_thread_create(session,
+		    &conn->prefetch_tids[i], __prefetch_server,
+		    conn->prefetch_sessions[i]));
+		conn->prefetch_workers = i + 1;
+	}
+	return (0);
+}
+
+/*
+ * __wt_prefetch_destroy --
+ *	Destroy the open prefetch threads.
+ */
+int
+__wt_prefetch_destroy(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_SESSION *wt_session;
+	uint32_t i;
+
+	conn = S2C(session);
+
+	F_CLR(conn, WT_CONN_SERVER_PREFETCH);
+	for (i = 0; i < conn->prefetch_workers; ++i)
+		WT_TRET(__wt_thread_join(session, conn->prefetch_tids[i]));
+	for (i = 0; i < conn->prefetch_workers; ++i) {
+		wt_session = &conn->prefetch_sessions[i]->iface;
+		WT_TRET(wt_session->close(wt_session, NULL));
+	}
+	conn->prefetch_workers = 0;
+
+	for (i = 0; i < conn->prefetch_entries; ++i)
+		__wt_free(session, conn->prefetch_uris[i]);
+	__wt_free(session, conn->prefetch_uris);
+	conn->prefetch_entries = conn->prefetch_next = 0;
+	__wt_free(session, conn->prefetch_sessions);
+	__wt_free(session, conn->prefetch_tids);
+
+	return (ret);
+}
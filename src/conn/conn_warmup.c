@@ -0,0 +1,548 @@
+/*-
+ * Copyright (c) 2014-2015 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * Cache warm-up records the addresses of the pages in the cache as each file
+ * is discarded from the cache at connection close, and writes them to the
+ * warm-up file once all files are closed.  The addresses are those the pages
+ * have after the files' final checkpoints: clean pages are recorded from their
+ * parent's reference, reconciled pages from their reconciliation results.
+ *
+ * When the connection is next opened, the warm-up server reads and removes the
+ * warm-up file, then reads the recorded pages of each file back in.  It first
+ * asks the block manager to preload the pages in address order (for the block
+ * manager, that's file offset order), so the reads are sequential and can be
+ * merged by the system, then walks the tree reading the recorded pages into
+ * the cache, skipping any leaf page that wasn't recorded.  Internal pages are
+ * always read: they're a small part of the tree, and splitting the root when
+ * it's written at close creates internal pages that were never in the cache.
+ * The server runs beside the application and stops once the cache is filled
+ * to the configured target.  Addresses aren't trusted: a leaf page is read
+ * only if its reference in the tree has a recorded address, anything else
+ * recorded is ignored.
+ *
+ * The warm-up file is a version number, then for each file the file's URI
+ * (nul-terminated) and a list of page addresses, each preceded by its length,
+ * the list terminated by a zero length.  Integers are packed.
+ */
+#define	WT_WARMUP_FILE		"WiredTigerWarmup"
+#define	WT_WARMUP_VERSION	1
+
+/*
+ * __warmup_config --
+ *	Parse and setup the cache warm-up options.
+ */
+static int
+__warmup_config(WT_SESSION_IMPL *session, const char **cfg, bool *startp)
+{
+	WT_CONFIG_ITEM cval;
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+	*startp = false;
+
+	WT_RET(__wt_config_gets(session, cfg, "cache_warmup.enabled", &cval));
+	if (cval.val == 0)
+		return (0);
+
+	/* There's nothing to warm if the cache is the only copy. */
+	if (F_ISSET(conn, WT_CONN_IN_MEMORY))
+		WT_RET_MSG(session, EINVAL,
+		    "In memory configuration incompatible with cache warm-up");
+
+	WT_RET(__wt_config_gets(session, cfg, "cache_warmup.target", &cval));
+	conn->warmup_target = (u_int)cval.val;
+
+	WT_RET(__wt_calloc_one(session, &conn->warmup_rec));
+
+	*startp = true;
+	return (0);
+}
+
+/*
+ * __warmup_running --
+ *	Return if the warm-up server should keep running.
+ */
+static inline bool
+__warmup_running(WT_CONNECTION_IMPL *conn)
+{
+	return (F_ISSET(conn, WT_CONN_SERVER_RUN) &&
+	    F_ISSET(conn, WT_CONN_SERVER_WARMUP));
+}
+
+/*
+ * __warmup_cache_full --
+ *	Return if the cache is filled to the warm-up target.
+ */
+static inline bool
+__warmup_cache_full(WT_CONNECTION_IMPL *conn)
+{
+	return (__wt_cache_bytes_inuse(conn->cache) * 100 >=
+	    conn->warmup_target * conn->cache_size);
+}
+
+/*
+ * __warmup_addr_compare --
+ *	Qsort function: sort page addresses.
+ */
+static int WT_CDECL
+__warmup_addr_compare(const void *a, const void *b)
+{
+	const WT_ITEM *aitem, *bitem;
+	int cmp;
+
+	aitem = a;
+	bitem = b;
+	if ((cmp = memcmp(aitem->data, bitem->data,
+	    WT_MIN(aitem->size, bitem->size))) != 0)
+		return (cmp);
+	return (aitem->size < bitem->size ? -1 :
+	    (aitem->size > bitem->size ? 1 : 0));
+}
+
+/*
+ * __wt_warmup_page_skip --
+ *	Return if warm-up should skip reading this page.
+ */
+int
+__wt_warmup_page_skip(WT_SESSION_IMPL *session, WT_REF *ref, bool *skipp)
+{
+	WT_ITEM key;
+	WT_WARMUP *warmup;
+	size_t addr_size;
+	u_int type;
+	const uint8_t *addr;
+
+	*skipp = true;
+	type = 0;			/* -Wuninitialized */
+
+	warmup = session->warmup;
+
+	/*
+	 * We aren't holding a hazard pointer, so we can't look at the page
+	 * itself, all we can look at is the WT_REF information.  Internal
+	 * pages are read whether or not they were recorded, the recorded leaf
+	 * pages can't be found otherwise.
+	 */
+	WT_RET(__wt_ref_info(session, ref, &addr, &addr_size, &type));
+	if (addr == NULL)
+		return (0);
+
+	key.data = addr;
+	key.size = addr_size;
+	if (type != WT_CELL_ADDR_INT && bsearch(&key, warmup->addr,
+	    warmup->entries, sizeof(WT_ITEM), __warmup_addr_compare) == NULL)
+		return (0);
+
+	*skipp = false;
+	WT_STAT_FAST_CONN_INCR(session, cache_warmup_read);
+	return (0);
+}
+
+/*
+ * __warmup_file --
+ *	Read a file's recorded pages back into the cache.
+ */
+static int
+__warmup_file(WT_SESSION_IMPL *session, const char *uri, WT_WARMUP *warmup)
+{
+	WT_BM *bm;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_REF *ref;
+	u_int i;
+
+	conn = S2C(session);
+	ref = NULL;
+
+	/* The file may have been dropped or be busy, skip it. */
+	if ((ret = __wt_session_get_btree(session, uri, NULL, NULL, 0)) != 0)
+		return (ret == ENOENT || ret == EBUSY ? 0 : ret);
+
+	qsort(warmup->addr,
+	    warmup->entries, sizeof(WT_ITEM), __warmup_addr_compare);
+
+	/*
+	 * Preload the pages in address order.  A recorded address may no longer
+	 * be valid: it's only a hint to the block manager, ignore failures.
+	 */
+	bm = S2BT(session)->bm;
+	F_SET(session, WT_SESSION_QUIET_CORRUPT_FILE);
+	for (i = 0; i < warmup->entries && __warmup_running(conn); ++i)
+		(void)bm->preload(bm, session,
+		    warmup->addr[i].data, warmup->addr[i].size);
+	F_CLR(session, WT_SESSION_QUIET_CORRUPT_FILE);
+
+	/* Read the recorded pages into the cache. */
+	session->warmup = warmup;
+	while (__warmup_running(conn) && !__warmup_cache_full(conn)) {
+		WT_ERR(__wt_tree_walk(session, &ref, NULL, WT_READ_WARMUP));
+		if (ref == NULL)
+			break;
+	}
+
+err:	if (ref != NULL)
+		WT_TRET(__wt_page_release(session, ref, 0));
+	session->warmup = NULL;
+
+	WT_TRET(__wt_session_release_btree(session));
+	return (ret);
+}
+
+/*
+ * __warmup_run --
+ *	Read the warm-up file and warm the cache from it.
+ */
+static int
+__warmup_run(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_ITEM(buf);
+	WT_DECL_RET;
+	WT_FH *fh;
+	WT_WARMUP warmup;
+	wt_off_t size;
+	size_t allocated;
+	uint64_t v;
+	const uint8_t *end, *p;
+	const char *uri;
+	bool exist;
+
+	conn = S2C(session);
+	fh = NULL;
+	memset(&warmup, 0, sizeof(warmup));
+	allocated = 0;
+
+	WT_RET(__wt_exist(session, WT_WARMUP_FILE, &exist));
+	if (!exist)
+		return (0);
+
+	/*
+	 * Read the file and remove it: it describes the cache at the last
+	 * clean close, and after a crash we have nothing better.
+	 */
+	WT_ERR(__wt_open(session, WT_WARMUP_FILE, false, false, 0, &fh));
+	WT_ERR(__wt_filesize(session, fh, &size));
+	WT_ERR(__wt_scr_alloc(session, (size_t)size, &buf));
+	WT_ERR(__wt_read(session, fh, 0, (size_t)size, buf->mem));
+	buf->size = (size_t)size;
+	WT_ERR(__wt_close(session, &fh));
+	WT_ERR(__wt_remove(session, WT_WARMUP_FILE));
+
+	/* Ignore files we don't understand, they may have been truncated. */
+	p = buf->data;
+	end = p + buf->size;
+	if (__wt_vunpack_uint(&p, WT_PTRDIFF(end, p), &v) != 0 ||
+	    v != WT_WARMUP_VERSION)
+		goto err;
+	while (p < end && __warmup_running(conn) &&
+	    !__warmup_cache_full(conn)) {
+		uri = (const char *)p;
+		if ((p = memchr(p, '\0', WT_PTRDIFF(end, p))) == NULL)
+			goto err;
+		for (++p, warmup.entries = 0;; ++warmup.entries) {
+			if (__wt_vunpack_uint(
+			    &p, WT_PTRDIFF(end, p), &v) != 0 ||
+			    v > WT_PTRDIFF(end, p))
+				goto err;
+			if (v == 0)
+				break;
+			WT_ERR(__wt_realloc_def(session,
+			    &allocated, warmup.entries + 1, &warmup.addr));
+			warmup.addr[warmup.entries].data = p;
+			warmup.addr[warmup.entries].size = (size_t)v;
+			p += v;
+		}
+
+		if (!WT_PREFIX_MATCH(uri, "file:"))
+			continue;
+
+		WT_ERR(__wt_verbose(session, WT_VERB_EVICTSERVER,
+		    "%s: cache warm-up of %u pages", uri, warmup.entries));
+		WT_ERR(__warmup_file(session, uri, &warmup));
+	}
+
+err:	if (fh != NULL)
+		WT_TRET(__wt_close(session, &fh));
+	__wt_free(session, warmup.addr);
+	__wt_scr_free(session, &buf);
+	WT_TRET(__wt_session_release_resources(session));
+	return (ret);
+}
+
+/*
+ * __warmup_server --
+ *	The cache warm-up server thread.
+ */
+static WT_THREAD_RET
+__warmup_server(void *arg)
+{
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	session = arg;
+
+	WT_ERR(__warmup_run(session));
+
+	/*
+	 * Warm-up is only an optimization: on error, complain and stop, the
+	 * pages are read when the application needs them.
+	 */
+	if (0) {
+err:		__wt_err(session, ret, "cache warm-up server error");
+	}
+	return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * __wt_warmup_create --
+ *	Configure cache warm-up and start the warm-up server.
+ */
+int
+__wt_warmup_create(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_CONNECTION_IMPL *conn;
+	bool start;
+
+	conn = S2C(session);
+
+	WT_RET(__warmup_config(session, cfg, &start));
+	if (!start)
+		return (0);
+
+	F_SET(conn, WT_CONN_SERVER_WARMUP);
+
+	/*
+	 * The server gets its own session, and does enough I/O it may be
+	 * called upon to perform slow operations for the block manager.
+	 */
+	WT_RET(__wt_open_internal_session(conn, "warmup-server",
+	    true, WT_SESSION_CAN_WAIT, &conn->warmup_session));
+	session = conn->warmup_session;
+
+	WT_RET(__wt_thread_create(
+	    session, &conn->warmup_tid, __warmup_server, session));
+	conn->warmup_tid_set = true;
+
+	return (0);
+}
+
+/*
+ * __wt_warmup_destroy --
+ *	Stop the cache warm-up server.
+ */
+int
+__wt_warmup_destroy(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_SESSION *wt_session;
+
+	conn = S2C(session);
+
+	F_CLR(conn, WT_CONN_SERVER_WARMUP);
+	if (conn->warmup_tid_set) {
+		WT_TRET(__wt_thread_join(session, conn->warmup_tid));
+		conn->warmup_tid_set = false;
+	}
+
+	/* Close the server thread's session. */
+	if (conn->warmup_session != NULL) {
+		wt_session = &conn->warmup_session->iface;
+		WT_TRET(wt_session->close(wt_session, NULL));
+	}
+	conn->warmup_session = NULL;
+
+	return (ret);
+}
+
+/*
+ * __warmup_record_addr --
+ *	Record a page address.
+ */
+static int
+__warmup_record_addr(
+    WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr_size)
+{
+	WT_ITEM *buf;
+	uint8_t *p;
+
+	buf = S2C(session)->warmup_rec;
+
+	WT_RET(__wt_buf_grow(
+	    session, buf, buf->size + WT_INTPACK64_MAXSIZE + addr_size));
+	p = (uint8_t *)buf->mem + buf->size;
+	WT_RET(__wt_vpack_uint(&p, 0, (uint64_t)addr_size));
+	memcpy(p, addr, addr_size);
+	buf->size = WT_PTRDIFF(p + addr_size, buf->mem);
+
+	WT_STAT_FAST_CONN_INCR(session, cache_warmup_recorded);
+	return (0);
+}
+
+/*
+ * __wt_warmup_record_start --
+ *	Start recording the pages of a file being closed, if configured.
+ */
+int
+__wt_warmup_record_start(WT_SESSION_IMPL *session, bool *recordp)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DATA_HANDLE *dhandle;
+	WT_ITEM *buf;
+	size_t len;
+	uint8_t *p;
+
+	conn = S2C(session);
+	dhandle = session->dhandle;
+	buf = conn->warmup_rec;
+
+	*recordp = false;
+
+	/*
+	 * Only record when the connection is closing, and only files the
+	 * application reads.
+	 */
+	if (buf == NULL || !F_ISSET(conn, WT_CONN_CLOSING) ||
+	    WT_IS_METADATA(dhandle) ||
+	    dhandle->checkpoint != NULL ||
+	    F_ISSET(dhandle, WT_DHANDLE_DEAD) ||
+	    F_ISSET(S2BT(session),
+	    WT_BTREE_BULK | WT_BTREE_SALVAGE | WT_BTREE_VERIFY) ||
+	    !WT_PREFIX_MATCH(dhandle->name, "file:") ||
+	    strcmp(dhandle->name, WT_LAS_URI) == 0)
+		return (0);
+
+	/* The file starts with the version. */
+	if (buf->size == 0) {
+		WT_RET(__wt_buf_grow(session, buf, WT_INTPACK64_MAXSIZE));
+		p = buf->mem;
+		WT_RET(__wt_vpack_uint(&p, 0, WT_WARMUP_VERSION));
+		buf->size = WT_PTRDIFF(p, buf->mem);
+	}
+
+	/* Remember where the file starts in case the close fails. */
+	conn->warmup_rec_off = buf->size;
+	len = strlen(dhandle->name) + 1;
+	WT_RET(__wt_buf_grow(session, buf, buf->size + len));
+	memcpy((uint8_t *)buf->mem + buf->size, dhandle->name, len);
+	buf->size += len;
+
+	*recordp = true;
+	return (0);
+}
+
+/*
+ * __wt_warmup_record_page --
+ *	Record the current addresses of a page in the cache.
+ */
+int
+__wt_warmup_record_page(WT_SESSION_IMPL *session, WT_REF *ref)
+{
+	WT_MULTI *multi;
+	WT_PAGE_MODIFY *mod;
+	size_t addr_size;
+	uint32_t i;
+	const uint8_t *addr;
+
+	/* The root page is always read when the file is opened. */
+	if (__wt_ref_is_root(ref))
+		return (0);
+
+	/*
+	 * If the page has been reconciled, its reconciliation results replace
+	 * it in its parent.
+	 */
+	mod = ref->page->modify;
+	if (mod == NULL || mod->rec_result == 0) {
+		WT_RET(__wt_ref_info(session, ref, &addr, &addr_size, NULL));
+		if (addr != NULL)
+			WT_RET(__warmup_record_addr(session, addr, addr_size));
+		return (0);
+	}
+	switch (mod->rec_result) {
+	case WT_PM_REC_EMPTY:
+		break;
+	case WT_PM_REC_MULTIBLOCK:
+		for (multi = mod->mod_multi,
+		    i = 0; i < mod->mod_multi_entries; ++multi, ++i)
+			if (multi->addr.addr != NULL)
+				WT_RET(__warmup_record_addr(session,
+				    multi->addr.addr, multi->addr.size));
+		break;
+	case WT_PM_REC_REPLACE:
+		WT_RET(__warmup_record_addr(session,
+		    mod->mod_replace.addr, mod->mod_replace.size));
+		break;
+	WT_ILLEGAL_VALUE(session);
+	}
+	return (0);
+}
+
+/*
+ * __wt_warmup_record_end --
+ *	Finish recording the pages of a file, discarding them if the file
+ * couldn't be closed.
+ */
+int
+__wt_warmup_record_end(WT_SESSION_IMPL *session, bool ok)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_ITEM *buf;
+	uint8_t *p;
+
+	conn = S2C(session);
+	buf = conn->warmup_rec;
+
+	if (!ok) {
+		buf->size = conn->warmup_rec_off;
+		return (0);
+	}
+
+	WT_RET(__wt_buf_grow(session, buf, buf->size + 1));
+	p = (uint8_t *)buf->mem + buf->size;
+	WT_RET(__wt_vpack_uint(&p, 0, 0));
+	buf->size = WT_PTRDIFF(p, buf->mem);
+	return (0);
+}
+
+/*
+ * __wt_warmup_save --
+ *	Write the pages recorded at close to the warm-up file, and discard the
+ * recording.
+ */
+int
+__wt_warmup_save(WT_SESSION_IMPL *session, bool save)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_FH *fh;
+	WT_ITEM *buf;
+
+	conn = S2C(session);
+	buf = conn->warmup_rec;
+	fh = NULL;
+
+	if (buf == NULL)
+		return (0);
+
+	if (save && buf->size != 0) {
+		WT_ERR(__wt_open(session, WT_WARMUP_FILE, true, false, 0, &fh));
+		WT_ERR(__wt_ftruncate(session, fh, 0));
+		WT_ERR(__wt_write(session, fh, 0, buf->size, buf->data));
+		WT_ERR(__wt_fsync(session, fh));
+	}
+
+err:	if (fh != NULL)
+		WT_TRET(__wt_close(session, &fh));
+	__wt_buf_free(session, buf);
+	__wt_free(session, conn->warmup_rec);
+	return (ret);
+}
@@ -0,0 +1,234 @@
+/*-
+ * Copyright (c) 2014-2015 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __write_req_run --
+ *	Compress, encrypt, checksum and write a queued page image.
+ */
+static int
+__write_req_run(WT_SESSION_IMPL *session, WT_WRITE_REQ *req)
+{
+	WT_DECL_RET;
+
+	WT_WITH_DHANDLE(session, req->dhandle,
+	    ret = __wt_bt_write(session, &req->buf, req->addr,
+	    &req->addr_size, false, req->checkpoint_io, req->compressed));
+	return (ret);
+}
+
+/*
+ * __write_server --
+ *	The write pool thread.
+ */
+static WT_THREAD_RET
+__write_server(void *arg)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	WT_WRITE_REQ *req;
+
+	session = arg;
+	conn = S2C(session);
+
+	while (F_ISSET(conn, WT_CONN_SERVER_WRITE)) {
+		__wt_spin_lock(session, &conn->write_lock);
+		if ((req = TAILQ_FIRST(&conn->writeqh)) != NULL) {
+			TAILQ_REMOVE(&conn->writeqh, req, q);
+			req->state = WT_WRITE_REQ_RUNNING;
+		}
+		__wt_spin_unlock(session, &conn->write_lock);
+
+		if (req == NULL) {
+			WT_ERR(__wt_cond_wait(
+			    session, conn->write_cond, 100000));
+			continue;
+		}
+
+		/*
+		 * The request's owner may reuse or free the request as soon as
+		 * it's marked done, don't touch it after that.
+		 */
+		req->write_ret = __write_req_run(session, req);
+		WT_STAT_FAST_CONN_INCR(session, rec_write_pool);
+		WT_PUBLISH(req->state, WT_WRITE_REQ_DONE);
+		WT_ERR(__wt_cond_signal(session, conn->write_done_cond));
+	}
+
+	if (0) {
+err:		WT_PANIC_MSG(session, ret, "write pool server error");
+	}
+	return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * __wt_write_pool_create --
+ *	Start the optional write pool threads.
+ */
+int
+__wt_write_pool_create(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_CONFIG_ITEM cval;
+	WT_CONNECTION_IMPL *conn;
+	uint32_t i;
+
+	conn = S2C(session);
+
+	WT_RET(__wt_config_gets(session, cfg, "write_pool.threads", &cval));
+	if (cval.val == 0 || F_ISSET(conn, WT_CONN_IN_MEMORY))
+		return (0);
+
+	WT_RET(__wt_cond_alloc(
+	    session, "write pool server", false, &conn->write_cond));
+	WT_RET(__wt_cond_alloc(
+	    session, "write pool complete", false, &conn->write_done_cond));
+	WT_RET(__wt_calloc_def(
+	    session, (size_t)cval.val, &conn->write_sessions));
+	WT_RET(__wt_calloc_def(session, (size_t)cval.val, &conn->write_tids));
+
+	/* Set first, the threads might run before we finish up. */
+	F_SET(conn, WT_CONN_SERVER_WRITE);
+
+	/*
+	 * Write pool threads do block manager writes, they may be called upon
+	 * to perform slow operations for the block manager.
+	 *
+	 * Don't tap the write pool threads for eviction.
+	 */
+	for (i = 0; i < (uint32_t)cval.val; ++i) {
+		WT_RET(__wt_open_internal_session(conn, "write-pool", true,
+		    WT_SESSION_CAN_WAIT | WT_SESSION_NO_EVICTION,
+		    &conn->write_sessions[i]));
+		WT_RET(__wt_thread_create(session,
+		    &conn->write_tids[i], __write_server,
+		    conn->write_sessions[i]));
+		conn->write_workers = i + 1;
+	}
+	return (0);
+}
+
+/*
+ * __wt_write_pool_destroy --
+ *	Destroy the write pool threads.
+ */
+int
+__wt_write_pool_destroy(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_SESSION *wt_session;
+	uint32_t i;
+
+	conn = S2C(session);
+
+	/*
+	 * Reconciliation joins its writes before returning, there's no queued
+	 * work by the time the pool is shut down.
+	 */
+	WT_ASSERT(session, TAILQ_EMPTY(&conn->writeqh));
+
+	F_CLR(conn, WT_CONN_SERVER_WRITE);
+	for (i = 0; i < conn->write_workers; ++i) {
+		WT_TRET(__wt_cond_signal(session, conn->write_cond));
+		WT_TRET(__wt_thread_join(session, conn->write_tids[i]));
+	}
+	for (i = 0; i < conn->write_workers; ++i) {
+		wt_session = &conn->write_sessions[i]->iface;
+		WT_TRET(wt_session->close(wt_session, NULL));
+	}
+	conn->write_workers = 0;
+
+	WT_TRET(__wt_cond_destroy(session, &conn->write_cond));
+	WT_TRET(__wt_cond_destroy(session, &conn->write_done_cond));
+	__wt_free(session, conn->write_sessions);
+	__wt_free(session, conn->write_tids);
+
+	return (ret);
+}
+
+/*
+ * __wt_write_pool_submit --
+ *	Queue a page image for the write pool, copying the image so the caller
+ * can immediately reuse its buffer.
+ */
+int
+__wt_write_pool_submit(WT_SESSION_IMPL *session,
+    WT_WRITE_REQ *req, const WT_ITEM *buf, bool compressed, uint32_t id)
+{
+	WT_BM *bm;
+	WT_CONNECTION_IMPL *conn;
+	size_t size;
+
+	bm = S2BT(session)->bm;
+	conn = S2C(session);
+
+	/*
+	 * The block manager zeroes the buffer to the next allocation unit and
+	 * may be configured for direct I/O: size and align the copy the way
+	 * reconciliation sizes its own buffers.
+	 */
+	size = buf->size;
+	WT_RET(bm->write_size(bm, session, &size));
+	F_SET(&req->buf, WT_ITEM_ALIGNED);
+	WT_RET(__wt_buf_init(session, &req->buf, size));
+	memcpy(req->buf.mem, buf->data, buf->size);
+	req->buf.size = buf->size;
+	req->dhandle = session->dhandle;
+	req->compressed = compressed;
+	/* Decide here, the pool's sessions don't hold the checkpoint lock. */
+	req->checkpoint_io = __wt_btree_checkpoint_io(session);
+	req->id = id;
+	req->addr_size = 0;
+	req->write_ret = 0;
+	req->state = WT_WRITE_REQ_QUEUED;
+
+	__wt_spin_lock(session, &conn->write_lock);
+	TAILQ_INSERT_TAIL(&conn->writeqh, req, q);
+	__wt_spin_unlock(session, &conn->write_lock);
+
+	return (__wt_cond_signal(session, conn->write_cond));
+}
+
+/*
+ * __wt_write_pool_wait --
+ *	Wait for a queued page image to be written, returning the result of
+ * the write.  If no thread has picked up the request yet, write it in the
+ * calling thread rather than waiting.
+ */
+int
+__wt_write_pool_wait(WT_SESSION_IMPL *session, WT_WRITE_REQ *req)
+{
+	WT_CONNECTION_IMPL *conn;
+	bool inline_write;
+
+	conn = S2C(session);
+
+	inline_write = false;
+	if (req->state == WT_WRITE_REQ_QUEUED) {
+		__wt_spin_lock(session, &conn->write_lock);
+		if (req->state == WT_WRITE_REQ_QUEUED) {
+			TAILQ_REMOVE(&conn->writeqh, req, q);
+			req->state = WT_WRITE_REQ_RUNNING;
+			inline_write = true;
+		}
+		__wt_spin_unlock(session, &conn->write_lock);
+	}
+	if (inline_write) {
+		WT_STAT_FAST_CONN_INCR(session, rec_write_pool_inline);
+		req->write_ret = __write_req_run(session, req);
+		req->state = WT_WRITE_REQ_DONE;
+	}
+
+	while (req->state != WT_WRITE_REQ_DONE)
+		WT_RET(__wt_cond_wait(session, conn->write_done_cond, 10000));
+	WT_READ_BARRIER();
+
+	return (req->write_ret);
+}
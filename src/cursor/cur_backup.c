@@ -11,6 +11,8 @@
 static int __backup_all(WT_SESSION_IMPL *, WT_CURSOR_BACKUP *);
 static int __backup_cleanup_handles(WT_SESSION_IMPL *, WT_CURSOR_BACKUP *);
 static int __backup_file_create(WT_SESSION_IMPL *, WT_CURSOR_BACKUP *, bool);
+static int __backup_incr_ranges(WT_SESSION_IMPL *, WT_CURSOR_BACKUP *);
+static int __backup_incr_value(WT_SESSION_IMPL *, WT_CURSOR_BACKUP *);
 static int __backup_list_all_append(WT_SESSION_IMPL *, const char *[]);
 static int __backup_list_append(
     WT_SESSION_IMPL *, WT_CURSOR_BACKUP *, const char *);
@@ -33,16 +35,29 @@ __curbackup_next(WT_CURSOR *cursor)
 	cb = (WT_CURSOR_BACKUP *)cursor;
 	CURSOR_API_CALL(cursor, session, next, NULL);
 
-	if (cb->list == NULL || cb->list[cb->next].name == NULL) {
-		F_CLR(cursor, WT_CURSTD_KEY_SET);
-		WT_ERR(WT_NOTFOUND);
-	}
+	/*
+	 * Incremental backups step through the changed ranges of each file,
+	 * move to the next file once its ranges are done.
+	 */
+	if (!cb->incremental || cb->incr_range_next >= cb->incr_range_count) {
+		if (cb->list == NULL || cb->list[cb->next].name == NULL) {
+			F_CLR(cursor, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
+			WT_ERR(WT_NOTFOUND);
+		}
 
-	cb->iface.key.data = cb->list[cb->next].name;
-	cb->iface.key.size = strlen(cb->list[cb->next].name) + 1;
-	++cb->next;
+		cb->iface.key.data = cb->list[cb->next].name;
+		cb->iface.key.size = strlen(cb->list[cb->next].name) + 1;
+		++cb->next;
+
+		if (cb->incremental)
+			WT_ERR(__backup_incr_ranges(session, cb));
+	}
 
 	F_SET(cursor, WT_CURSTD_KEY_INT);
+	if (cb->incremental) {
+		WT_ERR(__backup_incr_value(session, cb));
+		F_SET(cursor, WT_CURSTD_VALUE_INT);
+	}
 
 err:	API_END_RET(session, ret);
 }
@@ -62,6 +77,7 @@ __curbackup_reset(WT_CURSOR *cursor)
 	CURSOR_API_CALL(cursor, session, reset, NULL);
 
 	cb->next = 0;
+	cb->incr_range_count = cb->incr_range_next = 0;
 	F_CLR(cursor, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
 
 err:	API_END_RET(session, ret);
@@ -83,6 +99,8 @@ __curbackup_close(WT_CURSOR *cursor)
 	CURSOR_API_CALL(cursor, session, close, NULL);
 
 	WT_TRET(__backup_cleanup_handles(session, cb));
+	__wt_free(session, cb->incr_src);
+	__wt_buf_free(session, &cb->incr_ranges);
 	WT_TRET(__wt_cursor_close(cursor));
 	session->bkp_cursor = NULL;
 
@@ -110,6 +128,7 @@ __wt_curbackup_open(WT_SESSION_IMPL *session,
 	    __wt_cursor_notsup,		/* equals */
 	    __curbackup_next,		/* next */
 	    __wt_cursor_notsup,		/* prev */
+	    __wt_cursor_notsup,		/* next_batch */
 	    __curbackup_reset,		/* reset */
 	    __wt_cursor_notsup,		/* search */
 	    __wt_cursor_notsup,		/* search-near */
@@ -118,9 +137,13 @@ __wt_curbackup_open(WT_SESSION_IMPL *session,
 	    __wt_cursor_notsup,		/* remove */
 	    __wt_cursor_notsup,		/* reconfigure */
 	    __curbackup_close);		/* close */
+	WT_CONFIG_ITEM cval;
 	WT_CURSOR *cursor;
 	WT_CURSOR_BACKUP *cb;
+	WT_DECL_ITEM(tmp);
 	WT_DECL_RET;
+	const char *ckpt_cfg[] = {
+	    WT_CONFIG_BASE(session, WT_SESSION_checkpoint), NULL, NULL };
 
 	WT_STATIC_ASSERT(offsetof(WT_CURSOR_BACKUP, iface) == 0);
 
@@ -130,11 +153,50 @@ __wt_curbackup_open(WT_SESSION_IMPL *session,
 	cursor = &cb->iface;
 	*cursor = iface;
 	cursor->session = &session->iface;
-	session->bkp_cursor = cb;
 
 	cursor->key_format = "S";	/* Return the file names as the key. */
 	cursor->value_format = "";	/* No value. */
 
+	/*
+	 * Incremental backups return the changed ranges of each file since
+	 * the checkpoint named for a previous backup.  If this backup is named
+	 * for later ones, take its checkpoint: the files are copied from that
+	 * checkpoint, and it must exist before the backup cursor blocks
+	 * checkpoints from replacing an earlier one of the same name.
+	 */
+	WT_ERR(__wt_config_gets(session, cfg, "incremental.src_id", &cval));
+	if (cval.len != 0) {
+		cb->incremental = true;
+		WT_ERR(__wt_scr_alloc(session, 0, &tmp));
+		WT_ERR(__wt_buf_fmt(session, tmp, "%s.%.*s",
+		    WT_CHECKPOINT_BACKUP, (int)cval.len, cval.str));
+		WT_ERR(__wt_strndup(
+		    session, tmp->data, tmp->size, &cb->incr_src));
+	}
+	WT_ERR(__wt_config_gets(session, cfg, "incremental.this_id", &cval));
+	if (cval.len != 0) {
+		cb->incremental = true;
+		if (F_ISSET(&session->txn, WT_TXN_RUNNING))
+			WT_ERR_MSG(session, EINVAL,
+			    "an incremental backup identifier can't be set in "
+			    "a transaction");
+		if (tmp == NULL)
+			WT_ERR(__wt_scr_alloc(session, 0, &tmp));
+		WT_ERR(__wt_buf_fmt(session, tmp, "name=\"%s.%.*s\"",
+		    WT_CHECKPOINT_BACKUP, (int)cval.len, cval.str));
+		ckpt_cfg[1] = tmp->data;
+		WT_ERR(__wt_txn_checkpoint(session, ckpt_cfg));
+		__wt_scr_free(session, &tmp);
+		WT_ERR(__wt_session_release_resources(session));
+	}
+	if (cb->incremental) {
+		/* Return the offset, size and type of each range. */
+		cursor->value_format = "QQI";
+		cursor->get_value = __wt_cursor_get_value;
+	}
+
+	session->bkp_cursor = cb;
+
 	/*
 	 * Start the backup and fill in the cursor's list.  Acquire the schema
 	 * lock, we need a consistent view when creating a copy.
@@ -146,12 +208,87 @@ __wt_curbackup_open(WT_SESSION_IMPL *session,
 	WT_ERR(__wt_cursor_init(cursor, uri, NULL, cfg, cursorp));
 
 	if (0) {
-err:		__wt_free(session, cb);
+err:		if (cb != NULL) {
+			session->bkp_cursor = NULL;
+			__wt_free(session, cb->incr_src);
+			__wt_free(session, cb);
+		}
+	}
+
+	__wt_scr_free(session, &tmp);
+	return (ret);
+}
+
+/*
+ * __backup_incr_ranges --
+ *	Get the changed block ranges of the next file in an incremental backup.
+ */
+static int
+__backup_incr_ranges(WT_SESSION_IMPL *session, WT_CURSOR_BACKUP *cb)
+{
+	WT_BM *bm;
+	WT_CKPT *ckptbase;
+	WT_CURSOR_BACKUP_ENTRY *p;
+	WT_DECL_RET;
+	bool found;
+
+	p = &cb->list[cb->next - 1];
+
+	cb->incr_range_count = cb->incr_range_next = 0;
+	cb->incr_type = WT_BACKUP_FILE;
+
+	/*
+	 * Log files, the configuration and metadata files, and files without
+	 * the previous backup's checkpoint (including every file in a backup
+	 * that doesn't name a previous one), are copied whole.
+	 */
+	if (cb->incr_src == NULL || p->handle == NULL)
+		return (0);
+
+	WT_RET(__wt_meta_ckptlist_get(session, p->handle->name, &ckptbase));
+	bm = ((WT_BTREE *)p->handle->handle)->bm;
+	WT_ERR(bm->checkpoint_changes(
+	    bm, session, ckptbase, cb->incr_src, &cb->incr_ranges, &found));
+	if (found) {
+		cb->incr_type = WT_BACKUP_RANGE;
+		cb->incr_range_count =
+		    cb->incr_ranges.size / (2 * sizeof(uint64_t));
 	}
 
+err:	__wt_meta_ckptlist_free(session, ckptbase);
 	return (ret);
 }
 
+/*
+ * __backup_incr_value --
+ *	Set the value for the next range of an incremental backup: files that
+ * haven't changed return a single empty range.
+ */
+static int
+__backup_incr_value(WT_SESSION_IMPL *session, WT_CURSOR_BACKUP *cb)
+{
+	WT_CURSOR *cursor;
+	size_t size;
+	uint64_t len, off;
+	const uint64_t *p;
+
+	cursor = &cb->iface;
+
+	off = len = 0;
+	if (cb->incr_range_next < cb->incr_range_count) {
+		p = cb->incr_ranges.data;
+		off = p[2 * cb->incr_range_next];
+		len = p[2 * cb->incr_range_next + 1];
+	}
+	++cb->incr_range_next;
+
+	WT_RET(__wt_struct_size(session,
+	    &size, cursor->value_format, off, len, cb->incr_type));
+	WT_RET(__wt_buf_initsize(session, &cursor->value, size));
+	return (__wt_struct_pack(session, cursor->value.mem,
+	    size, cursor->value_format, off, len, cb->incr_type));
+}
+
 /*
  * __backup_log_append --
  *	Append log files needed for backup.
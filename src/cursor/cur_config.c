@@ -35,6 +35,7 @@ __wt_curconfig_open(WT_SESSION_IMPL *session,
 	    __wt_cursor_notsup,		/* equals */
 	    __wt_cursor_notsup,		/* next */
 	    __wt_cursor_notsup,		/* prev */
+	    __wt_cursor_notsup,		/* next_batch */
 	    __wt_cursor_noop,		/* reset */
 	    __wt_cursor_notsup,		/* search */
 	    __wt_cursor_notsup,		/* search-near */
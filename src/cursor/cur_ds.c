@@ -457,6 +457,7 @@ __wt_curds_open(
 	    __wt_cursor_equals,		/* equals */
 	    __curds_next,		/* next */
 	    __curds_prev,		/* prev */
+	    __wt_cursor_next_batch,	/* next_batch */
 	    __curds_reset,		/* reset */
 	    __curds_search,		/* search */
 	    __curds_search_near,	/* search-near */
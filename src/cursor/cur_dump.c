@@ -356,6 +356,7 @@ __wt_curdump_create(WT_CURSOR *child, WT_CURSOR *owner, WT_CURSOR **cursorp)
 	    __wt_cursor_notsup,		/* equals */
 	    __curdump_next,		/* next */
 	    __curdump_prev,		/* prev */
+	    __wt_cursor_notsup,		/* next_batch */
 	    __curdump_reset,		/* reset */
 	    __curdump_search,		/* search */
 	    __curdump_search_near,	/* search-near */
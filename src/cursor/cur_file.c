@@ -159,6 +159,101 @@ __curfile_prev(WT_CURSOR *cursor)
 err:	API_END_RET(session, ret);
 }
 
+/*
+ * __curfile_batch_next --
+ *	Move to the next record of a batch, returning its raw key and value.
+ * The caller has entered the API.
+ */
+static int
+__curfile_batch_next(WT_CURSOR *cursor, WT_ITEM *key, WT_ITEM *value)
+{
+	WT_CURSOR_BTREE *cbt;
+	uint8_t *p;
+
+	cbt = (WT_CURSOR_BTREE *)cursor;
+
+	F_CLR(cursor, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
+	WT_RET(__wt_btcur_next(cbt, false));
+	F_SET(cursor, WT_CURSTD_KEY_INT | WT_CURSTD_VALUE_INT);
+
+	/*
+	 * Take the key and value directly from the cursor rather than going
+	 * through the get-key and get-value methods.  Record numbers are
+	 * packed the same way a raw cursor returns them.
+	 */
+	if (cbt->btree->type == BTREE_ROW) {
+		key->data = cursor->key.data;
+		key->size = cursor->key.size;
+	} else {
+		p = cursor->raw_recno_buf;
+		WT_RET(__wt_vpack_uint(
+		    &p, sizeof(cursor->raw_recno_buf), cursor->recno));
+		key->data = cursor->raw_recno_buf;
+		key->size = WT_PTRDIFF(p, cursor->raw_recno_buf);
+	}
+	value->data = cursor->value.data;
+	value->size = cursor->value.size;
+	return (0);
+}
+
+/*
+ * __curfile_batch_prev --
+ *	Move to the previous record when repositioning after a batch, the
+ * caller has entered the API.
+ */
+static int
+__curfile_batch_prev(WT_CURSOR *cursor)
+{
+	WT_DECL_RET;
+
+	F_CLR(cursor, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
+	if ((ret = __wt_btcur_prev((WT_CURSOR_BTREE *)cursor, false)) == 0)
+		F_SET(cursor, WT_CURSTD_KEY_INT | WT_CURSTD_VALUE_INT);
+	return (ret);
+}
+
+/*
+ * __curfile_batch_search_near --
+ *	Search near the last record of a batch, the caller has entered the API.
+ */
+static int
+__curfile_batch_search_near(WT_CURSOR *cursor, int *exact)
+{
+	WT_DECL_RET;
+
+	WT_BTREE_CURSOR_SAVE_AND_RESTORE(cursor,
+	    __wt_btcur_search_near((WT_CURSOR_BTREE *)cursor, exact), ret);
+	return (ret);
+}
+
+/*
+ * __curfile_next_batch --
+ *	WT_CURSOR->next_batch method for the btree cursor type.
+ */
+static int
+__curfile_next_batch(WT_CURSOR *cursor,
+    WT_ITEM *buf, WT_ITEM *keys, WT_ITEM *values, uint32_t *countp)
+{
+	WT_CURSOR_BTREE *cbt;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	cbt = (WT_CURSOR_BTREE *)cursor;
+	CURSOR_API_CALL(cursor, session, next_batch, cbt->btree);
+	WT_STAT_FAST_CONN_INCR(session, cursor_next_batch);
+	WT_STAT_FAST_DATA_INCR(session, cursor_next_batch);
+
+	/*
+	 * Walk the tree directly for the whole batch, rather than entering
+	 * and leaving the API for each record.
+	 */
+	ret = __wt_cursor_batch(cursor,
+	    __curfile_batch_next, __curfile_batch_prev,
+	    __curfile_batch_search_near, buf, keys, values, countp);
+
+err:	API_END_RET(session, ret);
+}
+
 /*
  * __curfile_reset --
  *	WT_CURSOR->reset method for the btree cursor type.
@@ -405,6 +500,7 @@ __wt_curfile_create(WT_SESSION_IMPL *session,
 	    __curfile_equals,		/* equals */
 	    __curfile_next,		/* next */
 	    __curfile_prev,		/* prev */
+	    __curfile_next_batch,	/* next_batch */
 	    __curfile_reset,		/* reset */
 	    __curfile_search,		/* search */
 	    __curfile_search_near,	/* search-near */
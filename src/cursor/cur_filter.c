@@ -0,0 +1,399 @@
+/*-
+ * Copyright (c) 2014-2015 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __filter_find_column --
+ *	Find the column group and position of a named column.
+ */
+static int
+__filter_find_column(WT_SESSION_IMPL *session,
+    WT_CURSOR_TABLE *ctable, WT_CONFIG_ITEM *colname, WT_CURSOR_FILTER *f)
+{
+	WT_CONFIG conf;
+	WT_CONFIG_ITEM k, v;
+	WT_DECL_RET;
+	WT_TABLE *table;
+	u_int cg, col;
+
+	table = ctable->table;
+
+	/* Find the column in the table's list: key columns come first. */
+	WT_RET(__wt_config_subinit(session, &conf, &table->colconf));
+	for (col = 0; (ret = __wt_config_next(&conf, &k, &v)) == 0; col++)
+		if (k.len == colname->len &&
+		    strncmp(colname->str, k.str, k.len) == 0)
+			break;
+	if (ret == WT_NOTFOUND)
+		WT_RET_MSG(session, EINVAL,
+		    "filter column '%.*s' not found in table '%s'",
+		    (int)colname->len, colname->str, table->name);
+	WT_RET(ret);
+
+	if (col < table->nkey_columns) {
+		f->key = true;
+		f->cg = 0;
+		f->col = col;
+		return (0);
+	}
+	f->key = false;
+
+	/* A table without column groups stores all of the value columns. */
+	if (table->ncolgroups == 0) {
+		f->cg = 0;
+		f->col = col - table->nkey_columns;
+		return (0);
+	}
+
+	/*
+	 * Otherwise look through the column groups, choosing the first that
+	 * contains the column.
+	 */
+	for (cg = 0; cg < WT_COLGROUPS(table); cg++) {
+		WT_RET(__wt_config_subinit(
+		    session, &conf, &table->cgroups[cg]->colconf));
+		for (col = 0; (ret = __wt_config_next(&conf, &k, &v)) == 0;
+		    col++)
+			if (k.len == colname->len &&
+			    strncmp(colname->str, k.str, k.len) == 0) {
+				f->cg = cg;
+				f->col = col;
+				return (0);
+			}
+		WT_RET_NOTFOUND_OK(ret);
+	}
+	WT_RET_MSG(session, EINVAL,
+	    "filter column '%.*s' is not in a column group of table '%s'",
+	    (int)colname->len, colname->str, table->name);
+}
+
+/*
+ * __filter_column_type --
+ *	Return the pack type of a column in a format.
+ */
+static int
+__filter_column_type(
+    WT_SESSION_IMPL *session, const char *fmt, u_int col, char *typep)
+{
+	WT_DECL_PACK_VALUE(pv);
+	WT_PACK pack;
+	u_int i;
+
+	WT_RET(__pack_init(session, &pack, fmt));
+	for (i = 0; i <= col; i++)
+		WT_RET(__pack_next(&pack, &pv));
+	*typep = pv.type;
+	return (0);
+}
+
+/*
+ * __filter_add --
+ *	Add a comparison to a table cursor's filters.
+ */
+static int
+__filter_add(WT_SESSION_IMPL *session, WT_CURSOR_TABLE *ctable,
+    WT_CONFIG_ITEM *colname, WT_CONFIG_ITEM *opname, WT_CONFIG_ITEM *value)
+{
+	WT_CURSOR_FILTER *f, filter;
+	u_int i;
+	const char *fmt;
+
+	WT_CLEAR(filter);
+	f = &filter;
+
+	if (opname == NULL || WT_STRING_MATCH("eq", opname->str, opname->len))
+		f->op = WT_FILTER_EQ;
+	else if (WT_STRING_MATCH("ne", opname->str, opname->len))
+		f->op = WT_FILTER_NE;
+	else if (WT_STRING_MATCH("lt", opname->str, opname->len))
+		f->op = WT_FILTER_LT;
+	else if (WT_STRING_MATCH("le", opname->str, opname->len))
+		f->op = WT_FILTER_LE;
+	else if (WT_STRING_MATCH("gt", opname->str, opname->len))
+		f->op = WT_FILTER_GT;
+	else if (WT_STRING_MATCH("ge", opname->str, opname->len))
+		f->op = WT_FILTER_GE;
+	else if (WT_STRING_MATCH("prefix", opname->str, opname->len))
+		f->op = WT_FILTER_PREFIX;
+	else
+		WT_RET_MSG(session, EINVAL,
+		    "unknown filter comparison '%.*s' for column '%.*s'",
+		    (int)opname->len, opname->str,
+		    (int)colname->len, colname->str);
+
+	WT_RET(__filter_find_column(session, ctable, colname, f));
+	if (f->key)
+		fmt = ctable->cg_cursors[0]->key_format;
+	else
+		fmt = ctable->cg_cursors[f->cg]->value_format;
+	WT_RET(__filter_column_type(session, fmt, f->col, &f->type));
+
+	switch (f->type) {
+	case 'b':
+	case 'h':
+	case 'i':
+	case 'l':
+	case 'q':
+		if (f->op == WT_FILTER_PREFIX ||
+		    value->type != WT_CONFIG_ITEM_NUM)
+			goto badvalue;
+		f->i = value->val;
+		break;
+	case 'B':
+	case 'H':
+	case 'I':
+	case 'L':
+	case 'Q':
+	case 'r':
+	case 'R':
+	case 't':
+		if (f->op == WT_FILTER_PREFIX ||
+		    value->type != WT_CONFIG_ITEM_NUM || value->val < 0)
+			goto badvalue;
+		f->u = (uint64_t)value->val;
+		break;
+	case 'S':
+	case 's':
+	case 'u':
+	case 'U':
+		if (value->type == WT_CONFIG_ITEM_STRUCT)
+			goto badvalue;
+		WT_RET(__wt_buf_set(session, &f->item, value->str, value->len));
+		break;
+	default:
+badvalue:	__wt_buf_free(session, &f->item);
+		WT_RET_MSG(session, EINVAL,
+		    "filter on column '%.*s' does not match its type '%c'",
+		    (int)colname->len, colname->str, f->type);
+	}
+
+	/*
+	 * Keep the filters sorted so a single walk through each packed key or
+	 * value checks all of its columns: key columns first, then each column
+	 * group's value columns in order.
+	 */
+	if (__wt_realloc_def(session, &ctable->filters_allocated,
+	    ctable->nfilters + 1, &ctable->filters) != 0) {
+		__wt_buf_free(session, &f->item);
+		return (ENOMEM);
+	}
+	for (i = ctable->nfilters; i > 0; --i) {
+		f = &ctable->filters[i - 1];
+		if (f->key != filter.key ? f->key :
+		    (f->cg != filter.cg ? f->cg < filter.cg :
+		    f->col <= filter.col))
+			break;
+		ctable->filters[i] = *f;
+	}
+	ctable->filters[i] = filter;
+	++ctable->nfilters;
+	return (0);
+}
+
+/*
+ * __wt_curtable_filter_init --
+ *	Configure the filters for a table cursor.
+ */
+int
+__wt_curtable_filter_init(WT_CURSOR_TABLE *ctable, WT_CONFIG_ITEM *cval)
+{
+	WT_CONFIG colconf, opconf;
+	WT_CONFIG_ITEM k, opk, opv, v;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	session = (WT_SESSION_IMPL *)ctable->iface.session;
+
+	/*
+	 * Each entry is either "column=value", an equality comparison, or
+	 * "column=(op=value,...)".
+	 */
+	WT_RET(__wt_config_subinit(session, &colconf, cval));
+	while ((ret = __wt_config_next(&colconf, &k, &v)) == 0) {
+		if (v.type != WT_CONFIG_ITEM_STRUCT) {
+			WT_RET(__filter_add(session, ctable, &k, NULL, &v));
+			continue;
+		}
+		WT_RET(__wt_config_subinit(session, &opconf, &v));
+		while ((ret = __wt_config_next(&opconf, &opk, &opv)) == 0)
+			WT_RET(__filter_add(session, ctable, &k, &opk, &opv));
+		WT_RET_NOTFOUND_OK(ret);
+	}
+	WT_RET_NOTFOUND_OK(ret);
+	return (0);
+}
+
+/*
+ * __filter_compare --
+ *	Compare a column value with a filter.
+ */
+static bool
+__filter_compare(
+    WT_CURSOR_FILTER *f, WT_PACK_VALUE *pv, const void *data, size_t size)
+{
+	int cmp;
+
+	switch (f->type) {
+	case 'b':
+	case 'h':
+	case 'i':
+	case 'l':
+	case 'q':
+		cmp = pv->u.i < f->i ? -1 : (pv->u.i > f->i ? 1 : 0);
+		break;
+	case 'S':
+	case 's':
+	case 'u':
+	case 'U':
+		if (f->op == WT_FILTER_PREFIX)
+			return (size >= f->item.size &&
+			    memcmp(data, f->item.data, f->item.size) == 0);
+		cmp = memcmp(data, f->item.data, WT_MIN(size, f->item.size));
+		if (cmp == 0)
+			cmp = size < f->item.size ? -1 :
+			    (size > f->item.size ? 1 : 0);
+		break;
+	default:
+		cmp = pv->u.u < f->u ? -1 : (pv->u.u > f->u ? 1 : 0);
+		break;
+	}
+
+	switch (f->op) {
+	case WT_FILTER_EQ:
+		return (cmp == 0);
+	case WT_FILTER_NE:
+		return (cmp != 0);
+	case WT_FILTER_LT:
+		return (cmp < 0);
+	case WT_FILTER_LE:
+		return (cmp <= 0);
+	case WT_FILTER_GT:
+		return (cmp > 0);
+	case WT_FILTER_GE:
+	default:
+		return (cmp >= 0);
+	}
+}
+
+/*
+ * __filter_match_item --
+ *	Check the filters for one packed key or value, without unpacking any
+ * columns past the last one with a filter.  Returns the next filter to check
+ * in *fp.
+ */
+static int
+__filter_match_item(WT_SESSION_IMPL *session, WT_CURSOR_FILTER **fp,
+    WT_CURSOR_FILTER *end, const char *fmt, WT_ITEM *item, bool *matchp)
+{
+	WT_CURSOR_FILTER *f, *first;
+	WT_DECL_PACK_VALUE(pv);
+	WT_PACK pack;
+	size_t size;
+	u_int col;
+	const uint8_t *p, *pend, *start;
+	const void *data, *nul;
+
+	first = f = *fp;
+	p = item->data;
+	pend = p + item->size;
+
+	WT_RET(__pack_init(session, &pack, fmt));
+	for (col = 0;
+	    f < end && f->key == first->key && f->cg == first->cg; ++col) {
+		WT_RET(__pack_next(&pack, &pv));
+		start = p;
+		WT_RET(__unpack_read(session, &pv, &p, WT_PTRDIFF(pend, p)));
+		if (f->col != col)
+			continue;
+
+		/* Strings may be nul-terminated or padded: find their end. */
+		data = NULL;
+		size = 0;
+		switch (pv.type) {
+		case 'S':
+		case 's':
+			data = start;
+			size = WT_PTRDIFF(p, start);
+			if ((nul = memchr(start, '\0', size)) != NULL)
+				size = WT_PTRDIFF(nul, start);
+			break;
+		case 'u':
+		case 'U':
+			data = pv.u.item.data;
+			size = pv.u.item.size;
+			break;
+		}
+
+		for (; f < end && f->key == first->key &&
+		    f->cg == first->cg && f->col == col; ++f)
+			if (!__filter_compare(f, &pv, data, size)) {
+				*matchp = false;
+				return (0);
+			}
+	}
+	*fp = f;
+	return (0);
+}
+
+/*
+ * __wt_curtable_filter_match --
+ *	Check whether a table cursor's current record matches its filters.
+ */
+int
+__wt_curtable_filter_match(WT_CURSOR_TABLE *ctable, bool *matchp)
+{
+	WT_CURSOR *c, *primary;
+	WT_CURSOR_FILTER *end, *f;
+	WT_DECL_PACK_VALUE(pv);
+	WT_SESSION_IMPL *session;
+
+	session = (WT_SESSION_IMPL *)ctable->iface.session;
+	primary = ctable->cg_cursors[0];
+
+	*matchp = true;
+	f = ctable->filters;
+	end = f + ctable->nfilters;
+
+	/* Record number keys aren't packed. */
+	if (f < end && f->key) {
+		if (WT_CURSOR_RECNO(primary)) {
+			pv.u.u = primary->recno;
+			for (; f < end && f->key; ++f)
+				if (!__filter_compare(f, &pv, NULL, 0)) {
+					*matchp = false;
+					return (0);
+				}
+		} else
+			WT_RET(__filter_match_item(session, &f, end,
+			    primary->key_format, &primary->key, matchp));
+	}
+
+	while (*matchp && f < end) {
+		c = ctable->cg_cursors[f->cg];
+		WT_RET(__filter_match_item(
+		    session, &f, end, c->value_format, &c->value, matchp));
+	}
+	return (0);
+}
+
+/*
+ * __wt_curtable_filter_free --
+ *	Discard a table cursor's filters.
+ */
+void
+__wt_curtable_filter_free(WT_SESSION_IMPL *session, WT_CURSOR_TABLE *ctable)
+{
+	u_int i;
+
+	for (i = 0; i < ctable->nfilters; ++i)
+		__wt_buf_free(session, &ctable->filters[i].item);
+	__wt_free(session, ctable->filters);
+	ctable->nfilters = 0;
+	ctable->filters_allocated = 0;
+}
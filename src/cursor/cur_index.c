@@ -394,6 +394,7 @@ __wt_curindex_open(WT_SESSION_IMPL *session,
 	    __wt_cursor_equals,		/* equals */
 	    __curindex_next,		/* next */
 	    __curindex_prev,		/* prev */
+	    __wt_cursor_next_batch,	/* next_batch */
 	    __curindex_reset,		/* reset */
 	    __curindex_search,		/* search */
 	    __curindex_search_near,	/* search-near */
@@ -613,6 +613,7 @@ __curjoin_entry_member(WT_SESSION_IMPL *session, WT_CURSOR_JOIN *cjoin,
 	    __wt_cursor_notsup,		/* equals */
 	    __wt_cursor_notsup,		/* next */
 	    __wt_cursor_notsup,		/* prev */
+	    __wt_cursor_notsup,		/* next_batch */
 	    __wt_cursor_notsup,		/* reset */
 	    __wt_cursor_notsup,		/* search */
 	    __wt_cursor_notsup,		/* search-near */
@@ -821,6 +822,7 @@ __wt_curjoin_open(WT_SESSION_IMPL *session,
 	    __wt_cursor_notsup,		/* equals */
 	    __curjoin_next,		/* next */
 	    __wt_cursor_notsup,		/* prev */
+	    __wt_cursor_notsup,		/* next_batch */
 	    __curjoin_reset,		/* reset */
 	    __wt_cursor_notsup,		/* search */
 	    __wt_cursor_notsup,		/* search-near */
@@ -354,6 +354,7 @@ __wt_curlog_open(WT_SESSION_IMPL *session,
 	    __wt_cursor_equals,		/* equals */
 	    __curlog_next,		/* next */
 	    __wt_cursor_notsup,		/* prev */
+	    __wt_cursor_notsup,		/* next_batch */
 	    __curlog_reset,		/* reset */
 	    __curlog_search,		/* search */
 	    __wt_cursor_notsup,		/* search-near */
@@ -456,6 +456,7 @@ __wt_curmetadata_open(WT_SESSION_IMPL *session,
 	    __wt_cursor_equals,		/* equals */
 	    __curmetadata_next,		/* next */
 	    __curmetadata_prev,		/* prev */
+	    __wt_cursor_next_batch,	/* next_batch */
 	    __curmetadata_reset,	/* reset */
 	    __curmetadata_search,	/* search */
 	    __curmetadata_search_near,	/* search-near */
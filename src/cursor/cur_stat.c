@@ -582,6 +582,7 @@ __wt_curstat_open(WT_SESSION_IMPL *session,
 	    __wt_cursor_notsup,		/* equals */
 	    __curstat_next,		/* next */
 	    __curstat_prev,		/* prev */
+	    __wt_cursor_notsup,		/* next_batch */
 	    __curstat_reset,		/* reset */
 	    __curstat_search,		/* search */
 	    __wt_cursor_notsup,		/* search-near */
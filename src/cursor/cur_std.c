@@ -50,6 +50,8 @@ __wt_cursor_set_notsup(WT_CURSOR *cursor)
 	    (int (*)(WT_CURSOR *, WT_CURSOR *, int *))__wt_cursor_notsup;
 	cursor->next = __wt_cursor_notsup;
 	cursor->prev = __wt_cursor_notsup;
+	cursor->next_batch = (int (*)(WT_CURSOR *,
+	    WT_ITEM *, WT_ITEM *, WT_ITEM *, uint32_t *))__wt_cursor_notsup;
 	cursor->reset = __wt_cursor_noop;
 	cursor->search = __wt_cursor_notsup;
 	cursor->search_near = (int (*)(WT_CURSOR *, int *))__wt_cursor_notsup;
@@ -180,6 +182,136 @@ __wt_cursor_set_raw_value(WT_CURSOR *cursor, WT_ITEM *value)
 		F_CLR(cursor, WT_CURSTD_RAW);
 }
 
+/*
+ * __cursor_batch_next --
+ *	Move to the next record of a batch, returning its raw key and value.
+ */
+static int
+__cursor_batch_next(WT_CURSOR *cursor, WT_ITEM *key, WT_ITEM *value)
+{
+	WT_RET(cursor->next(cursor));
+	WT_RET(__wt_cursor_get_raw_key(cursor, key));
+	return (__wt_cursor_get_raw_value(cursor, value));
+}
+
+/*
+ * __cursor_batch_position --
+ *	Position a cursor so the next record returned follows the specified
+ * key, even if the key's record has since been removed.
+ */
+static int
+__cursor_batch_position(WT_CURSOR *cursor, int (*prevf)(WT_CURSOR *),
+    int (*search_nearf)(WT_CURSOR *, int *), WT_ITEM *key)
+{
+	WT_DECL_RET;
+	int exact;
+
+	__wt_cursor_set_raw_key(cursor, key);
+	if ((ret = search_nearf(cursor, &exact)) == 0 && exact > 0)
+		ret = prevf(cursor);
+
+	/*
+	 * Not-found leaves the cursor unpositioned, which is correct: there
+	 * are no records before the one the next call returns.
+	 */
+	return (ret == WT_NOTFOUND ? 0 : ret);
+}
+
+/*
+ * __wt_cursor_batch --
+ *	WT_CURSOR->next_batch worker function: copy records into the caller's
+ * buffer, moving the cursor with the supplied functions.
+ */
+int
+__wt_cursor_batch(WT_CURSOR *cursor,
+    int (*nextf)(WT_CURSOR *, WT_ITEM *, WT_ITEM *),
+    int (*prevf)(WT_CURSOR *), int (*search_nearf)(WT_CURSOR *, int *),
+    WT_ITEM *buf, WT_ITEM *keys, WT_ITEM *values, uint32_t *countp)
+{
+	WT_DECL_RET;
+	WT_ITEM key, value;
+	WT_SESSION_IMPL *session;
+	size_t len, used;
+	uint32_t i, max;
+	uint8_t *p;
+	bool full;
+
+	session = (WT_SESSION_IMPL *)cursor->session;
+
+	max = *countp;
+	*countp = 0;
+	if (buf == NULL || buf->mem == NULL || buf->memsize == 0 ||
+	    keys == NULL || values == NULL || max == 0)
+		WT_RET_MSG(session, EINVAL,
+		    "next_batch requires a buffer and arrays of keys and "
+		    "values");
+
+	buf->data = buf->mem;
+	buf->size = 0;
+	full = false;
+	len = used = 0;
+	for (i = 0; i < max; ++i) {
+		if ((ret = nextf(cursor, &key, &value)) != 0)
+			break;
+		len = key.size + value.size;
+		if (len > buf->memsize - used) {
+			full = true;
+			break;
+		}
+
+		p = (uint8_t *)buf->mem + used;
+		memcpy(p, key.data, key.size);
+		keys[i].data = p;
+		keys[i].size = key.size;
+		p += key.size;
+		memcpy(p, value.data, value.size);
+		values[i].data = p;
+		values[i].size = value.size;
+		used += len;
+	}
+	if (ret != 0 && (ret != WT_NOTFOUND || i == 0))
+		return (ret);
+
+	/*
+	 * If the first record doesn't fit, leave the cursor positioned on it
+	 * and tell the caller how much space it needs.
+	 */
+	if (full && i == 0) {
+		buf->size = len;
+		return (ENOMEM);
+	}
+
+	/*
+	 * We moved past the end of the batch: either onto a record that didn't
+	 * fit, or off the end of the data and lost our position.  Reposition
+	 * the cursor at the last record returned.
+	 */
+	if (full || ret == WT_NOTFOUND)
+		WT_RET(__cursor_batch_position(
+		    cursor, prevf, search_nearf, &keys[i - 1]));
+
+	*countp = i;
+	buf->size = used;
+	return (0);
+}
+
+/*
+ * __wt_cursor_next_batch --
+ *	WT_CURSOR->next_batch default implementation.
+ */
+int
+__wt_cursor_next_batch(WT_CURSOR *cursor,
+    WT_ITEM *buf, WT_ITEM *keys, WT_ITEM *values, uint32_t *countp)
+{
+	WT_SESSION_IMPL *session;
+
+	session = (WT_SESSION_IMPL *)cursor->session;
+	WT_STAT_FAST_CONN_INCR(session, cursor_next_batch);
+
+	return (__wt_cursor_batch(cursor, __cursor_batch_next,
+	    cursor->prev, cursor->search_near, buf, keys, values, countp));
+}
+
 /*
  * __wt_cursor_get_keyv --
  *	WT_CURSOR->get_key worker function.
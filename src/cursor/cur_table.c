@@ -87,6 +87,7 @@ __wt_apply_single_idx(WT_SESSION_IMPL *session, WT_INDEX *idx,
 	    __wt_cursor_notsup,		/* equals */
 	    __wt_cursor_notsup,		/* next */
 	    __wt_cursor_notsup,		/* prev */
+	    __wt_cursor_notsup,		/* next_batch */
 	    __wt_cursor_notsup,		/* reset */
 	    __wt_cursor_notsup,		/* search */
 	    __wt_cursor_notsup,		/* search-near */
@@ -220,6 +221,7 @@ __wt_curtable_set_key(WT_CURSOR *cursor, ...)
 
 	if (!F_ISSET(primary, WT_CURSTD_KEY_SET))
 		return;
+	ctable->cg_unread = false;
 
 	/* Copy the primary key to the other cursors. */
 	for (i = 1; i < WT_COLGROUPS(ctable->table); i++, cp++) {
@@ -332,6 +334,90 @@ __curtable_compare(WT_CURSOR *a, WT_CURSOR *b, int *cmpp)
 err:	API_END_RET(session, ret);
 }
 
+/*
+ * __curtable_move --
+ *	Move a table cursor with a projection or filters, reading only the
+ * column groups it needs.
+ */
+static int
+__curtable_move(WT_CURSOR_TABLE *ctable, bool next)
+{
+	WT_CURSOR **cp, *primary;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	u_int i;
+	bool match;
+
+	session = (WT_SESSION_IMPL *)ctable->iface.session;
+	primary = ctable->cg_cursors[0];
+
+	/*
+	 * Move the primary and any column groups with filters together until
+	 * a record matches: the filters compare packed values in place, so
+	 * records that don't match are never unpacked.
+	 */
+	for (;;) {
+		for (i = 0, cp = ctable->cg_cursors;
+		    i < WT_COLGROUPS(ctable->table); i++, cp++)
+			if (ctable->cg_access[i] == WT_CURTABLE_CG_MOVE)
+				WT_TRET(next ?
+				    (*cp)->next(*cp) : (*cp)->prev(*cp));
+		WT_RET(ret);
+		ctable->cg_unread = true;
+
+		if (ctable->nfilters == 0)
+			break;
+		WT_RET(__wt_curtable_filter_match(ctable, &match));
+		if (match)
+			break;
+		WT_STAT_FAST_CONN_INCR(session, cursor_filter_skip);
+	}
+
+	/* Read the rest of the projection for the record we're returning. */
+	for (i = 0, cp = ctable->cg_cursors;
+	    i < WT_COLGROUPS(ctable->table); i++, cp++)
+		if (ctable->cg_access[i] == WT_CURTABLE_CG_FETCH) {
+			(*cp)->key.data = primary->key.data;
+			(*cp)->key.size = primary->key.size;
+			(*cp)->recno = primary->recno;
+			F_SET(*cp, WT_CURSTD_KEY_EXT);
+			WT_RET((*cp)->search(*cp));
+		}
+	return (0);
+}
+
+/*
+ * __curtable_sync_colgroups --
+ *	Position column groups a scan didn't read on the primary's record, so
+ * an update through the cursor applies to the current record, and writes
+ * the current values of any columns outside the projection.
+ */
+static int
+__curtable_sync_colgroups(WT_CURSOR_TABLE *ctable)
+{
+	WT_CURSOR **cp, *primary;
+	u_int i;
+
+	if (!ctable->cg_unread)
+		return (0);
+
+	primary = ctable->cg_cursors[0];
+	if (!F_ISSET(primary, WT_CURSTD_KEY_SET))
+		return (0);
+
+	for (i = 1, cp = ctable->cg_cursors + 1;
+	    i < WT_COLGROUPS(ctable->table); i++, cp++)
+		if (ctable->cg_access[i] == 0) {
+			(*cp)->key.data = primary->key.data;
+			(*cp)->key.size = primary->key.size;
+			(*cp)->recno = primary->recno;
+			F_SET(*cp, WT_CURSTD_KEY_EXT);
+			WT_RET((*cp)->search(*cp));
+		}
+	ctable->cg_unread = false;
+	return (0);
+}
+
 /*
  * __curtable_next --
  *	WT_CURSOR->next method for the table cursor type.
@@ -345,7 +431,10 @@ __curtable_next(WT_CURSOR *cursor)
 
 	ctable = (WT_CURSOR_TABLE *)cursor;
 	JOINABLE_CURSOR_API_CALL(cursor, session, next, NULL);
-	APPLY_CG(ctable, next);
+	if (ctable->cg_access == NULL)
+		APPLY_CG(ctable, next);
+	else
+		ret = __curtable_move(ctable, true);
 
 err:	API_END_RET(session, ret);
 }
@@ -397,7 +486,10 @@ __curtable_prev(WT_CURSOR *cursor)
 
 	ctable = (WT_CURSOR_TABLE *)cursor;
 	JOINABLE_CURSOR_API_CALL(cursor, session, prev, NULL);
-	APPLY_CG(ctable, prev);
+	if (ctable->cg_access == NULL)
+		APPLY_CG(ctable, prev);
+	else
+		ret = __curtable_move(ctable, false);
 
 err:	API_END_RET(session, ret);
 }
@@ -416,6 +508,7 @@ __curtable_reset(WT_CURSOR *cursor)
 	ctable = (WT_CURSOR_TABLE *)cursor;
 	JOINABLE_CURSOR_API_CALL(cursor, session, reset, NULL);
 	APPLY_CG(ctable, reset);
+	ctable->cg_unread = false;
 
 err:	API_END_RET(session, ret);
 }
@@ -485,6 +578,7 @@ __curtable_insert(WT_CURSOR *cursor)
 	ctable = (WT_CURSOR_TABLE *)cursor;
 	JOINABLE_CURSOR_UPDATE_API_CALL(cursor, session, insert, NULL);
 	WT_ERR(__curtable_open_indices(ctable));
+	WT_ERR(__curtable_sync_colgroups(ctable));
 
 	/*
 	 * Split out the first insert, it may be allocating a recno.
@@ -552,6 +646,7 @@ __curtable_update(WT_CURSOR *cursor)
 	ctable = (WT_CURSOR_TABLE *)cursor;
 	JOINABLE_CURSOR_UPDATE_API_CALL(cursor, session, update, NULL);
 	WT_ERR(__curtable_open_indices(ctable));
+	WT_ERR(__curtable_sync_colgroups(ctable));
 
 	/*
 	 * If the table has indices, first delete any old index keys, then
@@ -603,6 +698,7 @@ __curtable_remove(WT_CURSOR *cursor)
 	ctable = (WT_CURSOR_TABLE *)cursor;
 	JOINABLE_CURSOR_REMOVE_API_CALL(cursor, session, NULL);
 	WT_ERR(__curtable_open_indices(ctable));
+	WT_ERR(__curtable_sync_colgroups(ctable));
 
 	/* Find the old record so it can be removed from indices */
 	if (ctable->table->nindices > 0) {
@@ -638,6 +734,12 @@ __wt_table_range_truncate(WT_CURSOR_TABLE *start, WT_CURSOR_TABLE *stop)
 	wt_start = &start->iface;
 	wt_stop = &stop->iface;
 
+	/* Stepping through the range must not skip records. */
+	if ((start != NULL && start->nfilters != 0) ||
+	    (stop != NULL && stop->nfilters != 0))
+		WT_RET_MSG(session, ENOTSUP,
+		    "truncate not supported on cursors with filters");
+
 	/* Open any indices. */
 	WT_RET(__curtable_open_indices(ctable));
 	WT_RET(__wt_scr_alloc(session, 128, &key));
@@ -657,6 +759,7 @@ __wt_table_range_truncate(WT_CURSOR_TABLE *start, WT_CURSOR_TABLE *stop)
 			WT_ERR(__wt_buf_set(session, key, raw.data, raw.size));
 
 			do {
+				WT_ERR(__curtable_sync_colgroups(stop));
 				APPLY_CG(stop, search);
 				WT_ERR(ret);
 				WT_ERR(__apply_idx(
@@ -672,6 +775,7 @@ __wt_table_range_truncate(WT_CURSOR_TABLE *start, WT_CURSOR_TABLE *stop)
 
 			cmp = -1;
 			do {
+				WT_ERR(__curtable_sync_colgroups(start));
 				APPLY_CG(start, search);
 				WT_ERR(ret);
 				WT_ERR(__apply_idx(
@@ -733,6 +837,8 @@ __curtable_close(WT_CURSOR *cursor)
 
 	if (ctable->plan != ctable->table->plan)
 		__wt_free(session, ctable->plan);
+	__wt_curtable_filter_free(session, ctable);
+	__wt_free(session, ctable->cg_access);
 	if (ctable->cfg != NULL) {
 		for (i = 0; ctable->cfg[i] != NULL; ++i)
 			__wt_free(session, ctable->cfg[i]);
@@ -798,6 +904,50 @@ __curtable_open_colgroups(WT_CURSOR_TABLE *ctable, const char *cfg_arg[])
 	return (0);
 }
 
+/*
+ * __curtable_access_init --
+ *	Work out which column groups a cursor with a projection or filters
+ * reads as it scans.
+ */
+static int
+__curtable_access_init(WT_CURSOR_TABLE *ctable)
+{
+	WT_SESSION_IMPL *session;
+	WT_TABLE *table;
+	u_long arg;
+	u_int i;
+	char *proj;
+
+	session = (WT_SESSION_IMPL *)ctable->iface.session;
+	table = ctable->table;
+
+	if (ctable->plan == table->plan && ctable->nfilters == 0)
+		return (0);
+
+	WT_RET(__wt_calloc_def(session,
+	    WT_COLGROUPS(table), &ctable->cg_access));
+
+	/* The primary holds the key. */
+	ctable->cg_access[0] = WT_CURTABLE_CG_MOVE;
+	for (i = 0; i < ctable->nfilters; i++)
+		if (!ctable->filters[i].key)
+			ctable->cg_access[ctable->filters[i].cg] =
+			    WT_CURTABLE_CG_MOVE;
+
+	/*
+	 * Without filters, every record is returned and the projection's
+	 * column groups might as well move in step with the primary.
+	 */
+	for (proj = (char *)ctable->plan; *proj != '\0'; proj++) {
+		arg = strtoul(proj, &proj, 10);
+		if ((*proj == WT_PROJ_KEY || *proj == WT_PROJ_VALUE) &&
+		    ctable->cg_access[arg] == 0)
+			ctable->cg_access[arg] = ctable->nfilters == 0 ?
+			    WT_CURTABLE_CG_MOVE : WT_CURTABLE_CG_FETCH;
+	}
+	return (0);
+}
+
 /*
  * __curtable_open_indices --
  *	Open cursors on indices for a table cursor.
@@ -847,6 +997,7 @@ __wt_curtable_open(WT_SESSION_IMPL *session,
 	    __wt_cursor_equals,		/* equals */
 	    __curtable_next,		/* next */
 	    __curtable_prev,		/* prev */
+	    __wt_cursor_next_batch,	/* next_batch */
 	    __curtable_reset,		/* reset */
 	    __curtable_search,		/* search */
 	    __curtable_search_near,	/* search-near */
@@ -880,9 +1031,19 @@ __wt_curtable_open(WT_SESSION_IMPL *session,
 	WT_RET(__wt_schema_get_table(session, tablename, size, false, &table));
 
 	if (table->is_simple) {
-		/* Just return a cursor on the underlying data source. */
-		ret = __wt_open_cursor(session,
-		    table->cgroups[0]->source, NULL, cfg, cursorp);
+		/*
+		 * Just return a cursor on the underlying data source.  Filters
+		 * name columns, so they need more than that.
+		 */
+		if ((ret = __wt_config_gets_def(
+		    session, cfg, "filter", 0, &cval)) == 0 && cval.len != 0) {
+			__wt_errx(session,
+			    "filters require a table with named columns");
+			ret = EINVAL;
+		}
+		if (ret == 0)
+			ret = __wt_open_cursor(session,
+			    table->cgroups[0]->source, NULL, cfg, cursorp);
 
 		__wt_schema_release_table(session, table);
 		return (ret);
@@ -943,6 +1104,12 @@ __wt_curtable_open(WT_SESSION_IMPL *session,
 	 */
 	WT_ERR(__curtable_open_colgroups(ctable, cfg));
 
+	/* Filters are checked against the column group formats. */
+	WT_ERR(__wt_config_gets_def(session, cfg, "filter", 0, &cval));
+	if (cval.len != 0)
+		WT_ERR(__wt_curtable_filter_init(ctable, &cval));
+	WT_ERR(__curtable_access_init(ctable));
+
 	/*
 	 * We'll need to squirrel away a copy of the cursor configuration for
 	 * if/when we open indices.
@@ -18,19 +18,22 @@ __wt_evict_file(WT_SESSION_IMPL *session, WT_CACHE_OP syncop)
 	WT_DECL_RET;
 	WT_PAGE *page;
 	WT_REF *next_ref, *ref;
-	bool evict_reset;
+	bool evict_reset, record;
 
 	/*
 	 * We need exclusive access to the file -- disable ordinary eviction
 	 * and drain any blocks already queued.
 	 */
 	WT_RET(__wt_evict_file_exclusive_on(session, &evict_reset));
+	next_ref = NULL;
 
 	/* Make sure the oldest transaction ID is up-to-date. */
 	__wt_txn_update_oldest(session, true);
 
+	/* Record the file's pages for cache warm-up, if configured. */
+	WT_ERR(__wt_warmup_record_start(session, &record));
+
 	/* Walk the tree, discarding pages. */
-	next_ref = NULL;
 	WT_ERR(__wt_tree_walk(session, &next_ref, NULL,
 	    WT_READ_CACHE | WT_READ_NO_EVICT));
 	while ((ref = next_ref) != NULL) {
@@ -58,6 +61,8 @@ __wt_evict_file(WT_SESSION_IMPL *session, WT_CACHE_OP syncop)
 		 */
 		if (syncop == WT_SYNC_CLOSE && __wt_page_is_modified(page))
 			WT_ERR(__wt_reconcile(session, ref, NULL, WT_EVICTING));
+		if (record)
+			WT_ERR(__wt_warmup_record_page(session, ref));
 
 		/*
 		 * We can't evict the page just returned to us (it marks our
@@ -98,6 +103,9 @@ err:		/* On error, clear any left-over tree walk. */
 			    session, next_ref, WT_READ_NO_EVICT));
 	}
 
+	if (record)
+		WT_TRET(__wt_warmup_record_end(session, ret == 0));
+
 	if (evict_reset)
 		__wt_evict_file_exclusive_off(session);
 
@@ -1170,6 +1170,14 @@ __evict_init_candidate(
 	evict->ref = ref;
 	evict->btree = S2BT(session);
 
+	/*
+	 * With frequency-aware eviction, halve the page's access frequency
+	 * each time it's considered for eviction: pages have to keep being
+	 * used to keep their place in the cache.
+	 */
+	if (F_ISSET(cache, WT_CACHE_EVICT_FREQUENCY))
+		ref->page->evict_freq >>= 1;
+
 	/* Mark the page on the list */
 	F_SET_ATOMIC(ref->page, WT_PAGE_EVICT_LRU);
 }
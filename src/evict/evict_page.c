@@ -69,6 +69,7 @@ __wt_evict(WT_SESSION_IMPL *session, WT_REF *ref, bool closing)
 
 	WT_RET(__wt_verbose(session, WT_VERB_EVICT,
 	    "page %p (%s)", page, __wt_page_type_string(page->type)));
+	WT_TRACE(session, WT_TRACE_EVICT_START, page->memory_footprint);
 
 	/*
 	 * Get exclusive access to the page and review it for conditions that
@@ -144,6 +145,7 @@ done:	if (((inmem_split && ret == 0) || (forced_eviction && ret == EBUSY)) &&
 		WT_TRET(__wt_evict_server_wake(session));
 	}
 
+	WT_TRACE(session, WT_TRACE_EVICT_STOP, ret);
 	return (ret);
 }
 /*
@@ -208,6 +210,8 @@ __wt_evict_page_clean_update(
     WT_SESSION_IMPL *session, WT_REF *ref, bool closing)
 {
 	WT_DECL_RET;
+	size_t addr_size;
+	const uint8_t *addr;
 
 	/*
 	 * If doing normal system eviction, but only in the service of reducing
@@ -216,6 +220,15 @@ __wt_evict_page_clean_update(
 	if (!closing && __wt_eviction_dirty_target(session))
 		return (EBUSY);
 
+	/*
+	 * A shared cache watches for evicted pages being read back, only look
+	 * up the page's address if there's a shared cache.
+	 */
+	if (!closing && S2C(session)->cache->cp_ghost != NULL) {
+		WT_RET(__wt_ref_info(session, ref, &addr, &addr_size, NULL));
+		__wt_cache_pool_ghost_insert(session, addr, addr_size);
+	}
+
 	/*
 	 * Discard the page and update the reference structure; if the page has
 	 * an address, it's a disk page; if it has no address, it's a deleted
@@ -312,6 +325,10 @@ __evict_page_dirty_update(WT_SESSION_IMPL *session, WT_REF *ref, bool closing)
 		mod->mod_replace.addr = NULL;
 		mod->mod_replace.size = 0;
 
+		if (!closing)
+			__wt_cache_pool_ghost_insert(
+			    session, addr->addr, addr->size);
+
 		__wt_ref_out(session, ref);
 		ref->addr = addr;
 		WT_PUBLISH(ref->state, WT_REF_DISK);
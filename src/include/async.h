@@ -9,6 +9,8 @@
 #define	MAX_ASYNC_SLEEP_USECS	100000	/* Maximum sleep waiting for work */
 #define	MAX_ASYNC_YIELD		200	/* Maximum number of yields for work */
 
+#define	WT_ASYNC_BATCH_MAX	32	/* Maximum ops dequeued at once */
+
 #define	O2C(op)	((WT_CONNECTION_IMPL *)(op)->iface.connection)
 #define	O2S(op)								\
     (((WT_CONNECTION_IMPL *)(op)->iface.connection)->default_session)
@@ -44,9 +46,25 @@ struct __wt_async_op_impl {
 #define	WT_ASYNCOP_FREE		1	/* Able to be allocated to user */
 #define	WT_ASYNCOP_READY	2	/* Allocated, ready for user to use */
 #define	WT_ASYNCOP_WORKING	3	/* Operation in progress by worker */
+#define	WT_ASYNCOP_COMPLETE	4	/* On the completion queue */
 	uint32_t	state;
 
 	WT_ASYNC_OPTYPE	optype;		/* Operation type */
+
+	TAILQ_ENTRY(__wt_async_op_impl) q;	/* Completion queue */
+	int		op_ret;		/* Result for the completion queue */
+
+#define	WT_ASYNCOP_QUEUE_COMPLETION	0x01	/* Use the completion queue */
+	uint32_t	flags;
+};
+
+/*
+ * WT_ASYNC_QSLOT --
+ *	A work queue slot.
+ */
+struct __wt_async_qslot {
+	uint64_t	  seq;		/* Slot sequence number */
+	WT_ASYNC_OP_IMPL *op;		/* Enqueued op */
 };
 
 /*
@@ -61,24 +79,38 @@ struct __wt_async {
 #define	OPS_INVALID_INDEX	0xffffffff
 	uint32_t		 ops_index;	/* Active slot index */
 	uint64_t		 op_id;		/* Unique ID counter */
-	WT_ASYNC_OP_IMPL	 **async_queue;	/* Async ops work queue */
+	WT_ASYNC_QSLOT		 *async_queue;	/* Async ops work queue */
 	uint32_t		 async_qsize;	/* Async work queue size */
 	/*
-	 * We need to have two head and tail values.  All but one is
-	 * maintained as an ever increasing value to ease wrap around.
+	 * The work queue is a bounded, lock-free multi-producer/multi-consumer
+	 * ring buffer.  Head and tail are ever increasing positions: producers
+	 * claim the slot at the head and consumers claim one or more slots at
+	 * the tail, using compare-and-swap.  Each slot's sequence number says
+	 * whether it's empty or full for the current lap around the ring:
 	 *
-	 * alloc_head: the next one to allocate for producers.
-	 * head: the current head visible to consumers.
-	 * head is always <= alloc_head.
-	 * alloc_tail: the next slot for consumers to dequeue.
-	 * alloc_tail is always <= head.
-	 * tail_slot: the last slot consumed.
-	 * A producer may need wait for tail_slot to advance.
+	 * seq == position: the slot is empty, a producer can fill it.
+	 * seq == position + 1: the slot is full, a consumer can take it.
+	 * seq == position + qsize: the slot was emptied, and is ready for the
+	 * producer filling it on the next lap.
+	 */
+	uint64_t		 head;		/* Next slot to enqueue */
+	uint64_t		 tail;		/* Next slot to dequeue */
+
+	/* Workers without work block on a condition variable. */
+	WT_CONDVAR		*worker_cond;
+	uint32_t		 worker_waiters;/* Workers waiting for work */
+
+	/*
+	 * Operations configured to use the completion queue are posted to it
+	 * by the workers, and the application drains it.  The notification
+	 * descriptors are opened when the application first asks for them,
+	 * and are readable while the completion queue isn't empty.
 	 */
-	uint64_t		 alloc_head;	/* Next slot to enqueue */
-	uint64_t		 head;		/* Head visible to worker */
-	uint64_t		 alloc_tail;	/* Next slot to dequeue */
-	uint64_t		 tail_slot;	/* Worker slot consumed */
+	WT_SPINLOCK		 complete_lock;	/* Locked: completion queue */
+	TAILQ_HEAD(__wt_async_complete_qh, __wt_async_op_impl) completeqh;
+	uint32_t		 complete_count;/* Completion queue length */
+	int			 complete_rfd;	/* Notification descriptors */
+	int			 complete_wfd;
 
 	TAILQ_HEAD(__wt_async_format_qh, __wt_async_format) formatqh;
 	uint32_t		 cur_queue;	/* Currently enqueued */
@@ -96,7 +128,7 @@ struct __wt_async {
 	uint32_t		 flush_count;	/* Worker count */
 	uint64_t		 flush_gen;	/* Flush generation number */
 
-#define	WT_ASYNC_MAX_WORKERS	20
+#define	WT_ASYNC_MAX_WORKERS	128
 	WT_SESSION_IMPL		*worker_sessions[WT_ASYNC_MAX_WORKERS];
 					/* Async worker threads */
 	wt_thread_t		 worker_tids[WT_ASYNC_MAX_WORKERS];
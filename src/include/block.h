@@ -149,6 +149,18 @@ struct __wt_block_ckpt {
 	WT_EXTLIST ckpt_discard;		/* Checkpoint archive */
 };
 
+/*
+ * WT_BLOCK_SLVG_SCAN --
+ *	A salvage scan of a region of the file; salvage reads the regions of a
+ * file in parallel, then merges the blocks found in each one.
+ */
+struct __wt_block_slvg_scan {
+	wt_off_t start;				/* Region start */
+	wt_off_t stop;				/* Region end */
+	wt_off_t offset;			/* Next offset to read */
+	wt_off_t readahead;			/* Read-ahead scheduled to */
+};
+
 /*
  * WT_BM --
  *	Block manager handle, references a single checkpoint in a file.
@@ -162,6 +174,8 @@ struct __wt_bm {
 	u_int (*block_header)(WT_BM *);
 	int (*checkpoint)
 	    (WT_BM *, WT_SESSION_IMPL *, WT_ITEM *, WT_CKPT *, bool);
+	int (*checkpoint_changes)(WT_BM *,
+	    WT_SESSION_IMPL *, WT_CKPT *, const char *, WT_ITEM *, bool *);
 	int (*checkpoint_load)(WT_BM *, WT_SESSION_IMPL *,
 	    const uint8_t *, size_t, uint8_t *, size_t *, bool);
 	int (*checkpoint_resolve)(WT_BM *, WT_SESSION_IMPL *);
@@ -170,15 +184,24 @@ struct __wt_bm {
 	int (*compact_end)(WT_BM *, WT_SESSION_IMPL *);
 	int (*compact_page_skip)
 	    (WT_BM *, WT_SESSION_IMPL *, const uint8_t *, size_t, bool *);
-	int (*compact_skip)(WT_BM *, WT_SESSION_IMPL *, bool *);
+	int (*compact_skip)(WT_BM *, WT_SESSION_IMPL *, bool *, wt_off_t *);
 	int (*compact_start)(WT_BM *, WT_SESSION_IMPL *);
+	int (*first_fit)(WT_BM *, WT_SESSION_IMPL *, bool);
 	int (*free)(WT_BM *, WT_SESSION_IMPL *, const uint8_t *, size_t);
 	int (*preload)(WT_BM *, WT_SESSION_IMPL *, const uint8_t *, size_t);
 	int (*read)
 	    (WT_BM *, WT_SESSION_IMPL *, WT_ITEM *, const uint8_t *, size_t);
 	int (*salvage_end)(WT_BM *, WT_SESSION_IMPL *);
+	int (*salvage_merge)(WT_BM *, WT_SESSION_IMPL *,
+	    WT_BLOCK_SLVG_SCAN *, uint8_t *, size_t, bool *);
 	int (*salvage_next)
 	    (WT_BM *, WT_SESSION_IMPL *, uint8_t *, size_t *, bool *);
+	int (*salvage_region)(WT_BM *,
+	    WT_SESSION_IMPL *, u_int, u_int, WT_BLOCK_SLVG_SCAN *);
+	int (*salvage_region_next)(WT_BM *, WT_SESSION_IMPL *,
+	    WT_BLOCK_SLVG_SCAN *, uint8_t *, size_t *, bool *);
+	int (*salvage_region_valid)(WT_BM *, WT_SESSION_IMPL *,
+	    WT_BLOCK_SLVG_SCAN *, uint8_t *, size_t, bool);
 	int (*salvage_start)(WT_BM *, WT_SESSION_IMPL *);
 	int (*salvage_valid)
 	    (WT_BM *, WT_SESSION_IMPL *, uint8_t *, size_t, bool);
@@ -189,7 +212,7 @@ struct __wt_bm {
 	int (*verify_start)
 	    (WT_BM *, WT_SESSION_IMPL *, WT_CKPT *, const char *[]);
 	int (*write) (WT_BM *,
-	    WT_SESSION_IMPL *, WT_ITEM *, uint8_t *, size_t *, bool);
+	    WT_SESSION_IMPL *, WT_ITEM *, uint8_t *, size_t *, bool, bool);
 	int (*write_size)(WT_BM *, WT_SESSION_IMPL *, size_t *);
 
 	WT_BLOCK *block;			/* Underlying file */
@@ -348,3 +371,80 @@ struct __wt_block_header {
  */
 #define	WT_BLOCK_COMPRESS_SKIP	64
 #define	WT_BLOCK_ENCRYPT_SKIP	WT_BLOCK_HEADER_BYTE_SIZE
+
+/*
+ * WT_BCACHE_HDR --
+ *	The header of a block image in the block cache file.  The block cache
+ * file is local to the machine, so the header is in native byte order.
+ */
+struct __wt_bcache_hdr {
+#define	WT_BCACHE_MAGIC		0x62636831
+	uint32_t magic;			/* 00-03: Magic number */
+	uint32_t cksum;			/* 04-07: Image checksum */
+	uint64_t name_hash;		/* 08-15: Hash of the file name */
+	uint64_t offset;		/* 16-23: Block offset */
+	uint32_t size;			/* 24-27: Block size */
+	uint32_t block_cksum;		/* 28-31: Block checksum */
+};
+#define	WT_BCACHE_HDR_SIZE		32
+
+/*
+ * WT_BCACHE_ENTRY --
+ *	A block image in the block cache file.
+ */
+struct __wt_bcache_entry {
+	TAILQ_ENTRY(__wt_bcache_entry) hashq;	/* Hash bucket list */
+	TAILQ_ENTRY(__wt_bcache_entry) q;	/* Cache file order */
+
+	uint64_t name_hash;		/* Hash of the file name */
+	wt_off_t offset;		/* Block offset */
+	uint32_t size;			/* Block size */
+	uint32_t cksum;			/* Block checksum */
+
+	wt_off_t coff;			/* Cache file offset */
+	bool	 ready;			/* Image written */
+};
+
+/*
+ * WT_BCACHE_INDEX --
+ *	The block cache index file: this header followed by an array of entries,
+ * oldest first.
+ */
+struct __wt_bcache_index {
+#define	WT_BCACHE_INDEX_MAGIC	0x62636931
+	uint32_t magic;			/* Magic number */
+#define	WT_BCACHE_INDEX_VERSION	1
+	uint32_t version;		/* Version */
+	uint64_t entries;		/* Entry count */
+	uint64_t size;			/* Cache file size */
+	uint64_t woff;			/* Next write offset */
+};
+struct __wt_bcache_index_entry {
+	uint64_t name_hash;		/* Hash of the file name */
+	uint64_t offset;		/* Block offset */
+	uint32_t size;			/* Block size */
+	uint32_t cksum;			/* Block checksum */
+	uint64_t coff;			/* Cache file offset */
+};
+
+/*
+ * WT_BCACHE --
+ *	The block cache: a bounded file on fast local storage holding copies of
+ * blocks recently read from or written to data files, checked before reading
+ * from the data file.
+ */
+struct __wt_bcache {
+	WT_SPINLOCK lock;		/* Index lock */
+
+	WT_FH	*fh;			/* Cache file */
+	char	*index_name;		/* Index file name */
+
+	wt_off_t size;			/* Cache file maximum size */
+	wt_off_t woff;			/* Next write offset */
+
+	uint32_t buckets;		/* Hash buckets */
+	TAILQ_HEAD(__wt_bcache_hash, __wt_bcache_entry) *hash;
+					/* Entries, oldest first */
+	TAILQ_HEAD(__wt_bcache_qh, __wt_bcache_entry) qh;
+	uint64_t entries;		/* Entry count */
+};
@@ -282,6 +282,17 @@ struct __wt_page_modify {
 #define	mod_multi_entries	u1.m.multi_entries
 	} u1;
 
+	/*
+	 * Row-store leaf pages can be written as deltas: a small block holding
+	 * the page's changed records and a reference to the page's previous
+	 * block.  While the page's current block is a delta, the addresses of
+	 * the blocks it depends on (most recent first, ending with the full
+	 * base image) are tracked here, those blocks are discarded when the
+	 * page is next written as a full image.
+	 */
+	WT_ADDR	*delta_chain;
+	uint32_t delta_chain_entries;
+
 	/*
 	 * Internal pages need to be able to chain root-page splits and have a
 	 * special transactional eviction requirement.  Column-store leaf pages
@@ -367,6 +378,8 @@ struct __wt_page_modify {
 #define	WT_PM_REC_MULTIBLOCK	2	/* Reconciliation: multiple blocks */
 #define	WT_PM_REC_REPLACE	3	/* Reconciliation: single block */
 	uint8_t rec_result;		/* Reconciliation state */
+
+	uint8_t delta_consolidate;	/* Next write must be a full image */
 };
 
 /*
@@ -537,6 +550,7 @@ struct __wt_page {
 #define	WT_PAGE_OVFL		5	/* Overflow page */
 #define	WT_PAGE_ROW_INT		6	/* Row-store internal page */
 #define	WT_PAGE_ROW_LEAF	7	/* Row-store leaf page */
+#define	WT_PAGE_ROW_LEAF_DELTA	8	/* Row-store leaf page delta */
 	uint8_t type;			/* Page type */
 
 #define	WT_PAGE_BUILD_KEYS	0x01	/* Keys have been built in memory */
@@ -549,7 +563,15 @@ struct __wt_page {
 #define	WT_PAGE_UPDATE_IGNORE	0x80	/* Ignore updates on page discard */
 	uint8_t flags_atomic;		/* Atomic flags, use F_*_ATOMIC */
 
-	uint8_t unused[2];		/* Unused padding */
+	/*
+	 * With frequency-aware eviction, the number of read generations in
+	 * which the page was used again after it was read, aged each time
+	 * eviction considers the page.
+	 */
+#define	WT_PAGE_FREQ_MAX	15
+	uint8_t evict_freq;		/* Page access frequency */
+
+	uint8_t unused[1];		/* Unused padding */
 
 	/*
 	 * Used to protect and co-ordinate splits for internal pages and
@@ -104,6 +104,8 @@ struct __wt_btree {
 	 */
 	u_int dictionary;		/* Dictionary slots */
 	bool  internal_key_truncate;	/* Internal key truncate */
+#define	WT_BTREE_DELTA_MAX	16
+	u_int leaf_delta_max;		/* Leaf page delta chain maximum */
 	int   maximum_depth;		/* Maximum tree depth */
 	bool  prefix_compression;	/* Prefix compression */
 	u_int prefix_compression_min;	/* Prefix compression min */
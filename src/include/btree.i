@@ -37,6 +37,21 @@ __wt_page_is_modified(WT_PAGE *page)
 	return (page->modify != NULL && page->modify->write_gen != 0);
 }
 
+/*
+ * __wt_btree_checkpoint_io --
+ *	Return if the current tree's writes are part of a checkpoint: pages
+ * written by a checkpoint aren't likely to be read again soon.  That includes
+ * the leaf pages written before the tree's checkpoint starts, and pages
+ * written by operations holding the checkpoint lock (for example, closing the
+ * file for verify).
+ */
+static inline bool
+__wt_btree_checkpoint_io(WT_SESSION_IMPL *session)
+{
+	return (S2BT(session)->checkpointing != WT_CKPT_OFF ||
+	    F_ISSET(session, WT_SESSION_LOCKED_CHECKPOINT));
+}
+
 /*
  * __wt_btree_block_free --
  *	Helper function to free a block from the current tree.
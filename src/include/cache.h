@@ -38,6 +38,18 @@ struct __wt_evict_worker {
 	uint32_t flags;
 };
 
+/*
+ * WT_CACHE_GHOST --
+ *	A page recently evicted from the cache: if the page is read back while
+ * its entry remains, the bytes evicted in between tell us how much larger
+ * the cache would have to have been to keep it.
+ */
+#define	WT_CACHE_GHOST_SLOTS	16384	/* Evicted pages tracked */
+struct __wt_cache_ghost {
+	uint64_t hash;			/* Hash of the page's address */
+	uint64_t evict_bytes;		/* Cache's bytes evicted at eviction */
+};
+
 /* Cache operations. */
 typedef enum __wt_cache_op {
 	WT_SYNC_CHECKPOINT,
@@ -108,9 +120,15 @@ struct __wt_cache {
 		*evict_file_next;	/* LRU next file to search */
 	uint32_t evict_max_refs_per_file;/* LRU pages per file per pass */
 
+	WT_CCACHE *ccache;		/* Compressed cache */
+
 	/*
 	 * Cache pool information.
 	 */
+	uint64_t cp_chunk;		/* Cache pool chunk size */
+	WT_CACHE_GHOST *cp_ghost;	/* Recently evicted pages */
+	uint64_t cp_ghost_hits;		/* Reads within a chunk of eviction */
+	uint64_t cp_hit_gain;		/* Estimated hits from another chunk */
 	uint64_t cp_pass_pressure;	/* Calculated pressure from this pass */
 	uint64_t cp_quota;		/* Maximum size for this cache */
 	uint64_t cp_reserved;		/* Base size for this cache */
@@ -120,6 +138,7 @@ struct __wt_cache {
 	/* State seen at the last pass of the shared cache manager */
 	uint64_t cp_saved_app_evicts;	/* User eviction count at last review */
 	uint64_t cp_saved_app_waits;	/* User wait count at last review */
+	uint64_t cp_saved_ghost_hits;	/* Ghost hit count at last review */
 	uint64_t cp_saved_read;		/* Read count at last review */
 
 	/*
@@ -140,6 +159,7 @@ struct __wt_cache {
 #define	WT_CACHE_STUCK		0x08	/* Eviction server is stuck */
 #define	WT_CACHE_WALK_REVERSE	0x10	/* Scan backwards for candidates */
 #define	WT_CACHE_WOULD_BLOCK	0x20	/* Pages that would block apps */
+#define	WT_CACHE_EVICT_FREQUENCY 0x40	/* Frequency-aware eviction */
 	uint32_t flags;
 };
 
@@ -164,3 +184,60 @@ struct __wt_cache_pool {
 #define	WT_CACHE_POOL_ACTIVE	0x01	/* Cache pool is active */
 	uint8_t flags;
 };
+
+/*
+ * WT_CCACHE_ENTRY --
+ *	A block image in the compressed cache, followed in memory by its address
+ * cookie and then the image itself.
+ */
+struct __wt_ccache_entry {
+	TAILQ_ENTRY(__wt_ccache_entry) hashq;	/* Hash bucket list */
+	TAILQ_ENTRY(__wt_ccache_entry) q;	/* LRU list */
+
+	uint64_t hash;			/* Hash of the file ID and address */
+	uint32_t id;			/* File ID */
+	uint32_t addr_size;		/* Address cookie length */
+	size_t	 size;			/* Image length */
+};
+#define	WT_CCACHE_ADDR(e)						\
+	((uint8_t *)(e) + sizeof(WT_CCACHE_ENTRY))
+#define	WT_CCACHE_IMAGE(e)						\
+	(WT_CCACHE_ADDR(e) + (e)->addr_size)
+
+/*
+ * WT_CCACHE_PART --
+ *	A partition of the compressed cache, with its own lock.
+ */
+struct __wt_ccache_part {
+	WT_SPINLOCK lock;		/* Partition lock */
+
+					/* Hash buckets */
+	TAILQ_HEAD(__wt_ccache_hash, __wt_ccache_entry) *hash;
+					/* LRU list, most recent first */
+	TAILQ_HEAD(__wt_ccache_qh, __wt_ccache_entry) qh;
+
+	uint64_t bytes;			/* Bytes held in the partition */
+};
+
+/*
+ * WT_CCACHE --
+ *	The compressed cache: a bounded, in-memory copy of compressed blocks
+ * recently read from data files, checked before reading from the file.
+ */
+#define	WT_CCACHE_PARTS		16	/* Lock partitions */
+struct __wt_ccache {
+	uint64_t bytes_max;		/* Maximum bytes per partition */
+	uint32_t buckets;		/* Hash buckets per partition */
+
+	WT_CCACHE_PART part[WT_CCACHE_PARTS];
+};
+
+/*
+ * WT_WARMUP --
+ *	The pages of a file recorded at close, sorted for searching while cache
+ * warm-up reads them back in.
+ */
+struct __wt_warmup {
+	WT_ITEM	*addr;			/* Page addresses */
+	u_int	 entries;		/* Address count */
+};
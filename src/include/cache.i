@@ -58,6 +58,36 @@ __wt_cache_read_gen_new(WT_SESSION_IMPL *session)
 	return (__wt_cache_read_gen(session) + cache->read_gen_oldest) / 2;
 }
 
+/*
+ * __wt_cache_read_gen_access --
+ *      Get the read generation for a page being accessed.
+ */
+static inline uint64_t
+__wt_cache_read_gen_access(WT_SESSION_IMPL *session, WT_PAGE *page)
+{
+	if (!F_ISSET(S2C(session)->cache, WT_CACHE_EVICT_FREQUENCY))
+		return (__wt_cache_read_gen_bump(session));
+
+	/*
+	 * With frequency-aware eviction, a page's first access puts it in the
+	 * middle of the LRU list rather than bumping it, so a scan reading each
+	 * page once doesn't push out pages being used repeatedly. Each later
+	 * access counts toward the page's frequency, and the more frequently a
+	 * page is used, the further into the future its read generation goes.
+	 *
+	 * Until eviction has run for a while, the middle of the list can be
+	 * one of the special read generations: don't return a value that
+	 * leaves the page unset or marks it for immediate eviction.
+	 */
+	if (page->read_gen == WT_READGEN_NOTSET)
+		return (WT_MAX(
+		    __wt_cache_read_gen_new(session), WT_READGEN_OLDEST + 1));
+	if (page->evict_freq < WT_PAGE_FREQ_MAX)
+		++page->evict_freq;
+	return (__wt_cache_read_gen(session) +
+	    WT_READGEN_STEP * (1 + (uint64_t)page->evict_freq));
+}
+
 /*
  * __wt_cache_pages_inuse --
  *	Return the number of pages in use.
@@ -204,7 +234,9 @@ __wt_cache_full(WT_SESSION_IMPL *session)
 static inline int
 __wt_cache_eviction_check(WT_SESSION_IMPL *session, bool busy, bool *didworkp)
 {
+	struct timespec start;
 	WT_BTREE *btree;
+	WT_DECL_RET;
 	u_int pct_full;
 
 	if (didworkp != NULL)
@@ -242,5 +274,10 @@ __wt_cache_eviction_check(WT_SESSION_IMPL *session, bool busy, bool *didworkp)
 	if (didworkp != NULL)
 		*didworkp = true;
 
-	return (__wt_cache_eviction_worker(session, busy, pct_full));
+	WT_STAT_LATENCY_START(session, start);
+	WT_TRACE(session, WT_TRACE_EVICT_STALL_START, pct_full);
+	ret = __wt_cache_eviction_worker(session, busy, pct_full);
+	WT_TRACE(session, WT_TRACE_EVICT_STALL_STOP, ret);
+	WT_STAT_LATENCY_CONN(session, latency_evict_stall, start);
+	return (ret);
 }
@@ -10,4 +10,6 @@ struct __wt_compact {
 	uint32_t	lsm_count;	/* Number of LSM trees seen */
 	uint32_t	file_count;	/* Number of files seen */
 	uint64_t	max_time;	/* Configured timeout */
+	uint64_t	max_bytes;	/* Pass size limit, 0 for no limit */
+	uint64_t	bytes;		/* Bytes rewritten by the pass */
 };
@@ -54,43 +54,44 @@ struct __wt_config_parser_impl {
 #define	WT_CONFIG_ENTRY_WT_CONNECTION_add_data_source	 2
 #define	WT_CONFIG_ENTRY_WT_CONNECTION_add_encryptor	 3
 #define	WT_CONFIG_ENTRY_WT_CONNECTION_add_extractor	 4
-#define	WT_CONFIG_ENTRY_WT_CONNECTION_async_new_op	 5
-#define	WT_CONFIG_ENTRY_WT_CONNECTION_close		 6
-#define	WT_CONFIG_ENTRY_WT_CONNECTION_load_extension	 7
-#define	WT_CONFIG_ENTRY_WT_CONNECTION_open_session	 8
-#define	WT_CONFIG_ENTRY_WT_CONNECTION_reconfigure	 9
-#define	WT_CONFIG_ENTRY_WT_CURSOR_close			10
-#define	WT_CONFIG_ENTRY_WT_CURSOR_reconfigure		11
-#define	WT_CONFIG_ENTRY_WT_SESSION_begin_transaction	12
-#define	WT_CONFIG_ENTRY_WT_SESSION_checkpoint		13
-#define	WT_CONFIG_ENTRY_WT_SESSION_close		14
-#define	WT_CONFIG_ENTRY_WT_SESSION_commit_transaction	15
-#define	WT_CONFIG_ENTRY_WT_SESSION_compact		16
-#define	WT_CONFIG_ENTRY_WT_SESSION_create		17
-#define	WT_CONFIG_ENTRY_WT_SESSION_drop			18
-#define	WT_CONFIG_ENTRY_WT_SESSION_join			19
-#define	WT_CONFIG_ENTRY_WT_SESSION_log_flush		20
-#define	WT_CONFIG_ENTRY_WT_SESSION_log_printf		21
-#define	WT_CONFIG_ENTRY_WT_SESSION_open_cursor		22
-#define	WT_CONFIG_ENTRY_WT_SESSION_reconfigure		23
-#define	WT_CONFIG_ENTRY_WT_SESSION_rename		24
-#define	WT_CONFIG_ENTRY_WT_SESSION_reset		25
-#define	WT_CONFIG_ENTRY_WT_SESSION_rollback_transaction	26
-#define	WT_CONFIG_ENTRY_WT_SESSION_salvage		27
-#define	WT_CONFIG_ENTRY_WT_SESSION_snapshot		28
-#define	WT_CONFIG_ENTRY_WT_SESSION_strerror		29
-#define	WT_CONFIG_ENTRY_WT_SESSION_transaction_sync	30
-#define	WT_CONFIG_ENTRY_WT_SESSION_truncate		31
-#define	WT_CONFIG_ENTRY_WT_SESSION_upgrade		32
-#define	WT_CONFIG_ENTRY_WT_SESSION_verify		33
-#define	WT_CONFIG_ENTRY_colgroup_meta			34
-#define	WT_CONFIG_ENTRY_file_meta			35
-#define	WT_CONFIG_ENTRY_index_meta			36
-#define	WT_CONFIG_ENTRY_table_meta			37
-#define	WT_CONFIG_ENTRY_wiredtiger_open			38
-#define	WT_CONFIG_ENTRY_wiredtiger_open_all		39
-#define	WT_CONFIG_ENTRY_wiredtiger_open_basecfg		40
-#define	WT_CONFIG_ENTRY_wiredtiger_open_usercfg		41
+#define	WT_CONFIG_ENTRY_WT_CONNECTION_async_drain	 5
+#define	WT_CONFIG_ENTRY_WT_CONNECTION_async_new_op	 6
+#define	WT_CONFIG_ENTRY_WT_CONNECTION_close		 7
+#define	WT_CONFIG_ENTRY_WT_CONNECTION_load_extension	 8
+#define	WT_CONFIG_ENTRY_WT_CONNECTION_open_session	 9
+#define	WT_CONFIG_ENTRY_WT_CONNECTION_reconfigure	10
+#define	WT_CONFIG_ENTRY_WT_CURSOR_close			11
+#define	WT_CONFIG_ENTRY_WT_CURSOR_reconfigure		12
+#define	WT_CONFIG_ENTRY_WT_SESSION_begin_transaction	13
+#define	WT_CONFIG_ENTRY_WT_SESSION_checkpoint		14
+#define	WT_CONFIG_ENTRY_WT_SESSION_close		15
+#define	WT_CONFIG_ENTRY_WT_SESSION_commit_transaction	16
+#define	WT_CONFIG_ENTRY_WT_SESSION_compact		17
+#define	WT_CONFIG_ENTRY_WT_SESSION_create		18
+#define	WT_CONFIG_ENTRY_WT_SESSION_drop			19
+#define	WT_CONFIG_ENTRY_WT_SESSION_join			20
+#define	WT_CONFIG_ENTRY_WT_SESSION_log_flush		21
+#define	WT_CONFIG_ENTRY_WT_SESSION_log_printf		22
+#define	WT_CONFIG_ENTRY_WT_SESSION_open_cursor		23
+#define	WT_CONFIG_ENTRY_WT_SESSION_reconfigure		24
+#define	WT_CONFIG_ENTRY_WT_SESSION_rename		25
+#define	WT_CONFIG_ENTRY_WT_SESSION_reset		26
+#define	WT_CONFIG_ENTRY_WT_SESSION_rollback_transaction	27
+#define	WT_CONFIG_ENTRY_WT_SESSION_salvage		28
+#define	WT_CONFIG_ENTRY_WT_SESSION_snapshot		29
+#define	WT_CONFIG_ENTRY_WT_SESSION_strerror		30
+#define	WT_CONFIG_ENTRY_WT_SESSION_transaction_sync	31
+#define	WT_CONFIG_ENTRY_WT_SESSION_truncate		32
+#define	WT_CONFIG_ENTRY_WT_SESSION_upgrade		33
+#define	WT_CONFIG_ENTRY_WT_SESSION_verify		34
+#define	WT_CONFIG_ENTRY_colgroup_meta			35
+#define	WT_CONFIG_ENTRY_file_meta			36
+#define	WT_CONFIG_ENTRY_index_meta			37
+#define	WT_CONFIG_ENTRY_table_meta			38
+#define	WT_CONFIG_ENTRY_wiredtiger_open			39
+#define	WT_CONFIG_ENTRY_wiredtiger_open_all		40
+#define	WT_CONFIG_ENTRY_wiredtiger_open_basecfg		41
+#define	WT_CONFIG_ENTRY_wiredtiger_open_usercfg		42
 /*
  * configuration section: END
  * DO NOT EDIT: automatically built by dist/flags.py.
@@ -99,6 +99,30 @@ struct __wt_named_extractor {
 	TAILQ_ENTRY(__wt_named_extractor) q;	/* Linked list of extractors */
 };
 
+/*
+ * WT_WRITE_REQ --
+ *	A page image queued for the write pool.
+ */
+struct __wt_write_req {
+	WT_DATA_HANDLE *dhandle;	/* Enclosing data handle */
+	WT_ITEM buf;			/* Page image */
+	bool compressed;		/* Image already compressed */
+	bool checkpoint_io;		/* Write is part of a checkpoint */
+	uint32_t id;			/* Owner's identifier */
+
+					/* Returned block address */
+	uint8_t addr[WT_BTREE_MAX_ADDR_COOKIE];
+	size_t addr_size;
+	int write_ret;			/* Write return */
+
+#define	WT_WRITE_REQ_QUEUED	0	/* Waiting for a worker */
+#define	WT_WRITE_REQ_RUNNING	1	/* Being written */
+#define	WT_WRITE_REQ_DONE	2	/* Write complete */
+	volatile uint32_t state;
+
+	TAILQ_ENTRY(__wt_write_req) q;	/* Write pool queue */
+};
+
 /*
  * Allocate some additional slots for internal sessions so the user cannot
  * configure too few sessions for us to run.
@@ -271,6 +295,7 @@ struct __wt_connection_impl {
 	uint32_t   hazard_max;		/* Hazard array size */
 
 	WT_CACHE  *cache;		/* Page cache */
+	WT_BCACHE *bcache;		/* Block cache */
 	volatile uint64_t cache_size;	/* Cache size (either statically
 					   configured or the current size
 					   within a cache pool). */
@@ -295,6 +320,20 @@ struct __wt_connection_impl {
 	uint64_t  ckpt_time_recent;	/* Checkpoint time recent/total */
 	uint64_t  ckpt_time_total;
 
+	WT_SESSION_IMPL *compact_session;/* Compaction thread session */
+	wt_thread_t	 compact_tid;	/* Compaction thread */
+	bool		 compact_tid_set;/* Compaction thread set */
+	WT_CONDVAR	*compact_cond;	/* Compaction wait mutex */
+	uint64_t	 compact_rate;	/* Compaction bytes per second */
+	uint64_t	 compact_usecs;	/* Compaction timer */
+
+	WT_SESSION_IMPL *warmup_session;/* Warm-up thread session */
+	wt_thread_t	 warmup_tid;	/* Warm-up thread */
+	bool		 warmup_tid_set;/* Warm-up thread set */
+	u_int		 warmup_target;	/* Warm-up cache fill percentage */
+	WT_ITEM		*warmup_rec;	/* Pages recorded at close */
+	size_t		 warmup_rec_off;/* Recorded file's start */
+
 #define	WT_CONN_STAT_ALL	0x01	/* "all" statistics configured */
 #define	WT_CONN_STAT_CLEAR	0x02	/* clear after gathering */
 #define	WT_CONN_STAT_FAST	0x04	/* "fast" statistics configured */
@@ -311,6 +350,7 @@ struct __wt_connection_impl {
 	int		 async_cfg;	/* Global async configuration */
 	uint32_t	 async_size;	/* Async op array size */
 	uint32_t	 async_workers;	/* Number of async workers */
+	uint32_t	 async_ops_per_txn;/* Async ops per transaction */
 
 	WT_LSM_MANAGER	lsm_manager;	/* LSM worker thread information */
 
@@ -326,6 +366,22 @@ struct __wt_connection_impl {
 	uint32_t	 evict_workers;	/* Number of eviction workers */
 	WT_EVICT_WORKER	*evict_workctx;	/* Eviction worker context */
 
+					/* Locked: write pool queue */
+	WT_SPINLOCK	 write_lock;	/* Write pool queue lock */
+	TAILQ_HEAD(__wt_write_qh, __wt_write_req) writeqh;
+	WT_CONDVAR	*write_cond;	/* Write pool work condition */
+	WT_CONDVAR	*write_done_cond;/* Write pool completion condition */
+	uint32_t	 write_workers;	/* Number of write pool threads */
+	WT_SESSION_IMPL **write_sessions;/* Write pool sessions */
+	wt_thread_t	*write_tids;	/* Write pool threads */
+
+	uint32_t	 prefetch_workers;/* Number of prefetch threads */
+	WT_SESSION_IMPL **prefetch_sessions;/* Prefetch sessions */
+	wt_thread_t	*prefetch_tids;	/* Prefetch threads */
+	char		**prefetch_uris;/* Files to prefetch */
+	uint32_t	 prefetch_entries;/* Files to prefetch count */
+	uint32_t	 prefetch_next;	/* Next file to prefetch */
+
 	WT_SESSION_IMPL *stat_session;	/* Statistics log session */
 	wt_thread_t	 stat_tid;	/* Statistics log thread */
 	bool		 stat_tid_set;	/* Statistics log thread set */
@@ -337,6 +393,18 @@ struct __wt_connection_impl {
 	const char	*stat_stamp;	/* Statistics log entry timestamp */
 	uint64_t	 stat_usecs;	/* Statistics log period */
 
+	WT_SPINLOCK	 trace_lock;	/* Trace dump lock */
+	uint32_t	 trace_entries;	/* Trace events per session */
+	char		*trace_path;	/* Trace dump file path */
+	uint64_t	 trace_slow;	/* Trace dump slow operation usecs */
+	uint64_t	 trace_dump_last;/* Last slow operation dump, seconds */
+	uint32_t	 trace_dump_count;/* Trace dump file sequence */
+	uint64_t	 trace_dump_usecs;/* Pending slow operation dump */
+	WT_SESSION_IMPL *trace_session;	/* Trace dump thread session */
+	wt_thread_t	 trace_tid;	/* Trace dump thread */
+	bool		 trace_tid_set;	/* Trace dump thread set */
+	WT_CONDVAR	*trace_cond;	/* Trace dump wait mutex */
+
 #define	WT_CONN_LOG_ARCHIVE		0x01	/* Archive is enabled */
 #define	WT_CONN_LOG_ENABLED		0x02	/* Logging is enabled */
 #define	WT_CONN_LOG_EXISTED		0x04	/* Log files found */
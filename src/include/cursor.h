@@ -18,6 +18,7 @@
 	equals,								\
 	next,								\
 	prev,								\
+	next_batch,							\
 	reset,								\
 	search,								\
 	search_near,							\
@@ -39,6 +40,8 @@
 	(int (*)(WT_CURSOR *, WT_CURSOR *, int *))(equals),		\
 	next,								\
 	prev,								\
+	(int (*)(WT_CURSOR *,						\
+	    WT_ITEM *, WT_ITEM *, WT_ITEM *, uint32_t *))(next_batch),	\
 	reset,								\
 	search,								\
 	(int (*)(WT_CURSOR *, int *))(search_near),			\
@@ -73,6 +76,17 @@ struct __wt_cursor_backup {
 	WT_CURSOR_BACKUP_ENTRY *list;	/* List of files to be copied. */
 	size_t list_allocated;
 	size_t list_next;
+
+	/*
+	 * Incremental backups return the block ranges of each file changed
+	 * since a previous backup's checkpoint, one range per cursor position.
+	 */
+	bool incremental;		/* Incremental backup */
+	char *incr_src;			/* Source backup checkpoint */
+	WT_ITEM incr_ranges;		/* Changed ranges: offset/size pairs */
+	size_t incr_range_count;	/* Ranges for the current file */
+	size_t incr_range_next;		/* Next range to return */
+	uint32_t incr_type;		/* WT_BACKUP_FILE or WT_BACKUP_RANGE */
 };
 #define	WT_CURSOR_BACKUP_ID(cursor)	(((WT_CURSOR_BACKUP *)cursor)->maxid)
 
@@ -99,6 +113,20 @@ struct __wt_cursor_btree {
 					/* Next item(s) found during search */
 	WT_INSERT	*next_stack[WT_SKIP_MAXDEPTH];
 
+	/*
+	 * Skiplists only link forward, so moving a cursor backward through an
+	 * insert list means searching for the current entry's predecessor.
+	 * Instead of searching at each step, reverse iteration materializes a
+	 * run of consecutive insert list entries ending at the current entry,
+	 * and then steps back through the run, confirming each step with the
+	 * previous entry's forward link (which catches concurrent inserts).
+	 * The prev_run_slot field is the run's slot for the current entry, 0
+	 * if the run is empty or exhausted.
+	 */
+	WT_INSERT **prev_run;		/* Run of insert list entries */
+	size_t	   prev_run_allocated;
+	uint32_t   prev_run_slot;	/* Slot of the current entry */
+
 	uint32_t page_deleted_count;	/* Deleted items on the page */
 
 	uint64_t recno;			/* Record number */
@@ -410,6 +438,30 @@ struct __wt_cursor_stat {
 #define	WT_CURSOR_STATS(cursor)						\
 	(((WT_CURSOR_STAT *)cursor)->stats)
 
+/*
+ * WT_CURSOR_FILTER --
+ *	A comparison against one column, checked as a table cursor scans.
+ */
+struct __wt_cursor_filter {
+	bool	 key;			/* Key column */
+	u_int	 cg;			/* Column group of a value column */
+	u_int	 col;			/* Column in the packed key or value */
+	char	 type;			/* Column pack type */
+
+#define	WT_FILTER_EQ		1
+#define	WT_FILTER_NE		2
+#define	WT_FILTER_LT		3
+#define	WT_FILTER_LE		4
+#define	WT_FILTER_GT		5
+#define	WT_FILTER_GE		6
+#define	WT_FILTER_PREFIX	7
+	int	 op;
+
+	int64_t	 i;			/* Signed integer constant */
+	uint64_t u;			/* Unsigned integer constant */
+	WT_ITEM	 item;			/* String or raw constant */
+};
+
 struct __wt_cursor_table {
 	WT_CURSOR iface;
 
@@ -424,6 +476,23 @@ struct __wt_cursor_table {
 					 * overlapping set_value calls.
 					 */
 	WT_CURSOR **idx_cursors;
+
+	WT_CURSOR_FILTER *filters;	/* Sorted scan filters */
+	size_t filters_allocated;
+	u_int nfilters;
+
+	/*
+	 * Cursors with a projection or filters only read the column groups
+	 * they reference as they scan: the primary and any column groups
+	 * with filters move in step, column groups in the projection are
+	 * searched for records that are returned, and the rest aren't read.
+	 * If a scan left column groups unread, they're positioned on the
+	 * primary's record before an update.
+	 */
+#define	WT_CURTABLE_CG_MOVE	1	/* Moved with the primary */
+#define	WT_CURTABLE_CG_FETCH	2	/* Searched for returned records */
+	uint8_t *cg_access;		/* Column group access, or NULL */
+	bool cg_unread;			/* Column groups unread by the scan */
 };
 
 #define	WT_CURSOR_PRIMARY(cursor)					\
@@ -37,6 +37,7 @@ __cursor_pos_clear(WT_CURSOR_BTREE *cbt)
 	cbt->ins = NULL;
 	cbt->ins_head = NULL;
 	cbt->ins_stack[0] = NULL;
+	cbt->prev_run_slot = 0;
 
 	cbt->cip_saved = NULL;
 	cbt->rip_saved = NULL;
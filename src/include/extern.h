@@ -5,6 +5,8 @@ extern int __wt_async_create(WT_SESSION_IMPL *session, const char *cfg[]);
 extern int __wt_async_reconfig(WT_SESSION_IMPL *session, const char *cfg[]);
 extern int __wt_async_destroy(WT_SESSION_IMPL *session);
 extern int __wt_async_flush(WT_SESSION_IMPL *session);
+extern int __wt_async_drain(WT_SESSION_IMPL *session, const char *cfg[]);
+extern int __wt_async_completion_fd(WT_SESSION_IMPL *session, int *fdp);
 extern int __wt_async_new_op(WT_SESSION_IMPL *session, const char *uri, const char *config, const char *cfg[], WT_ASYNC_CALLBACK *cb, WT_ASYNC_OP_IMPL **opp);
 extern int __wt_async_op_enqueue(WT_SESSION_IMPL *session, WT_ASYNC_OP_IMPL *op);
 extern int __wt_async_op_init(WT_SESSION_IMPL *session);
@@ -15,15 +17,21 @@ extern int __wt_block_addr_invalid(WT_SESSION_IMPL *session, WT_BLOCK *block, co
 extern int __wt_block_addr_string(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf, const uint8_t *addr, size_t addr_size);
 extern int __wt_block_buffer_to_ckpt(WT_SESSION_IMPL *session, WT_BLOCK *block, const uint8_t *p, WT_BLOCK_CKPT *ci);
 extern int __wt_block_ckpt_to_buffer(WT_SESSION_IMPL *session, WT_BLOCK *block, uint8_t **pp, WT_BLOCK_CKPT *ci);
+extern void __wt_bcache_read(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf, wt_off_t offset, uint32_t size, uint32_t cksum, bool *foundp);
+extern void __wt_bcache_insert(WT_SESSION_IMPL *session, WT_BLOCK *block, const void *image, wt_off_t offset, uint32_t size, uint32_t cksum);
+extern void __wt_bcache_discard(WT_SESSION_IMPL *session, const char *filename);
+extern int __wt_bcache_create(WT_SESSION_IMPL *session, const char *cfg[]);
+extern int __wt_bcache_destroy(WT_SESSION_IMPL *session, bool save);
 extern int __wt_block_ckpt_init( WT_SESSION_IMPL *session, WT_BLOCK_CKPT *ci, const char *name);
 extern int __wt_block_checkpoint_load(WT_SESSION_IMPL *session, WT_BLOCK *block, const uint8_t *addr, size_t addr_size, uint8_t *root_addr, size_t *root_addr_sizep, bool checkpoint);
 extern int __wt_block_checkpoint_unload( WT_SESSION_IMPL *session, WT_BLOCK *block, bool checkpoint);
 extern void __wt_block_ckpt_destroy(WT_SESSION_IMPL *session, WT_BLOCK_CKPT *ci);
 extern int __wt_block_checkpoint(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf, WT_CKPT *ckptbase, bool data_cksum);
 extern int __wt_block_checkpoint_resolve(WT_SESSION_IMPL *session, WT_BLOCK *block);
+extern int __wt_block_checkpoint_changes(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_CKPT *ckptbase, const char *name, WT_ITEM *ranges, bool *foundp);
 extern int __wt_block_compact_start(WT_SESSION_IMPL *session, WT_BLOCK *block);
 extern int __wt_block_compact_end(WT_SESSION_IMPL *session, WT_BLOCK *block);
-extern int __wt_block_compact_skip(WT_SESSION_IMPL *session, WT_BLOCK *block, bool *skipp);
+extern int __wt_block_compact_skip(WT_SESSION_IMPL *session, WT_BLOCK *block, bool *skipp, wt_off_t *reclaimp);
 extern int __wt_block_compact_page_skip(WT_SESSION_IMPL *session, WT_BLOCK *block, const uint8_t *addr, size_t addr_size, bool *skipp);
 extern int __wt_block_misplaced(WT_SESSION_IMPL *session, WT_BLOCK *block, const char *tag, wt_off_t offset, uint32_t size, bool live);
 extern int __wt_block_off_remove_overlap(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_EXTLIST *el, wt_off_t off, wt_off_t size);
@@ -45,6 +53,7 @@ extern int __wt_block_unmap( WT_SESSION_IMPL *session, WT_BLOCK *block, void *ma
 extern int __wt_block_manager_open(WT_SESSION_IMPL *session, const char *filename, const char *cfg[], bool forced_salvage, bool readonly, uint32_t allocsize, WT_BM **bmp);
 extern int __wt_block_manager_truncate( WT_SESSION_IMPL *session, const char *filename, uint32_t allocsize);
 extern int __wt_block_manager_create( WT_SESSION_IMPL *session, const char *filename, uint32_t allocsize);
+extern int __wt_block_manager_prefetch(WT_SESSION_IMPL *session, const char *filename, uint32_t allocsize, const uint8_t *addr, size_t addr_size);
 extern void __wt_block_configure_first_fit(WT_BLOCK *block, bool on);
 extern int __wt_block_open(WT_SESSION_IMPL *session, const char *filename, const char *cfg[], bool forced_salvage, bool readonly, uint32_t allocsize, WT_BLOCK **blockp);
 extern int __wt_block_close(WT_SESSION_IMPL *session, WT_BLOCK *block);
@@ -66,6 +75,10 @@ extern int __wt_block_salvage_end(WT_SESSION_IMPL *session, WT_BLOCK *block);
 extern bool __wt_block_offset_invalid(WT_BLOCK *block, wt_off_t offset, uint32_t size);
 extern int __wt_block_salvage_next(WT_SESSION_IMPL *session, WT_BLOCK *block, uint8_t *addr, size_t *addr_sizep, bool *eofp);
 extern int __wt_block_salvage_valid(WT_SESSION_IMPL *session, WT_BLOCK *block, uint8_t *addr, size_t addr_size, bool valid);
+extern int __wt_block_salvage_region(WT_SESSION_IMPL *session, WT_BLOCK *block, u_int region, u_int regions, WT_BLOCK_SLVG_SCAN *scan);
+extern int __wt_block_salvage_region_next(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_BLOCK_SLVG_SCAN *scan, uint8_t *addr, size_t *addr_sizep, bool *eofp);
+extern int __wt_block_salvage_region_valid(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_BLOCK_SLVG_SCAN *scan, uint8_t *addr, size_t addr_size, bool valid);
+extern int __wt_block_salvage_merge(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_BLOCK_SLVG_SCAN *scan, uint8_t *addr, size_t addr_size, bool *skipp);
 extern int __wt_block_verify_start(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_CKPT *ckptbase, const char *cfg[]);
 extern int __wt_block_verify_end(WT_SESSION_IMPL *session, WT_BLOCK *block);
 extern int __wt_verify_ckpt_load( WT_SESSION_IMPL *session, WT_BLOCK *block, WT_BLOCK_CKPT *ci);
@@ -74,8 +87,8 @@ extern int __wt_block_verify_addr(WT_SESSION_IMPL *session, WT_BLOCK *block, con
 extern u_int __wt_block_header(WT_BLOCK *block);
 extern int __wt_block_truncate(WT_SESSION_IMPL *session, WT_FH *fh, wt_off_t len);
 extern int __wt_block_write_size(WT_SESSION_IMPL *session, WT_BLOCK *block, size_t *sizep);
-extern int __wt_block_write(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf, uint8_t *addr, size_t *addr_sizep, bool data_cksum);
-extern int __wt_block_write_off(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf, wt_off_t *offsetp, uint32_t *sizep, uint32_t *cksump, bool data_cksum, bool caller_locked);
+extern int __wt_block_write(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf, uint8_t *addr, size_t *addr_sizep, bool data_cksum, bool checkpoint_io);
+extern int __wt_block_write_off(WT_SESSION_IMPL *session, WT_BLOCK *block, WT_ITEM *buf, wt_off_t *offsetp, uint32_t *sizep, uint32_t *cksump, bool data_cksum, bool checkpoint_io, bool caller_locked);
 extern int __wt_bloom_create( WT_SESSION_IMPL *session, const char *uri, const char *config, uint64_t count, uint32_t factor, uint32_t k, WT_BLOOM **bloomp);
 extern int __wt_bloom_open(WT_SESSION_IMPL *session, const char *uri, uint32_t factor, uint32_t k, WT_CURSOR *owner, WT_BLOOM **bloomp);
 extern int __wt_bloom_insert(WT_BLOOM *bloom, WT_ITEM *key);
@@ -120,6 +133,8 @@ extern int __wt_delete_page(WT_SESSION_IMPL *session, WT_REF *ref, bool *skipp);
 extern void __wt_delete_page_rollback(WT_SESSION_IMPL *session, WT_REF *ref);
 extern bool __wt_delete_page_skip(WT_SESSION_IMPL *session, WT_REF *ref, bool visible_all);
 extern int __wt_delete_page_instantiate(WT_SESSION_IMPL *session, WT_REF *ref);
+extern int __wt_delta_build(WT_SESSION_IMPL *session, WT_ITEM *buf, WT_ADDR **chainp, uint32_t *entriesp);
+extern void __wt_delta_chain_free( WT_SESSION_IMPL *session, WT_ADDR **chainp, uint32_t entries);
 extern void __wt_ref_out(WT_SESSION_IMPL *session, WT_REF *ref);
 extern void __wt_page_out(WT_SESSION_IMPL *session, WT_PAGE **pagep);
 extern void __wt_free_ref( WT_SESSION_IMPL *session, WT_REF *ref, int page_type, bool free_pages);
@@ -134,7 +149,7 @@ extern void __wt_btree_evictable(WT_SESSION_IMPL *session, bool on);
 extern int __wt_btree_huffman_open(WT_SESSION_IMPL *session);
 extern void __wt_btree_huffman_close(WT_SESSION_IMPL *session);
 extern int __wt_bt_read(WT_SESSION_IMPL *session, WT_ITEM *buf, const uint8_t *addr, size_t addr_size);
-extern int __wt_bt_write(WT_SESSION_IMPL *session, WT_ITEM *buf, uint8_t *addr, size_t *addr_sizep, bool checkpoint, bool compressed);
+extern int __wt_bt_write(WT_SESSION_IMPL *session, WT_ITEM *buf, uint8_t *addr, size_t *addr_sizep, bool checkpoint, bool checkpoint_io, bool compressed);
 extern const char *__wt_page_type_string(u_int type);
 extern const char *__wt_cell_type_string(uint8_t type);
 extern const char *__wt_page_addr_string(WT_SESSION_IMPL *session, WT_REF *ref, WT_ITEM *buf);
@@ -184,6 +199,11 @@ extern void __wt_update_obsolete_free( WT_SESSION_IMPL *session, WT_PAGE *page,
 extern int __wt_search_insert( WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, WT_ITEM *srch_key);
 extern int __wt_row_search(WT_SESSION_IMPL *session, WT_ITEM *srch_key, WT_REF *leaf, WT_CURSOR_BTREE *cbt, bool insert);
 extern int __wt_row_random(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt);
+extern int __wt_ccache_read(WT_SESSION_IMPL *session, WT_ITEM *buf, const uint8_t *addr, size_t addr_size, bool *foundp);
+extern int __wt_ccache_insert(WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr_size, const void *image, size_t size);
+extern void __wt_ccache_stats_update(WT_SESSION_IMPL *session);
+extern int __wt_ccache_create(WT_SESSION_IMPL *session, const char *cfg[]);
+extern int __wt_ccache_destroy(WT_SESSION_IMPL *session);
 extern void __wt_las_stats_update(WT_SESSION_IMPL *session);
 extern int __wt_las_create(WT_SESSION_IMPL *session);
 extern int __wt_las_destroy(WT_SESSION_IMPL *session);
@@ -236,9 +256,13 @@ extern int __wt_cache_pool_config(WT_SESSION_IMPL *session, const char **cfg);
 extern int __wt_conn_cache_pool_open(WT_SESSION_IMPL *session);
 extern int __wt_conn_cache_pool_destroy(WT_SESSION_IMPL *session);
 extern WT_THREAD_RET __wt_cache_pool_server(void *arg);
+extern void __wt_cache_pool_ghost_insert( WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr_size);
+extern void __wt_cache_pool_ghost_check( WT_SESSION_IMPL *session, const uint8_t *addr, size_t addr_size);
 extern int __wt_checkpoint_server_create(WT_SESSION_IMPL *session, const char *cfg[]);
 extern int __wt_checkpoint_server_destroy(WT_SESSION_IMPL *session);
 extern int __wt_checkpoint_signal(WT_SESSION_IMPL *session, wt_off_t logsize);
+extern int __wt_compact_server_create(WT_SESSION_IMPL *session, const char *cfg[]);
+extern int __wt_compact_server_destroy(WT_SESSION_IMPL *session);
 extern int __wt_conn_dhandle_find( WT_SESSION_IMPL *session, const char *uri, const char *checkpoint);
 extern int __wt_conn_btree_sync_and_close(WT_SESSION_IMPL *session, bool final, bool force);
 extern int __wt_conn_btree_open( WT_SESSION_IMPL *session, const char *cfg[], uint32_t flags);
@@ -259,6 +283,8 @@ extern int __wt_logmgr_destroy(WT_SESSION_IMPL *session);
 extern int __wt_connection_open(WT_CONNECTION_IMPL *conn, const char *cfg[]);
 extern int __wt_connection_close(WT_CONNECTION_IMPL *conn);
 extern int __wt_connection_workers(WT_SESSION_IMPL *session, const char *cfg[]);
+extern int __wt_prefetch_create(WT_SESSION_IMPL *session, const char *cfg[]);
+extern int __wt_prefetch_destroy(WT_SESSION_IMPL *session);
 extern void __wt_conn_stat_init(WT_SESSION_IMPL *session);
 extern int __wt_statlog_log_one(WT_SESSION_IMPL *session);
 extern int __wt_statlog_create(WT_SESSION_IMPL *session, const char *cfg[]);
@@ -266,6 +292,17 @@ extern int __wt_statlog_destroy(WT_SESSION_IMPL *session, bool is_close);
 extern int __wt_sweep_config(WT_SESSION_IMPL *session, const char *cfg[]);
 extern int __wt_sweep_create(WT_SESSION_IMPL *session);
 extern int __wt_sweep_destroy(WT_SESSION_IMPL *session);
+extern int __wt_warmup_page_skip(WT_SESSION_IMPL *session, WT_REF *ref, bool *skipp);
+extern int __wt_warmup_create(WT_SESSION_IMPL *session, const char *cfg[]);
+extern int __wt_warmup_destroy(WT_SESSION_IMPL *session);
+extern int __wt_warmup_record_start(WT_SESSION_IMPL *session, bool *recordp);
+extern int __wt_warmup_record_page(WT_SESSION_IMPL *session, WT_REF *ref);
+extern int __wt_warmup_record_end(WT_SESSION_IMPL *session, bool ok);
+extern int __wt_warmup_save(WT_SESSION_IMPL *session, bool save);
+extern int __wt_write_pool_create(WT_SESSION_IMPL *session, const char *cfg[]);
+extern int __wt_write_pool_destroy(WT_SESSION_IMPL *session);
+extern int __wt_write_pool_submit(WT_SESSION_IMPL *session, WT_WRITE_REQ *req, const WT_ITEM *buf, bool compressed, uint32_t id);
+extern int __wt_write_pool_wait(WT_SESSION_IMPL *session, WT_WRITE_REQ *req);
 extern int __wt_curbackup_open(WT_SESSION_IMPL *session, const char *uri, const char *cfg[], WT_CURSOR **cursorp);
 extern int __wt_backup_file_remove(WT_SESSION_IMPL *session);
 extern int __wt_backup_list_uri_append( WT_SESSION_IMPL *session, const char *name, bool *skip);
@@ -276,6 +313,9 @@ extern int __wt_curdump_create(WT_CURSOR *child, WT_CURSOR *owner, WT_CURSOR **c
 extern int __wt_curfile_update_check(WT_CURSOR *cursor);
 extern int __wt_curfile_create(WT_SESSION_IMPL *session, WT_CURSOR *owner, const char *cfg[], bool bulk, bool bitmap, WT_CURSOR **cursorp);
 extern int __wt_curfile_open(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *owner, const char *cfg[], WT_CURSOR **cursorp);
+extern int __wt_curtable_filter_init(WT_CURSOR_TABLE *ctable, WT_CONFIG_ITEM *cval);
+extern int __wt_curtable_filter_match(WT_CURSOR_TABLE *ctable, bool *matchp);
+extern void __wt_curtable_filter_free(WT_SESSION_IMPL *session, WT_CURSOR_TABLE *ctable);
 extern int __wt_curindex_joined(WT_CURSOR *cursor);
 extern int __wt_curindex_open(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *owner, const char *cfg[], WT_CURSOR **cursorp);
 extern int __wt_curjoin_open(WT_SESSION_IMPL *session, const char *uri, WT_CURSOR *owner, const char *cfg[], WT_CURSOR **cursorp);
@@ -304,6 +344,8 @@ extern int __wt_cursor_get_raw_key(WT_CURSOR *cursor, WT_ITEM *key);
 extern void __wt_cursor_set_raw_key(WT_CURSOR *cursor, WT_ITEM *key);
 extern int __wt_cursor_get_raw_value(WT_CURSOR *cursor, WT_ITEM *value);
 extern void __wt_cursor_set_raw_value(WT_CURSOR *cursor, WT_ITEM *value);
+extern int __wt_cursor_batch(WT_CURSOR *cursor, int (*nextf)(WT_CURSOR *, WT_ITEM *, WT_ITEM *), int (*prevf)(WT_CURSOR *), int (*search_nearf)(WT_CURSOR *, int *), WT_ITEM *buf, WT_ITEM *keys, WT_ITEM *values, uint32_t *countp);
+extern int __wt_cursor_next_batch(WT_CURSOR *cursor, WT_ITEM *buf, WT_ITEM *keys, WT_ITEM *values, uint32_t *countp);
 extern int __wt_cursor_get_keyv(WT_CURSOR *cursor, uint32_t flags, va_list ap);
 extern void __wt_cursor_set_keyv(WT_CURSOR *cursor, uint32_t flags, va_list ap);
 extern int __wt_cursor_get_value(WT_CURSOR *cursor, ...);
@@ -508,6 +550,10 @@ extern int __wt_try_writelock(WT_SESSION_IMPL *session, WT_RWLOCK *rwlock);
 extern int __wt_writelock(WT_SESSION_IMPL *session, WT_RWLOCK *rwlock);
 extern int __wt_writeunlock(WT_SESSION_IMPL *session, WT_RWLOCK *rwlock);
 extern int __wt_rwlock_destroy(WT_SESSION_IMPL *session, WT_RWLOCK **rwlockp);
+extern int __wt_notify_open(WT_SESSION_IMPL *session, int *readfdp, int *writefdp);
+extern int __wt_notify_signal(WT_SESSION_IMPL *session, int writefd);
+extern int __wt_notify_clear(WT_SESSION_IMPL *session, int readfd);
+extern int __wt_notify_close(WT_SESSION_IMPL *session, int *readfdp, int *writefdp);
 extern int __wt_once(void (*init_routine)(void));
 extern int __wt_open(WT_SESSION_IMPL *session, const char *name, bool ok_create, bool exclusive, int dio_type, WT_FH **fhp);
 extern int __wt_close(WT_SESSION_IMPL *session, WT_FH **fhp);
@@ -699,6 +745,13 @@ extern void __wt_stat_join_init_single(WT_JOIN_STATS *stats);
 extern void __wt_stat_join_clear_single(WT_JOIN_STATS *stats);
 extern void __wt_stat_join_clear_all(WT_JOIN_STATS **stats);
 extern void __wt_stat_join_aggregate( WT_JOIN_STATS **from, WT_JOIN_STATS *to);
+extern int __wt_trace_config(WT_SESSION_IMPL *session, const char *cfg[]);
+extern int __wt_trace_alloc(WT_SESSION_IMPL *session);
+extern int __wt_trace_dump(WT_SESSION_IMPL *session);
+extern void __wt_trace_slow(WT_SESSION_IMPL *session, uint64_t usecs);
+extern int __wt_trace_server_create(WT_SESSION_IMPL *session);
+extern int __wt_trace_server_destroy(WT_SESSION_IMPL *session);
+extern int __wt_trace_print(WT_SESSION *wt_session, const char *name, FILE *out);
 extern void __wt_txn_release_snapshot(WT_SESSION_IMPL *session);
 extern void __wt_txn_get_snapshot(WT_SESSION_IMPL *session);
 extern void __wt_txn_update_oldest(WT_SESSION_IMPL *session, bool force);
@@ -14,11 +14,16 @@
 #define	WT_CONN_PANIC					0x00000200
 #define	WT_CONN_SERVER_ASYNC				0x00000400
 #define	WT_CONN_SERVER_CHECKPOINT			0x00000800
-#define	WT_CONN_SERVER_LSM				0x00001000
-#define	WT_CONN_SERVER_RUN				0x00002000
-#define	WT_CONN_SERVER_STATISTICS			0x00004000
-#define	WT_CONN_SERVER_SWEEP				0x00008000
-#define	WT_CONN_WAS_BACKUP				0x00010000
+#define	WT_CONN_SERVER_COMPACT				0x00001000
+#define	WT_CONN_SERVER_LSM				0x00002000
+#define	WT_CONN_SERVER_PREFETCH				0x00004000
+#define	WT_CONN_SERVER_RUN				0x00008000
+#define	WT_CONN_SERVER_STATISTICS			0x00010000
+#define	WT_CONN_SERVER_SWEEP				0x00020000
+#define	WT_CONN_SERVER_TRACE				0x00040000
+#define	WT_CONN_SERVER_WARMUP				0x00080000
+#define	WT_CONN_SERVER_WRITE				0x00100000
+#define	WT_CONN_WAS_BACKUP				0x00200000
 #define	WT_EVICTING					0x00000001
 #define	WT_EVICT_IN_MEMORY				0x00000002
 #define	WT_EVICT_LOOKASIDE				0x00000004
@@ -46,7 +51,8 @@
 #define	WT_READ_PREV					0x00000040
 #define	WT_READ_SKIP_INTL				0x00000080
 #define	WT_READ_TRUNCATE				0x00000100
-#define	WT_READ_WONT_NEED				0x00000200
+#define	WT_READ_WARMUP					0x00000200
+#define	WT_READ_WONT_NEED				0x00000400
 #define	WT_SESSION_CAN_WAIT				0x00000001
 #define	WT_SESSION_CLEAR_EVICT_WALK			0x00000002
 #define	WT_SESSION_INTERNAL				0x00000004
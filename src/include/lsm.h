@@ -50,6 +50,18 @@ struct __wt_cursor_lsm {
 	size_t cursor_alloc;
 
 	WT_CURSOR *current;     	/* The current cursor for iteration */
+
+	/*
+	 * Iteration merges the chunk cursors through a binary heap of chunk
+	 * slots ordered by key (largest first when moving backwards), ties
+	 * going to the newest chunk.  The better child of the root is cached
+	 * so stepping a cursor that keeps winning costs a single comparison.
+	 */
+	u_int *heap;			/* Heap of cursor slots */
+	size_t heap_alloc;
+	u_int heap_entries;		/* Entries in the heap */
+	u_int heap_child;		/* Cached root child, 0 if unknown */
+
 	WT_LSM_CHUNK *primary_chunk;	/* The current primary chunk */
 
 	uint64_t *switch_txn;		/* Switch txn for each chunk */
@@ -124,8 +136,10 @@ struct __wt_lsm_work_unit {
 	TAILQ_ENTRY(__wt_lsm_work_unit) q;	/* Worker unit queue */
 	uint32_t	type;			/* Type of operation */
 #define	WT_LSM_WORK_FORCE	0x0001		/* Force operation */
+#define	WT_LSM_WORK_RUNNING	0x0002		/* Popped by a worker */
 	uint32_t	flags;			/* Flags for operation */
 	WT_LSM_TREE *lsm_tree;
+	struct timespec queued_ts;		/* Time the unit was queued */
 };
 
 /*
@@ -136,17 +150,22 @@ struct __wt_lsm_work_unit {
 struct __wt_lsm_manager {
 	/*
 	 * Queues of work units for LSM worker threads. We maintain three
-	 * queues, to allow us to keep each queue FIFO, rather than needing
-	 * to manage the order of work by shuffling the queue order.
+	 * queues, so cheap, latency sensitive work never waits behind long
+	 * running operations.
 	 * One queue for switches - since switches should never wait for other
-	 *   work to be done.
+	 *   work to be done. The switch queue is FIFO.
 	 * One queue for application requested work. For example flushing
 	 *   and creating bloom filters.
 	 * One queue that is for longer running operations such as merges.
+	 * Work is taken from the application and merge queues in order of
+	 * urgency rather than arrival, see __wt_lsm_manager_pop_entry.  To
+	 * bound the time the queue locks are held, only the oldest matching
+	 * work units in a queue are considered.
 	 */
 	TAILQ_HEAD(__wt_lsm_work_switch_qh, __wt_lsm_work_unit)  switchqh;
 	TAILQ_HEAD(__wt_lsm_work_app_qh, __wt_lsm_work_unit)	  appqh;
 	TAILQ_HEAD(__wt_lsm_work_manager_qh, __wt_lsm_work_unit) managerqh;
+#define	WT_LSM_PRIORITY_SCAN	32
 	WT_SPINLOCK	switch_lock;	/* Lock for switch queue */
 	WT_SPINLOCK	app_lock;	/* Lock for application queue */
 	WT_SPINLOCK	manager_lock;	/* Lock for manager queue */
@@ -195,6 +214,8 @@ struct __wt_lsm_tree {
 	uint64_t chunks_flushed;	/* Count of chunks flushed since open */
 	struct timespec merge_aggressive_ts;/* Timestamp for merge aggression */
 	struct timespec work_push_ts;	/* Timestamp last work unit added */
+	uint32_t work_running;		/* Work units being run by workers */
+	uint32_t chunks_in_memory;	/* Chunks not yet flushed */
 	uint64_t merge_progressing;	/* Bumped when merges are active */
 	uint32_t merge_syncing;		/* Bumped when merges are syncing */
 
@@ -241,6 +262,8 @@ struct __wt_lsm_tree {
 	int64_t lsm_checkpoint_throttle;
 	int64_t lsm_lookup_no_bloom;
 	int64_t lsm_merge_throttle;
+	int64_t lsm_work_queue_wait;
+	int64_t lsm_work_units_done;
 
 #define	WT_LSM_TREE_ACTIVE		0x01	/* Workers are active */
 #define	WT_LSM_TREE_AGGRESSIVE_TIMER	0x02	/* Timer for merge aggression */
@@ -248,7 +271,8 @@ struct __wt_lsm_tree {
 #define	WT_LSM_TREE_MERGES		0x08	/* Tree should run merges */
 #define	WT_LSM_TREE_NEED_SWITCH		0x10	/* New chunk needs creating */
 #define	WT_LSM_TREE_OPEN		0x20	/* The tree is open */
-#define	WT_LSM_TREE_THROTTLE		0x40	/* Throttle updates */
+#define	WT_LSM_TREE_SKIPLIST		0x40	/* Skiplist memtable */
+#define	WT_LSM_TREE_THROTTLE		0x80	/* Throttle updates */
 	uint32_t flags;
 };
 
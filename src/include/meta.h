@@ -55,6 +55,7 @@
  * btree engine, and the block manager.
  */
 #define	WT_CHECKPOINT		"WiredTigerCheckpoint"
+#define	WT_CHECKPOINT_BACKUP	"WiredTigerBackup"	/* Incremental backup */
 #define	WT_CKPT_FOREACH(ckptbase, ckpt)					\
 	for ((ckpt) = (ckptbase); (ckpt)->name != NULL; ++(ckpt))
 
@@ -45,6 +45,56 @@ __wt_seconds(WT_SESSION_IMPL *session, time_t *timep)
 	return (0);
 }
 
+/*
+ * __wt_stat_latency_usecs --
+ *	Return the microseconds since an operation timed for a latency
+ * histogram started, or false if the histogram shouldn't be updated.
+ */
+static inline bool
+__wt_stat_latency_usecs(
+    WT_SESSION_IMPL *session, struct timespec start, uint64_t *usecsp)
+{
+	struct timespec stop;
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+
+	if (start.tv_sec == 0 || __wt_epoch(session, &stop) != 0 ||
+	    WT_TIMECMP(stop, start) < 0)
+		return (false);
+	*usecsp = WT_TIMEDIFF_US(stop, start);
+
+	/* Operations are also timed to trigger trace dumps. */
+	if (conn->trace_slow != 0 && *usecsp >= conn->trace_slow)
+		__wt_trace_slow(session, *usecsp);
+	return (FLD_ISSET(conn->stat_flags, WT_CONN_STAT_ALL));
+}
+
+/*
+ * __wt_trace_event --
+ *	Record an event in the session's trace ring buffer.
+ */
+static inline void
+__wt_trace_event(WT_SESSION_IMPL *session, uint32_t event, uint64_t arg)
+{
+	struct timespec ts;
+	WT_TRACE_REC *rec;
+
+	if (session->trace == NULL && __wt_trace_alloc(session) != 0)
+		return;
+	if (__wt_epoch(session, &ts) != 0)
+		return;
+
+	rec = &session->trace[
+	    session->trace_next & (S2C(session)->trace_entries - 1)];
+	rec->ts = (uint64_t)ts.tv_sec * WT_BILLION + (uint64_t)ts.tv_nsec;
+	rec->arg = arg;
+	rec->event = event;
+
+	/* Publish the event for threads dumping the ring buffer. */
+	WT_PUBLISH(session->trace_next, session->trace_next + 1);
+}
+
 /*
  * __wt_verbose --
  * 	Verbose message.
@@ -75,6 +75,7 @@ struct WT_COMPILER_TYPE_ALIGN(WT_CACHE_LINE_ALIGNMENT) __wt_session_impl {
 
 	WT_CURSOR_BACKUP *bkp_cursor;	/* Hot backup cursor */
 	WT_COMPACT	 *compact;	/* Compact state */
+	WT_WARMUP	 *warmup;	/* Cache warm-up state */
 
 	/*
 	 * Lookaside table cursor, sweep and eviction worker threads only.
@@ -191,4 +192,11 @@ struct WT_COMPILER_TYPE_ALIGN(WT_CACHE_LINE_ALIGNMENT) __wt_session_impl {
 	uint32_t   hazard_size;		/* Allocated slots in hazard array. */
 	uint32_t   nhazard;		/* Count of active hazard pointers */
 	WT_HAZARD *hazard;		/* Hazard pointer array */
+
+	/*
+	 * The trace ring buffer is allocated on first use and is read by
+	 * threads dumping the trace, it persists past session close.
+	 */
+	WT_TRACE_REC *trace;		/* Trace event ring buffer */
+	uint64_t      trace_next;	/* Next trace event */
 };
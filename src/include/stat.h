@@ -217,6 +217,68 @@ __wt_stats_clear(void *stats_arg, int slot)
 		    session, (session)->dhandle->stats, fld, value);	\
 } while (0)
 
+/*
+ * Latency histograms: a histogram is a set of statistics, counting operations
+ * completing in each of a series of log-scaled latency ranges.  Timing isn't
+ * free, histograms are only updated if "all" statistics are configured.  The
+ * ranges must match the list in dist/stat_data.py.
+ */
+#define	WT_STAT_LATENCY_INCR(session, stats, fld, usecs) do {		\
+	uint64_t __lat = (usecs);					\
+	if (__lat < 10)							\
+		WT_STAT_INCR(session, stats, fld##_0);			\
+	else if (__lat < 50)						\
+		WT_STAT_INCR(session, stats, fld##_1);			\
+	else if (__lat < 100)						\
+		WT_STAT_INCR(session, stats, fld##_2);			\
+	else if (__lat < 500)						\
+		WT_STAT_INCR(session, stats, fld##_3);			\
+	else if (__lat < WT_THOUSAND)					\
+		WT_STAT_INCR(session, stats, fld##_4);			\
+	else if (__lat < 5 * WT_THOUSAND)				\
+		WT_STAT_INCR(session, stats, fld##_5);			\
+	else if (__lat < 10 * WT_THOUSAND)				\
+		WT_STAT_INCR(session, stats, fld##_6);			\
+	else if (__lat < 50 * WT_THOUSAND)				\
+		WT_STAT_INCR(session, stats, fld##_7);			\
+	else if (__lat < 100 * WT_THOUSAND)				\
+		WT_STAT_INCR(session, stats, fld##_8);			\
+	else								\
+		WT_STAT_INCR(session, stats, fld##_9);			\
+} while (0)
+
+/*
+ * Start timing an operation for the latency histograms or a slow-operation
+ * trace dump; a zero start time means the operation isn't being timed.
+ */
+#define	WT_STAT_LATENCY_START(session, start) do {			\
+	(start).tv_sec = 0;						\
+	if (FLD_ISSET(S2C(session)->stat_flags, WT_CONN_STAT_ALL) ||	\
+	    S2C(session)->trace_slow != 0)				\
+		(void)__wt_epoch(session, &(start));			\
+} while (0)
+
+/*
+ * Update the connection's histogram, and optionally the data-source handle's
+ * histogram, with the time since an operation was started.
+ */
+#define	WT_STAT_LATENCY_CONN(session, fld, start) do {			\
+	uint64_t __usecs;						\
+	if (__wt_stat_latency_usecs(session, (start), &__usecs))	\
+		WT_STAT_LATENCY_INCR(					\
+		    session, S2C(session)->stats, fld, __usecs);	\
+} while (0)
+#define	WT_STAT_LATENCY_CONN_DATA(session, fld, start) do {		\
+	uint64_t __usecs;						\
+	if (__wt_stat_latency_usecs(session, (start), &__usecs)) {	\
+		WT_STAT_LATENCY_INCR(					\
+		    session, S2C(session)->stats, fld, __usecs);	\
+		if ((session)->dhandle != NULL)				\
+			WT_STAT_LATENCY_INCR(session,			\
+			    (session)->dhandle->stats, fld, __usecs);	\
+	}								\
+} while (0)
+
 /*
  * DO NOT EDIT: automatically built by dist/stat.py.
  */
@@ -229,9 +291,13 @@ __wt_stats_clear(void *stats_arg, int slot)
 struct __wt_connection_stats {
 	int64_t async_alloc_race;
 	int64_t async_alloc_view;
+	int64_t async_complete;
 	int64_t async_cur_queue;
+	int64_t async_drain;
 	int64_t async_flush;
 	int64_t async_full;
+	int64_t async_group_ops;
+	int64_t async_group_retry;
 	int64_t async_max_queue;
 	int64_t async_nowork;
 	int64_t async_op_alloc;
@@ -240,9 +306,19 @@ struct __wt_connection_stats {
 	int64_t async_op_remove;
 	int64_t async_op_search;
 	int64_t async_op_update;
+	int64_t async_worker_batch;
+	int64_t async_worker_wait;
 	int64_t block_byte_map_read;
 	int64_t block_byte_read;
 	int64_t block_byte_write;
+	int64_t block_cache_bypass;
+	int64_t block_cache_error;
+	int64_t block_cache_hit;
+	int64_t block_cache_insert;
+	int64_t block_cache_invalid;
+	int64_t block_cache_miss;
+	int64_t block_compact_server_files;
+	int64_t block_compact_server_rewrite;
 	int64_t block_map_read;
 	int64_t block_preload;
 	int64_t block_read;
@@ -255,6 +331,11 @@ struct __wt_connection_stats {
 	int64_t cache_bytes_overflow;
 	int64_t cache_bytes_read;
 	int64_t cache_bytes_write;
+	int64_t cache_compressed_bytes;
+	int64_t cache_compressed_evict;
+	int64_t cache_compressed_hit;
+	int64_t cache_compressed_insert;
+	int64_t cache_compressed_miss;
 	int64_t cache_eviction_app;
 	int64_t cache_eviction_checkpoint;
 	int64_t cache_eviction_clean;
@@ -283,15 +364,24 @@ struct __wt_connection_stats {
 	int64_t cache_overhead;
 	int64_t cache_pages_dirty;
 	int64_t cache_pages_inuse;
+	int64_t cache_pool_chunk1;
+	int64_t cache_pool_chunk2;
+	int64_t cache_pool_chunk4;
+	int64_t cache_pool_chunk8;
 	int64_t cache_read;
+	int64_t cache_read_delta;
 	int64_t cache_read_lookaside;
+	int64_t cache_warmup_read;
+	int64_t cache_warmup_recorded;
 	int64_t cache_write;
 	int64_t cache_write_lookaside;
 	int64_t cache_write_restore;
 	int64_t cond_wait;
 	int64_t cursor_create;
+	int64_t cursor_filter_skip;
 	int64_t cursor_insert;
 	int64_t cursor_next;
+	int64_t cursor_next_batch;
 	int64_t cursor_prev;
 	int64_t cursor_remove;
 	int64_t cursor_reset;
@@ -301,6 +391,7 @@ struct __wt_connection_stats {
 	int64_t cursor_truncate;
 	int64_t cursor_update;
 	int64_t dh_conn_handle_count;
+	int64_t dh_open_prefetch;
 	int64_t dh_session_handles;
 	int64_t dh_session_sweeps;
 	int64_t dh_sweep_close;
@@ -309,6 +400,96 @@ struct __wt_connection_stats {
 	int64_t dh_sweep_tod;
 	int64_t dh_sweeps;
 	int64_t file_open;
+	int64_t latency_cursor_insert_0;
+	int64_t latency_cursor_insert_1;
+	int64_t latency_cursor_insert_2;
+	int64_t latency_cursor_insert_3;
+	int64_t latency_cursor_insert_4;
+	int64_t latency_cursor_insert_5;
+	int64_t latency_cursor_insert_6;
+	int64_t latency_cursor_insert_7;
+	int64_t latency_cursor_insert_8;
+	int64_t latency_cursor_insert_9;
+	int64_t latency_cursor_remove_0;
+	int64_t latency_cursor_remove_1;
+	int64_t latency_cursor_remove_2;
+	int64_t latency_cursor_remove_3;
+	int64_t latency_cursor_remove_4;
+	int64_t latency_cursor_remove_5;
+	int64_t latency_cursor_remove_6;
+	int64_t latency_cursor_remove_7;
+	int64_t latency_cursor_remove_8;
+	int64_t latency_cursor_remove_9;
+	int64_t latency_cursor_search_0;
+	int64_t latency_cursor_search_1;
+	int64_t latency_cursor_search_2;
+	int64_t latency_cursor_search_3;
+	int64_t latency_cursor_search_4;
+	int64_t latency_cursor_search_5;
+	int64_t latency_cursor_search_6;
+	int64_t latency_cursor_search_7;
+	int64_t latency_cursor_search_8;
+	int64_t latency_cursor_search_9;
+	int64_t latency_cursor_update_0;
+	int64_t latency_cursor_update_1;
+	int64_t latency_cursor_update_2;
+	int64_t latency_cursor_update_3;
+	int64_t latency_cursor_update_4;
+	int64_t latency_cursor_update_5;
+	int64_t latency_cursor_update_6;
+	int64_t latency_cursor_update_7;
+	int64_t latency_cursor_update_8;
+	int64_t latency_cursor_update_9;
+	int64_t latency_evict_stall_0;
+	int64_t latency_evict_stall_1;
+	int64_t latency_evict_stall_2;
+	int64_t latency_evict_stall_3;
+	int64_t latency_evict_stall_4;
+	int64_t latency_evict_stall_5;
+	int64_t latency_evict_stall_6;
+	int64_t latency_evict_stall_7;
+	int64_t latency_evict_stall_8;
+	int64_t latency_evict_stall_9;
+	int64_t latency_log_sync_0;
+	int64_t latency_log_sync_1;
+	int64_t latency_log_sync_2;
+	int64_t latency_log_sync_3;
+	int64_t latency_log_sync_4;
+	int64_t latency_log_sync_5;
+	int64_t latency_log_sync_6;
+	int64_t latency_log_sync_7;
+	int64_t latency_log_sync_8;
+	int64_t latency_log_sync_9;
+	int64_t latency_page_read_0;
+	int64_t latency_page_read_1;
+	int64_t latency_page_read_2;
+	int64_t latency_page_read_3;
+	int64_t latency_page_read_4;
+	int64_t latency_page_read_5;
+	int64_t latency_page_read_6;
+	int64_t latency_page_read_7;
+	int64_t latency_page_read_8;
+	int64_t latency_page_read_9;
+	int64_t latency_page_wait_0;
+	int64_t latency_page_wait_1;
+	int64_t latency_page_wait_2;
+	int64_t latency_page_wait_3;
+	int64_t latency_page_wait_4;
+	int64_t latency_page_wait_5;
+	int64_t latency_page_wait_6;
+	int64_t latency_page_wait_7;
+	int64_t latency_page_wait_8;
+	int64_t latency_page_wait_9;
+	int64_t latency_txn_commit_0;
+	int64_t latency_txn_commit_1;
+	int64_t latency_txn_commit_2;
+	int64_t latency_txn_commit_3;
+	int64_t latency_txn_commit_4;
+	int64_t latency_txn_commit_5;
+	int64_t latency_txn_commit_6;
+	int64_t latency_txn_commit_7;
+	int64_t latency_txn_commit_8;
+	int64_t latency_txn_commit_9;
 	int64_t log_buffer_size;
 	int64_t log_bytes_payload;
 	int64_t log_bytes_written;
@@ -348,6 +529,7 @@ struct __wt_connection_stats {
 	int64_t lsm_work_queue_manager;
 	int64_t lsm_work_queue_max;
 	int64_t lsm_work_queue_switch;
+	int64_t lsm_work_queue_wait;
 	int64_t lsm_work_units_created;
 	int64_t lsm_work_units_discarded;
 	int64_t lsm_work_units_done;
@@ -362,10 +544,13 @@ struct __wt_connection_stats {
 	int64_t read_io;
 	int64_t rec_page_delete;
 	int64_t rec_page_delete_fast;
+	int64_t rec_page_delta;
 	int64_t rec_pages;
 	int64_t rec_pages_eviction;
 	int64_t rec_split_stashed_bytes;
 	int64_t rec_split_stashed_objects;
+	int64_t rec_write_pool;
+	int64_t rec_write_pool_inline;
 	int64_t rwlock_read;
 	int64_t rwlock_write;
 	int64_t session_cursor_open;
@@ -445,6 +630,7 @@ struct __wt_dsrc_stats {
 	int64_t cache_inmem_splittable;
 	int64_t cache_overflow_value;
 	int64_t cache_read;
+	int64_t cache_read_delta;
 	int64_t cache_read_lookaside;
 	int64_t cache_read_overflow;
 	int64_t cache_write;
@@ -462,6 +648,7 @@ struct __wt_dsrc_stats {
 	int64_t cursor_insert_bulk;
 	int64_t cursor_insert_bytes;
 	int64_t cursor_next;
+	int64_t cursor_next_batch;
 	int64_t cursor_prev;
 	int64_t cursor_remove;
 	int64_t cursor_remove_bytes;
@@ -472,11 +659,73 @@ struct __wt_dsrc_stats {
 	int64_t cursor_truncate;
 	int64_t cursor_update;
 	int64_t cursor_update_bytes;
+	int64_t latency_cursor_insert_0;
+	int64_t latency_cursor_insert_1;
+	int64_t latency_cursor_insert_2;
+	int64_t latency_cursor_insert_3;
+	int64_t latency_cursor_insert_4;
+	int64_t latency_cursor_insert_5;
+	int64_t latency_cursor_insert_6;
+	int64_t latency_cursor_insert_7;
+	int64_t latency_cursor_insert_8;
+	int64_t latency_cursor_insert_9;
+	int64_t latency_cursor_remove_0;
+	int64_t latency_cursor_remove_1;
+	int64_t latency_cursor_remove_2;
+	int64_t latency_cursor_remove_3;
+	int64_t latency_cursor_remove_4;
+	int64_t latency_cursor_remove_5;
+	int64_t latency_cursor_remove_6;
+	int64_t latency_cursor_remove_7;
+	int64_t latency_cursor_remove_8;
+	int64_t latency_cursor_remove_9;
+	int64_t latency_cursor_search_0;
+	int64_t latency_cursor_search_1;
+	int64_t latency_cursor_search_2;
+	int64_t latency_cursor_search_3;
+	int64_t latency_cursor_search_4;
+	int64_t latency_cursor_search_5;
+	int64_t latency_cursor_search_6;
+	int64_t latency_cursor_search_7;
+	int64_t latency_cursor_search_8;
+	int64_t latency_cursor_search_9;
+	int64_t latency_cursor_update_0;
+	int64_t latency_cursor_update_1;
+	int64_t latency_cursor_update_2;
+	int64_t latency_cursor_update_3;
+	int64_t latency_cursor_update_4;
+	int64_t latency_cursor_update_5;
+	int64_t latency_cursor_update_6;
+	int64_t latency_cursor_update_7;
+	int64_t latency_cursor_update_8;
+	int64_t latency_cursor_update_9;
+	int64_t latency_page_read_0;
+	int64_t latency_page_read_1;
+	int64_t latency_page_read_2;
+	int64_t latency_page_read_3;
+	int64_t latency_page_read_4;
+	int64_t latency_page_read_5;
+	int64_t latency_page_read_6;
+	int64_t latency_page_read_7;
+	int64_t latency_page_read_8;
+	int64_t latency_page_read_9;
+	int64_t latency_page_wait_0;
+	int64_t latency_page_wait_1;
+	int64_t latency_page_wait_2;
+	int64_t latency_page_wait_3;
+	int64_t latency_page_wait_4;
+	int64_t latency_page_wait_5;
+	int64_t latency_page_wait_6;
+	int64_t latency_page_wait_7;
+	int64_t latency_page_wait_8;
+	int64_t latency_page_wait_9;
 	int64_t lsm_checkpoint_throttle;
 	int64_t lsm_chunk_count;
 	int64_t lsm_generation_max;
 	int64_t lsm_lookup_no_bloom;
 	int64_t lsm_merge_throttle;
+	int64_t lsm_work_queue_wait;
+	int64_t lsm_work_units_done;
 	int64_t rec_dictionary;
 	int64_t rec_multiblock_internal;
 	int64_t rec_multiblock_leaf;
@@ -486,6 +735,7 @@ struct __wt_dsrc_stats {
 	int64_t rec_overflow_value;
 	int64_t rec_page_delete;
 	int64_t rec_page_delete_fast;
+	int64_t rec_page_delta;
 	int64_t rec_page_match;
 	int64_t rec_pages;
 	int64_t rec_pages_eviction;
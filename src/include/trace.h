@@ -0,0 +1,97 @@
+/*-
+ * Copyright (c) 2014-2015 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+/*
+ * Engine event tracing.
+ *
+ * Each session has a ring buffer of timestamped events recorded at points of
+ * interest (eviction, reconciliation, splits, log slots, page reads and
+ * checkpoint phases).  Recording an event is a timestamp and a few stores
+ * into memory owned by the session; the rings are only read when they're
+ * dumped to a file, on demand or when an operation is slow.
+ */
+
+/*
+ * WT_TRACE_REC --
+ *	A single trace event.
+ */
+struct __wt_trace_rec {
+	uint64_t ts;			/* Nanoseconds since the Epoch */
+	uint64_t arg;			/* Event argument */
+	uint32_t event;			/* Event type */
+	uint32_t unused;		/* Padding */
+};
+
+/*
+ * Trace event types: the names and argument descriptions are in the decoder's
+ * table in support/trace.c, new events must be added in both places.
+ */
+#define	WT_TRACE_CKPT_START		0	/* Checkpoint */
+#define	WT_TRACE_CKPT_LEAVES		1
+#define	WT_TRACE_CKPT_TREES		2
+#define	WT_TRACE_CKPT_SYNC		3
+#define	WT_TRACE_CKPT_META		4
+#define	WT_TRACE_CKPT_STOP		5
+#define	WT_TRACE_EVICT_START		6	/* Eviction */
+#define	WT_TRACE_EVICT_STOP		7
+#define	WT_TRACE_EVICT_STALL_START	8
+#define	WT_TRACE_EVICT_STALL_STOP	9
+#define	WT_TRACE_LOG_SLOT_JOIN		10	/* Logging */
+#define	WT_TRACE_LOG_SLOT_NEW		11
+#define	WT_TRACE_LOG_SLOT_RELEASE	12
+#define	WT_TRACE_LOG_SLOT_SWITCH_START	13
+#define	WT_TRACE_LOG_SLOT_SWITCH_STOP	14
+#define	WT_TRACE_LOG_SYNC_START		15
+#define	WT_TRACE_LOG_SYNC_STOP		16
+#define	WT_TRACE_PAGE_READ_START	17	/* Page acquisition */
+#define	WT_TRACE_PAGE_READ_STOP		18
+#define	WT_TRACE_PAGE_WAIT		19
+#define	WT_TRACE_REC_START		20	/* Reconciliation */
+#define	WT_TRACE_REC_STOP		21
+#define	WT_TRACE_SLOW_OP		22	/* Slow operation trigger */
+#define	WT_TRACE_SPLIT_INSERT_START	23	/* Splits */
+#define	WT_TRACE_SPLIT_INSERT_STOP	24
+#define	WT_TRACE_SPLIT_MULTI_START	25
+#define	WT_TRACE_SPLIT_MULTI_STOP	26
+#define	WT_TRACE_SPLIT_REVERSE_START	27
+#define	WT_TRACE_SPLIT_REVERSE_STOP	28
+#define	WT_TRACE_SPLIT_REWRITE_START	29
+#define	WT_TRACE_SPLIT_REWRITE_STOP	30
+#define	WT_TRACE_EVENT_MAX		31
+
+/*
+ * WT_TRACE --
+ *	Record an event in the session's trace ring buffer.
+ */
+#define	WT_TRACE(session, event, arg) do {				\
+	if (S2C(session)->trace_entries != 0)				\
+		__wt_trace_event(session, event, (uint64_t)(arg));	\
+} while (0)
+
+/*
+ * Trace dump file layout: a header followed by a block for each session with
+ * events, each block is a session header followed by the session's events,
+ * oldest first.  Dumps are decoded on the same machine, all fields are in
+ * native byte order.
+ */
+#define	WT_TRACE_MAGIC		0x57545452	/* "WTTR" */
+#define	WT_TRACE_VERSION	1
+
+struct __wt_trace_file_hdr {
+	uint32_t magic;			/* WT_TRACE_MAGIC */
+	uint32_t version;		/* WT_TRACE_VERSION */
+	uint32_t entries;		/* Ring buffer entries per session */
+	uint32_t sessions;		/* Session blocks */
+	uint64_t ts;			/* Dump time, nanoseconds */
+	uint64_t slow_usecs;		/* Slow operation or 0 if on demand */
+};
+
+struct __wt_trace_session_hdr {
+	uint32_t id;			/* Session ID */
+	uint32_t count;			/* Events that follow */
+};
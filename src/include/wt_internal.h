@@ -70,8 +70,20 @@ struct __wt_async_format;
     typedef struct __wt_async_format WT_ASYNC_FORMAT;
 struct __wt_async_op_impl;
     typedef struct __wt_async_op_impl WT_ASYNC_OP_IMPL;
+struct __wt_async_qslot;
+    typedef struct __wt_async_qslot WT_ASYNC_QSLOT;
 struct __wt_async_worker_state;
     typedef struct __wt_async_worker_state WT_ASYNC_WORKER_STATE;
+struct __wt_bcache;
+    typedef struct __wt_bcache WT_BCACHE;
+struct __wt_bcache_entry;
+    typedef struct __wt_bcache_entry WT_BCACHE_ENTRY;
+struct __wt_bcache_hdr;
+    typedef struct __wt_bcache_hdr WT_BCACHE_HDR;
+struct __wt_bcache_index;
+    typedef struct __wt_bcache_index WT_BCACHE_INDEX;
+struct __wt_bcache_index_entry;
+    typedef struct __wt_bcache_index_entry WT_BCACHE_INDEX_ENTRY;
 struct __wt_block;
     typedef struct __wt_block WT_BLOCK;
 struct __wt_block_ckpt;
@@ -80,6 +92,8 @@ struct __wt_block_desc;
     typedef struct __wt_block_desc WT_BLOCK_DESC;
 struct __wt_block_header;
     typedef struct __wt_block_header WT_BLOCK_HEADER;
+struct __wt_block_slvg_scan;
+    typedef struct __wt_block_slvg_scan WT_BLOCK_SLVG_SCAN;
 struct __wt_bloom;
     typedef struct __wt_bloom WT_BLOOM;
 struct __wt_bloom_hash;
@@ -90,8 +104,16 @@ struct __wt_btree;
     typedef struct __wt_btree WT_BTREE;
 struct __wt_cache;
     typedef struct __wt_cache WT_CACHE;
+struct __wt_cache_ghost;
+    typedef struct __wt_cache_ghost WT_CACHE_GHOST;
 struct __wt_cache_pool;
     typedef struct __wt_cache_pool WT_CACHE_POOL;
+struct __wt_ccache;
+    typedef struct __wt_ccache WT_CCACHE;
+struct __wt_ccache_entry;
+    typedef struct __wt_ccache_entry WT_CCACHE_ENTRY;
+struct __wt_ccache_part;
+    typedef struct __wt_ccache_part WT_CCACHE_PART;
 struct __wt_cell;
     typedef struct __wt_cell WT_CELL;
 struct __wt_cell_unpack;
@@ -134,6 +156,8 @@ struct __wt_cursor_data_source;
     typedef struct __wt_cursor_data_source WT_CURSOR_DATA_SOURCE;
 struct __wt_cursor_dump;
     typedef struct __wt_cursor_dump WT_CURSOR_DUMP;
+struct __wt_cursor_filter;
+    typedef struct __wt_cursor_filter WT_CURSOR_FILTER;
 struct __wt_cursor_index;
     typedef struct __wt_cursor_index WT_CURSOR_INDEX;
 struct __wt_cursor_join;
@@ -274,6 +298,12 @@ struct __wt_split_stash;
     typedef struct __wt_split_stash WT_SPLIT_STASH;
 struct __wt_table;
     typedef struct __wt_table WT_TABLE;
+struct __wt_trace_file_hdr;
+    typedef struct __wt_trace_file_hdr WT_TRACE_FILE_HDR;
+struct __wt_trace_rec;
+    typedef struct __wt_trace_rec WT_TRACE_REC;
+struct __wt_trace_session_hdr;
+    typedef struct __wt_trace_session_hdr WT_TRACE_SESSION_HDR;
 struct __wt_txn;
     typedef struct __wt_txn WT_TXN;
 struct __wt_txn_global;
@@ -284,6 +314,10 @@ struct __wt_txn_state;
     typedef struct __wt_txn_state WT_TXN_STATE;
 struct __wt_update;
     typedef struct __wt_update WT_UPDATE;
+struct __wt_warmup;
+    typedef struct __wt_warmup WT_WARMUP;
+struct __wt_write_req;
+    typedef struct __wt_write_req WT_WRITE_REQ;
 union __wt_rand_state;
     typedef union __wt_rand_state WT_RAND_STATE;
 /*
@@ -335,6 +369,7 @@ union __wt_rand_state;
 #include "meta.h"
 #include "os.h"
 #include "schema.h"
+#include "trace.h"
 #include "txn.h"
 
 #include "session.h"			/* required by connection.h */
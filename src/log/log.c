@@ -93,6 +93,7 @@ __wt_log_background(WT_SESSION_IMPL *session, WT_LSN *lsn)
 int
 __wt_log_force_sync(WT_SESSION_IMPL *session, WT_LSN *min_lsn)
 {
+	struct timespec start;
 	WT_LOG *log;
 	WT_DECL_RET;
 
@@ -131,7 +132,12 @@ __wt_log_force_sync(WT_SESSION_IMPL *session, WT_LSN *min_lsn)
 		WT_ERR(__wt_verbose(session, WT_VERB_LOG,
 		    "log_force_sync: sync %s to LSN %d/%lu",
 		    log->log_fh->name, min_lsn->file, min_lsn->offset));
-		WT_ERR(__wt_fsync(session, log->log_fh));
+		WT_STAT_LATENCY_START(session, start);
+		WT_TRACE(session, WT_TRACE_LOG_SYNC_START, 0);
+		ret = __wt_fsync(session, log->log_fh);
+		WT_TRACE(session, WT_TRACE_LOG_SYNC_STOP, ret);
+		WT_ERR(ret);
+		WT_STAT_LATENCY_CONN(session, latency_log_sync, start);
 		log->sync_lsn = *min_lsn;
 		WT_STAT_FAST_CONN_INCR(session, log_sync);
 		WT_ERR(__wt_cond_signal(session, log->log_sync_cond));
@@ -1239,6 +1245,7 @@ err:	if (buf != NULL)
 int
 __wt_log_release(WT_SESSION_IMPL *session, WT_LOGSLOT *slot, bool *freep)
 {
+	struct timespec start;
 	WT_CONNECTION_IMPL *conn;
 	WT_DECL_RET;
 	WT_LOG *log;
@@ -1387,7 +1394,12 @@ __wt_log_release(WT_SESSION_IMPL *session, WT_LOGSLOT *slot, bool *freep)
 			    "log_release: sync log %s to LSN %d/%lu",
 			    log->log_fh->name, sync_lsn.file, sync_lsn.offset));
 			WT_STAT_FAST_CONN_INCR(session, log_sync);
-			WT_ERR(__wt_fsync(session, log->log_fh));
+			WT_STAT_LATENCY_START(session, start);
+			WT_TRACE(session, WT_TRACE_LOG_SYNC_START, 0);
+			ret = __wt_fsync(session, log->log_fh);
+			WT_TRACE(session, WT_TRACE_LOG_SYNC_STOP, ret);
+			WT_ERR(ret);
+			WT_STAT_LATENCY_CONN(session, latency_log_sync, start);
 			log->sync_lsn = sync_lsn;
 			WT_ERR(__wt_cond_signal(session, log->log_sync_cond));
 		}
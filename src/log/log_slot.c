@@ -175,6 +175,7 @@ __wt_log_slot_switch(
 	WT_LOG *log;
 
 	log = S2C(session)->log;
+	WT_TRACE(session, WT_TRACE_LOG_SLOT_SWITCH_START, forced);
 	/*
 	 * !!! Since the WT_WITH_SLOT_LOCK macro is a do-while loop, the
 	 * compiler does not like it combined directly with the while loop
@@ -194,6 +195,7 @@ __wt_log_slot_switch(
 			__wt_yield();
 		}
 	} while (F_ISSET(myslot, WT_MYSLOT_CLOSE) || (retry && ret == EBUSY));
+	WT_TRACE(session, WT_TRACE_LOG_SLOT_SWITCH_STOP, ret);
 	return (ret);
 }
 
@@ -245,6 +247,7 @@ __wt_log_slot_new(WT_SESSION_IMPL *session)
 				 */
 				WT_STAT_FAST_CONN_INCR(session,
 				    log_slot_transitions);
+				WT_TRACE(session, WT_TRACE_LOG_SLOT_NEW, 0);
 				log->active_slot = slot;
 				return (0);
 			}
@@ -441,6 +444,7 @@ __wt_log_slot_join(WT_SESSION_IMPL *session, uint64_t mysize,
 	myslot->slot = slot;
 	myslot->offset = join_offset;
 	myslot->end_offset = (wt_off_t)((uint64_t)join_offset + mysize);
+	WT_TRACE(session, WT_TRACE_LOG_SLOT_JOIN, mysize);
 }
 
 /*
@@ -456,7 +460,7 @@ __wt_log_slot_release(WT_SESSION_IMPL *session, WT_MYSLOT *myslot, int64_t size)
 	wt_off_t cur_offset, my_start;
 	int64_t my_size, rel_size;
 
-	WT_UNUSED(session);
+	WT_TRACE(session, WT_TRACE_LOG_SLOT_RELEASE, size);
 	slot = myslot->slot;
 	my_start = slot->slot_start_offset + myslot->offset;
 	while ((cur_offset = slot->slot_last_offset) < my_start) {
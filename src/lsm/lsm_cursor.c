@@ -583,6 +583,8 @@ retry:	if (F_ISSET(clsm, WT_CLSM_MERGE)) {
 	    &clsm->bloom_alloc, nchunks, &clsm->blooms));
 	WT_ERR(__wt_realloc_def(session,
 	    &clsm->cursor_alloc, nchunks, &clsm->cursors));
+	WT_ERR(__wt_realloc_def(session,
+	    &clsm->heap_alloc, nchunks, &clsm->heap));
 
 	clsm->nchunks = nchunks;
 
@@ -716,46 +718,303 @@ __wt_clsm_init_merge(
 }
 
 /*
- * __clsm_get_current --
- *	Find the smallest / largest of the cursors and copy its key/value.
+ * __clsm_heap_cmp --
+ *	Compare two entries in the merge heap: set *beforep if the entry at a
+ * belongs above the entry at b, and return the key comparison in *cmpp.
+ */
+static inline int
+__clsm_heap_cmp(WT_SESSION_IMPL *session,
+    WT_CURSOR_LSM *clsm, u_int a, u_int b, int *cmpp, bool *beforep)
+{
+	u_int slot_a, slot_b;
+	int cmp;
+
+	slot_a = clsm->heap[a];
+	slot_b = clsm->heap[b];
+	WT_RET(WT_LSM_CURCMP(session, clsm->lsm_tree,
+	    clsm->cursors[slot_a], clsm->cursors[slot_b], cmp));
+	if (F_ISSET(clsm, WT_CLSM_ITERATE_PREV))
+		cmp = -cmp;
+
+	/* Equal keys: the newest chunk (the highest slot) wins. */
+	*beforep = cmp < 0 || (cmp == 0 && slot_a > slot_b);
+	*cmpp = cmp;
+	return (0);
+}
+
+/*
+ * __clsm_heap_swap --
+ *	Swap two entries in the merge heap.
+ */
+static inline void
+__clsm_heap_swap(WT_CURSOR_LSM *clsm, u_int a, u_int b)
+{
+	u_int tmp;
+
+	tmp = clsm->heap[a];
+	clsm->heap[a] = clsm->heap[b];
+	clsm->heap[b] = tmp;
+
+	/* The cached child of the root is invalid once the children move. */
+	if (a <= 2 || b <= 2)
+		clsm->heap_child = 0;
+}
+
+/*
+ * __clsm_heap_child --
+ *	Return the better child of a heap entry, or 0 if it has no children.
+ */
+static inline int
+__clsm_heap_child(
+    WT_SESSION_IMPL *session, WT_CURSOR_LSM *clsm, u_int pos, u_int *childp)
+{
+	u_int left, right;
+	int cmp;
+	bool before;
+
+	*childp = 0;
+	left = 2 * pos + 1;
+	right = left + 1;
+	if (left >= clsm->heap_entries)
+		return (0);
+	if (right >= clsm->heap_entries) {
+		*childp = left;
+		return (0);
+	}
+
+	/*
+	 * The root's children don't change while the same cursor keeps
+	 * winning, cache the result of comparing them.
+	 */
+	if (pos == 0 && clsm->heap_child != 0) {
+		*childp = clsm->heap_child;
+		return (0);
+	}
+	WT_RET(__clsm_heap_cmp(session, clsm, left, right, &cmp, &before));
+	*childp = before ? left : right;
+	if (pos == 0)
+		clsm->heap_child = *childp;
+	return (0);
+}
+
+/*
+ * __clsm_heap_sift_down --
+ *	Move a heap entry down to its place.  When sifting from the root, set
+ * *multiplep if the root's key is shared with another cursor.
  */
 static int
-__clsm_get_current(WT_SESSION_IMPL *session,
-    WT_CURSOR_LSM *clsm, bool smallest, bool *deletedp)
+__clsm_heap_sift_down(
+    WT_SESSION_IMPL *session, WT_CURSOR_LSM *clsm, u_int pos, bool *multiplep)
 {
-	WT_CURSOR *c, *current;
+	u_int child, start;
+	int cmp;
+	bool before;
+
+	*multiplep = false;
+	for (start = pos;; pos = child) {
+		WT_RET(__clsm_heap_child(session, clsm, pos, &child));
+		if (child == 0)
+			break;
+		WT_RET(__clsm_heap_cmp(
+		    session, clsm, pos, child, &cmp, &before));
+		if (before) {
+			/*
+			 * If the entry didn't move, we already know whether its
+			 * best child has the same key.
+			 */
+			if (pos == start) {
+				*multiplep = cmp == 0;
+				return (0);
+			}
+			break;
+		}
+		__clsm_heap_swap(clsm, pos, child);
+	}
+
+	/* The root changed: check its new best child for a duplicate key. */
+	if (start == 0 && pos != start) {
+		WT_RET(__clsm_heap_child(session, clsm, 0, &child));
+		if (child != 0) {
+			WT_RET(__clsm_heap_cmp(
+			    session, clsm, 0, child, &cmp, &before));
+			*multiplep = cmp == 0;
+		}
+	}
+	return (0);
+}
+
+/*
+ * __clsm_heap_sift_up --
+ *	Move a heap entry up to its place.
+ */
+static int
+__clsm_heap_sift_up(WT_SESSION_IMPL *session, WT_CURSOR_LSM *clsm, u_int pos)
+{
+	u_int parent;
+	int cmp;
+	bool before;
+
+	for (; pos > 0; pos = parent) {
+		parent = (pos - 1) / 2;
+		WT_RET(__clsm_heap_cmp(
+		    session, clsm, pos, parent, &cmp, &before));
+		if (!before)
+			break;
+		__clsm_heap_swap(clsm, pos, parent);
+	}
+	return (0);
+}
+
+/*
+ * __clsm_heap_remove_root --
+ *	Remove the root of the merge heap.
+ */
+static inline void
+__clsm_heap_remove_root(WT_CURSOR_LSM *clsm)
+{
+	clsm->heap[0] = clsm->heap[--clsm->heap_entries];
+	clsm->heap_child = 0;
+}
+
+/*
+ * __clsm_heap_multiple --
+ *	Check whether the root's key is shared with another cursor.
+ */
+static int
+__clsm_heap_multiple(WT_SESSION_IMPL *session, WT_CURSOR_LSM *clsm)
+{
+	u_int child;
 	int cmp;
+	bool before;
+
+	F_CLR(clsm, WT_CLSM_MULTIPLE);
+	WT_RET(__clsm_heap_child(session, clsm, 0, &child));
+	if (child != 0) {
+		WT_RET(__clsm_heap_cmp(session, clsm, 0, child, &cmp, &before));
+		if (cmp == 0)
+			F_SET(clsm, WT_CLSM_MULTIPLE);
+	}
+	return (0);
+}
+
+/*
+ * __clsm_heap_build --
+ *	Build the merge heap from the positioned chunk cursors.
+ */
+static int
+__clsm_heap_build(WT_SESSION_IMPL *session, WT_CURSOR_LSM *clsm)
+{
+	WT_CURSOR *c;
 	u_int i;
 	bool multiple;
 
-	current = NULL;
-	multiple = false;
+	clsm->heap_entries = 0;
+	clsm->heap_child = 0;
+	for (i = 0; i < clsm->nchunks; i++)
+		if ((c = clsm->cursors[i]) != NULL &&
+		    F_ISSET(c, WT_CURSTD_KEY_INT))
+			clsm->heap[clsm->heap_entries++] = i;
 
-	WT_FORALL_CURSORS(clsm, c, i) {
-		if (!F_ISSET(c, WT_CURSTD_KEY_INT))
-			continue;
-		if (current == NULL) {
-			current = c;
-			continue;
-		}
+	for (i = clsm->heap_entries / 2; i > 0;)
+		WT_RET(__clsm_heap_sift_down(session, clsm, --i, &multiple));
+
+	if (clsm->heap_entries != 0)
+		clsm->current = clsm->cursors[clsm->heap[0]];
+	return (__clsm_heap_multiple(session, clsm));
+}
+
+/*
+ * __clsm_heap_move_root --
+ *	Move the cursor at the root of the merge heap and restore the heap.
+ */
+static int
+__clsm_heap_move_root(
+    WT_SESSION_IMPL *session, WT_CURSOR_LSM *clsm, bool next, bool *multiplep)
+{
+	WT_CURSOR *c;
+	WT_DECL_RET;
+
+	c = clsm->cursors[clsm->heap[0]];
+	if ((ret = next ? c->next(c) : c->prev(c)) == WT_NOTFOUND)
+		__clsm_heap_remove_root(clsm);
+	else
+		WT_RET(ret);
+	return (__clsm_heap_sift_down(session, clsm, 0, multiplep));
+}
+
+/*
+ * __clsm_heap_step --
+ *	Move every cursor positioned on the current key.
+ */
+static int
+__clsm_heap_step(WT_SESSION_IMPL *session, WT_CURSOR_LSM *clsm, bool next)
+{
+	WT_CURSOR *c, *current;
+	WT_DECL_RET;
+	u_int top;
+	int cmp;
+	bool multiple;
+
+	WT_ASSERT(session, clsm->heap_entries != 0);
+
+	/*
+	 * Fast path: if no other cursor has the current key, move the current
+	 * cursor; if it stays on top, that costs a single comparison.
+	 */
+	if (!F_ISSET(clsm, WT_CLSM_MULTIPLE)) {
+		WT_RET(__clsm_heap_move_root(session, clsm, next, &multiple));
+		if (multiple)
+			F_SET(clsm, WT_CLSM_MULTIPLE);
+		return (0);
+	}
+
+	/*
+	 * Otherwise, take the current cursor out of the heap (its key is the
+	 * one being skipped), move the other cursors on that key, then move
+	 * the current cursor and put it back.
+	 */
+	top = clsm->heap[0];
+	current = clsm->cursors[top];
+	__clsm_heap_remove_root(clsm);
+	WT_RET(__clsm_heap_sift_down(session, clsm, 0, &multiple));
+	while (clsm->heap_entries != 0) {
+		c = clsm->cursors[clsm->heap[0]];
 		WT_RET(WT_LSM_CURCMP(session, clsm->lsm_tree, c, current, cmp));
-		if (smallest ? cmp < 0 : cmp > 0) {
-			current = c;
-			multiple = false;
-		} else if (cmp == 0)
-			multiple = true;
+		if (cmp != 0)
+			break;
+		WT_RET(__clsm_heap_move_root(session, clsm, next, &multiple));
 	}
 
+	if ((ret = next ?
+	    current->next(current) : current->prev(current)) == 0) {
+		clsm->heap[clsm->heap_entries] = top;
+		if (++clsm->heap_entries <= 3)
+			clsm->heap_child = 0;
+		WT_RET(__clsm_heap_sift_up(
+		    session, clsm, clsm->heap_entries - 1));
+	}
+	WT_RET_NOTFOUND_OK(ret);
+
+	return (__clsm_heap_multiple(session, clsm));
+}
+
+/*
+ * __clsm_get_current --
+ *	Copy the key/value from the cursor at the top of the merge heap.
+ */
+static int
+__clsm_get_current(
+    WT_SESSION_IMPL *session, WT_CURSOR_LSM *clsm, bool *deletedp)
+{
+	WT_CURSOR *c, *current;
+
 	c = &clsm->iface;
-	if ((clsm->current = current) == NULL) {
+	if (clsm->heap_entries == 0) {
+		clsm->current = NULL;
 		F_CLR(c, WT_CURSTD_KEY_SET | WT_CURSTD_VALUE_SET);
 		return (WT_NOTFOUND);
 	}
-
-	if (multiple)
-		F_SET(clsm, WT_CLSM_MULTIPLE);
-	else
-		F_CLR(clsm, WT_CLSM_MULTIPLE);
+	current = clsm->current = clsm->cursors[clsm->heap[0]];
 
 	WT_RET(current->get_key(current, &c->key));
 	WT_RET(current->get_value(current, &c->value));
@@ -812,7 +1071,7 @@ __clsm_next(WT_CURSOR *cursor)
 	WT_SESSION_IMPL *session;
 	u_int i;
 	int cmp;
-	bool check, deleted;
+	bool deleted, positioned;
 
 	clsm = (WT_CURSOR_LSM *)cursor;
 
@@ -847,38 +1106,23 @@ __clsm_next(WT_CURSOR *cursor)
 		F_SET(clsm, WT_CLSM_ITERATE_NEXT);
 		F_CLR(clsm, WT_CLSM_ITERATE_PREV);
 
+		/* Merge the positioned cursors. */
+		positioned = clsm->current != NULL;
+		WT_ERR(__clsm_heap_build(session, clsm));
+
 		/* We just positioned *at* the key, now move. */
-		if (clsm->current != NULL)
+		if (positioned)
 			goto retry;
 	} else {
 retry:		/*
-		 * If there are multiple cursors on that key, move them
-		 * forward.
+		 * Move the smallest cursor forward, along with any other
+		 * cursors on the same key.
 		 */
-		if (F_ISSET(clsm, WT_CLSM_MULTIPLE)) {
-			check = false;
-			WT_FORALL_CURSORS(clsm, c, i) {
-				if (!F_ISSET(c, WT_CURSTD_KEY_INT))
-					continue;
-				if (check) {
-					WT_ERR(WT_LSM_CURCMP(session,
-					    clsm->lsm_tree, c, clsm->current,
-					    cmp));
-					if (cmp == 0)
-						WT_ERR_NOTFOUND_OK(c->next(c));
-				}
-				if (c == clsm->current)
-					check = true;
-			}
-		}
-
-		/* Move the smallest cursor forward. */
-		c = clsm->current;
-		WT_ERR_NOTFOUND_OK(c->next(c));
+		WT_ERR(__clsm_heap_step(session, clsm, true));
 	}
 
-	/* Find the cursor(s) with the smallest key. */
-	if ((ret = __clsm_get_current(session, clsm, true, &deleted)) == 0 &&
+	/* Return the cursor with the smallest key. */
+	if ((ret = __clsm_get_current(session, clsm, &deleted)) == 0 &&
 	    deleted)
 		goto retry;
 
@@ -902,7 +1146,7 @@ __clsm_prev(WT_CURSOR *cursor)
 	WT_SESSION_IMPL *session;
 	u_int i;
 	int cmp;
-	bool check, deleted;
+	bool deleted, positioned;
 
 	clsm = (WT_CURSOR_LSM *)cursor;
 
@@ -936,38 +1180,23 @@ __clsm_prev(WT_CURSOR *cursor)
 		F_SET(clsm, WT_CLSM_ITERATE_PREV);
 		F_CLR(clsm, WT_CLSM_ITERATE_NEXT);
 
+		/* Merge the positioned cursors. */
+		positioned = clsm->current != NULL;
+		WT_ERR(__clsm_heap_build(session, clsm));
+
 		/* We just positioned *at* the key, now move. */
-		if (clsm->current != NULL)
+		if (positioned)
 			goto retry;
 	} else {
 retry:		/*
-		 * If there are multiple cursors on that key, move them
-		 * backwards.
+		 * Move the largest cursor backwards, along with any other
+		 * cursors on the same key.
 		 */
-		if (F_ISSET(clsm, WT_CLSM_MULTIPLE)) {
-			check = false;
-			WT_FORALL_CURSORS(clsm, c, i) {
-				if (!F_ISSET(c, WT_CURSTD_KEY_INT))
-					continue;
-				if (check) {
-					WT_ERR(WT_LSM_CURCMP(session,
-					    clsm->lsm_tree, c, clsm->current,
-					    cmp));
-					if (cmp == 0)
-						WT_ERR_NOTFOUND_OK(c->prev(c));
-				}
-				if (c == clsm->current)
-					check = true;
-			}
-		}
-
-		/* Move the smallest cursor backwards. */
-		c = clsm->current;
-		WT_ERR_NOTFOUND_OK(c->prev(c));
+		WT_ERR(__clsm_heap_step(session, clsm, false));
 	}
 
-	/* Find the cursor(s) with the largest key. */
-	if ((ret = __clsm_get_current(session, clsm, false, &deleted)) == 0 &&
+	/* Return the cursor with the largest key. */
+	if ((ret = __clsm_get_current(session, clsm, &deleted)) == 0 &&
 	    deleted)
 		goto retry;
 
@@ -1477,6 +1706,7 @@ __wt_clsm_close(WT_CURSOR *cursor)
 	WT_TRET(__clsm_close_cursors(clsm, 0, clsm->nchunks));
 	__wt_free(session, clsm->blooms);
 	__wt_free(session, clsm->cursors);
+	__wt_free(session, clsm->heap);
 	__wt_free(session, clsm->switch_txn);
 
 	/* In case we were somehow left positioned, clear that. */
@@ -1509,6 +1739,7 @@ __wt_clsm_open(WT_SESSION_IMPL *session,
 	    __wt_cursor_equals,		/* equals */
 	    __clsm_next,		/* next */
 	    __clsm_prev,		/* prev */
+	    __wt_cursor_next_batch,	/* next_batch */
 	    __clsm_reset,		/* reset */
 	    __clsm_search,		/* search */
 	    __clsm_search_near,		/* search-near */
@@ -260,6 +260,9 @@ __wt_lsm_manager_free_work_unit(
 	if (entry != NULL) {
 		WT_ASSERT(session, entry->lsm_tree->queue_ref > 0);
 
+		if (F_ISSET(entry, WT_LSM_WORK_RUNNING))
+			(void)__wt_atomic_sub32(
+			    &entry->lsm_tree->work_running, 1);
 		(void)__wt_atomic_sub32(&entry->lsm_tree->queue_ref, 1);
 		__wt_free(session, entry);
 	}
@@ -536,6 +539,66 @@ __wt_lsm_manager_clear_tree(
 	return (0);
 }
 
+/*
+ * __lsm_work_priority --
+ *	Return how urgent a queued work unit is, larger values are more urgent.
+ */
+static uint64_t
+__lsm_work_priority(WT_SESSION_IMPL *session,
+    WT_LSM_WORK_UNIT *entry, struct timespec *now)
+{
+	WT_LSM_TREE *lsm_tree;
+	uint64_t cache_sz, limit, pending, priority;
+
+	lsm_tree = entry->lsm_tree;
+	cache_sz = WT_MAX(S2C(session)->cache_size, WT_MEGABYTE);
+
+	/*
+	 * Work units age, gaining a point for every 10ms spent waiting, so
+	 * nothing queued can be starved by a busier tree.
+	 */
+	priority = WT_TIMECMP(*now, entry->queued_ts) > 0 ?
+	    WT_TIMEDIFF_MS(*now, entry->queued_ts) / 10 : 0;
+
+	/*
+	 * Read amplification grows with the number of chunks: measure it as a
+	 * percentage of the configured chunk count limit, or of a single
+	 * merge's worth of chunks if there is no limit.
+	 */
+	limit = lsm_tree->chunk_count_limit != 0 ?
+	    lsm_tree->chunk_count_limit : WT_MAX(lsm_tree->merge_max, 2);
+
+	switch (entry->type) {
+	case WT_LSM_WORK_FLUSH:
+		/*
+		 * Unflushed chunks pin cache (and eventually throttle the
+		 * application), weigh them in tenths of a percent of the
+		 * cache.  The count is approximate and includes the primary
+		 * chunk, which can't be flushed.
+		 */
+		pending = lsm_tree->chunks_in_memory;
+		if (pending > 0)
+			--pending;
+		priority += 100 +
+		    1000 * pending * lsm_tree->chunk_size / cache_sz;
+		break;
+	case WT_LSM_WORK_BLOOM:
+	case WT_LSM_WORK_MERGE:
+		priority += 100 * lsm_tree->nchunks / limit;
+		break;
+	case WT_LSM_WORK_DROP:
+	default:
+		priority += 50;
+		break;
+	}
+
+	/*
+	 * Share the workers between trees: divide the priority by the number
+	 * of work units the tree already has running.
+	 */
+	return (priority / (1 + lsm_tree->work_running));
+}
+
 /*
  * We assume this is only called from __wt_lsm_manager_pop_entry and we
  * have session, entry and type available to use.  If the queue is empty
@@ -555,17 +618,56 @@ __wt_lsm_manager_clear_tree(
 	__wt_spin_unlock(session, (qlock));				\
 } while (0)
 
+/*
+ * As LSM_POP_ENTRY, but retrieve the most urgent of the first
+ * WT_LSM_PRIORITY_SCAN matching entries rather than the first. Ties go to
+ * the entry queued first.  Entries further back in the queue were queued
+ * later and have aged less, they are considered once older entries are taken.
+ */
+#define	LSM_POP_PRIORITY_ENTRY(qh, qlock, qlen) do {			\
+	WT_LSM_WORK_UNIT *__best, *__e;					\
+	uint64_t __best_priority, __priority;				\
+	u_int __scanned;						\
+	if (TAILQ_EMPTY(qh))						\
+		return (0);						\
+	WT_RET(__wt_epoch(session, &now));				\
+	__best = NULL;							\
+	__best_priority = 0;						\
+	__scanned = 0;							\
+	__wt_spin_lock(session, qlock);					\
+	TAILQ_FOREACH(__e, (qh), q) {					\
+		if (!FLD_ISSET(type, __e->type))			\
+			continue;					\
+		__priority = __lsm_work_priority(session, __e, &now);	\
+		if (__best == NULL || __priority > __best_priority) {	\
+			__best = __e;					\
+			__best_priority = __priority;			\
+		}							\
+		if (++__scanned == WT_LSM_PRIORITY_SCAN)		\
+			break;						\
+	}								\
+	if ((entry = __best) != NULL) {					\
+		TAILQ_REMOVE(qh, entry, q);				\
+		WT_STAT_FAST_CONN_DECR(session, qlen);			\
+	}								\
+	__wt_spin_unlock(session, (qlock));				\
+} while (0)
+
 /*
  * __wt_lsm_manager_pop_entry --
- *	Retrieve the head of the queue, if it matches the requested work
- *	unit type.
+ *	Retrieve a work unit matching the requested work unit type.  Switches
+ *	are taken in order, other work in order of urgency: see
+ *	__lsm_work_priority.
  */
 int
 __wt_lsm_manager_pop_entry(
     WT_SESSION_IMPL *session, uint32_t type, WT_LSM_WORK_UNIT **entryp)
 {
 	WT_LSM_MANAGER *manager;
+	WT_LSM_TREE *lsm_tree;
 	WT_LSM_WORK_UNIT *entry;
+	struct timespec now;
+	uint64_t waitus;
 
 	manager = &S2C(session)->lsm_manager;
 	*entryp = NULL;
@@ -574,17 +676,30 @@ __wt_lsm_manager_pop_entry(
 	/*
 	 * Pop the entry off the correct queue based on our work type.
 	 */
-	if (type == WT_LSM_WORK_SWITCH)
+	if (type == WT_LSM_WORK_SWITCH) {
 		LSM_POP_ENTRY(&manager->switchqh,
 		    &manager->switch_lock, lsm_work_queue_switch);
-	else if (type == WT_LSM_WORK_MERGE)
-		LSM_POP_ENTRY(&manager->managerqh,
+		if (entry != NULL)
+			WT_RET(__wt_epoch(session, &now));
+	} else if (type == WT_LSM_WORK_MERGE)
+		LSM_POP_PRIORITY_ENTRY(&manager->managerqh,
 		    &manager->manager_lock, lsm_work_queue_manager);
 	else
-		LSM_POP_ENTRY(&manager->appqh,
+		LSM_POP_PRIORITY_ENTRY(&manager->appqh,
 		    &manager->app_lock, lsm_work_queue_app);
-	if (entry != NULL)
+	if (entry != NULL) {
+		lsm_tree = entry->lsm_tree;
+		F_SET(entry, WT_LSM_WORK_RUNNING);
+		(void)__wt_atomic_add32(&lsm_tree->work_running, 1);
+
+		waitus = WT_TIMECMP(now, entry->queued_ts) > 0 ?
+		    WT_TIMEDIFF_US(now, entry->queued_ts) : 0;
 		WT_STAT_FAST_CONN_INCR(session, lsm_work_units_done);
+		WT_STAT_FAST_CONN_INCRV(session, lsm_work_queue_wait, waitus);
+		WT_LSM_TREE_STAT_INCR(session, lsm_tree->lsm_work_units_done);
+		WT_LSM_TREE_STAT_INCRV(
+		    session, lsm_tree->lsm_work_queue_wait, waitus);
+	}
 	*entryp = entry;
 	return (0);
 }
@@ -603,7 +718,7 @@ __wt_lsm_manager_pop_entry(
 
 /*
  * __wt_lsm_manager_push_entry --
- *	Add an entry to the end of the switch queue.
+ *	Add an entry to the end of the appropriate queue.
  */
 int
 __wt_lsm_manager_push_entry(WT_SESSION_IMPL *session,
@@ -612,6 +727,7 @@ __wt_lsm_manager_push_entry(WT_SESSION_IMPL *session,
 	WT_DECL_RET;
 	WT_LSM_MANAGER *manager;
 	WT_LSM_WORK_UNIT *entry;
+	struct timespec now;
 	bool pushed;
 
 	manager = &S2C(session)->lsm_manager;
@@ -647,11 +763,13 @@ __wt_lsm_manager_push_entry(WT_SESSION_IMPL *session,
 	}
 
 	pushed = false;
-	WT_ERR(__wt_epoch(session, &lsm_tree->work_push_ts));
+	WT_ERR(__wt_epoch(session, &now));
+	lsm_tree->work_push_ts = now;
 	WT_ERR(__wt_calloc_one(session, &entry));
 	entry->type = type;
 	entry->flags = flags;
 	entry->lsm_tree = lsm_tree;
+	entry->queued_ts = now;
 	WT_STAT_FAST_CONN_INCR(session, lsm_work_units_created);
 
 	if (type == WT_LSM_WORK_SWITCH)
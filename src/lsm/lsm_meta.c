@@ -86,7 +86,12 @@ __wt_lsm_meta_read(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 			lsm_tree->chunk_max = (uint64_t)cv.val;
 		else if (WT_STRING_MATCH("chunk_size", ck.str, ck.len))
 			lsm_tree->chunk_size = (uint64_t)cv.val;
-		else if (WT_STRING_MATCH("merge_max", ck.str, ck.len))
+		else if (WT_STRING_MATCH("memtable", ck.str, ck.len)) {
+			if (WT_STRING_MATCH("skiplist", cv.str, cv.len))
+				F_SET(lsm_tree, WT_LSM_TREE_SKIPLIST);
+			else
+				F_CLR(lsm_tree, WT_LSM_TREE_SKIPLIST);
+		} else if (WT_STRING_MATCH("merge_max", ck.str, ck.len))
 			lsm_tree->merge_max = (uint32_t)cv.val;
 		else if (WT_STRING_MATCH("merge_min", ck.str, ck.len))
 			lsm_tree->merge_min = (uint32_t)cv.val;
@@ -200,6 +205,7 @@ __wt_lsm_meta_write(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 	    ",chunk_max=%" PRIu64
 	    ",chunk_size=%" PRIu64
 	    ",auto_throttle=%" PRIu32
+	    ",memtable=%s"
 	    ",merge_max=%" PRIu32
 	    ",merge_min=%" PRIu32
 	    ",bloom=%" PRIu32
@@ -208,6 +214,7 @@ __wt_lsm_meta_write(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 	    lsm_tree->last, lsm_tree->chunk_count_limit,
 	    lsm_tree->chunk_max, lsm_tree->chunk_size,
 	    F_ISSET(lsm_tree, WT_LSM_TREE_THROTTLE) ? 1 : 0,
+	    F_ISSET(lsm_tree, WT_LSM_TREE_SKIPLIST) ? "skiplist" : "btree",
 	    lsm_tree->merge_max, lsm_tree->merge_min, lsm_tree->bloom,
 	    lsm_tree->bloom_bit_count, lsm_tree->bloom_hash_count));
 	WT_ERR(__wt_buf_catfmt(session, buf, ",chunks=["));
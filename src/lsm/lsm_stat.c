@@ -148,6 +148,12 @@ __curstat_lsm_init(
 	stats->lsm_merge_throttle = lsm_tree->lsm_merge_throttle;
 	if (F_ISSET(cst, WT_CONN_STAT_CLEAR))
 		lsm_tree->lsm_merge_throttle = 0;
+	stats->lsm_work_queue_wait = lsm_tree->lsm_work_queue_wait;
+	if (F_ISSET(cst, WT_CONN_STAT_CLEAR))
+		lsm_tree->lsm_work_queue_wait = 0;
+	stats->lsm_work_units_done = lsm_tree->lsm_work_units_done;
+	if (F_ISSET(cst, WT_CONN_STAT_CLEAR))
+		lsm_tree->lsm_work_units_done = 0;
 
 	__wt_curstat_dsrc_final(cst);
 
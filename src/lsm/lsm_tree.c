@@ -412,6 +412,9 @@ __wt_lsm_tree_create(WT_SESSION_IMPL *session,
 		WT_ERR_MSG(session, EINVAL,
 		    "Chunk size (chunk_size) must be smaller than or equal to "
 		    "the maximum chunk size (chunk_max)");
+	WT_ERR(__wt_config_gets(session, cfg, "lsm.memtable", &cval));
+	if (WT_STRING_MATCH("skiplist", cval.str, cval.len))
+		F_SET(lsm_tree, WT_LSM_TREE_SKIPLIST);
 	WT_ERR(__wt_config_gets(session, cfg, "lsm.merge_max", &cval));
 	lsm_tree->merge_max = (uint32_t)cval.val;
 	WT_ERR(__wt_config_gets(session, cfg, "lsm.merge_min", &cval));
@@ -688,9 +691,13 @@ __wt_lsm_tree_throttle(
 	uint64_t cache_sz, cache_used, oldtime, record_count, timediff;
 	uint32_t in_memory, gen0_chunks;
 
-	/* Never throttle in small trees. */
+	/*
+	 * Never throttle in small trees. Don't bother counting the in-memory
+	 * chunks either, there is at most one waiting to be flushed.
+	 */
 	if (lsm_tree->nchunks < 3) {
 		lsm_tree->ckpt_throttle = lsm_tree->merge_throttle = 0;
+		lsm_tree->chunks_in_memory = lsm_tree->nchunks;
 		return;
 	}
 
@@ -734,6 +741,9 @@ __wt_lsm_tree_throttle(
 				++gen0_chunks;
 		}
 
+	/* The LSM manager uses the flush backlog to prioritize work. */
+	lsm_tree->chunks_in_memory = in_memory;
+
 	last_chunk = lsm_tree->chunk[lsm_tree->nchunks - 1];
 
 	/* Checkpoint throttling, based on the number of in-memory chunks. */
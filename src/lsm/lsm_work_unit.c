@@ -10,6 +10,7 @@
 
 static int __lsm_bloom_create(
     WT_SESSION_IMPL *, WT_LSM_TREE *, WT_LSM_CHUNK *, u_int);
+static int __lsm_bulk_flush(WT_SESSION_IMPL *, WT_LSM_TREE *, WT_LSM_CHUNK *);
 static int __lsm_discard_handle(WT_SESSION_IMPL *, const char *, const char *);
 
 /*
@@ -305,6 +306,17 @@ __wt_lsm_checkpoint_chunk(WT_SESSION_IMPL *session,
 	WT_ERR(__wt_verbose(session, WT_VERB_LSM, "LSM worker flushing %s",
 	    chunk->uri));
 
+	/*
+	 * A skiplist memtable is never reconciled: copy it into a new on-disk
+	 * chunk instead.
+	 */
+	if (F_ISSET(lsm_tree, WT_LSM_TREE_SKIPLIST)) {
+		WT_ERR(__lsm_bulk_flush(session, lsm_tree, chunk));
+		WT_PUBLISH(chunk->flushing, 0);
+		flush_set = false;
+		goto flushed;
+	}
+
 	/*
 	 * Flush the file before checkpointing: this is the expensive part in
 	 * terms of I/O.
@@ -374,7 +386,7 @@ __wt_lsm_checkpoint_chunk(WT_SESSION_IMPL *session,
 	__wt_btree_evictable(session, true);
 	WT_ERR(__wt_session_release_btree(session));
 
-	/* Make sure we aren't pinning a transaction ID. */
+flushed:	/* Make sure we aren't pinning a transaction ID. */
 	__wt_txn_release_snapshot(session);
 
 	WT_ERR(__wt_verbose(session, WT_VERB_LSM, "LSM worker checkpointed %s",
@@ -394,6 +406,159 @@ err:	if (flush_set)
 	return (ret);
 }
 
+/*
+ * __lsm_bulk_flush --
+ *	Flush a skiplist memtable: bulk load its contents, which are already
+ *	sorted, into a new on-disk chunk and replace the memtable with it.
+ */
+static int
+__lsm_bulk_flush(
+    WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree, WT_LSM_CHUNK *chunk)
+{
+	WT_CURSOR *dest, *src;
+	WT_DECL_RET;
+	WT_ITEM key, value;
+	WT_LSM_CHUNK *new_chunk;
+	WT_TXN_ISOLATION saved_isolation;
+	uint64_t insert_count;
+	u_int i;
+	int tret;
+	bool installed, locked;
+	const char *cfg[3];
+	const char *drop_cfg[] =
+	    { WT_CONFIG_BASE(session, WT_SESSION_drop), "force", NULL };
+
+	dest = src = NULL;
+	new_chunk = NULL;
+	saved_isolation = session->txn.isolation;
+	installed = locked = false;
+
+	/* Find the chunk's slot: merges may have moved it. */
+	WT_RET(__wt_lsm_tree_readlock(session, lsm_tree));
+	for (i = 0; i < lsm_tree->nchunks; i++)
+		if (lsm_tree->chunk[i] == chunk)
+			break;
+	WT_RET(__wt_lsm_tree_readunlock(session, lsm_tree));
+	if (i == lsm_tree->nchunks)
+		return (0);
+
+	WT_ERR(__wt_calloc_one(session, &new_chunk));
+	new_chunk->id = __wt_atomic_add32(&lsm_tree->last, 1);
+	new_chunk->generation = chunk->generation;
+
+	/* Open a merge cursor on just the memtable. */
+	WT_ERR(__wt_open_cursor(session, lsm_tree->name, NULL, NULL, &src));
+	F_SET(src, WT_CURSTD_RAW);
+	WT_ERR(__wt_clsm_init_merge(src, i, chunk->id, 1));
+
+	WT_WITH_SCHEMA_LOCK(session,
+	    ret = __wt_lsm_tree_setup_chunk(session, lsm_tree, new_chunk));
+	WT_ERR(ret);
+
+	/*
+	 * The new chunk replaces the memtable in the tree's ordering: it holds
+	 * the same updates, keep the memtable's creation time and switch
+	 * transaction rather than the ones set up for a new chunk.
+	 */
+	new_chunk->create_ts = chunk->create_ts;
+	new_chunk->switch_txn = chunk->switch_txn;
+
+	cfg[0] = WT_CONFIG_BASE(session, WT_SESSION_open_cursor);
+	cfg[1] = "bulk,raw,skip_sort_check";
+	cfg[2] = NULL;
+	WT_ERR(__wt_open_cursor(session, new_chunk->uri, NULL, cfg, &dest));
+
+	/*
+	 * We have already checked that all of the updates in the memtable are
+	 * globally visible, use the cheapest possible visibility check.
+	 */
+	session->txn.isolation = WT_ISO_READ_UNCOMMITTED;
+	for (insert_count = 0; (ret = src->next(src)) == 0; insert_count++) {
+		if (insert_count % WT_THOUSAND == 0 &&
+		    !F_ISSET(lsm_tree, WT_LSM_TREE_ACTIVE))
+			WT_ERR(EINTR);
+
+		WT_ERR(src->get_key(src, &key));
+		dest->set_key(dest, &key);
+		WT_ERR(src->get_value(src, &value));
+		dest->set_value(dest, &value);
+		WT_ERR(dest->insert(dest));
+	}
+	WT_ERR_NOTFOUND_OK(ret);
+	session->txn.isolation = saved_isolation;
+
+	/* Closing the bulk cursor checkpoints the new chunk. */
+	ret = src->close(src);
+	WT_TRET(dest->close(dest));
+	src = dest = NULL;
+	WT_ERR(ret);
+
+	WT_ERR(__wt_lsm_tree_set_chunk_size(session, new_chunk));
+	new_chunk->count = insert_count;
+	F_SET(new_chunk, WT_LSM_CHUNK_ONDISK);
+
+	/* Update the flush timestamp to help track ongoing progress. */
+	WT_ERR(__wt_epoch(session, &lsm_tree->last_flush_ts));
+	++lsm_tree->chunks_flushed;
+
+	/*
+	 * Swap the new chunk into the tree.  If the memtable was retired while
+	 * we were copying it, there's nothing left to replace and the new
+	 * chunk is discarded.
+	 */
+	WT_ERR(__wt_lsm_tree_writelock(session, lsm_tree));
+	locked = true;
+	for (i = 0; i < lsm_tree->nchunks; i++)
+		if (lsm_tree->chunk[i] == chunk)
+			break;
+	if (i == lsm_tree->nchunks)
+		goto err;
+	WT_ERR(__wt_lsm_merge_update_tree(session, lsm_tree, i, 1, new_chunk));
+	installed = true;
+
+	/*
+	 * The memtable's contents are on disk: mark it so anything waiting for
+	 * the flush sees it complete.  It is dropped with the other old chunks
+	 * once no cursors reference it.
+	 */
+	F_SET(chunk, WT_LSM_CHUNK_ONDISK);
+	if ((ret = __wt_lsm_meta_write(session, lsm_tree)) != 0)
+		WT_PANIC_ERR(session, ret, "Failed finalizing LSM flush");
+	++lsm_tree->dsk_gen;
+
+	/* Update the throttle time. */
+	__wt_lsm_tree_throttle(session, lsm_tree, true);
+
+	WT_ERR(__wt_verbose(session, WT_VERB_LSM,
+	    "LSM worker bulk loaded %s into %s (%" PRIu64 " records)",
+	    chunk->uri, new_chunk->uri, insert_count));
+	locked = false;
+	WT_ERR(__wt_lsm_tree_writeunlock(session, lsm_tree));
+
+	WT_ERR(__wt_lsm_manager_push_entry(
+	    session, WT_LSM_WORK_DROP, 0, lsm_tree));
+
+err:	session->txn.isolation = saved_isolation;
+	if (locked)
+		WT_TRET(__wt_lsm_tree_writeunlock(session, lsm_tree));
+	if (src != NULL)
+		WT_TRET(src->close(src));
+	if (dest != NULL)
+		WT_TRET(dest->close(dest));
+	if (new_chunk != NULL && !installed) {
+		/* Drop the new chunk on error. */
+		if (new_chunk->uri != NULL) {
+			WT_WITH_SCHEMA_LOCK(session,
+			    tret = __wt_schema_drop(
+			    session, new_chunk->uri, drop_cfg));
+			WT_TRET(tret);
+		}
+		__wt_free(session, new_chunk->uri);
+		__wt_free(session, new_chunk);
+	}
+	return (ret);
+}
+
 /*
  * __lsm_bloom_create --
  *	Create a bloom filter for a chunk of the LSM tree that has been
@@ -605,6 +770,21 @@ __wt_lsm_free_chunks(WT_SESSION_IMPL *session, WT_LSM_TREE *lsm_tree)
 			F_CLR(chunk, WT_LSM_CHUNK_BLOOM);
 		}
 		if (chunk->uri != NULL) {
+			/*
+			 * A skiplist memtable's in-memory tree was copied, not
+			 * written: discard it rather than have the drop write
+			 * it out.
+			 */
+			if (F_ISSET(lsm_tree, WT_LSM_TREE_SKIPLIST)) {
+				WT_WITH_HANDLE_LIST_LOCK(session,
+				    drop_ret = __lsm_discard_handle(
+				    session, chunk->uri, NULL));
+				if (drop_ret == EBUSY) {
+					++skipped;
+					continue;
+				}
+				WT_ERR(drop_ret);
+			}
 			drop_ret = __lsm_drop_file(session, chunk->uri);
 			if (drop_ret == EBUSY) {
 				++skipped;
@@ -0,0 +1,115 @@
+/*-
+ * Copyright (c) 2014-2015 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+#if defined(__linux__)
+#include <sys/eventfd.h>
+#endif
+
+/*
+ * __wt_notify_open --
+ *	Open a pair of descriptors the application can poll: the read
+ * descriptor is readable after the write descriptor is signalled, until
+ * it's cleared.  Linux uses an eventfd for both, elsewhere we use a pipe.
+ */
+int
+__wt_notify_open(WT_SESSION_IMPL *session, int *readfdp, int *writefdp)
+{
+	int fds[2];
+#if !defined(__linux__)
+	WT_DECL_RET;
+	int f, i;
+#endif
+
+	*readfdp = *writefdp = -1;
+
+#if defined(__linux__)
+	if ((fds[0] = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK)) == -1)
+		WT_RET_MSG(session, __wt_errno(), "eventfd");
+	fds[1] = fds[0];
+#else
+	if (pipe(fds) == -1)
+		WT_RET_MSG(session, __wt_errno(), "pipe");
+
+	/*
+	 * Neither end of the pipe should block, and as with files, we don't
+	 * want other processes to have access to the descriptors.
+	 */
+	for (i = 0; i < 2; ++i)
+		if ((f = fcntl(fds[i], F_GETFL)) == -1 ||
+		    fcntl(fds[i], F_SETFL, f | O_NONBLOCK) == -1 ||
+		    (f = fcntl(fds[i], F_GETFD)) == -1 ||
+		    fcntl(fds[i], F_SETFD, f | FD_CLOEXEC) == -1) {
+			ret = __wt_errno();
+			(void)close(fds[0]);
+			(void)close(fds[1]);
+			WT_RET_MSG(session, ret, "pipe: fcntl");
+		}
+#endif
+	*readfdp = fds[0];
+	*writefdp = fds[1];
+	return (0);
+}
+
+/*
+ * __wt_notify_signal --
+ *	Make the read descriptor readable.
+ */
+int
+__wt_notify_signal(WT_SESSION_IMPL *session, int writefd)
+{
+	uint64_t v;
+
+	/*
+	 * An eventfd requires an 8-byte write, a pipe is happy with anything.
+	 * If the write would block, the descriptor is already readable.
+	 */
+	v = 1;
+	if (write(writefd, &v, sizeof(v)) == -1 &&
+	    errno != EAGAIN && errno != EWOULDBLOCK)
+		WT_RET_MSG(session, __wt_errno(), "notification write");
+	return (0);
+}
+
+/*
+ * __wt_notify_clear --
+ *	Make the read descriptor no longer readable.
+ */
+int
+__wt_notify_clear(WT_SESSION_IMPL *session, int readfd)
+{
+	ssize_t nr;
+	uint64_t buf[8];
+
+	/* Reading an eventfd resets it, a pipe has to be emptied. */
+	while ((nr = read(readfd, buf, sizeof(buf))) > 0)
+		;
+	if (nr == -1 && errno != EAGAIN && errno != EWOULDBLOCK)
+		WT_RET_MSG(session, __wt_errno(), "notification read");
+	return (0);
+}
+
+/*
+ * __wt_notify_close --
+ *	Close a pair of notification descriptors.
+ */
+int
+__wt_notify_close(WT_SESSION_IMPL *session, int *readfdp, int *writefdp)
+{
+	WT_DECL_RET;
+
+	if (*readfdp != -1 && close(*readfdp) != 0)
+		ret = __wt_errno();
+	if (*writefdp != -1 && *writefdp != *readfdp && close(*writefdp) != 0)
+		ret = __wt_errno();
+	*readfdp = *writefdp = -1;
+	if (ret != 0)
+		WT_RET_MSG(session, ret, "notification close");
+	return (0);
+}
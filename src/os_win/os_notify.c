@@ -0,0 +1,61 @@
+/*-
+ * Copyright (c) 2014-2015 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * __wt_notify_open --
+ *	Open a pair of descriptors the application can poll.
+ */
+int
+__wt_notify_open(WT_SESSION_IMPL *session, int *readfdp, int *writefdp)
+{
+	*readfdp = *writefdp = -1;
+
+	WT_RET_MSG(session, ENOTSUP,
+	    "pollable notification descriptors are not supported on Windows");
+}
+
+/*
+ * __wt_notify_signal --
+ *	Make the read descriptor readable.
+ */
+int
+__wt_notify_signal(WT_SESSION_IMPL *session, int writefd)
+{
+	WT_UNUSED(session);
+	WT_UNUSED(writefd);
+
+	return (0);
+}
+
+/*
+ * __wt_notify_clear --
+ *	Make the read descriptor no longer readable.
+ */
+int
+__wt_notify_clear(WT_SESSION_IMPL *session, int readfd)
+{
+	WT_UNUSED(session);
+	WT_UNUSED(readfd);
+
+	return (0);
+}
+
+/*
+ * __wt_notify_close --
+ *	Close a pair of notification descriptors.
+ */
+int
+__wt_notify_close(WT_SESSION_IMPL *session, int *readfdp, int *writefdp)
+{
+	WT_UNUSED(session);
+
+	*readfdp = *writefdp = -1;
+	return (0);
+}
@@ -232,6 +232,16 @@ typedef struct {
 	uint32_t     supd_next;
 	size_t	     supd_allocated;
 
+	/*
+	 * Blocks handed to the connection's write pool: the pool compresses,
+	 * checksums and writes each block while we build the next one, the
+	 * writes are joined before the reconciliation is wrapped up.
+	 */
+	WT_WRITE_REQ **wreq;		/* Write pool requests */
+	uint32_t       wreq_next;	/* Outstanding requests */
+	uint32_t       wreq_entries;	/* Allocated requests */
+	size_t	       wreq_allocated;
+
 	/*
 	 * We don't need to keep the 0th key around on internal pages, the
 	 * search code ignores them as nothing can sort less by definition.
@@ -280,6 +290,8 @@ typedef struct {
 
 	bool is_bulk_load;		/* If it's a bulk load */
 
+	bool delta;			/* If it's a row-store leaf delta */
+
 	WT_SALVAGE_COOKIE *salvage;	/* If it's a salvage operation */
 
 	bool cache_write_lookaside;	/* Used the lookaside table */
@@ -308,11 +320,15 @@ static int  __rec_col_var(WT_SESSION_IMPL *,
 		WT_RECONCILE *, WT_PAGE *, WT_SALVAGE_COOKIE *);
 static int  __rec_col_var_helper(WT_SESSION_IMPL *, WT_RECONCILE *,
 		WT_SALVAGE_COOKIE *, WT_ITEM *, bool, uint8_t, uint64_t);
+static int  __rec_delta_chain_push(
+		WT_SESSION_IMPL *, WT_REF *, WT_PAGE_MODIFY *);
 static int  __rec_destroy_session(WT_SESSION_IMPL *);
 static int  __rec_root_write(WT_SESSION_IMPL *, WT_PAGE *, uint32_t);
 static int  __rec_row_int(WT_SESSION_IMPL *, WT_RECONCILE *, WT_PAGE *);
 static int  __rec_row_leaf(WT_SESSION_IMPL *,
 		WT_RECONCILE *, WT_PAGE *, WT_SALVAGE_COOKIE *);
+static int  __rec_row_leaf_delta(WT_SESSION_IMPL *,
+		WT_RECONCILE *, WT_PAGE *, WT_SALVAGE_COOKIE *);
 static int  __rec_row_leaf_insert(
 		WT_SESSION_IMPL *, WT_RECONCILE *, WT_INSERT *);
 static int  __rec_row_merge(WT_SESSION_IMPL *, WT_RECONCILE *, WT_PAGE *);
@@ -322,6 +338,10 @@ static int  __rec_split_fixup(WT_SESSION_IMPL *, WT_RECONCILE *);
 static int  __rec_split_row(WT_SESSION_IMPL *, WT_RECONCILE *, WT_PAGE *);
 static int  __rec_split_row_promote(
 		WT_SESSION_IMPL *, WT_RECONCILE *, WT_ITEM *, uint8_t);
+static int  __rec_write_complete(WT_SESSION_IMPL *, WT_RECONCILE *);
+static int  __rec_write_join(WT_SESSION_IMPL *, WT_RECONCILE *);
+static int  __rec_write_submit(
+		WT_SESSION_IMPL *, WT_RECONCILE *, WT_BOUNDARY *, WT_ITEM *);
 static int  __rec_split_write(WT_SESSION_IMPL *,
 		WT_RECONCILE *, WT_BOUNDARY *, WT_ITEM *, bool);
 static int  __rec_update_las(
@@ -388,6 +408,7 @@ __wt_reconcile(WT_SESSION_IMPL *session,
 	WT_RET(__wt_fair_lock(session, &page->page_lock));
 
 	/* Reconcile the page. */
+	WT_TRACE(session, WT_TRACE_REC_START, page->memory_footprint);
 	switch (page->type) {
 	case WT_PAGE_COL_FIX:
 		if (salvage != NULL)
@@ -407,11 +428,16 @@ __wt_reconcile(WT_SESSION_IMPL *session,
 		    ret = __rec_row_int(session, r, page));
 		break;
 	case WT_PAGE_ROW_LEAF:
-		ret = __rec_row_leaf(session, r, page, salvage);
+		if ((ret = __rec_row_leaf_delta(
+		    session, r, page, salvage)) == WT_NOTFOUND)
+			ret = __rec_row_leaf(session, r, page, salvage);
 		break;
 	WT_ILLEGAL_VALUE_SET(session);
 	}
 
+	/* Wait for any blocks handed to the write pool. */
+	WT_TRET(__rec_write_join(session, r));
+
 	/* Get the final status for the reconciliation. */
 	if (ret == 0)
 		ret = __rec_write_status(session, r, page);
@@ -424,6 +450,7 @@ __wt_reconcile(WT_SESSION_IMPL *session,
 
 	/* Release the reconciliation lock. */
 	WT_TRET(__wt_fair_unlock(session, &page->page_lock));
+	WT_TRACE(session, WT_TRACE_REC_STOP, ret);
 
 	/* Update statistics. */
 	WT_STAT_FAST_CONN_INCR(session, rec_pages);
@@ -874,6 +901,8 @@ __rec_write_init(WT_SESSION_IMPL *session,
 
 	r->is_bulk_load = false;
 
+	r->delta = false;
+
 	r->salvage = salvage;
 
 	r->cache_write_lookaside = r->cache_write_restore = false;
@@ -889,6 +918,7 @@ static void
 __rec_destroy(WT_SESSION_IMPL *session, void *reconcilep)
 {
 	WT_RECONCILE *r;
+	uint32_t i;
 
 	if ((r = *(WT_RECONCILE **)reconcilep) == NULL)
 		return;
@@ -896,6 +926,17 @@ __rec_destroy(WT_SESSION_IMPL *session, void *reconcilep)
 
 	__wt_buf_free(session, &r->disk_image);
 
+	/*
+	 * Reconciliation joins its block writes, but a failed bulk load may not
+	 * have, don't free requests the write pool might still be using.
+	 */
+	(void)__rec_write_join(session, r);
+	for (i = 0; i < r->wreq_entries; ++i) {
+		__wt_buf_free(session, &r->wreq[i]->buf);
+		__wt_free(session, r->wreq[i]);
+	}
+	__wt_free(session, r->wreq);
+
 	__wt_free(session, r->raw_entries);
 	__wt_free(session, r->raw_offsets);
 	__wt_free(session, r->raw_recnos);
@@ -936,12 +977,12 @@ __rec_bnd_cleanup(WT_SESSION_IMPL *session, WT_RECONCILE *r, bool destroy)
 	WT_BOUNDARY *bnd;
 	uint32_t i, last_used;
 
-	if (r->bnd == NULL)
-		return;
-
 	/* Reconciliation is not re-entrant, make sure that doesn't happen. */
 	r->ref = NULL;
 
+	if (r->bnd == NULL)
+		return;
+
 	/*
 	 * Free the boundary structures' memory.  In the case of normal cleanup,
 	 * discard any memory we won't reuse in the next reconciliation; in the
@@ -3277,8 +3318,20 @@ supd_check_complete:
 		}
 	}
 
-	WT_ERR(__wt_bt_write(session,
-	    buf, addr, &addr_size, false, bnd->already_compressed));
+	/*
+	 * If there's a write pool, hand it the block and continue building the
+	 * next one.  The last block is written here, there's nothing else for
+	 * this thread to do, as are blocks whose address is needed to copy the
+	 * block's updates into the lookaside table.
+	 */
+	if (S2C(session)->write_workers != 0 && !last_block &&
+	    (!F_ISSET(r, WT_EVICT_LOOKASIDE) || bnd->supd == NULL)) {
+		WT_ERR(__rec_write_submit(session, r, bnd, buf));
+		goto done;
+	}
+
+	WT_ERR(__wt_bt_write(session, buf, addr, &addr_size, false,
+	    __wt_btree_checkpoint_io(session), bnd->already_compressed));
 	WT_ERR(__wt_strndup(session, addr, addr_size, &bnd->addr.addr));
 	bnd->addr.size = (uint8_t)addr_size;
 
@@ -3295,6 +3348,83 @@ err:	__wt_scr_free(session, &key);
 	return (ret);
 }
 
+/*
+ * __rec_write_submit --
+ *	Hand a block to the write pool.
+ */
+static int
+__rec_write_submit(WT_SESSION_IMPL *session,
+    WT_RECONCILE *r, WT_BOUNDARY *bnd, WT_ITEM *buf)
+{
+	/*
+	 * Bound the number of blocks outstanding: each request holds a copy of
+	 * the block, and there's no point getting far ahead of the pool.
+	 */
+	if (r->wreq_next >= 2 * S2C(session)->write_workers)
+		WT_RET(__rec_write_complete(session, r));
+
+	if (r->wreq_next == r->wreq_entries) {
+		WT_RET(__wt_realloc_def(session,
+		    &r->wreq_allocated, r->wreq_entries + 1, &r->wreq));
+		WT_RET(__wt_calloc_one(session, &r->wreq[r->wreq_entries]));
+		++r->wreq_entries;
+	}
+
+	WT_RET(__wt_write_pool_submit(session, r->wreq[r->wreq_next],
+	    buf, bnd->already_compressed, (uint32_t)(bnd - r->bnd)));
+	++r->wreq_next;
+	return (0);
+}
+
+/*
+ * __rec_write_complete --
+ *	Wait for the oldest block handed to the write pool, and set its
+ * boundary's address.
+ */
+static int
+__rec_write_complete(WT_SESSION_IMPL *session, WT_RECONCILE *r)
+{
+	WT_BOUNDARY *bnd;
+	WT_DECL_RET;
+	WT_WRITE_REQ *req;
+
+	/*
+	 * Requests are completed in the order they were submitted; move the
+	 * completed request to the end of the list for re-use.
+	 */
+	req = r->wreq[0];
+	ret = __wt_write_pool_wait(session, req);
+	--r->wreq_next;
+	memmove(r->wreq, r->wreq + 1, r->wreq_next * sizeof(*r->wreq));
+	r->wreq[r->wreq_next] = req;
+	WT_RET(ret);
+
+	/*
+	 * The boundary array may have been re-allocated since the request was
+	 * submitted, the request has the boundary's slot.
+	 */
+	bnd = &r->bnd[req->id];
+	WT_RET(__wt_strndup(
+	    session, req->addr, req->addr_size, &bnd->addr.addr));
+	bnd->addr.size = (uint8_t)req->addr_size;
+	return (0);
+}
+
+/*
+ * __rec_write_join --
+ *	Wait for all of the blocks handed to the write pool.
+ */
+static int
+__rec_write_join(WT_SESSION_IMPL *session, WT_RECONCILE *r)
+{
+	WT_DECL_RET;
+
+	/* Wait for all requests, even after a failure. */
+	while (r->wreq_next > 0)
+		WT_TRET(__rec_write_complete(session, r));
+	return (ret);
+}
+
 /*
  * __rec_update_las --
  *	Copy a set of updates into the database's lookaside buffer.
@@ -3510,6 +3640,7 @@ __wt_bulk_wrapup(WT_SESSION_IMPL *session, WT_CURSOR_BULK *cbulk)
 	}
 
 	WT_RET(__rec_split_finish(session, r));
+	WT_RET(__rec_write_join(session, r));
 	WT_RET(__rec_write_wrapup(session, r, r->page));
 	WT_RET(__rec_write_status(session, r, r->page));
 
@@ -5182,6 +5313,214 @@ err:	__wt_scr_free(session, &tmpkey);
 	return (ret);
 }
 
+/*
+ * __rec_row_leaf_delta_append --
+ *	Append a changed record to a row-store leaf page delta.
+ */
+static int
+__rec_row_leaf_delta_append(WT_SESSION_IMPL *session, WT_RECONCILE *r,
+    const void *key, size_t key_size, WT_UPDATE *upd, size_t max)
+{
+	WT_BTREE *btree;
+	WT_CELL key_cell, val_cell;
+	WT_PAGE_HEADER *dsk;
+	size_t key_cell_len, val_cell_len, val_size;
+	uint8_t *p;
+
+	btree = S2BT(session);
+
+	/*
+	 * Removed records are written as a key followed by a WT_CELL_DEL cell,
+	 * records with zero-length values as a key with no following value.
+	 */
+	val_size = val_cell_len = 0;
+	if (WT_UPDATE_DELETED_ISSET(upd))
+		val_cell_len = __wt_cell_pack_del(&val_cell, 0);
+	else if (upd->size != 0) {
+		val_size = upd->size;
+		val_cell_len = __wt_cell_pack_data(&val_cell, 0, val_size);
+	}
+	key_cell_len = __wt_cell_pack_leaf_key(&key_cell, 0, key_size);
+
+	/*
+	 * Delta pages never reference overflow items, and a delta that isn't
+	 * much smaller than the page isn't worth writing.
+	 */
+	if (key_size > btree->maxleafkey || val_size > btree->maxleafvalue ||
+	    r->disk_image.size +
+	    key_cell_len + key_size + val_cell_len + val_size > max)
+		return (WT_NOTFOUND);
+
+	dsk = r->disk_image.mem;
+	p = (uint8_t *)r->disk_image.mem + r->disk_image.size;
+	memcpy(p, &key_cell, key_cell_len);
+	p += key_cell_len;
+	memcpy(p, key, key_size);
+	p += key_size;
+	++dsk->u.entries;
+	if (val_cell_len != 0) {
+		memcpy(p, &val_cell, val_cell_len);
+		p += val_cell_len;
+		if (val_size != 0)
+			memcpy(p, WT_UPDATE_DATA(upd), val_size);
+		p += val_size;
+		++dsk->u.entries;
+	}
+	r->disk_image.size = WT_PTRDIFF(p, r->disk_image.mem);
+	return (0);
+}
+
+/*
+ * __rec_row_leaf_delta --
+ *	Reconcile a row-store leaf page into a delta of its changed records,
+ * returning WT_NOTFOUND if the page should be written as a full image.
+ */
+static int
+__rec_row_leaf_delta(WT_SESSION_IMPL *session,
+    WT_RECONCILE *r, WT_PAGE *page, WT_SALVAGE_COOKIE *salvage)
+{
+	WT_BM *bm;
+	WT_BOUNDARY *bnd;
+	WT_BTREE *btree;
+	WT_CELL cell;
+	WT_DECL_ITEM(tmpkey);
+	WT_DECL_RET;
+	WT_INSERT *ins;
+	WT_PAGE_HEADER *dsk;
+	WT_PAGE_MODIFY *mod;
+	WT_ROW *rip;
+	WT_UPDATE *upd;
+	size_t addr_size, cell_len, max, prev_size;
+	uint32_t chain_len, i;
+	u_int prev_type;
+	uint8_t addr[WT_BTREE_MAX_ADDR_COOKIE];
+	const uint8_t *prev;
+
+	btree = S2BT(session);
+	bm = btree->bm;
+	mod = page->modify;
+	prev_type = 0;			/* -Wuninitialized */
+
+	/*
+	 * Deltas are written for pages read from disk that haven't been split
+	 * or rewritten since, and that don't involve overflow items, encoded
+	 * keys or values, or updates saved outside the page.
+	 */
+	if (btree->leaf_delta_max == 0 || salvage != NULL ||
+	    r->raw_compression || page->dsk == NULL ||
+	    mod->delta_consolidate || mod->ovfl_track != NULL ||
+	    btree->huffman_key != NULL || btree->huffman_value != NULL ||
+	    F_ISSET(page->dsk, WT_PAGE_LAS_UPDATE) ||
+	    F_ISSET(r, WT_EVICT_IN_MEMORY |
+	    WT_EVICT_LOOKASIDE | WT_EVICT_UPDATE_RESTORE) ||
+	    __wt_ref_is_root(r->ref))
+		return (WT_NOTFOUND);
+
+	/*
+	 * A delta references the block the page was read from: the first delta
+	 * written for a page must be against a full image without overflow
+	 * items, later deltas replace the page's last delta and reference the
+	 * same block.
+	 */
+	switch (mod->rec_result) {
+	case 0:
+		WT_RET(__wt_ref_info(
+		    session, r->ref, &prev, &prev_size, &prev_type));
+		if (prev == NULL || (prev_type != WT_CELL_ADDR_LEAF_NO &&
+		    mod->delta_chain_entries == 0))
+			return (WT_NOTFOUND);
+		chain_len = mod->delta_chain_entries + 1;
+		break;
+	case WT_PM_REC_REPLACE:
+		if (mod->delta_chain_entries == 0)
+			return (WT_NOTFOUND);
+		prev = mod->delta_chain[0].addr;
+		prev_size = mod->delta_chain[0].size;
+		chain_len = mod->delta_chain_entries;
+		break;
+	default:
+		return (WT_NOTFOUND);
+	}
+	if (chain_len > btree->leaf_delta_max)
+		return (WT_NOTFOUND);
+
+	/*
+	 * Size the delta image: give up if it grows past a quarter of the page
+	 * it replaces.
+	 */
+	max = WT_MIN(page->dsk->mem_size / 4, btree->maxleafpage);
+	if (max <
+	    WT_PAGE_HEADER_BYTE_SIZE(btree) + 2 * WT_BTREE_MAX_ADDR_COOKIE)
+		return (WT_NOTFOUND);
+	addr_size = max;
+	WT_RET(bm->write_size(bm, session, &addr_size));
+	WT_RET(__wt_buf_init(session, &r->disk_image, addr_size));
+	dsk = r->disk_image.mem;
+	memset(dsk, 0, WT_PAGE_HEADER_BYTE_SIZE(btree));
+	dsk->type = WT_PAGE_ROW_LEAF_DELTA;
+	r->disk_image.size = WT_PAGE_HEADER_BYTE_SIZE(btree);
+
+	/* The first cell is the address of the previous block. */
+	cell_len = __wt_cell_pack_addr(
+	    &cell, WT_CELL_ADDR_LEAF, WT_RECNO_OOB, prev_size);
+	memcpy(WT_PAGE_HEADER_BYTE(btree, dsk), &cell, cell_len);
+	memcpy((uint8_t *)
+	    WT_PAGE_HEADER_BYTE(btree, dsk) + cell_len, prev, prev_size);
+	r->disk_image.size += cell_len + prev_size;
+	dsk->u.entries = 1;
+
+	WT_RET(__wt_scr_alloc(session, 0, &tmpkey));
+
+	/*
+	 * Walk the page in key order, writing the records with updates: inserts
+	 * before the first on-page key, then each on-page key followed by the
+	 * records inserted after it.  Removed on-page records are written as
+	 * removes, removed inserts were never written and are skipped.
+	 */
+	ins = WT_SKIP_FIRST(WT_ROW_INSERT_SMALLEST(page));
+	for (i = 0;;) {
+		for (; ins != NULL; ins = WT_SKIP_NEXT(ins)) {
+			WT_ERR(__rec_txn_read(
+			    session, r, ins, NULL, NULL, &upd));
+			if (upd == NULL || WT_UPDATE_DELETED_ISSET(upd))
+				continue;
+			WT_ERR(__rec_row_leaf_delta_append(session, r,
+			    WT_INSERT_KEY(ins), WT_INSERT_KEY_SIZE(ins),
+			    upd, max));
+		}
+		if (i == page->pg_row_entries)
+			break;
+
+		rip = &page->pg_row_d[i++];
+		WT_ERR(__rec_txn_read(session, r, NULL, rip, NULL, &upd));
+		if (upd != NULL) {
+			WT_ERR(__wt_row_leaf_key(
+			    session, page, rip, tmpkey, false));
+			WT_ERR(__rec_row_leaf_delta_append(session,
+			    r, tmpkey->data, tmpkey->size, upd, max));
+		}
+		ins = WT_SKIP_FIRST(WT_ROW_INSERT(page, rip));
+	}
+	dsk->mem_size = WT_STORE_SIZE(r->disk_image.size);
+
+	/* Write the delta as the page's single block. */
+	r->bnd_next = 0;
+	WT_ERR(__rec_split_bnd_grow(session, r));
+	bnd = &r->bnd[0];
+	__rec_split_bnd_init(session, bnd);
+	WT_ERR(__wt_bt_write(session, &r->disk_image, addr, &addr_size,
+	    false, __wt_btree_checkpoint_io(session), false));
+	WT_ERR(__wt_strndup(session, addr, addr_size, &bnd->addr.addr));
+	bnd->addr.size = (uint8_t)addr_size;
+	bnd->addr.type = WT_ADDR_LEAF;
+	bnd->size = (uint32_t)r->disk_image.size;
+	r->bnd_next = 1;
+	r->delta = true;
+
+err:	__wt_scr_free(session, &tmpkey);
+	return (ret);
+}
+
 /*
  * __rec_row_leaf_insert --
  *	Walk an insert chain, writing K/V pairs.
@@ -5361,6 +5700,42 @@ err:	__wt_scr_free(session, &tkey);
 	return (ret);
 }
 
+/*
+ * __rec_delta_chain_push --
+ *	Add a page's original block to the front of its delta chain.
+ */
+static int
+__rec_delta_chain_push(
+    WT_SESSION_IMPL *session, WT_REF *ref, WT_PAGE_MODIFY *mod)
+{
+	WT_ADDR *chain;
+	WT_DECL_RET;
+	size_t size;
+	u_int type;
+	const uint8_t *p;
+
+	type = 0;			/* -Wuninitialized */
+	WT_RET(__wt_ref_info(session, ref, &p, &size, &type));
+	WT_RET(__wt_calloc_def(session, mod->delta_chain_entries + 1, &chain));
+	WT_ERR(__wt_strndup(session, p, size, &chain[0].addr));
+	chain[0].size = (uint8_t)size;
+	chain[0].type =
+	    type == WT_CELL_ADDR_LEAF_NO ? WT_ADDR_LEAF_NO : WT_ADDR_LEAF;
+	if (mod->delta_chain_entries != 0)
+		memcpy(chain + 1, mod->delta_chain,
+		    mod->delta_chain_entries * sizeof(WT_ADDR));
+	__wt_free(session, mod->delta_chain);
+	mod->delta_chain = chain;
+	++mod->delta_chain_entries;
+
+	/* The block is now owned by the chain, clear the original address. */
+	__wt_ref_addr_free(session, ref);
+	return (0);
+
+err:	__wt_free(session, chain);
+	return (ret);
+}
+
 /*
  * __rec_write_wrapup --
  *	Finish the reconciliation.
@@ -5373,6 +5748,7 @@ __rec_write_wrapup(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_PAGE *page)
 	WT_BTREE *btree;
 	WT_PAGE_MODIFY *mod;
 	WT_REF *ref;
+	uint32_t i;
 
 	btree = S2BT(session);
 	bm = btree->bm;
@@ -5397,6 +5773,15 @@ __rec_write_wrapup(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_PAGE *page)
 		 */
 		if (__wt_ref_is_root(ref))
 			break;
+
+		/*
+		 * If the page was written as a delta, the original block is
+		 * referenced by the delta, add it to the page's delta chain.
+		 */
+		if (r->delta) {
+			WT_RET(__rec_delta_chain_push(session, ref, mod));
+			break;
+		}
 		WT_RET(__wt_ref_block_free(session, ref));
 		break;
 	case WT_PM_REC_EMPTY:				/* Page deleted */
@@ -5428,6 +5813,21 @@ __rec_write_wrapup(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_PAGE *page)
 	/* Reset the reconciliation state. */
 	mod->rec_result = 0;
 
+	/*
+	 * If the page wasn't written as a delta, the blocks in any delta chain
+	 * are no longer referenced, discard them.
+	 */
+	if (!r->delta && mod->delta_chain != NULL) {
+		for (i = 0; i < mod->delta_chain_entries; ++i)
+			WT_RET(__wt_btree_block_free(session,
+			    mod->delta_chain[i].addr,
+			    mod->delta_chain[i].size));
+		__wt_delta_chain_free(
+		    session, &mod->delta_chain, mod->delta_chain_entries);
+		mod->delta_chain_entries = 0;
+	}
+	mod->delta_consolidate = 0;
+
 	/*
 	 * Wrap up overflow tracking.  If we are about to create a checkpoint,
 	 * the system must be entirely consistent at that point (the underlying
@@ -5484,12 +5884,16 @@ __rec_write_wrapup(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_PAGE *page)
 		 */
 		if (bnd->addr.addr == NULL)
 			WT_RET(__wt_bt_write(session, &r->disk_image,
-			    NULL, NULL, true, bnd->already_compressed));
+			    NULL, NULL, true, true, bnd->already_compressed));
 		else {
 			mod->mod_replace = bnd->addr;
 			bnd->addr.addr = NULL;
 		}
 
+		if (r->delta) {
+			WT_STAT_FAST_CONN_INCR(session, rec_page_delta);
+			WT_STAT_FAST_DATA_INCR(session, rec_page_delta);
+		}
 		mod->rec_result = WT_PM_REC_REPLACE;
 		break;
 	default:					/* Page split */
@@ -5949,7 +6353,8 @@ __rec_cell_build_ovfl(WT_SESSION_IMPL *session,
 
 		/* Write the buffer. */
 		addr = buf;
-		WT_ERR(__wt_bt_write(session, tmp, addr, &size, false, false));
+		WT_ERR(__wt_bt_write(session, tmp, addr, &size,
+		    false, __wt_btree_checkpoint_io(session), false));
 
 		/*
 		 * Track the overflow record (unless it's a bulk load, which
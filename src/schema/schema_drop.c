@@ -33,6 +33,9 @@ __drop_file(
 	    ret = __wt_conn_dhandle_close_all(session, uri, force));
 	WT_RET(ret);
 
+	/* Discard any of the file's blocks from the block cache. */
+	__wt_bcache_discard(session, filename);
+
 	/* Remove the metadata entry (ignore missing items). */
 	WT_TRET(__wt_metadata_remove(session, uri));
 	if (!remove_files)
@@ -53,6 +53,7 @@ static const char * const __stats_dsrc_desc[] = {
 	"cache: in-memory page passed criteria to be split",
 	"cache: overflow values cached in memory",
 	"cache: pages read into cache",
+	"cache: pages read into cache from a chain of deltas",
 	"cache: pages read into cache requiring lookaside entries",
 	"cache: overflow pages read into cache",
 	"cache: pages written from cache",
@@ -70,6 +71,7 @@ static const char * const __stats_dsrc_desc[] = {
 	"cursor: bulk-loaded cursor-insert calls",
 	"cursor: cursor-insert key and value bytes inserted",
 	"cursor: next calls",
+	"cursor: next_batch calls",
 	"cursor: prev calls",
 	"cursor: remove calls",
 	"cursor: cursor-remove key bytes removed",
@@ -80,11 +82,73 @@ static const char * const __stats_dsrc_desc[] = {
 	"cursor: truncate calls",
 	"cursor: update calls",
 	"cursor: cursor-update value bytes updated",
+	"latency: cursor insert histogram (bucket 0) - under 10us",
+	"latency: cursor insert histogram (bucket 1) - 10-49us",
+	"latency: cursor insert histogram (bucket 2) - 50-99us",
+	"latency: cursor insert histogram (bucket 3) - 100-499us",
+	"latency: cursor insert histogram (bucket 4) - 500-999us",
+	"latency: cursor insert histogram (bucket 5) - 1-4ms",
+	"latency: cursor insert histogram (bucket 6) - 5-9ms",
+	"latency: cursor insert histogram (bucket 7) - 10-49ms",
+	"latency: cursor insert histogram (bucket 8) - 50-99ms",
+	"latency: cursor insert histogram (bucket 9) - 100ms and over",
+	"latency: cursor remove histogram (bucket 0) - under 10us",
+	"latency: cursor remove histogram (bucket 1) - 10-49us",
+	"latency: cursor remove histogram (bucket 2) - 50-99us",
+	"latency: cursor remove histogram (bucket 3) - 100-499us",
+	"latency: cursor remove histogram (bucket 4) - 500-999us",
+	"latency: cursor remove histogram (bucket 5) - 1-4ms",
+	"latency: cursor remove histogram (bucket 6) - 5-9ms",
+	"latency: cursor remove histogram (bucket 7) - 10-49ms",
+	"latency: cursor remove histogram (bucket 8) - 50-99ms",
+	"latency: cursor remove histogram (bucket 9) - 100ms and over",
+	"latency: cursor search histogram (bucket 0) - under 10us",
+	"latency: cursor search histogram (bucket 1) - 10-49us",
+	"latency: cursor search histogram (bucket 2) - 50-99us",
+	"latency: cursor search histogram (bucket 3) - 100-499us",
+	"latency: cursor search histogram (bucket 4) - 500-999us",
+	"latency: cursor search histogram (bucket 5) - 1-4ms",
+	"latency: cursor search histogram (bucket 6) - 5-9ms",
+	"latency: cursor search histogram (bucket 7) - 10-49ms",
+	"latency: cursor search histogram (bucket 8) - 50-99ms",
+	"latency: cursor search histogram (bucket 9) - 100ms and over",
+	"latency: cursor update histogram (bucket 0) - under 10us",
+	"latency: cursor update histogram (bucket 1) - 10-49us",
+	"latency: cursor update histogram (bucket 2) - 50-99us",
+	"latency: cursor update histogram (bucket 3) - 100-499us",
+	"latency: cursor update histogram (bucket 4) - 500-999us",
+	"latency: cursor update histogram (bucket 5) - 1-4ms",
+	"latency: cursor update histogram (bucket 6) - 5-9ms",
+	"latency: cursor update histogram (bucket 7) - 10-49ms",
+	"latency: cursor update histogram (bucket 8) - 50-99ms",
+	"latency: cursor update histogram (bucket 9) - 100ms and over",
+	"latency: page read histogram (bucket 0) - under 10us",
+	"latency: page read histogram (bucket 1) - 10-49us",
+	"latency: page read histogram (bucket 2) - 50-99us",
+	"latency: page read histogram (bucket 3) - 100-499us",
+	"latency: page read histogram (bucket 4) - 500-999us",
+	"latency: page read histogram (bucket 5) - 1-4ms",
+	"latency: page read histogram (bucket 6) - 5-9ms",
+	"latency: page read histogram (bucket 7) - 10-49ms",
+	"latency: page read histogram (bucket 8) - 50-99ms",
+	"latency: page read histogram (bucket 9) - 100ms and over",
+	"latency: page acquire wait histogram (bucket 0) - under 10us",
+	"latency: page acquire wait histogram (bucket 1) - 10-49us",
+	"latency: page acquire wait histogram (bucket 2) - 50-99us",
+	"latency: page acquire wait histogram (bucket 3) - 100-499us",
+	"latency: page acquire wait histogram (bucket 4) - 500-999us",
+	"latency: page acquire wait histogram (bucket 5) - 1-4ms",
+	"latency: page acquire wait histogram (bucket 6) - 5-9ms",
+	"latency: page acquire wait histogram (bucket 7) - 10-49ms",
+	"latency: page acquire wait histogram (bucket 8) - 50-99ms",
+	"latency: page acquire wait histogram (bucket 9) - 100ms and over",
 	"LSM: sleep for LSM checkpoint throttle",
 	"LSM: chunks in the LSM tree",
 	"LSM: highest merge generation in the LSM tree",
 	"LSM: queries that could have benefited from a Bloom filter that did not exist",
 	"LSM: sleep for LSM merge throttle",
+	"LSM: tree maintenance operations time queued (usecs)",
+	"LSM: tree maintenance operations executed",
 	"reconciliation: dictionary matches",
 	"reconciliation: internal page multi-block writes",
 	"reconciliation: leaf page multi-block writes",
@@ -94,6 +158,7 @@ static const char * const __stats_dsrc_desc[] = {
 	"reconciliation: overflow values written",
 	"reconciliation: pages deleted",
 	"reconciliation: fast-path pages deleted",
+	"reconciliation: leaf pages written as deltas",
 	"reconciliation: page checksum matches",
 	"reconciliation: page reconciliation calls",
 	"reconciliation: page reconciliation calls for eviction",
@@ -176,6 +241,7 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
 	stats->cache_eviction_deepen = 0;
 	stats->cache_write_lookaside = 0;
 	stats->cache_read = 0;
+	stats->cache_read_delta = 0;
 	stats->cache_read_lookaside = 0;
 	stats->cache_write = 0;
 	stats->cache_write_restore = 0;
@@ -194,6 +260,7 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
 	stats->cursor_update_bytes = 0;
 	stats->cursor_insert = 0;
 	stats->cursor_next = 0;
+	stats->cursor_next_batch = 0;
 	stats->cursor_prev = 0;
 	stats->cursor_remove = 0;
 	stats->cursor_reset = 0;
@@ -202,6 +269,66 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
 	stats->cursor_search_near = 0;
 	stats->cursor_truncate = 0;
 	stats->cursor_update = 0;
+	stats->latency_cursor_insert_0 = 0;
+	stats->latency_cursor_insert_1 = 0;
+	stats->latency_cursor_insert_2 = 0;
+	stats->latency_cursor_insert_3 = 0;
+	stats->latency_cursor_insert_4 = 0;
+	stats->latency_cursor_insert_5 = 0;
+	stats->latency_cursor_insert_6 = 0;
+	stats->latency_cursor_insert_7 = 0;
+	stats->latency_cursor_insert_8 = 0;
+	stats->latency_cursor_insert_9 = 0;
+	stats->latency_cursor_remove_0 = 0;
+	stats->latency_cursor_remove_1 = 0;
+	stats->latency_cursor_remove_2 = 0;
+	stats->latency_cursor_remove_3 = 0;
+	stats->latency_cursor_remove_4 = 0;
+	stats->latency_cursor_remove_5 = 0;
+	stats->latency_cursor_remove_6 = 0;
+	stats->latency_cursor_remove_7 = 0;
+	stats->latency_cursor_remove_8 = 0;
+	stats->latency_cursor_remove_9 = 0;
+	stats->latency_cursor_search_0 = 0;
+	stats->latency_cursor_search_1 = 0;
+	stats->latency_cursor_search_2 = 0;
+	stats->latency_cursor_search_3 = 0;
+	stats->latency_cursor_search_4 = 0;
+	stats->latency_cursor_search_5 = 0;
+	stats->latency_cursor_search_6 = 0;
+	stats->latency_cursor_search_7 = 0;
+	stats->latency_cursor_search_8 = 0;
+	stats->latency_cursor_search_9 = 0;
+	stats->latency_cursor_update_0 = 0;
+	stats->latency_cursor_update_1 = 0;
+	stats->latency_cursor_update_2 = 0;
+	stats->latency_cursor_update_3 = 0;
+	stats->latency_cursor_update_4 = 0;
+	stats->latency_cursor_update_5 = 0;
+	stats->latency_cursor_update_6 = 0;
+	stats->latency_cursor_update_7 = 0;
+	stats->latency_cursor_update_8 = 0;
+	stats->latency_cursor_update_9 = 0;
+	stats->latency_page_wait_0 = 0;
+	stats->latency_page_wait_1 = 0;
+	stats->latency_page_wait_2 = 0;
+	stats->latency_page_wait_3 = 0;
+	stats->latency_page_wait_4 = 0;
+	stats->latency_page_wait_5 = 0;
+	stats->latency_page_wait_6 = 0;
+	stats->latency_page_wait_7 = 0;
+	stats->latency_page_wait_8 = 0;
+	stats->latency_page_wait_9 = 0;
+	stats->latency_page_read_0 = 0;
+	stats->latency_page_read_1 = 0;
+	stats->latency_page_read_2 = 0;
+	stats->latency_page_read_3 = 0;
+	stats->latency_page_read_4 = 0;
+	stats->latency_page_read_5 = 0;
+	stats->latency_page_read_6 = 0;
+	stats->latency_page_read_7 = 0;
+	stats->latency_page_read_8 = 0;
+	stats->latency_page_read_9 = 0;
 	stats->bloom_false_positive = 0;
 	stats->bloom_hit = 0;
 	stats->bloom_miss = 0;
@@ -214,6 +341,8 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
 	stats->lsm_checkpoint_throttle = 0;
 	stats->lsm_merge_throttle = 0;
 	stats->bloom_size = 0;
+	stats->lsm_work_units_done = 0;
+	stats->lsm_work_queue_wait = 0;
 	stats->rec_dictionary = 0;
 	stats->rec_page_delete_fast = 0;
 	stats->rec_suffix_compression = 0;
@@ -221,6 +350,7 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
 	stats->rec_overflow_key_internal = 0;
 	stats->rec_prefix_compression = 0;
 	stats->rec_multiblock_leaf = 0;
+	stats->rec_page_delta = 0;
 	stats->rec_overflow_key_leaf = 0;
 	stats->rec_multiblock_max = 0;
 	stats->rec_overflow_value = 0;
@@ -297,6 +427,7 @@ __wt_stat_dsrc_aggregate_single(
 	to->cache_eviction_deepen += from->cache_eviction_deepen;
 	to->cache_write_lookaside += from->cache_write_lookaside;
 	to->cache_read += from->cache_read;
+	to->cache_read_delta += from->cache_read_delta;
 	to->cache_read_lookaside += from->cache_read_lookaside;
 	to->cache_write += from->cache_write;
 	to->cache_write_restore += from->cache_write_restore;
@@ -315,6 +446,7 @@ __wt_stat_dsrc_aggregate_single(
 	to->cursor_update_bytes += from->cursor_update_bytes;
 	to->cursor_insert += from->cursor_insert;
 	to->cursor_next += from->cursor_next;
+	to->cursor_next_batch += from->cursor_next_batch;
 	to->cursor_prev += from->cursor_prev;
 	to->cursor_remove += from->cursor_remove;
 	to->cursor_reset += from->cursor_reset;
@@ -323,6 +455,66 @@ __wt_stat_dsrc_aggregate_single(
 	to->cursor_search_near += from->cursor_search_near;
 	to->cursor_truncate += from->cursor_truncate;
 	to->cursor_update += from->cursor_update;
+	to->latency_cursor_insert_0 += from->latency_cursor_insert_0;
+	to->latency_cursor_insert_1 += from->latency_cursor_insert_1;
+	to->latency_cursor_insert_2 += from->latency_cursor_insert_2;
+	to->latency_cursor_insert_3 += from->latency_cursor_insert_3;
+	to->latency_cursor_insert_4 += from->latency_cursor_insert_4;
+	to->latency_cursor_insert_5 += from->latency_cursor_insert_5;
+	to->latency_cursor_insert_6 += from->latency_cursor_insert_6;
+	to->latency_cursor_insert_7 += from->latency_cursor_insert_7;
+	to->latency_cursor_insert_8 += from->latency_cursor_insert_8;
+	to->latency_cursor_insert_9 += from->latency_cursor_insert_9;
+	to->latency_cursor_remove_0 += from->latency_cursor_remove_0;
+	to->latency_cursor_remove_1 += from->latency_cursor_remove_1;
+	to->latency_cursor_remove_2 += from->latency_cursor_remove_2;
+	to->latency_cursor_remove_3 += from->latency_cursor_remove_3;
+	to->latency_cursor_remove_4 += from->latency_cursor_remove_4;
+	to->latency_cursor_remove_5 += from->latency_cursor_remove_5;
+	to->latency_cursor_remove_6 += from->latency_cursor_remove_6;
+	to->latency_cursor_remove_7 += from->latency_cursor_remove_7;
+	to->latency_cursor_remove_8 += from->latency_cursor_remove_8;
+	to->latency_cursor_remove_9 += from->latency_cursor_remove_9;
+	to->latency_cursor_search_0 += from->latency_cursor_search_0;
+	to->latency_cursor_search_1 += from->latency_cursor_search_1;
+	to->latency_cursor_search_2 += from->latency_cursor_search_2;
+	to->latency_cursor_search_3 += from->latency_cursor_search_3;
+	to->latency_cursor_search_4 += from->latency_cursor_search_4;
+	to->latency_cursor_search_5 += from->latency_cursor_search_5;
+	to->latency_cursor_search_6 += from->latency_cursor_search_6;
+	to->latency_cursor_search_7 += from->latency_cursor_search_7;
+	to->latency_cursor_search_8 += from->latency_cursor_search_8;
+	to->latency_cursor_search_9 += from->latency_cursor_search_9;
+	to->latency_cursor_update_0 += from->latency_cursor_update_0;
+	to->latency_cursor_update_1 += from->latency_cursor_update_1;
+	to->latency_cursor_update_2 += from->latency_cursor_update_2;
+	to->latency_cursor_update_3 += from->latency_cursor_update_3;
+	to->latency_cursor_update_4 += from->latency_cursor_update_4;
+	to->latency_cursor_update_5 += from->latency_cursor_update_5;
+	to->latency_cursor_update_6 += from->latency_cursor_update_6;
+	to->latency_cursor_update_7 += from->latency_cursor_update_7;
+	to->latency_cursor_update_8 += from->latency_cursor_update_8;
+	to->latency_cursor_update_9 += from->latency_cursor_update_9;
+	to->latency_page_wait_0 += from->latency_page_wait_0;
+	to->latency_page_wait_1 += from->latency_page_wait_1;
+	to->latency_page_wait_2 += from->latency_page_wait_2;
+	to->latency_page_wait_3 += from->latency_page_wait_3;
+	to->latency_page_wait_4 += from->latency_page_wait_4;
+	to->latency_page_wait_5 += from->latency_page_wait_5;
+	to->latency_page_wait_6 += from->latency_page_wait_6;
+	to->latency_page_wait_7 += from->latency_page_wait_7;
+	to->latency_page_wait_8 += from->latency_page_wait_8;
+	to->latency_page_wait_9 += from->latency_page_wait_9;
+	to->latency_page_read_0 += from->latency_page_read_0;
+	to->latency_page_read_1 += from->latency_page_read_1;
+	to->latency_page_read_2 += from->latency_page_read_2;
+	to->latency_page_read_3 += from->latency_page_read_3;
+	to->latency_page_read_4 += from->latency_page_read_4;
+	to->latency_page_read_5 += from->latency_page_read_5;
+	to->latency_page_read_6 += from->latency_page_read_6;
+	to->latency_page_read_7 += from->latency_page_read_7;
+	to->latency_page_read_8 += from->latency_page_read_8;
+	to->latency_page_read_9 += from->latency_page_read_9;
 	to->bloom_false_positive += from->bloom_false_positive;
 	to->bloom_hit += from->bloom_hit;
 	to->bloom_miss += from->bloom_miss;
@@ -336,6 +528,8 @@ __wt_stat_dsrc_aggregate_single(
 	to->lsm_checkpoint_throttle += from->lsm_checkpoint_throttle;
 	to->lsm_merge_throttle += from->lsm_merge_throttle;
 	to->bloom_size += from->bloom_size;
+	to->lsm_work_units_done += from->lsm_work_units_done;
+	to->lsm_work_queue_wait += from->lsm_work_queue_wait;
 	to->rec_dictionary += from->rec_dictionary;
 	to->rec_page_delete_fast += from->rec_page_delete_fast;
 	to->rec_suffix_compression += from->rec_suffix_compression;
@@ -343,6 +537,7 @@ __wt_stat_dsrc_aggregate_single(
 	to->rec_overflow_key_internal += from->rec_overflow_key_internal;
 	to->rec_prefix_compression += from->rec_prefix_compression;
 	to->rec_multiblock_leaf += from->rec_multiblock_leaf;
+	to->rec_page_delta += from->rec_page_delta;
 	to->rec_overflow_key_leaf += from->rec_overflow_key_leaf;
 	if (from->rec_multiblock_max > to->rec_multiblock_max)
 		to->rec_multiblock_max = from->rec_multiblock_max;
@@ -431,6 +626,7 @@ __wt_stat_dsrc_aggregate(
 	to->cache_write_lookaside +=
 	    WT_STAT_READ(from, cache_write_lookaside);
 	to->cache_read += WT_STAT_READ(from, cache_read);
+	to->cache_read_delta += WT_STAT_READ(from, cache_read_delta);
 	to->cache_read_lookaside += WT_STAT_READ(from, cache_read_lookaside);
 	to->cache_write += WT_STAT_READ(from, cache_write);
 	to->cache_write_restore += WT_STAT_READ(from, cache_write_restore);
@@ -451,6 +647,7 @@ __wt_stat_dsrc_aggregate(
 	to->cursor_update_bytes += WT_STAT_READ(from, cursor_update_bytes);
 	to->cursor_insert += WT_STAT_READ(from, cursor_insert);
 	to->cursor_next += WT_STAT_READ(from, cursor_next);
+	to->cursor_next_batch += WT_STAT_READ(from, cursor_next_batch);
 	to->cursor_prev += WT_STAT_READ(from, cursor_prev);
 	to->cursor_remove += WT_STAT_READ(from, cursor_remove);
 	to->cursor_reset += WT_STAT_READ(from, cursor_reset);
@@ -459,6 +656,106 @@ __wt_stat_dsrc_aggregate(
 	to->cursor_search_near += WT_STAT_READ(from, cursor_search_near);
 	to->cursor_truncate += WT_STAT_READ(from, cursor_truncate);
 	to->cursor_update += WT_STAT_READ(from, cursor_update);
+	to->latency_cursor_insert_0 +=
+	    WT_STAT_READ(from, latency_cursor_insert_0);
+	to->latency_cursor_insert_1 +=
+	    WT_STAT_READ(from, latency_cursor_insert_1);
+	to->latency_cursor_insert_2 +=
+	    WT_STAT_READ(from, latency_cursor_insert_2);
+	to->latency_cursor_insert_3 +=
+	    WT_STAT_READ(from, latency_cursor_insert_3);
+	to->latency_cursor_insert_4 +=
+	    WT_STAT_READ(from, latency_cursor_insert_4);
+	to->latency_cursor_insert_5 +=
+	    WT_STAT_READ(from, latency_cursor_insert_5);
+	to->latency_cursor_insert_6 +=
+	    WT_STAT_READ(from, latency_cursor_insert_6);
+	to->latency_cursor_insert_7 +=
+	    WT_STAT_READ(from, latency_cursor_insert_7);
+	to->latency_cursor_insert_8 +=
+	    WT_STAT_READ(from, latency_cursor_insert_8);
+	to->latency_cursor_insert_9 +=
+	    WT_STAT_READ(from, latency_cursor_insert_9);
+	to->latency_cursor_remove_0 +=
+	    WT_STAT_READ(from, latency_cursor_remove_0);
+	to->latency_cursor_remove_1 +=
+	    WT_STAT_READ(from, latency_cursor_remove_1);
+	to->latency_cursor_remove_2 +=
+	    WT_STAT_READ(from, latency_cursor_remove_2);
+	to->latency_cursor_remove_3 +=
+	    WT_STAT_READ(from, latency_cursor_remove_3);
+	to->latency_cursor_remove_4 +=
+	    WT_STAT_READ(from, latency_cursor_remove_4);
+	to->latency_cursor_remove_5 +=
+	    WT_STAT_READ(from, latency_cursor_remove_5);
+	to->latency_cursor_remove_6 +=
+	    WT_STAT_READ(from, latency_cursor_remove_6);
+	to->latency_cursor_remove_7 +=
+	    WT_STAT_READ(from, latency_cursor_remove_7);
+	to->latency_cursor_remove_8 +=
+	    WT_STAT_READ(from, latency_cursor_remove_8);
+	to->latency_cursor_remove_9 +=
+	    WT_STAT_READ(from, latency_cursor_remove_9);
+	to->latency_cursor_search_0 +=
+	    WT_STAT_READ(from, latency_cursor_search_0);
+	to->latency_cursor_search_1 +=
+	    WT_STAT_READ(from, latency_cursor_search_1);
+	to->latency_cursor_search_2 +=
+	    WT_STAT_READ(from, latency_cursor_search_2);
+	to->latency_cursor_search_3 +=
+	    WT_STAT_READ(from, latency_cursor_search_3);
+	to->latency_cursor_search_4 +=
+	    WT_STAT_READ(from, latency_cursor_search_4);
+	to->latency_cursor_search_5 +=
+	    WT_STAT_READ(from, latency_cursor_search_5);
+	to->latency_cursor_search_6 +=
+	    WT_STAT_READ(from, latency_cursor_search_6);
+	to->latency_cursor_search_7 +=
+	    WT_STAT_READ(from, latency_cursor_search_7);
+	to->latency_cursor_search_8 +=
+	    WT_STAT_READ(from, latency_cursor_search_8);
+	to->latency_cursor_search_9 +=
+	    WT_STAT_READ(from, latency_cursor_search_9);
+	to->latency_cursor_update_0 +=
+	    WT_STAT_READ(from, latency_cursor_update_0);
+	to->latency_cursor_update_1 +=
+	    WT_STAT_READ(from, latency_cursor_update_1);
+	to->latency_cursor_update_2 +=
+	    WT_STAT_READ(from, latency_cursor_update_2);
+	to->latency_cursor_update_3 +=
+	    WT_STAT_READ(from, latency_cursor_update_3);
+	to->latency_cursor_update_4 +=
+	    WT_STAT_READ(from, latency_cursor_update_4);
+	to->latency_cursor_update_5 +=
+	    WT_STAT_READ(from, latency_cursor_update_5);
+	to->latency_cursor_update_6 +=
+	    WT_STAT_READ(from, latency_cursor_update_6);
+	to->latency_cursor_update_7 +=
+	    WT_STAT_READ(from, latency_cursor_update_7);
+	to->latency_cursor_update_8 +=
+	    WT_STAT_READ(from, latency_cursor_update_8);
+	to->latency_cursor_update_9 +=
+	    WT_STAT_READ(from, latency_cursor_update_9);
+	to->latency_page_wait_0 += WT_STAT_READ(from, latency_page_wait_0);
+	to->latency_page_wait_1 += WT_STAT_READ(from, latency_page_wait_1);
+	to->latency_page_wait_2 += WT_STAT_READ(from, latency_page_wait_2);
+	to->latency_page_wait_3 += WT_STAT_READ(from, latency_page_wait_3);
+	to->latency_page_wait_4 += WT_STAT_READ(from, latency_page_wait_4);
+	to->latency_page_wait_5 += WT_STAT_READ(from, latency_page_wait_5);
+	to->latency_page_wait_6 += WT_STAT_READ(from, latency_page_wait_6);
+	to->latency_page_wait_7 += WT_STAT_READ(from, latency_page_wait_7);
+	to->latency_page_wait_8 += WT_STAT_READ(from, latency_page_wait_8);
+	to->latency_page_wait_9 += WT_STAT_READ(from, latency_page_wait_9);
+	to->latency_page_read_0 += WT_STAT_READ(from, latency_page_read_0);
+	to->latency_page_read_1 += WT_STAT_READ(from, latency_page_read_1);
+	to->latency_page_read_2 += WT_STAT_READ(from, latency_page_read_2);
+	to->latency_page_read_3 += WT_STAT_READ(from, latency_page_read_3);
+	to->latency_page_read_4 += WT_STAT_READ(from, latency_page_read_4);
+	to->latency_page_read_5 += WT_STAT_READ(from, latency_page_read_5);
+	to->latency_page_read_6 += WT_STAT_READ(from, latency_page_read_6);
+	to->latency_page_read_7 += WT_STAT_READ(from, latency_page_read_7);
+	to->latency_page_read_8 += WT_STAT_READ(from, latency_page_read_8);
+	to->latency_page_read_9 += WT_STAT_READ(from, latency_page_read_9);
 	to->bloom_false_positive += WT_STAT_READ(from, bloom_false_positive);
 	to->bloom_hit += WT_STAT_READ(from, bloom_hit);
 	to->bloom_miss += WT_STAT_READ(from, bloom_miss);
@@ -474,6 +771,8 @@ __wt_stat_dsrc_aggregate(
 	    WT_STAT_READ(from, lsm_checkpoint_throttle);
 	to->lsm_merge_throttle += WT_STAT_READ(from, lsm_merge_throttle);
 	to->bloom_size += WT_STAT_READ(from, bloom_size);
+	to->lsm_work_units_done += WT_STAT_READ(from, lsm_work_units_done);
+	to->lsm_work_queue_wait += WT_STAT_READ(from, lsm_work_queue_wait);
 	to->rec_dictionary += WT_STAT_READ(from, rec_dictionary);
 	to->rec_page_delete_fast += WT_STAT_READ(from, rec_page_delete_fast);
 	to->rec_suffix_compression +=
@@ -485,6 +784,7 @@ __wt_stat_dsrc_aggregate(
 	to->rec_prefix_compression +=
 	    WT_STAT_READ(from, rec_prefix_compression);
 	to->rec_multiblock_leaf += WT_STAT_READ(from, rec_multiblock_leaf);
+	to->rec_page_delta += WT_STAT_READ(from, rec_page_delta);
 	to->rec_overflow_key_leaf +=
 	    WT_STAT_READ(from, rec_overflow_key_leaf);
 	if ((v = WT_STAT_READ(from, rec_multiblock_max)) >
@@ -503,9 +803,13 @@ __wt_stat_dsrc_aggregate(
 static const char * const __stats_connection_desc[] = {
 	"async: number of allocation state races",
 	"async: number of operation slots viewed for allocation",
+	"async: number of operations posted to the completion queue",
 	"async: current work queue length",
+	"async: number of completion queue drain calls",
 	"async: number of flush calls",
 	"async: number of times operation allocation failed",
+	"async: operations executed in transactions with other operations",
+	"async: grouped operations retried in separate transactions",
 	"async: maximum work queue length",
 	"async: number of times worker found no work",
 	"async: total allocations",
@@ -514,9 +818,19 @@ static const char * const __stats_connection_desc[] = {
 	"async: total remove calls",
 	"async: total search calls",
 	"async: total update calls",
+	"async: number of batches of work dequeued",
+	"async: number of times worker waited for work",
 	"block-manager: mapped bytes read",
 	"block-manager: bytes read",
 	"block-manager: bytes written",
+	"block-manager: block cache checkpoint writes not cached",
+	"block-manager: block cache read and write errors ignored",
+	"block-manager: block cache blocks found",
+	"block-manager: block cache blocks inserted",
+	"block-manager: block cache blocks overwritten or failing checksum",
+	"block-manager: block cache blocks not found",
+	"block-manager: files compacted by the background compaction server",
+	"block-manager: bytes of pages rewritten by the background compaction server",
 	"block-manager: mapped blocks read",
 	"block-manager: blocks pre-loaded",
 	"block-manager: blocks read",
@@ -529,6 +843,11 @@ static const char * const __stats_connection_desc[] = {
 	"cache: tracked bytes belonging to overflow pages in the cache",
 	"cache: bytes read into cache",
 	"cache: bytes written from cache",
+	"cache: compressed cache bytes held",
+	"cache: compressed cache blocks discarded",
+	"cache: compressed cache blocks found",
+	"cache: compressed cache blocks inserted",
+	"cache: compressed cache blocks not found",
 	"cache: pages evicted by application threads",
 	"cache: checkpoint blocked page eviction",
 	"cache: unmodified pages evicted",
@@ -557,15 +876,24 @@ static const char * const __stats_connection_desc[] = {
 	"cache: percentage overhead",
 	"cache: tracked dirty pages in the cache",
 	"cache: pages currently held in the cache",
+	"cache: shared cache estimated hits from 1 more chunk",
+	"cache: shared cache estimated hits from 2 more chunks",
+	"cache: shared cache estimated hits from 4 more chunks",
+	"cache: shared cache estimated hits from 8 more chunks",
 	"cache: pages read into cache",
+	"cache: pages read into cache from a chain of deltas",
 	"cache: pages read into cache requiring lookaside entries",
+	"cache: pages read into cache by warm-up",
+	"cache: pages recorded for warm-up at close",
 	"cache: pages written from cache",
 	"cache: page written requiring lookaside records",
 	"cache: pages written requiring in-memory restoration",
 	"connection: pthread mutex condition wait calls",
 	"cursor: cursor create calls",
+	"cursor: table cursor records skipped by filters",
 	"cursor: cursor insert calls",
 	"cursor: cursor next calls",
+	"cursor: cursor next_batch calls",
 	"cursor: cursor prev calls",
 	"cursor: cursor remove calls",
 	"cursor: cursor reset calls",
@@ -575,6 +903,7 @@ static const char * const __stats_connection_desc[] = {
 	"cursor: truncate calls",
 	"cursor: cursor update calls",
 	"data-handle: connection data handles currently active",
+	"data-handle: connection data files prefetched at open",
 	"data-handle: session dhandles swept",
 	"data-handle: session sweep attempts",
 	"data-handle: connection sweep dhandles closed",
@@ -583,6 +912,96 @@ static const char * const __stats_connection_desc[] = {
 	"data-handle: connection sweep time-of-death sets",
 	"data-handle: connection sweeps",
 	"connection: files currently open",
+	"latency: cursor insert histogram (bucket 0) - under 10us",
+	"latency: cursor insert histogram (bucket 1) - 10-49us",
+	"latency: cursor insert histogram (bucket 2) - 50-99us",
+	"latency: cursor insert histogram (bucket 3) - 100-499us",
+	"latency: cursor insert histogram (bucket 4) - 500-999us",
+	"latency: cursor insert histogram (bucket 5) - 1-4ms",
+	"latency: cursor insert histogram (bucket 6) - 5-9ms",
+	"latency: cursor insert histogram (bucket 7) - 10-49ms",
+	"latency: cursor insert histogram (bucket 8) - 50-99ms",
+	"latency: cursor insert histogram (bucket 9) - 100ms and over",
+	"latency: cursor remove histogram (bucket 0) - under 10us",
+	"latency: cursor remove histogram (bucket 1) - 10-49us",
+	"latency: cursor remove histogram (bucket 2) - 50-99us",
+	"latency: cursor remove histogram (bucket 3) - 100-499us",
+	"latency: cursor remove histogram (bucket 4) - 500-999us",
+	"latency: cursor remove histogram (bucket 5) - 1-4ms",
+	"latency: cursor remove histogram (bucket 6) - 5-9ms",
+	"latency: cursor remove histogram (bucket 7) - 10-49ms",
+	"latency: cursor remove histogram (bucket 8) - 50-99ms",
+	"latency: cursor remove histogram (bucket 9) - 100ms and over",
+	"latency: cursor search histogram (bucket 0) - under 10us",
+	"latency: cursor search histogram (bucket 1) - 10-49us",
+	"latency: cursor search histogram (bucket 2) - 50-99us",
+	"latency: cursor search histogram (bucket 3) - 100-499us",
+	"latency: cursor search histogram (bucket 4) - 500-999us",
+	"latency: cursor search histogram (bucket 5) - 1-4ms",
+	"latency: cursor search histogram (bucket 6) - 5-9ms",
+	"latency: cursor search histogram (bucket 7) - 10-49ms",
+	"latency: cursor search histogram (bucket 8) - 50-99ms",
+	"latency: cursor search histogram (bucket 9) - 100ms and over",
+	"latency: cursor update histogram (bucket 0) - under 10us",
+	"latency: cursor update histogram (bucket 1) - 10-49us",
+	"latency: cursor update histogram (bucket 2) - 50-99us",
+	"latency: cursor update histogram (bucket 3) - 100-499us",
+	"latency: cursor update histogram (bucket 4) - 500-999us",
+	"latency: cursor update histogram (bucket 5) - 1-4ms",
+	"latency: cursor update histogram (bucket 6) - 5-9ms",
+	"latency: cursor update histogram (bucket 7) - 10-49ms",
+	"latency: cursor update histogram (bucket 8) - 50-99ms",
+	"latency: cursor update histogram (bucket 9) - 100ms and over",
+	"latency: application eviction stall histogram (bucket 0) - under 10us",
+	"latency: application eviction stall histogram (bucket 1) - 10-49us",
+	"latency: application eviction stall histogram (bucket 2) - 50-99us",
+	"latency: application eviction stall histogram (bucket 3) - 100-499us",
+	"latency: application eviction stall histogram (bucket 4) - 500-999us",
+	"latency: application eviction stall histogram (bucket 5) - 1-4ms",
+	"latency: application eviction stall histogram (bucket 6) - 5-9ms",
+	"latency: application eviction stall histogram (bucket 7) - 10-49ms",
+	"latency: application eviction stall histogram (bucket 8) - 50-99ms",
+	"latency: application eviction stall histogram (bucket 9) - 100ms and over",
+	"latency: log sync histogram (bucket 0) - under 10us",
+	"latency: log sync histogram (bucket 1) - 10-49us",
+	"latency: log sync histogram (bucket 2) - 50-99us",
+	"latency: log sync histogram (bucket 3) - 100-499us",
+	"latency: log sync histogram (bucket 4) - 500-999us",
+	"latency: log sync histogram (bucket 5) - 1-4ms",
+	"latency: log sync histogram (bucket 6) - 5-9ms",
+	"latency: log sync histogram (bucket 7) - 10-49ms",
+	"latency: log sync histogram (bucket 8) - 50-99ms",
+	"latency: log sync histogram (bucket 9) - 100ms and over",
+	"latency: page read histogram (bucket 0) - under 10us",
+	"latency: page read histogram (bucket 1) - 10-49us",
+	"latency: page read histogram (bucket 2) - 50-99us",
+	"latency: page read histogram (bucket 3) - 100-499us",
+	"latency: page read histogram (bucket 4) - 500-999us",
+	"latency: page read histogram (bucket 5) - 1-4ms",
+	"latency: page read histogram (bucket 6) - 5-9ms",
+	"latency: page read histogram (bucket 7) - 10-49ms",
+	"latency: page read histogram (bucket 8) - 50-99ms",
+	"latency: page read histogram (bucket 9) - 100ms and over",
+	"latency: page acquire wait histogram (bucket 0) - under 10us",
+	"latency: page acquire wait histogram (bucket 1) - 10-49us",
+	"latency: page acquire wait histogram (bucket 2) - 50-99us",
+	"latency: page acquire wait histogram (bucket 3) - 100-499us",
+	"latency: page acquire wait histogram (bucket 4) - 500-999us",
+	"latency: page acquire wait histogram (bucket 5) - 1-4ms",
+	"latency: page acquire wait histogram (bucket 6) - 5-9ms",
+	"latency: page acquire wait histogram (bucket 7) - 10-49ms",
+	"latency: page acquire wait histogram (bucket 8) - 50-99ms",
+	"latency: page acquire wait histogram (bucket 9) - 100ms and over",
+	"latency: transaction commit histogram (bucket 0) - under 10us",
+	"latency: transaction commit histogram (bucket 1) - 10-49us",
+	"latency: transaction commit histogram (bucket 2) - 50-99us",
+	"latency: transaction commit histogram (bucket 3) - 100-499us",
+	"latency: transaction commit histogram (bucket 4) - 500-999us",
+	"latency: transaction commit histogram (bucket 5) - 1-4ms",
+	"latency: transaction commit histogram (bucket 6) - 5-9ms",
+	"latency: transaction commit histogram (bucket 7) - 10-49ms",
+	"latency: transaction commit histogram (bucket 8) - 50-99ms",
+	"latency: transaction commit histogram (bucket 9) - 100ms and over",
 	"log: total log buffer size",
 	"log: log bytes of payload data",
 	"log: log bytes written",
@@ -622,6 +1041,7 @@ static const char * const __stats_connection_desc[] = {
 	"LSM: merge work units currently queued",
 	"LSM: tree queue hit maximum",
 	"LSM: switch work units currently queued",
+	"LSM: tree maintenance operations time queued (usecs)",
 	"LSM: tree maintenance operations scheduled",
 	"LSM: tree maintenance operations discarded",
 	"LSM: tree maintenance operations executed",
@@ -636,10 +1056,13 @@ static const char * const __stats_connection_desc[] = {
 	"connection: total read I/Os",
 	"reconciliation: pages deleted",
 	"reconciliation: fast-path pages deleted",
+	"reconciliation: leaf pages written as deltas",
 	"reconciliation: page reconciliation calls",
 	"reconciliation: page reconciliation calls for eviction",
 	"reconciliation: split bytes currently awaiting free",
 	"reconciliation: split objects currently awaiting free",
+	"reconciliation: page images written by the write pool",
+	"reconciliation: write pool page images written by the reconciling thread",
 	"connection: pthread mutex shared lock read-lock calls",
 	"connection: pthread mutex shared lock write-lock calls",
 	"session: open cursor count",
@@ -693,29 +1116,48 @@ void
 __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
 {
 	stats->async_cur_queue = 0;
+	stats->async_group_retry = 0;
 		/* not clearing async_max_queue */
 	stats->async_alloc_race = 0;
+	stats->async_worker_batch = 0;
+	stats->async_drain = 0;
 	stats->async_flush = 0;
 	stats->async_alloc_view = 0;
+	stats->async_complete = 0;
 	stats->async_full = 0;
 	stats->async_nowork = 0;
+	stats->async_worker_wait = 0;
+	stats->async_group_ops = 0;
 	stats->async_op_alloc = 0;
 	stats->async_op_compact = 0;
 	stats->async_op_insert = 0;
 	stats->async_op_remove = 0;
 	stats->async_op_search = 0;
 	stats->async_op_update = 0;
+	stats->block_cache_hit = 0;
+	stats->block_cache_insert = 0;
+	stats->block_cache_miss = 0;
+	stats->block_cache_invalid = 0;
+	stats->block_cache_bypass = 0;
+	stats->block_cache_error = 0;
 	stats->block_preload = 0;
 	stats->block_read = 0;
 	stats->block_write = 0;
+	stats->block_compact_server_rewrite = 0;
 	stats->block_byte_read = 0;
 	stats->block_byte_write = 0;
+	stats->block_compact_server_files = 0;
 	stats->block_map_read = 0;
 	stats->block_byte_map_read = 0;
 		/* not clearing cache_bytes_inuse */
 	stats->cache_bytes_read = 0;
 	stats->cache_bytes_write = 0;
 	stats->cache_eviction_checkpoint = 0;
+	stats->cache_compressed_evict = 0;
+	stats->cache_compressed_hit = 0;
+	stats->cache_compressed_insert = 0;
+	stats->cache_compressed_miss = 0;
+		/* not clearing cache_compressed_bytes */
 	stats->cache_eviction_queue_empty = 0;
 	stats->cache_eviction_queue_not_empty = 0;
 	stats->cache_eviction_server_evicting = 0;
@@ -741,12 +1183,19 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
 	stats->cache_eviction_force_delete = 0;
 	stats->cache_eviction_app = 0;
 	stats->cache_read = 0;
+	stats->cache_warmup_read = 0;
+	stats->cache_read_delta = 0;
 	stats->cache_read_lookaside = 0;
+	stats->cache_warmup_recorded = 0;
 	stats->cache_eviction_fail = 0;
 	stats->cache_eviction_walk = 0;
 	stats->cache_write = 0;
 	stats->cache_write_restore = 0;
 		/* not clearing cache_overhead */
+	stats->cache_pool_chunk1 = 0;
+	stats->cache_pool_chunk2 = 0;
+	stats->cache_pool_chunk4 = 0;
+	stats->cache_pool_chunk8 = 0;
 		/* not clearing cache_bytes_internal */
 		/* not clearing cache_bytes_leaf */
 		/* not clearing cache_bytes_overflow */
@@ -765,6 +1214,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
 	stats->cursor_create = 0;
 	stats->cursor_insert = 0;
 	stats->cursor_next = 0;
+	stats->cursor_next_batch = 0;
 	stats->cursor_prev = 0;
 	stats->cursor_remove = 0;
 	stats->cursor_reset = 0;
@@ -772,7 +1222,9 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
 	stats->cursor_search = 0;
 	stats->cursor_search_near = 0;
 	stats->cursor_update = 0;
+	stats->cursor_filter_skip = 0;
 	stats->cursor_truncate = 0;
+	stats->dh_open_prefetch = 0;
 		/* not clearing dh_conn_handle_count */
 	stats->dh_sweep_ref = 0;
 	stats->dh_sweep_close = 0;
@@ -781,6 +1233,96 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
 	stats->dh_sweeps = 0;
 	stats->dh_session_handles = 0;
 	stats->dh_session_sweeps = 0;
+	stats->latency_evict_stall_0 = 0;
+	stats->latency_evict_stall_1 = 0;
+	stats->latency_evict_stall_2 = 0;
+	stats->latency_evict_stall_3 = 0;
+	stats->latency_evict_stall_4 = 0;
+	stats->latency_evict_stall_5 = 0;
+	stats->latency_evict_stall_6 = 0;
+	stats->latency_evict_stall_7 = 0;
+	stats->latency_evict_stall_8 = 0;
+	stats->latency_evict_stall_9 = 0;
+	stats->latency_cursor_insert_0 = 0;
+	stats->latency_cursor_insert_1 = 0;
+	stats->latency_cursor_insert_2 = 0;
+	stats->latency_cursor_insert_3 = 0;
+	stats->latency_cursor_insert_4 = 0;
+	stats->latency_cursor_insert_5 = 0;
+	stats->latency_cursor_insert_6 = 0;
+	stats->latency_cursor_insert_7 = 0;
+	stats->latency_cursor_insert_8 = 0;
+	stats->latency_cursor_insert_9 = 0;
+	stats->latency_cursor_remove_0 = 0;
+	stats->latency_cursor_remove_1 = 0;
+	stats->latency_cursor_remove_2 = 0;
+	stats->latency_cursor_remove_3 = 0;
+	stats->latency_cursor_remove_4 = 0;
+	stats->latency_cursor_remove_5 = 0;
+	stats->latency_cursor_remove_6 = 0;
+	stats->latency_cursor_remove_7 = 0;
+	stats->latency_cursor_remove_8 = 0;
+	stats->latency_cursor_remove_9 = 0;
+	stats->latency_cursor_search_0 = 0;
+	stats->latency_cursor_search_1 = 0;
+	stats->latency_cursor_search_2 = 0;
+	stats->latency_cursor_search_3 = 0;
+	stats->latency_cursor_search_4 = 0;
+	stats->latency_cursor_search_5 = 0;
+	stats->latency_cursor_search_6 = 0;
+	stats->latency_cursor_search_7 = 0;
+	stats->latency_cursor_search_8 = 0;
+	stats->latency_cursor_search_9 = 0;
+	stats->latency_cursor_update_0 = 0;
+	stats->latency_cursor_update_1 = 0;
+	stats->latency_cursor_update_2 = 0;
+	stats->latency_cursor_update_3 = 0;
+	stats->latency_cursor_update_4 = 0;
+	stats->latency_cursor_update_5 = 0;
+	stats->latency_cursor_update_6 = 0;
+	stats->latency_cursor_update_7 = 0;
+	stats->latency_cursor_update_8 = 0;
+	stats->latency_cursor_update_9 = 0;
+	stats->latency_log_sync_0 = 0;
+	stats->latency_log_sync_1 = 0;
+	stats->latency_log_sync_2 = 0;
+	stats->latency_log_sync_3 = 0;
+	stats->latency_log_sync_4 = 0;
+	stats->latency_log_sync_5 = 0;
+	stats->latency_log_sync_6 = 0;
+	stats->latency_log_sync_7 = 0;
+	stats->latency_log_sync_8 = 0;
+	stats->latency_log_sync_9 = 0;
+	stats->latency_page_wait_0 = 0;
+	stats->latency_page_wait_1 = 0;
+	stats->latency_page_wait_2 = 0;
+	stats->latency_page_wait_3 = 0;
+	stats->latency_page_wait_4 = 0;
+	stats->latency_page_wait_5 = 0;
+	stats->latency_page_wait_6 = 0;
+	stats->latency_page_wait_7 = 0;
+	stats->latency_page_wait_8 = 0;
+	stats->latency_page_wait_9 = 0;
+	stats->latency_page_read_0 = 0;
+	stats->latency_page_read_1 = 0;
+	stats->latency_page_read_2 = 0;
+	stats->latency_page_read_3 = 0;
+	stats->latency_page_read_4 = 0;
+	stats->latency_page_read_5 = 0;
+	stats->latency_page_read_6 = 0;
+	stats->latency_page_read_7 = 0;
+	stats->latency_page_read_8 = 0;
+	stats->latency_page_read_9 = 0;
+	stats->latency_txn_commit_0 = 0;
+	stats->latency_txn_commit_1 = 0;
+	stats->latency_txn_commit_2 = 0;
+	stats->latency_txn_commit_3 = 0;
+	stats->latency_txn_commit_4 = 0;
+	stats->latency_txn_commit_5 = 0;
+	stats->latency_txn_commit_6 = 0;
+	stats->latency_txn_commit_7 = 0;
+	stats->latency_txn_commit_8 = 0;
+	stats->latency_txn_commit_9 = 0;
 	stats->log_slot_switch_busy = 0;
 	stats->log_slot_closes = 0;
 	stats->log_slot_races = 0;
@@ -822,13 +1364,17 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
 	stats->lsm_work_units_discarded = 0;
 	stats->lsm_work_units_done = 0;
 	stats->lsm_work_units_created = 0;
+	stats->lsm_work_queue_wait = 0;
 	stats->lsm_work_queue_max = 0;
 	stats->rec_page_delete_fast = 0;
+	stats->rec_page_delta = 0;
+	stats->rec_write_pool = 0;
 	stats->rec_pages = 0;
 	stats->rec_pages_eviction = 0;
 	stats->rec_page_delete = 0;
 		/* not clearing rec_split_stashed_bytes */
 		/* not clearing rec_split_stashed_objects */
+	stats->rec_write_pool_inline = 0;
 		/* not clearing session_cursor_open */
 		/* not clearing session_open */
 	stats->page_busy_blocked = 0;
@@ -869,23 +1415,39 @@ __wt_stat_connection_aggregate(
     WT_CONNECTION_STATS **from, WT_CONNECTION_STATS *to)
 {
 	to->async_cur_queue += WT_STAT_READ(from, async_cur_queue);
+	to->async_group_retry += WT_STAT_READ(from, async_group_retry);
 	to->async_max_queue += WT_STAT_READ(from, async_max_queue);
 	to->async_alloc_race += WT_STAT_READ(from, async_alloc_race);
+	to->async_worker_batch += WT_STAT_READ(from, async_worker_batch);
+	to->async_drain += WT_STAT_READ(from, async_drain);
 	to->async_flush += WT_STAT_READ(from, async_flush);
 	to->async_alloc_view += WT_STAT_READ(from, async_alloc_view);
+	to->async_complete += WT_STAT_READ(from, async_complete);
 	to->async_full += WT_STAT_READ(from, async_full);
 	to->async_nowork += WT_STAT_READ(from, async_nowork);
+	to->async_worker_wait += WT_STAT_READ(from, async_worker_wait);
+	to->async_group_ops += WT_STAT_READ(from, async_group_ops);
 	to->async_op_alloc += WT_STAT_READ(from, async_op_alloc);
 	to->async_op_compact += WT_STAT_READ(from, async_op_compact);
 	to->async_op_insert += WT_STAT_READ(from, async_op_insert);
 	to->async_op_remove += WT_STAT_READ(from, async_op_remove);
 	to->async_op_search += WT_STAT_READ(from, async_op_search);
 	to->async_op_update += WT_STAT_READ(from, async_op_update);
+	to->block_cache_hit += WT_STAT_READ(from, block_cache_hit);
+	to->block_cache_insert += WT_STAT_READ(from, block_cache_insert);
+	to->block_cache_miss += WT_STAT_READ(from, block_cache_miss);
+	to->block_cache_invalid += WT_STAT_READ(from, block_cache_invalid);
+	to->block_cache_bypass += WT_STAT_READ(from, block_cache_bypass);
+	to->block_cache_error += WT_STAT_READ(from, block_cache_error);
 	to->block_preload += WT_STAT_READ(from, block_preload);
 	to->block_read += WT_STAT_READ(from, block_read);
 	to->block_write += WT_STAT_READ(from, block_write);
+	to->block_compact_server_rewrite +=
+	    WT_STAT_READ(from, block_compact_server_rewrite);
 	to->block_byte_read += WT_STAT_READ(from, block_byte_read);
 	to->block_byte_write += WT_STAT_READ(from, block_byte_write);
+	to->block_compact_server_files +=
+	    WT_STAT_READ(from, block_compact_server_files);
 	to->block_map_read += WT_STAT_READ(from, block_map_read);
 	to->block_byte_map_read += WT_STAT_READ(from, block_byte_map_read);
 	to->cache_bytes_inuse += WT_STAT_READ(from, cache_bytes_inuse);
@@ -893,6 +1455,15 @@ __wt_stat_connection_aggregate(
 	to->cache_bytes_write += WT_STAT_READ(from, cache_bytes_write);
 	to->cache_eviction_checkpoint +=
 	    WT_STAT_READ(from, cache_eviction_checkpoint);
+	to->cache_compressed_evict +=
+	    WT_STAT_READ(from, cache_compressed_evict);
+	to->cache_compressed_hit += WT_STAT_READ(from, cache_compressed_hit);
+	to->cache_compressed_insert +=
+	    WT_STAT_READ(from, cache_compressed_insert);
+	to->cache_compressed_miss +=
+	    WT_STAT_READ(from, cache_compressed_miss);
+	to->cache_compressed_bytes +=
+	    WT_STAT_READ(from, cache_compressed_bytes);
 	to->cache_eviction_queue_empty +=
 	    WT_STAT_READ(from, cache_eviction_queue_empty);
 	to->cache_eviction_queue_not_empty +=
@@ -935,12 +1506,20 @@ __wt_stat_connection_aggregate(
 	    WT_STAT_READ(from, cache_eviction_force_delete);
 	to->cache_eviction_app += WT_STAT_READ(from, cache_eviction_app);
 	to->cache_read += WT_STAT_READ(from, cache_read);
+	to->cache_warmup_read += WT_STAT_READ(from, cache_warmup_read);
+	to->cache_read_delta += WT_STAT_READ(from, cache_read_delta);
 	to->cache_read_lookaside += WT_STAT_READ(from, cache_read_lookaside);
+	to->cache_warmup_recorded +=
+	    WT_STAT_READ(from, cache_warmup_recorded);
 	to->cache_eviction_fail += WT_STAT_READ(from, cache_eviction_fail);
 	to->cache_eviction_walk += WT_STAT_READ(from, cache_eviction_walk);
 	to->cache_write += WT_STAT_READ(from, cache_write);
 	to->cache_write_restore += WT_STAT_READ(from, cache_write_restore);
 	to->cache_overhead += WT_STAT_READ(from, cache_overhead);
+	to->cache_pool_chunk1 += WT_STAT_READ(from, cache_pool_chunk1);
+	to->cache_pool_chunk2 += WT_STAT_READ(from, cache_pool_chunk2);
+	to->cache_pool_chunk4 += WT_STAT_READ(from, cache_pool_chunk4);
+	to->cache_pool_chunk8 += WT_STAT_READ(from, cache_pool_chunk8);
 	to->cache_bytes_internal += WT_STAT_READ(from, cache_bytes_internal);
 	to->cache_bytes_leaf += WT_STAT_READ(from, cache_bytes_leaf);
 	to->cache_bytes_overflow += WT_STAT_READ(from, cache_bytes_overflow);
@@ -959,6 +1538,7 @@ __wt_stat_connection_aggregate(
 	to->cursor_create += WT_STAT_READ(from, cursor_create);
 	to->cursor_insert += WT_STAT_READ(from, cursor_insert);
 	to->cursor_next += WT_STAT_READ(from, cursor_next);
+	to->cursor_next_batch += WT_STAT_READ(from, cursor_next_batch);
 	to->cursor_prev += WT_STAT_READ(from, cursor_prev);
 	to->cursor_remove += WT_STAT_READ(from, cursor_remove);
 	to->cursor_reset += WT_STAT_READ(from, cursor_reset);
@@ -966,7 +1546,9 @@ __wt_stat_connection_aggregate(
 	to->cursor_search += WT_STAT_READ(from, cursor_search);
 	to->cursor_search_near += WT_STAT_READ(from, cursor_search_near);
 	to->cursor_update += WT_STAT_READ(from, cursor_update);
+	to->cursor_filter_skip += WT_STAT_READ(from, cursor_filter_skip);
 	to->cursor_truncate += WT_STAT_READ(from, cursor_truncate);
+	to->dh_open_prefetch += WT_STAT_READ(from, dh_open_prefetch);
 	to->dh_conn_handle_count += WT_STAT_READ(from, dh_conn_handle_count);
 	to->dh_sweep_ref += WT_STAT_READ(from, dh_sweep_ref);
 	to->dh_sweep_close += WT_STAT_READ(from, dh_sweep_close);
@@ -975,6 +1557,146 @@ __wt_stat_connection_aggregate(
 	to->dh_sweeps += WT_STAT_READ(from, dh_sweeps);
 	to->dh_session_handles += WT_STAT_READ(from, dh_session_handles);
 	to->dh_session_sweeps += WT_STAT_READ(from, dh_session_sweeps);
+	to->latency_evict_stall_0 +=
+	    WT_STAT_READ(from, latency_evict_stall_0);
+	to->latency_evict_stall_1 +=
+	    WT_STAT_READ(from, latency_evict_stall_1);
+	to->latency_evict_stall_2 +=
+	    WT_STAT_READ(from, latency_evict_stall_2);
+	to->latency_evict_stall_3 +=
+	    WT_STAT_READ(from, latency_evict_stall_3);
+	to->latency_evict_stall_4 +=
+	    WT_STAT_READ(from, latency_evict_stall_4);
+	to->latency_evict_stall_5 +=
+	    WT_STAT_READ(from, latency_evict_stall_5);
+	to->latency_evict_stall_6 +=
+	    WT_STAT_READ(from, latency_evict_stall_6);
+	to->latency_evict_stall_7 +=
+	    WT_STAT_READ(from, latency_evict_stall_7);
+	to->latency_evict_stall_8 +=
+	    WT_STAT_READ(from, latency_evict_stall_8);
+	to->latency_evict_stall_9 +=
+	    WT_STAT_READ(from, latency_evict_stall_9);
+	to->latency_cursor_insert_0 +=
+	    WT_STAT_READ(from, latency_cursor_insert_0);
+	to->latency_cursor_insert_1 +=
+	    WT_STAT_READ(from, latency_cursor_insert_1);
+	to->latency_cursor_insert_2 +=
+	    WT_STAT_READ(from, latency_cursor_insert_2);
+	to->latency_cursor_insert_3 +=
+	    WT_STAT_READ(from, latency_cursor_insert_3);
+	to->latency_cursor_insert_4 +=
+	    WT_STAT_READ(from, latency_cursor_insert_4);
+	to->latency_cursor_insert_5 +=
+	    WT_STAT_READ(from, latency_cursor_insert_5);
+	to->latency_cursor_insert_6 +=
+	    WT_STAT_READ(from, latency_cursor_insert_6);
+	to->latency_cursor_insert_7 +=
+	    WT_STAT_READ(from, latency_cursor_insert_7);
+	to->latency_cursor_insert_8 +=
+	    WT_STAT_READ(from, latency_cursor_insert_8);
+	to->latency_cursor_insert_9 +=
+	    WT_STAT_READ(from, latency_cursor_insert_9);
+	to->latency_cursor_remove_0 +=
+	    WT_STAT_READ(from, latency_cursor_remove_0);
+	to->latency_cursor_remove_1 +=
+	    WT_STAT_READ(from, latency_cursor_remove_1);
+	to->latency_cursor_remove_2 +=
+	    WT_STAT_READ(from, latency_cursor_remove_2);
+	to->latency_cursor_remove_3 +=
+	    WT_STAT_READ(from, latency_cursor_remove_3);
+	to->latency_cursor_remove_4 +=
+	    WT_STAT_READ(from, latency_cursor_remove_4);
+	to->latency_cursor_remove_5 +=
+	    WT_STAT_READ(from, latency_cursor_remove_5);
+	to->latency_cursor_remove_6 +=
+	    WT_STAT_READ(from, latency_cursor_remove_6);
+	to->latency_cursor_remove_7 +=
+	    WT_STAT_READ(from, latency_cursor_remove_7);
+	to->latency_cursor_remove_8 +=
+	    WT_STAT_READ(from, latency_cursor_remove_8);
+	to->latency_cursor_remove_9 +=
+	    WT_STAT_READ(from, latency_cursor_remove_9);
+	to->latency_cursor_search_0 +=
+	    WT_STAT_READ(from, latency_cursor_search_0);
+	to->latency_cursor_search_1 +=
+	    WT_STAT_READ(from, latency_cursor_search_1);
+	to->latency_cursor_search_2 +=
+	    WT_STAT_READ(from, latency_cursor_search_2);
+	to->latency_cursor_search_3 +=
+	    WT_STAT_READ(from, latency_cursor_search_3);
+	to->latency_cursor_search_4 +=
+	    WT_STAT_READ(from, latency_cursor_search_4);
+	to->latency_cursor_search_5 +=
+	    WT_STAT_READ(from, latency_cursor_search_5);
+	to->latency_cursor_search_6 +=
+	    WT_STAT_READ(from, latency_cursor_search_6);
+	to->latency_cursor_search_7 +=
+	    WT_STAT_READ(from, latency_cursor_search_7);
+	to->latency_cursor_search_8 +=
+	    WT_STAT_READ(from, latency_cursor_search_8);
+	to->latency_cursor_search_9 +=
+	    WT_STAT_READ(from, latency_cursor_search_9);
+	to->latency_cursor_update_0 +=
+	    WT_STAT_READ(from, latency_cursor_update_0);
+	to->latency_cursor_update_1 +=
+	    WT_STAT_READ(from, latency_cursor_update_1);
+	to->latency_cursor_update_2 +=
+	    WT_STAT_READ(from, latency_cursor_update_2);
+	to->latency_cursor_update_3 +=
+	    WT_STAT_READ(from, latency_cursor_update_3);
+	to->latency_cursor_update_4 +=
+	    WT_STAT_READ(from, latency_cursor_update_4);
+	to->latency_cursor_update_5 +=
+	    WT_STAT_READ(from, latency_cursor_update_5);
+	to->latency_cursor_update_6 +=
+	    WT_STAT_READ(from, latency_cursor_update_6);
+	to->latency_cursor_update_7 +=
+	    WT_STAT_READ(from, latency_cursor_update_7);
+	to->latency_cursor_update_8 +=
+	    WT_STAT_READ(from, latency_cursor_update_8);
+	to->latency_cursor_update_9 +=
+	    WT_STAT_READ(from, latency_cursor_update_9);
+	to->latency_log_sync_0 += WT_STAT_READ(from, latency_log_sync_0);
+	to->latency_log_sync_1 += WT_STAT_READ(from, latency_log_sync_1);
+	to->latency_log_sync_2 += WT_STAT_READ(from, latency_log_sync_2);
+	to->latency_log_sync_3 += WT_STAT_READ(from, latency_log_sync_3);
+	to->latency_log_sync_4 += WT_STAT_READ(from, latency_log_sync_4);
+	to->latency_log_sync_5 += WT_STAT_READ(from, latency_log_sync_5);
+	to->latency_log_sync_6 += WT_STAT_READ(from, latency_log_sync_6);
+	to->latency_log_sync_7 += WT_STAT_READ(from, latency_log_sync_7);
+	to->latency_log_sync_8 += WT_STAT_READ(from, latency_log_sync_8);
+	to->latency_log_sync_9 += WT_STAT_READ(from, latency_log_sync_9);
+	to->latency_page_wait_0 += WT_STAT_READ(from, latency_page_wait_0);
+	to->latency_page_wait_1 += WT_STAT_READ(from, latency_page_wait_1);
+	to->latency_page_wait_2 += WT_STAT_READ(from, latency_page_wait_2);
+	to->latency_page_wait_3 += WT_STAT_READ(from, latency_page_wait_3);
+	to->latency_page_wait_4 += WT_STAT_READ(from, latency_page_wait_4);
+	to->latency_page_wait_5 += WT_STAT_READ(from, latency_page_wait_5);
+	to->latency_page_wait_6 += WT_STAT_READ(from, latency_page_wait_6);
+	to->latency_page_wait_7 += WT_STAT_READ(from, latency_page_wait_7);
+	to->latency_page_wait_8 += WT_STAT_READ(from, latency_page_wait_8);
+	to->latency_page_wait_9 += WT_STAT_READ(from, latency_page_wait_9);
+	to->latency_page_read_0 += WT_STAT_READ(from, latency_page_read_0);
+	to->latency_page_read_1 += WT_STAT_READ(from, latency_page_read_1);
+	to->latency_page_read_2 += WT_STAT_READ(from, latency_page_read_2);
+	to->latency_page_read_3 += WT_STAT_READ(from, latency_page_read_3);
+	to->latency_page_read_4 += WT_STAT_READ(from, latency_page_read_4);
+	to->latency_page_read_5 += WT_STAT_READ(from, latency_page_read_5);
+	to->latency_page_read_6 += WT_STAT_READ(from, latency_page_read_6);
+	to->latency_page_read_7 += WT_STAT_READ(from, latency_page_read_7);
+	to->latency_page_read_8 += WT_STAT_READ(from, latency_page_read_8);
+	to->latency_page_read_9 += WT_STAT_READ(from, latency_page_read_9);
+	to->latency_txn_commit_0 += WT_STAT_READ(from, latency_txn_commit_0);
+	to->latency_txn_commit_1 += WT_STAT_READ(from, latency_txn_commit_1);
+	to->latency_txn_commit_2 += WT_STAT_READ(from, latency_txn_commit_2);
+	to->latency_txn_commit_3 += WT_STAT_READ(from, latency_txn_commit_3);
+	to->latency_txn_commit_4 += WT_STAT_READ(from, latency_txn_commit_4);
+	to->latency_txn_commit_5 += WT_STAT_READ(from, latency_txn_commit_5);
+	to->latency_txn_commit_6 += WT_STAT_READ(from, latency_txn_commit_6);
+	to->latency_txn_commit_7 += WT_STAT_READ(from, latency_txn_commit_7);
+	to->latency_txn_commit_8 += WT_STAT_READ(from, latency_txn_commit_8);
+	to->latency_txn_commit_9 += WT_STAT_READ(from, latency_txn_commit_9);
 	to->log_slot_switch_busy += WT_STAT_READ(from, log_slot_switch_busy);
 	to->log_slot_closes += WT_STAT_READ(from, log_slot_closes);
 	to->log_slot_races += WT_STAT_READ(from, log_slot_races);
@@ -1024,8 +1746,11 @@ __wt_stat_connection_aggregate(
 	to->lsm_work_units_done += WT_STAT_READ(from, lsm_work_units_done);
 	to->lsm_work_units_created +=
 	    WT_STAT_READ(from, lsm_work_units_created);
+	to->lsm_work_queue_wait += WT_STAT_READ(from, lsm_work_queue_wait);
 	to->lsm_work_queue_max += WT_STAT_READ(from, lsm_work_queue_max);
 	to->rec_page_delete_fast += WT_STAT_READ(from, rec_page_delete_fast);
+	to->rec_page_delta += WT_STAT_READ(from, rec_page_delta);
+	to->rec_write_pool += WT_STAT_READ(from, rec_write_pool);
 	to->rec_pages += WT_STAT_READ(from, rec_pages);
 	to->rec_pages_eviction += WT_STAT_READ(from, rec_pages_eviction);
 	to->rec_page_delete += WT_STAT_READ(from, rec_page_delete);
@@ -1033,6 +1758,8 @@ __wt_stat_connection_aggregate(
 	    WT_STAT_READ(from, rec_split_stashed_bytes);
 	to->rec_split_stashed_objects +=
 	    WT_STAT_READ(from, rec_split_stashed_objects);
+	to->rec_write_pool_inline +=
+	    WT_STAT_READ(from, rec_write_pool_inline);
 	to->session_cursor_open += WT_STAT_READ(from, session_cursor_open);
 	to->session_open += WT_STAT_READ(from, session_open);
 	to->page_busy_blocked += WT_STAT_READ(from, page_busy_blocked);
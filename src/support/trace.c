@@ -0,0 +1,482 @@
+/*-
+ * Copyright (c) 2014-2015 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * Trace event names and argument descriptions, indexed by event type; stop
+ * events reference their start event so the decoder can report durations.
+ */
+static const struct {
+	const char *name;		/* Event name */
+	const char *arg;		/* Argument description, or NULL */
+	int start;			/* Matching start event, or -1 */
+} __trace_events[WT_TRACE_EVENT_MAX] = {
+	{ "checkpoint start",		NULL,			-1 },
+	{ "checkpoint write leaves",	NULL,			-1 },
+	{ "checkpoint trees",		NULL,			-1 },
+	{ "checkpoint sync",		NULL,			-1 },
+	{ "checkpoint metadata",	NULL,			-1 },
+	{ "checkpoint stop",		"error",
+	    WT_TRACE_CKPT_START },
+	{ "evict start",		"page bytes",		-1 },
+	{ "evict stop",			"error",
+	    WT_TRACE_EVICT_START },
+	{ "evict stall start",		"cache percent full",	-1 },
+	{ "evict stall stop",		"error",
+	    WT_TRACE_EVICT_STALL_START },
+	{ "log slot join",		"bytes",		-1 },
+	{ "log slot new",		NULL,			-1 },
+	{ "log slot release",		"bytes",		-1 },
+	{ "log slot switch start",	"forced",		-1 },
+	{ "log slot switch stop",	"error",
+	    WT_TRACE_LOG_SLOT_SWITCH_START },
+	{ "log sync start",		NULL,			-1 },
+	{ "log sync stop",		"error",
+	    WT_TRACE_LOG_SYNC_START },
+	{ "page read start",		NULL,			-1 },
+	{ "page read stop",		"error",
+	    WT_TRACE_PAGE_READ_START },
+	{ "page wait",			"wait count",		-1 },
+	{ "reconcile start",		"page bytes",		-1 },
+	{ "reconcile stop",		"error",
+	    WT_TRACE_REC_START },
+	{ "slow operation",		"usecs",		-1 },
+	{ "split insert start",		"page bytes",		-1 },
+	{ "split insert stop",		"error",
+	    WT_TRACE_SPLIT_INSERT_START },
+	{ "split multi start",		"page bytes",		-1 },
+	{ "split multi stop",		"error",
+	    WT_TRACE_SPLIT_MULTI_START },
+	{ "split reverse start",	NULL,			-1 },
+	{ "split reverse stop",		"error",
+	    WT_TRACE_SPLIT_REVERSE_START },
+	{ "split rewrite start",	"page bytes",		-1 },
+	{ "split rewrite stop",		"error",
+	    WT_TRACE_SPLIT_REWRITE_START },
+};
+
+/*
+ * __wt_trace_config --
+ *	Configure event tracing.
+ */
+int
+__wt_trace_config(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_CONFIG_ITEM cval;
+	WT_CONNECTION_IMPL *conn;
+	uint32_t entries;
+
+	conn = S2C(session);
+
+	WT_RET(__wt_config_gets(session, cfg, "trace.path", &cval));
+	WT_RET(__wt_strndup(session, cval.str, cval.len, &conn->trace_path));
+
+	WT_RET(__wt_config_gets(session, cfg, "trace.slow_threshold", &cval));
+	conn->trace_slow = (uint64_t)cval.val * WT_THOUSAND;
+
+	/* Ring buffer slots are found by masking, round up to a power-of-2. */
+	WT_RET(__wt_config_gets(session, cfg, "trace.entries", &cval));
+	entries = (uint32_t)cval.val;
+	if (entries != 0 && !__wt_ispo2(entries))
+		entries = 1U << (__wt_log2_int(entries) + 1);
+	conn->trace_entries = entries;
+
+	return (0);
+}
+
+/*
+ * __wt_trace_alloc --
+ *	Allocate a session's trace ring buffer.
+ */
+int
+__wt_trace_alloc(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+
+	/*
+	 * Only sessions in the connection's session array are dumped and have
+	 * their ring buffers discarded, don't trace the dummy session.
+	 */
+	if (session == &conn->dummy_session)
+		return (WT_NOTFOUND);
+
+	return (__wt_calloc_def(session, conn->trace_entries, &session->trace));
+}
+
+/*
+ * __trace_dump --
+ *	Write the sessions' ring buffers to a new trace dump file.
+ */
+static int
+__trace_dump(WT_SESSION_IMPL *session, uint64_t slow_usecs)
+{
+	struct timespec ts;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_ITEM(buf);
+	WT_DECL_ITEM(name);
+	WT_DECL_RET;
+	WT_FH *fh;
+	WT_SESSION_IMPL *s;
+	WT_TRACE_FILE_HDR *hdr;
+	WT_TRACE_REC *rec;
+	WT_TRACE_SESSION_HDR *shdr;
+	uint64_t count, next;
+	uint32_t entries, i;
+	bool exist;
+
+	conn = S2C(session);
+	entries = conn->trace_entries;
+	fh = NULL;
+
+	WT_RET(__wt_scr_alloc(session, 0, &buf));
+	WT_ERR(__wt_scr_alloc(session, 0, &name));
+
+	WT_ERR(__wt_epoch(session, &ts));
+	WT_ERR(__wt_buf_initsize(session, buf, sizeof(WT_TRACE_FILE_HDR)));
+	hdr = buf->mem;
+	hdr->magic = WT_TRACE_MAGIC;
+	hdr->version = WT_TRACE_VERSION;
+	hdr->entries = entries;
+	hdr->sessions = 0;
+	hdr->ts = (uint64_t)ts.tv_sec * WT_BILLION + (uint64_t)ts.tv_nsec;
+	hdr->slow_usecs = slow_usecs;
+
+	/*
+	 * Copy each session's events, oldest first.  The session's thread may
+	 * be adding events while we copy, the oldest events we copy can be
+	 * overwritten: that's acceptable, the dump is a diagnostic.
+	 */
+	for (s = conn->sessions, i = 0; i < conn->session_size; ++s, ++i) {
+		if (s->trace == NULL)
+			continue;
+		WT_ORDERED_READ(next, s->trace_next);
+		if ((count = WT_MIN(next, entries)) == 0)
+			continue;
+
+		WT_ERR(__wt_buf_extend(session, buf, buf->size +
+		    sizeof(WT_TRACE_SESSION_HDR) +
+		    count * sizeof(WT_TRACE_REC)));
+		shdr = (WT_TRACE_SESSION_HDR *)
+		    ((uint8_t *)buf->mem + buf->size);
+		shdr->id = s->id;
+		shdr->count = (uint32_t)count;
+		rec = (WT_TRACE_REC *)(shdr + 1);
+		for (next -= count; count > 0; --count, ++next)
+			*rec++ = s->trace[next & (entries - 1)];
+		buf->size = WT_PTRDIFF(rec, buf->mem);
+
+		hdr = buf->mem;
+		++hdr->sessions;
+	}
+
+	/* Find an unused file name: dumps from earlier runs are kept. */
+	do {
+		WT_ERR(__wt_buf_fmt(session, name, "%s.%010" PRIu32,
+		    conn->trace_path, ++conn->trace_dump_count));
+		WT_ERR(__wt_exist(session, name->data, &exist));
+	} while (exist);
+
+	WT_ERR(__wt_open(session, name->data, true, true, 0, &fh));
+	WT_ERR(__wt_write(session, fh, 0, buf->size, buf->mem));
+
+err:	if (fh != NULL)
+		WT_TRET(__wt_close(session, &fh));
+	__wt_scr_free(session, &buf);
+	__wt_scr_free(session, &name);
+	return (ret);
+}
+
+/*
+ * __wt_trace_dump --
+ *	Dump the trace ring buffers on demand.
+ */
+int
+__wt_trace_dump(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+
+	conn = S2C(session);
+
+	if (conn->trace_entries == 0)
+		WT_RET_MSG(session, EINVAL,
+		    "event tracing is not configured");
+
+	__wt_spin_lock(session, &conn->trace_lock);
+	ret = __trace_dump(session, 0);
+	__wt_spin_unlock(session, &conn->trace_lock);
+	return (ret);
+}
+
+/*
+ * __wt_trace_slow --
+ *	Note a slow operation and wake the trace dump thread.
+ */
+void
+__wt_trace_slow(WT_SESSION_IMPL *session, uint64_t usecs)
+{
+	WT_CONNECTION_IMPL *conn;
+	time_t now;
+
+	conn = S2C(session);
+
+	WT_TRACE(session, WT_TRACE_SLOW_OP, usecs);
+
+	/*
+	 * The caller may be holding locks, only record the event here, the
+	 * trace dump thread writes the dump.  Dump at most once a second.
+	 */
+	if (conn->trace_cond == NULL || __wt_seconds(session, &now) != 0 ||
+	    (uint64_t)now == conn->trace_dump_last)
+		return;
+	conn->trace_dump_last = (uint64_t)now;
+	conn->trace_dump_usecs = usecs;
+	(void)__wt_cond_signal(session, conn->trace_cond);
+}
+
+/*
+ * __trace_server --
+ *	The trace dump thread.
+ */
+static WT_THREAD_RET
+__trace_server(void *arg)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+	uint64_t usecs;
+
+	session = arg;
+	conn = S2C(session);
+
+	while (F_ISSET(conn, WT_CONN_SERVER_TRACE)) {
+		WT_ERR(__wt_cond_wait(session, conn->trace_cond, WT_MILLION));
+
+		if ((usecs = conn->trace_dump_usecs) == 0)
+			continue;
+		conn->trace_dump_usecs = 0;
+
+		/* A failed dump is reported, it isn't fatal. */
+		__wt_spin_lock(session, &conn->trace_lock);
+		ret = __trace_dump(session, usecs);
+		__wt_spin_unlock(session, &conn->trace_lock);
+		if (ret != 0)
+			__wt_err(session, ret, "slow operation trace dump");
+		ret = 0;
+	}
+
+	if (0) {
+err:		WT_PANIC_MSG(session, ret, "trace dump server error");
+	}
+	return (WT_THREAD_RET_VALUE);
+}
+
+/*
+ * __wt_trace_server_create --
+ *	Start the trace dump thread, if slow operations are dumped.
+ */
+int
+__wt_trace_server_create(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+
+	if (conn->trace_entries == 0 || conn->trace_slow == 0)
+		return (0);
+
+	F_SET(conn, WT_CONN_SERVER_TRACE);
+
+	WT_RET(__wt_open_internal_session(
+	    conn, "trace-server", true, 0, &conn->trace_session));
+	session = conn->trace_session;
+
+	WT_RET(__wt_cond_alloc(
+	    session, "trace server", false, &conn->trace_cond));
+
+	WT_RET(__wt_thread_create(
+	    session, &conn->trace_tid, __trace_server, session));
+	conn->trace_tid_set = true;
+
+	return (0);
+}
+
+/*
+ * __wt_trace_server_destroy --
+ *	Destroy the trace dump thread.
+ */
+int
+__wt_trace_server_destroy(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_SESSION *wt_session;
+
+	conn = S2C(session);
+
+	F_CLR(conn, WT_CONN_SERVER_TRACE);
+	if (conn->trace_tid_set) {
+		WT_TRET(__wt_cond_signal(session, conn->trace_cond));
+		WT_TRET(__wt_thread_join(session, conn->trace_tid));
+		conn->trace_tid_set = false;
+	}
+	WT_TRET(__wt_cond_destroy(session, &conn->trace_cond));
+
+	/* Close the server thread's session. */
+	if (conn->trace_session != NULL) {
+		wt_session = &conn->trace_session->iface;
+		WT_TRET(wt_session->close(wt_session, NULL));
+	}
+	conn->trace_session = NULL;
+
+	return (ret);
+}
+
+/*
+ * WT_TRACE_PRINT --
+ *	A decoded trace event.
+ */
+typedef struct {
+	uint64_t ts;			/* Event time */
+	uint64_t arg;			/* Event argument */
+	uint64_t duration;		/* Time since the start event */
+	uint32_t id;			/* Session ID */
+	uint32_t event;			/* Event type */
+	uint64_t seq;			/* Order in the dump file */
+} WT_TRACE_PRINT;
+
+/*
+ * __trace_print_cmp --
+ *	Qsort comparison routine for decoded trace events.
+ */
+static int WT_CDECL
+__trace_print_cmp(const void *a, const void *b)
+{
+	const WT_TRACE_PRINT *ap, *bp;
+
+	ap = a;
+	bp = b;
+
+	if (ap->ts != bp->ts)
+		return (ap->ts < bp->ts ? -1 : 1);
+	return (ap->seq < bp->seq ? -1 : 1);
+}
+
+/*
+ * __wt_trace_print --
+ *	Print a trace dump file in a human-readable format.
+ */
+int
+__wt_trace_print(WT_SESSION *wt_session, const char *name, FILE *out)
+{
+	WT_DECL_ITEM(buf);
+	WT_DECL_RET;
+	WT_FH *fh;
+	WT_SESSION_IMPL *session;
+	WT_TRACE_FILE_HDR *hdr;
+	WT_TRACE_PRINT *ev, *events;
+	WT_TRACE_REC *rec;
+	WT_TRACE_SESSION_HDR *shdr;
+	wt_off_t size;
+	uint64_t nevents, start[WT_TRACE_EVENT_MAX];
+	uint32_t i, j;
+	uint8_t *p, *end;
+	int s;
+
+	session = (WT_SESSION_IMPL *)wt_session;
+	events = NULL;
+	fh = NULL;
+
+	WT_RET(__wt_scr_alloc(session, 0, &buf));
+	WT_ERR(__wt_open(session, name, false, false, 0, &fh));
+	WT_ERR(__wt_filesize(session, fh, &size));
+	WT_ERR(__wt_buf_initsize(session, buf, (size_t)size));
+	WT_ERR(__wt_read(session, fh, 0, (size_t)size, buf->mem));
+
+	hdr = buf->mem;
+	if (buf->size < sizeof(WT_TRACE_FILE_HDR) ||
+	    hdr->magic != WT_TRACE_MAGIC || hdr->version != WT_TRACE_VERSION)
+		WT_ERR_MSG(session, WT_ERROR,
+		    "%s: not a trace dump file", name);
+
+	/*
+	 * Every event in the file fits in a file-sized array, decode them all,
+	 * then sort them by time.
+	 */
+	WT_ERR(__wt_calloc_def(session,
+	    (size_t)size / sizeof(WT_TRACE_REC), &events));
+	nevents = 0;
+	p = (uint8_t *)(hdr + 1);
+	end = (uint8_t *)buf->mem + buf->size;
+	for (i = 0; i < hdr->sessions; ++i) {
+		shdr = (WT_TRACE_SESSION_HDR *)p;
+		rec = (WT_TRACE_REC *)(shdr + 1);
+		if ((uint8_t *)rec > end || shdr->count >
+		    WT_PTRDIFF(end, rec) / sizeof(WT_TRACE_REC))
+			WT_ERR_MSG(session, WT_ERROR,
+			    "%s: trace dump file truncated", name);
+		p = (uint8_t *)(rec + shdr->count);
+
+		memset(start, 0, sizeof(start));
+		for (j = 0; j < shdr->count; ++j, ++rec) {
+			if (rec->event >= WT_TRACE_EVENT_MAX)
+				continue;
+			ev = &events[nevents];
+			ev->ts = rec->ts;
+			ev->arg = rec->arg;
+			ev->id = shdr->id;
+			ev->event = rec->event;
+			ev->seq = nevents++;
+
+			/* Pair stop events with their start events. */
+			if ((s = __trace_events[rec->event].start) == -1)
+				start[rec->event] = rec->ts;
+			else if (start[s] != 0 && rec->ts >= start[s]) {
+				ev->duration = rec->ts - start[s];
+				start[s] = 0;
+			}
+		}
+	}
+	qsort(events, (size_t)nevents, sizeof(WT_TRACE_PRINT),
+	    __trace_print_cmp);
+
+	WT_ERR(__wt_fprintf(out,
+	    "trace dump at %" PRIu64 ".%09" PRIu64 ", %" PRIu32
+	    " sessions, %" PRIu32 " events per session",
+	    hdr->ts / WT_BILLION, hdr->ts % WT_BILLION,
+	    hdr->sessions, hdr->entries));
+	if (hdr->slow_usecs == 0)
+		WT_ERR(__wt_fprintf(out, ", on demand\n"));
+	else
+		WT_ERR(__wt_fprintf(out, ", slow operation of %" PRIu64 "us\n",
+		    hdr->slow_usecs));
+
+	for (ev = events; ev < events + nevents; ++ev) {
+		WT_ERR(__wt_fprintf(out,
+		    "%" PRIu64 ".%09" PRIu64 " [%" PRIu32 "] %s",
+		    ev->ts / WT_BILLION, ev->ts % WT_BILLION,
+		    ev->id, __trace_events[ev->event].name));
+		if (__trace_events[ev->event].arg != NULL &&
+		    (__trace_events[ev->event].start == -1 || ev->arg != 0))
+			WT_ERR(__wt_fprintf(out, ", %s %" PRIu64,
+			    __trace_events[ev->event].arg, ev->arg));
+		if (ev->duration != 0)
+			WT_ERR(__wt_fprintf(out,
+			    " (%" PRIu64 "us)", ev->duration / WT_THOUSAND));
+		WT_ERR(__wt_fprintf(out, "\n"));
+	}
+
+err:	if (fh != NULL)
+		WT_TRET(__wt_close(session, &fh));
+	__wt_free(session, events);
+	__wt_scr_free(session, &buf);
+	return (ret);
+}
@@ -407,6 +407,7 @@ __txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
 	WT_ERR(__wt_epoch(session, &verb_timer));
 	WT_ERR(__checkpoint_verbose_track(session,
 	    "starting write leaves", &verb_timer));
+	WT_TRACE(session, WT_TRACE_CKPT_LEAVES, 0);
 
 	/* Flush dirty leaf pages before we start the checkpoint. */
 	session->isolation = txn->isolation = WT_ISO_READ_COMMITTED;
@@ -436,6 +437,7 @@ __txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
 
 	WT_ERR(__checkpoint_verbose_track(session,
 	    "starting transaction", &verb_timer));
+	WT_TRACE(session, WT_TRACE_CKPT_TREES, 0);
 
 	if (full)
 		WT_ERR(__wt_epoch(session, &start));
@@ -518,6 +520,7 @@ __txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
 
 	WT_ERR(__checkpoint_verbose_track(session,
 	    "committing transaction", &verb_timer));
+	WT_TRACE(session, WT_TRACE_CKPT_SYNC, 0);
 
 	/*
 	 * Checkpoints have to hit disk (it would be reasonable to configure for
@@ -545,6 +548,7 @@ __txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
 	 * updated by full checkpoints so only checkpoint the metadata for
 	 * full or non-logged checkpoints.
 	 */
+	WT_TRACE(session, WT_TRACE_CKPT_META, 0);
 	if (full || !logging) {
 		session->isolation = txn->isolation = WT_ISO_READ_UNCOMMITTED;
 		/* Disable metadata tracking during the metadata checkpoint. */
@@ -664,9 +668,11 @@ __wt_txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
 	 * to ensure we don't get into trouble.
 	 */
 	WT_STAT_FAST_CONN_SET(session, txn_checkpoint_running, 1);
+	WT_TRACE(session, WT_TRACE_CKPT_START, 0);
 
 	WT_WITH_CHECKPOINT_LOCK(session, ret = __txn_checkpoint(session, cfg));
 
+	WT_TRACE(session, WT_TRACE_CKPT_STOP, ret);
 	WT_STAT_FAST_CONN_SET(session, txn_checkpoint_running, 0);
 
 	F_CLR(session, WT_SESSION_CAN_WAIT | WT_SESSION_NO_EVICTION);
@@ -170,6 +170,10 @@ main(int argc, char *argv[])
 			config = "statistics=(all)";
 		}
 		break;
+	case 't':
+		if (strcmp(command, "trace") == 0)
+			func = util_trace;
+		break;
 	case 'u':
 		if (strcmp(command, "upgrade") == 0)
 			func = util_upgrade;
@@ -266,6 +270,7 @@ usage(void)
 	    "\t" "rename\t  rename an object\n"
 	    "\t" "salvage\t  salvage a file\n"
 	    "\t" "stat\t  display statistics for an object\n"
+	    "\t" "trace\t  display an event trace dump\n"
 	    "\t" "upgrade\t  upgrade an object\n"
 	    "\t" "verify\t  verify an object\n"
 	    "\t" "write\t  write values to an object\n");
@@ -14,16 +14,20 @@ int
 util_salvage(WT_SESSION *session, int argc, char *argv[])
 {
 	WT_DECL_RET;
+	size_t size;
 	int ch;
-	const char *force;
-	char *name;
+	bool force;
+	char *config, *name, *threads;
 
-	force = NULL;
-	name = NULL;
-	while ((ch = __wt_getopt(progname, argc, argv, "F")) != EOF)
+	force = false;
+	config = name = threads = NULL;
+	while ((ch = __wt_getopt(progname, argc, argv, "Ft:")) != EOF)
 		switch (ch) {
 		case 'F':
-			force = "force";
+			force = true;
+			break;
+		case 't':
+			threads = __wt_optarg;
 			break;
 		case '?':
 		default:
@@ -38,7 +42,24 @@ util_salvage(WT_SESSION *session, int argc, char *argv[])
 	if ((name = util_name(session, *argv, "file")) == NULL)
 		return (1);
 
-	if ((ret = session->salvage(session, name, force)) != 0) {
+	/* Build the configuration string as necessary. */
+	if (force || threads != NULL) {
+		size =
+		    strlen("force,") +
+		    strlen("threads=,") +
+		    (threads == NULL ? 0 : strlen(threads)) + 20;
+		if ((config = malloc(size)) == NULL) {
+			(void)util_err(session, errno, NULL);
+			goto err;
+		}
+		snprintf(config, size,
+		    "%s%s%s%s",
+		    force ? "force," : "",
+		    threads != NULL ? "threads=" : "",
+		    threads != NULL ? threads : "",
+		    threads != NULL ? "," : "");
+	}
+	if ((ret = session->salvage(session, name, config)) != 0) {
 		fprintf(stderr, "%s: salvage(%s): %s\n",
 		    progname, name, session->strerror(session, ret));
 		goto err;
@@ -52,6 +73,7 @@ util_salvage(WT_SESSION *session, int argc, char *argv[])
 err:		ret = 1;
 	}
 
+	free(config);
 	free(name);
 
 	return (ret);
@@ -62,7 +84,7 @@ usage(void)
 {
 	(void)fprintf(stderr,
 	    "usage: %s %s "
-	    "salvage [-F] uri\n",
+	    "salvage [-F] [-t threads] uri\n",
 	    progname, usage_prefix);
 	return (1);
 }
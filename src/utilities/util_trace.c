@@ -0,0 +1,55 @@
+/*-
+ * Copyright (c) 2014-2015 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "util.h"
+
+static int usage(void);
+
+int
+util_trace(WT_SESSION *session, int argc, char *argv[])
+{
+	WT_DECL_RET;
+	int ch;
+
+	while ((ch = __wt_getopt(progname, argc, argv, "f:")) != EOF)
+		switch (ch) {
+		case 'f':			/* output file */
+			if (freopen(__wt_optarg, "w", stdout) == NULL) {
+				fprintf(stderr, "%s: %s: reopen: %s\n",
+				    progname, __wt_optarg, strerror(errno));
+				return (1);
+			}
+			break;
+		case '?':
+		default:
+			return (usage());
+		}
+	argc -= __wt_optind;
+	argv += __wt_optind;
+
+	/* The remaining argument is the trace dump file. */
+	if (argc != 1)
+		return (usage());
+
+	if ((ret = __wt_trace_print(session, argv[0], stdout)) != 0) {
+		fprintf(stderr, "%s: trace failed: %s\n",
+		    progname, session->strerror(session, ret));
+		return (1);
+	}
+	return (0);
+}
+
+static int
+usage(void)
+{
+	(void)fprintf(stderr,
+	    "usage: %s %s "
+	    "trace [-f output-file] dump-file\n",
+	    progname, usage_prefix);
+	return (1);
+}
@@ -17,11 +17,11 @@ util_verify(WT_SESSION *session, int argc, char *argv[])
 	size_t size;
 	int ch;
 	bool dump_address, dump_blocks, dump_pages, dump_shape;
-	char *config, *dump_offsets, *name;
+	char *config, *dump_offsets, *name, *threads;
 
 	dump_address = dump_blocks = dump_pages = dump_shape = false;
-	config = dump_offsets = name = NULL;
-	while ((ch = __wt_getopt(progname, argc, argv, "d:")) != EOF)
+	config = dump_offsets = name = threads = NULL;
+	while ((ch = __wt_getopt(progname, argc, argv, "d:t:")) != EOF)
 		switch (ch) {
 		case 'd':
 			if (strcmp(__wt_optarg, "dump_address") == 0)
@@ -45,6 +45,9 @@ util_verify(WT_SESSION *session, int argc, char *argv[])
 			else
 				return (usage());
 			break;
+		case 't':
+			threads = __wt_optarg;
+			break;
 		case '?':
 		default:
 			return (usage());
@@ -59,28 +62,33 @@ util_verify(WT_SESSION *session, int argc, char *argv[])
 		return (1);
 
 	/* Build the configuration string as necessary. */
-	if (dump_address ||
-	    dump_blocks || dump_offsets != NULL || dump_pages || dump_shape) {
+	if (dump_address || dump_blocks || dump_offsets != NULL ||
+	    dump_pages || dump_shape || threads != NULL) {
 		size =
 		    strlen("dump_address,") +
 		    strlen("dump_blocks,") +
 		    strlen("dump_pages,") +
 		    strlen("dump_shape,") +
 		    strlen("dump_offsets[],") +
-		    (dump_offsets == NULL ? 0 : strlen(dump_offsets)) + 20;
+		    (dump_offsets == NULL ? 0 : strlen(dump_offsets)) +
+		    strlen("threads=,") +
+		    (threads == NULL ? 0 : strlen(threads)) + 20;
 		if ((config = malloc(size)) == NULL) {
 			(void)util_err(session, errno, NULL);
 			goto err;
 		}
 		snprintf(config, size,
-		    "%s%s%s%s%s%s%s",
+		    "%s%s%s%s%s%s%s%s%s%s",
 		    dump_address ? "dump_address," : "",
 		    dump_blocks ? "dump_blocks," : "",
 		    dump_offsets != NULL ? "dump_offsets=[" : "",
 		    dump_offsets != NULL ? dump_offsets : "",
 		    dump_offsets != NULL ? "]," : "",
 		    dump_pages ? "dump_pages," : "",
-		    dump_shape ? "dump_shape," : "");
+		    dump_shape ? "dump_shape," : "",
+		    threads != NULL ? "threads=" : "",
+		    threads != NULL ? threads : "",
+		    threads != NULL ? "," : "");
 	}
 	if ((ret = session->verify(session, name, config)) != 0) {
 		fprintf(stderr, "%s: verify(%s): %s\n",
@@ -110,6 +118,6 @@ usage(void)
 	    "verify %s\n",
 	    progname, usage_prefix,
 	    "[-d dump_address | dump_blocks | "
-	    "dump_offsets=#,# | dump_pages | dump_shape] uri");
+	    "dump_offsets=#,# | dump_pages | dump_shape] [-t threads] uri");
 	return (1);
 }
@@ -191,6 +191,10 @@ static CONFIG c[] = {
 	  "minimum size of keys",
 	  0x0, 10, 32, 256, &g.c_key_min, NULL },
 
+	{ "leaf_delta_max",
+	  "maximum number of deltas written for a row-store leaf page",
+	  0x0, 0, 8, 16, &g.c_leaf_delta_max, NULL },
+
 	{ "leaf_page_max",
 	  "maximum size of Btree leaf nodes",
 	  0x0, 9, 17, 27, &g.c_leaf_page_max, NULL },
@@ -303,5 +307,9 @@ static CONFIG c[] = {
 	  "percent operations that are writes",
 	  0x0, 0, 90, 90, &g.c_write_pct, NULL },
 
+	{ "write_threads",
+	  "the number of write pool threads",
+	  0x0, 0, 4, 20, &g.c_write_threads, NULL },
+
 	{ NULL, NULL, 0x0, 0, 0, 0, NULL, NULL }
 };
@@ -198,6 +198,7 @@ typedef struct {
 	uint32_t c_key_gap;
 	uint32_t c_key_max;
 	uint32_t c_key_min;
+	uint32_t c_leaf_delta_max;
 	uint32_t c_leaf_page_max;
 	uint32_t c_leak_memory;
 	uint32_t c_logging;
@@ -225,6 +226,7 @@ typedef struct {
 	uint32_t c_value_min;
 	uint32_t c_verify;
 	uint32_t c_write_pct;
+	uint32_t c_write_threads;
 
 #define	FIX				1	
 #define	ROW				2
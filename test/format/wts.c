@@ -164,6 +164,11 @@ wts_open(const char *home, int set_api, WT_CONNECTION **connp)
 		p += snprintf(p, REMAIN(p, end),
 		    ",eviction=(threads_max=%" PRIu32 ")", g.c_evict_max);
 
+	/* Write pool configuration. */
+	if (g.c_write_threads != 0)
+		p += snprintf(p, REMAIN(p, end),
+		    ",write_pool=(threads=%" PRIu32 ")", g.c_write_threads);
+
 	/* Logging configuration. */
 	if (g.c_logging)
 		p += snprintf(p, REMAIN(p, end),
@@ -349,6 +354,9 @@ wts_create(void)
 		if (g.c_reverse)
 			p += snprintf(p, REMAIN(p, end),
 			    ",collator=reverse");
+		if (g.c_leaf_delta_max != 0)
+			p += snprintf(p, REMAIN(p, end),
+			    ",leaf_delta_max=%" PRIu32, g.c_leaf_delta_max);
 		/* FALLTHROUGH */
 	case VAR:
 		if (g.c_huffman_value)
@@ -0,0 +1,138 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import sys, threading, wiredtiger, wttest
+from wiredtiger import wiredtiger_open
+from wtscenario import check_scenarios
+
+class Callback(wiredtiger.AsyncCallback):
+    def __init__(self):
+        self.nduplicate = 0
+        self.nerror = 0
+        self.nop = 0
+        self.values = {}
+        self.lock = threading.RLock()
+
+    def notify(self, op, op_ret, flags):
+        # Note: we are careful not to throw any errors here.  Any
+        # exceptions would be swallowed by a non-python worker thread.
+        self.lock.acquire()
+        self.nop += 1
+        if op_ret == wiredtiger.WT_DUPLICATE_KEY:
+            self.nduplicate += 1
+        elif op_ret != 0:
+            self.nerror += 1
+        elif op.get_type() == wiredtiger.WT_AOP_SEARCH:
+            self.values[op.get_key()] = op.get_value()
+        self.lock.release()
+        return 0
+
+
+# test_async04.py
+#    Async operations
+# Check async operations grouped into transactions: results are the same
+# whether or not operations are grouped, and a failing operation only fails
+# itself.
+class test_async04(wttest.WiredTigerTestCase):
+    table_name1 = 'test_async04'
+    nentries = 1000
+    async_ops = 200
+
+    scenarios = check_scenarios([
+        ('single', dict(ops_per_txn=1, async_threads=2)),
+        ('grouped', dict(ops_per_txn=8, async_threads=2)),
+        ('grouped-max', dict(ops_per_txn=32, async_threads=40)),
+    ])
+
+    # Overrides WiredTigerTestCase so that we can configure
+    # async operations.
+    def setUpConnectionOpen(self, dir):
+        self.home = dir
+        conn_params = \
+                'create,error_prefix="%s: ",' % self.shortid() + \
+                'async=(enabled=true,ops_max=%d,' % self.async_ops + \
+                'ops_per_txn=%d,' % self.ops_per_txn + \
+                'threads=%d)' % self.async_threads
+        sys.stdout.flush()
+        conn = wiredtiger_open(dir, conn_params)
+        self.pr(`conn`)
+        return conn
+
+    def queue_ops(self, uri, config, callback, optype, keys):
+        for i in keys:
+            op = self.conn.async_new_op(uri, config, callback)
+            op.set_key('key' + str(i))
+            if optype == 'search':
+                op.search()
+            else:
+                op.set_value('value' + str(i))
+                op.insert()
+        self.conn.async_flush()
+
+    def test_ops(self):
+        uris = [ 'table:' + self.table_name1, 'file:' + self.table_name1 ]
+        for uri in uris:
+            self.session.create(uri, 'key_format=S,value_format=S')
+
+        # Insert records, alternating between the objects.
+        callback = Callback()
+        for uri in uris:
+            self.queue_ops(uri, None, callback, 'insert',
+                range(0, self.nentries, 2))
+        self.assertEqual(callback.nop, self.nentries)
+        self.assertEqual(callback.nerror, 0)
+
+        # Insert records with overwrite turned off: the existing records
+        # fail, the new records are inserted.
+        callback = Callback()
+        self.queue_ops(uris[0], 'overwrite=false', callback, 'insert',
+            range(0, self.nentries))
+        self.assertEqual(callback.nop, self.nentries)
+        self.assertEqual(callback.nduplicate, self.nentries / 2)
+        self.assertEqual(callback.nerror, 0)
+
+        cursor = self.session.open_cursor(uris[0], None)
+        self.assertEqual(sum(1 for k, v in cursor), self.nentries)
+        cursor.close()
+
+        # Search for the records, changing the grouping on the way.
+        callback = Callback()
+        self.queue_ops(uris[0], None, callback, 'search',
+            range(0, self.nentries / 2))
+        self.conn.reconfigure('async=(ops_per_txn=4)')
+        self.queue_ops(uris[0], None, callback, 'search',
+            range(self.nentries / 2, self.nentries))
+        self.assertEqual(callback.nerror, 0)
+        self.assertEqual(len(callback.values), self.nentries)
+        for i in range(0, self.nentries):
+            self.assertEqual(
+                callback.values['key' + str(i)], 'value' + str(i))
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,139 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+
+import select, sys, threading, wiredtiger, wttest
+from wiredtiger import wiredtiger_open
+
+class Callback(wiredtiger.AsyncCallback):
+    def __init__(self):
+        self.nerror = 0
+        self.nop = 0
+        self.threads = set()
+        self.values = {}
+
+    def notify(self, op, op_ret, flags):
+        # Completion queue callbacks are called in the draining thread.
+        self.threads.add(threading.current_thread().ident)
+        self.nop += 1
+        if op_ret != 0:
+            self.nerror += 1
+        elif op.get_type() == wiredtiger.WT_AOP_SEARCH:
+            self.values[op.get_key()] = op.get_value()
+        # The transaction is resolved before the operation is queued, the
+        # return value is ignored.
+        return 1
+
+
+# test_async05.py
+#    Async operations
+# Check async operations posted to the completion queue: callbacks are
+# called when the application drains the queue, and the completion file
+# descriptor is readable while the queue isn't empty.
+class test_async05(wttest.WiredTigerTestCase):
+    uri = 'table:test_async05'
+    nentries = 100
+    async_ops = 200
+
+    # Overrides WiredTigerTestCase so that we can configure
+    # async operations.
+    def setUpConnectionOpen(self, dir):
+        self.home = dir
+        conn_params = \
+                'create,error_prefix="%s: ",' % self.shortid() + \
+                'async=(enabled=true,ops_max=%d,' % self.async_ops + \
+                'threads=2)'
+        sys.stdout.flush()
+        conn = wiredtiger_open(dir, conn_params)
+        self.pr(`conn`)
+        return conn
+
+    def queue_ops(self, callback, optype, keys):
+        for i in keys:
+            op = self.conn.async_new_op(
+                self.uri, 'completion_queue=true', callback)
+            op.set_key('key' + str(i))
+            if optype == 'search':
+                op.search()
+            else:
+                op.set_value('value' + str(i))
+                op.insert()
+        self.conn.async_flush()
+
+    def readable(self, fd):
+        return len(select.select([fd], [], [], 0)[0]) == 1
+
+    def test_completion_queue(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S')
+        fd = self.conn.async_completion_fd()
+        self.assertEqual(fd, self.conn.async_completion_fd())
+        self.assertFalse(self.readable(fd))
+
+        # Nothing is called back until the queue is drained.
+        callback = Callback()
+        self.queue_ops(callback, 'insert', range(0, self.nentries))
+        self.assertEqual(callback.nop, 0)
+        self.assertTrue(self.readable(fd))
+
+        # Drain part of the queue, then the rest of it.
+        self.conn.async_drain('max=10')
+        self.assertEqual(callback.nop, 10)
+        self.assertTrue(self.readable(fd))
+        self.conn.async_drain()
+        self.assertEqual(callback.nop, self.nentries)
+        self.assertEqual(callback.nerror, 0)
+        self.assertEqual(callback.threads,
+            set([threading.current_thread().ident]))
+        self.assertFalse(self.readable(fd))
+
+        # Callbacks can't roll back queued operations.
+        cursor = self.session.open_cursor(self.uri, None)
+        self.assertEqual(sum(1 for k, v in cursor), self.nentries)
+        cursor.close()
+
+        # Search results are available when the queue is drained.
+        callback = Callback()
+        self.queue_ops(callback, 'search', range(0, self.nentries))
+        self.assertTrue(self.readable(fd))
+        self.conn.async_drain()
+        self.assertFalse(self.readable(fd))
+        self.assertEqual(callback.nerror, 0)
+        for i in range(0, self.nentries):
+            self.assertEqual(
+                callback.values['key' + str(i)], 'value' + str(i))
+
+        # Completions not drained are called back when the connection is
+        # closed.
+        callback = Callback()
+        self.queue_ops(callback, 'search', range(0, self.nentries))
+        self.close_conn()
+        self.assertEqual(callback.nop, self.nentries)
+
+if __name__ == '__main__':
+    wttest.run()
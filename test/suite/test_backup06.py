@@ -0,0 +1,139 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_backup06.py
+#   Test incremental block backups: each backup copies the block ranges
+#   changed since the previous backup over that backup's copy.
+#
+
+import os, shutil
+import wiredtiger, wttest
+
+class test_backup06(wttest.WiredTigerTestCase):
+    uri = 'table:test_backup06'
+    nentries = 10000
+
+    # Copy the files and block ranges returned by a backup cursor.
+    def backup(self, config, dir):
+        cursor = self.session.open_cursor('backup:', None, config)
+        copied = 0
+        files = []
+        while cursor.next() == 0:
+            name = cursor.get_key()
+            offset, size, type = cursor.get_value()
+            if name not in files:
+                files.append(name)
+            if type == wiredtiger.WT_BACKUP_FILE:
+                self.assertEqual(offset, 0)
+                self.assertEqual(size, 0)
+                shutil.copy(name, dir)
+                copied += os.path.getsize(name)
+                continue
+            self.assertEqual(type, wiredtiger.WT_BACKUP_RANGE)
+            if size == 0:
+                continue
+            src = open(name, 'rb')
+            dst = open(os.path.join(dir, name), 'r+b')
+            src.seek(offset)
+            dst.seek(offset)
+            dst.write(src.read(size))
+            src.close()
+            dst.close()
+            copied += size
+        cursor.close()
+        return files, copied
+
+    # Open a copy of the backup and check its contents.
+    def check(self, dir, value):
+        shutil.rmtree('RESTART', True)
+        shutil.copytree(dir, 'RESTART')
+        conn = self.setUpConnectionOpen('RESTART')
+        session = self.setUpSessionOpen(conn)
+        session.verify(self.uri)
+        cursor = session.open_cursor(self.uri, None, None)
+        count = 0
+        for k, v in cursor:
+            self.assertEqual(v, value if k < 100 else 0)
+            count += 1
+        self.assertEqual(count, self.nentries)
+        conn.close()
+
+    def update(self, value):
+        cursor = self.session.open_cursor(self.uri, None, None)
+        for i in range(100):
+            cursor[i] = value
+        cursor.close()
+
+    def test_backup_incremental(self):
+        self.session.create(self.uri, 'key_format=i,value_format=i')
+        cursor = self.session.open_cursor(self.uri, None, None)
+        for i in range(self.nentries):
+            cursor[i] = 0
+        cursor.close()
+        self.session.checkpoint()
+
+        # A backup without a source copies everything.
+        os.mkdir('BACKUP')
+        files, full = self.backup('incremental=(this_id=1)', 'BACKUP')
+        self.assertTrue('test_backup06.wt' in files)
+        self.check('BACKUP', 0)
+
+        # Roll the copy forward, with unnamed checkpoints in between.
+        for i in range(1, 4):
+            self.update(i)
+            self.session.checkpoint()
+            self.update(i)
+            files, incr = self.backup(
+                'incremental=(src_id=%d,this_id=%d)' % (i, i + 1), 'BACKUP')
+            self.assertTrue('test_backup06.wt' in files)
+            self.assertLess(incr, full)
+            self.session.checkpoint('drop=(WiredTigerBackup.%d)' % i)
+            self.check('BACKUP', i)
+
+    def test_backup_incremental_unknown(self):
+        self.session.create(self.uri, 'key_format=i,value_format=i')
+        self.session.checkpoint()
+
+        # An unknown source backup copies every file whole.
+        cursor = self.session.open_cursor(
+            'backup:', None, 'incremental=(src_id=none)')
+        while cursor.next() == 0:
+            self.assertEqual(cursor.get_value()[2], wiredtiger.WT_BACKUP_FILE)
+        cursor.close()
+
+    def test_backup_incremental_txn(self):
+        self.session.create(self.uri, 'key_format=i,value_format=i')
+        self.session.begin_transaction()
+        msg = '/can\'t be set in a transaction/'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.open_cursor(
+            'backup:', None, 'incremental=(this_id=1)'), msg)
+        self.session.rollback_transaction()
+
+if __name__ == '__main__':
+    wttest.run()
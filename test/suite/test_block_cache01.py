@@ -0,0 +1,181 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_block_cache01.py
+#   Block cache operations
+#
+
+import os
+import wiredtiger, wttest
+from wiredtiger import stat
+from wtscenario import check_scenarios
+
+# Test reading blocks from the block cache, and that the cache never returns
+# a block it shouldn't.
+class test_block_cache01(wttest.WiredTigerTestCase):
+
+    scenarios = check_scenarios([
+        ('file', dict(uri='file:test_block_cache01')),
+        ('table', dict(uri='table:test_block_cache01')),
+    ])
+
+    nrecords = 50000
+    value = "abcdefghij" * 5
+    conn_config = 'cache_size=1MB'
+
+    # Override WiredTigerTestCase, we want a small cache and a block cache.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir, 'create,' +
+            ('error_prefix="%s: ",' % self.shortid()) +
+            'block_cache=(size=20MB),statistics=(fast),' + self.conn_config)
+        self.pr(`conn`)
+        return conn
+
+    def populate(self, value, nrecords):
+        self.session.create(self.uri,
+            'key_format=S,value_format=S,leaf_page_max=4096')
+        cursor = self.session.open_cursor(self.uri, None)
+        for idx in xrange(1, nrecords):
+            cursor[`idx`] = `idx` + value
+        cursor.close()
+
+    def read_all(self, value):
+        cursor = self.session.open_cursor(self.uri, None)
+        for idx in xrange(1, self.nrecords):
+            cursor.set_key(`idx`)
+            self.assertEqual(cursor.search(), 0)
+            self.assertEquals(cursor.get_value(), `idx` + value)
+        cursor.close()
+
+    # Pages evicted from the small cache are written to the block cache and
+    # read back from it, and the index is saved on close and read on open.
+    def test_block_cache(self):
+        self.populate(self.value, self.nrecords)
+        self.read_all(self.value)
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        self.assertGreater(stat_cursor[stat.conn.block_cache_insert][2], 0)
+        self.assertGreater(stat_cursor[stat.conn.block_cache_hit][2], 0)
+        stat_cursor.close()
+
+        self.reopen_conn()
+        self.assertFalse(os.path.exists('WiredTigerBlockCache.idx'))
+        self.read_all(self.value)
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        self.assertGreater(stat_cursor[stat.conn.block_cache_hit][2], 0)
+        self.assertEqual(stat_cursor[stat.conn.block_cache_invalid][2], 0)
+        self.assertEqual(stat_cursor[stat.conn.block_cache_error][2], 0)
+        stat_cursor.close()
+
+    # A dropped object's blocks are discarded: an object created with the
+    # same name never sees them, even after a restart.
+    def test_block_cache_drop(self):
+        self.populate(self.value, self.nrecords)
+        self.read_all(self.value)
+        self.session.drop(self.uri, None)
+
+        self.populate('new' + self.value, self.nrecords)
+        self.read_all('new' + self.value)
+        self.reopen_conn()
+        self.read_all('new' + self.value)
+
+    # Images damaged in the cache file fail their check and are read from
+    # the data file.
+    def test_block_cache_corrupt(self):
+        self.populate(self.value, self.nrecords)
+        self.read_all(self.value)
+        self.close_conn()
+
+        size = os.path.getsize('WiredTigerBlockCache')
+        self.assertGreater(size, 0)
+        f = open('WiredTigerBlockCache', 'r+b')
+        for off in xrange(0, size, 4096):
+            f.seek(off + 100)
+            f.write('corrupt')
+        f.close()
+
+        self.open_conn()
+        self.read_all(self.value)
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        self.assertGreater(stat_cursor[stat.conn.block_cache_invalid][2], 0)
+        stat_cursor.close()
+
+    # Checkpoint writes aren't added to the block cache.
+    def test_block_cache_checkpoint(self):
+        self.populate(self.value, 100)
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        bypass = stat_cursor[stat.conn.block_cache_bypass][2]
+        insert = stat_cursor[stat.conn.block_cache_insert][2]
+        stat_cursor.close()
+
+        self.session.checkpoint()
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        self.assertGreater(
+            stat_cursor[stat.conn.block_cache_bypass][2], bypass)
+        self.assertEqual(stat_cursor[stat.conn.block_cache_insert][2], insert)
+        stat_cursor.close()
+
+    # Checkpoint writes handed to the write pool aren't added to the block
+    # cache either, including the leaf pages written before the tree's
+    # checkpoint starts.
+    def test_block_cache_checkpoint_write_pool(self):
+        self.conn_config = 'cache_size=100MB,write_pool=(threads=2)'
+        self.reopen_conn()
+        self.session.create(self.uri, 'key_format=S,value_format=S,' +
+            'leaf_page_max=4096,memory_page_max=10MB')
+        cursor = self.session.open_cursor(self.uri, None)
+        for idx in xrange(1, 10000):
+            cursor[`idx`] = `idx` + self.value
+        cursor.close()
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        insert = stat_cursor[stat.conn.block_cache_insert][2]
+        pool = stat_cursor[stat.conn.rec_write_pool][2] + \
+            stat_cursor[stat.conn.rec_write_pool_inline][2]
+        stat_cursor.close()
+
+        self.session.checkpoint()
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        self.assertGreater(stat_cursor[stat.conn.rec_write_pool][2] +
+            stat_cursor[stat.conn.rec_write_pool_inline][2], pool)
+        self.assertEqual(stat_cursor[stat.conn.block_cache_insert][2], insert)
+        stat_cursor.close()
+
+    # Verify must read the data file, not the block cache.
+    def test_block_cache_verify(self):
+        self.populate(self.value, self.nrecords)
+        self.read_all(self.value)
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        hit = stat_cursor[stat.conn.block_cache_hit][2]
+        stat_cursor.close()
+
+        self.session.verify(self.uri, None)
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        self.assertEqual(stat_cursor[stat.conn.block_cache_hit][2], hit)
+        stat_cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,150 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_cache_warmup01.py
+#   Cache warm-up
+#
+
+import os, time
+import wiredtiger, wttest
+from wiredtiger import stat
+from wtscenario import check_scenarios
+
+# Test restoring the cache contents after a restart
+class test_cache_warmup01(wttest.WiredTigerTestCase):
+
+    scenarios = check_scenarios([
+        ('file', dict(uri='file:test_cache_warmup01')),
+        ('table', dict(uri='table:test_cache_warmup01')),
+    ])
+
+    nrecords = 50000
+    value = "abcdefghij" * 5
+    warmup_config = 'enabled=true'
+
+    # Override WiredTigerTestCase, we want cache warm-up.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir, 'create,' +
+            ('error_prefix="%s: ",' % self.shortid()) +
+            'cache_size=50MB,statistics=(fast),' +
+            ('cache_warmup=(%s)' % self.warmup_config))
+        self.pr(`conn`)
+        return conn
+
+    def populate(self, value, nrecords):
+        self.session.create(self.uri,
+            'key_format=S,value_format=S,leaf_page_max=4096')
+        cursor = self.session.open_cursor(self.uri, None)
+        for idx in xrange(1, nrecords):
+            cursor[`idx`] = `idx` + value
+        cursor.close()
+
+    def read_all(self, value, nrecords):
+        cursor = self.session.open_cursor(self.uri, None)
+        for idx in xrange(1, nrecords):
+            cursor.set_key(`idx`)
+            self.assertEqual(cursor.search(), 0)
+            self.assertEquals(cursor.get_value(), `idx` + value)
+        cursor.close()
+
+    # Wait for the warm-up server to read the warm-up file.
+    def wait_warmup_file(self):
+        for i in xrange(100):
+            if not os.path.exists('WiredTigerWarmup'):
+                break
+            time.sleep(0.1)
+        self.assertFalse(os.path.exists('WiredTigerWarmup'))
+
+    def test_cache_warmup(self):
+        self.populate(self.value, self.nrecords)
+
+        # The pages in the cache are recorded on close, and read back in on
+        # open; the warm-up file is removed when it's read.
+        self.reopen_conn()
+        self.wait_warmup_file()
+        self.read_all(self.value, self.nrecords)
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        self.assertGreater(stat_cursor[stat.conn.cache_warmup_read][2], 0)
+        stat_cursor.close()
+
+        # Pages are recorded again when the restored cache is closed.
+        self.reopen_conn()
+        self.read_all(self.value, self.nrecords)
+        self.session.verify(self.uri, None)
+
+    # Warm-up stops once the cache is filled to the target.
+    def test_cache_warmup_target(self):
+        nrecords = 200000
+        value = self.value * 2
+        self.populate(value, nrecords)
+
+        self.warmup_config = 'enabled=true,target=10'
+        self.reopen_conn()
+        self.wait_warmup_file()
+
+        # Wait for the warm-up server to stop reading pages.
+        last = -1
+        for i in xrange(100):
+            stat_cursor = self.session.open_cursor('statistics:', None, None)
+            pages = stat_cursor[stat.conn.cache_warmup_read][2]
+            stat_cursor.close()
+            if pages > 0 and pages == last:
+                break
+            last = pages
+            time.sleep(0.1)
+        self.assertGreater(pages, 0)
+
+        # The cache may overshoot the target by the pages being read.
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        inuse = stat_cursor[stat.conn.cache_bytes_inuse][2]
+        size = stat_cursor[stat.conn.cache_bytes_max][2]
+        stat_cursor.close()
+        self.assertLess(inuse, size * 15 / 100)
+        self.read_all(value, nrecords)
+
+    # Recorded addresses go stale if the database is changed by a run without
+    # warm-up: warm-up must only read pages the tree still references.
+    def test_cache_warmup_stale(self):
+        self.populate(self.value, self.nrecords)
+
+        self.warmup_config = 'enabled=false'
+        self.reopen_conn()
+        self.session.drop(self.uri, None)
+        self.populate('new' + self.value, self.nrecords)
+        self.session.checkpoint()
+        self.close_conn()
+        self.assertTrue(os.path.exists('WiredTigerWarmup'))
+
+        self.warmup_config = 'enabled=true'
+        self.open_conn()
+        self.wait_warmup_file()
+        self.read_all('new' + self.value, self.nrecords)
+        self.session.verify(self.uri, None)
+
+if __name__ == '__main__':
+    wttest.run()
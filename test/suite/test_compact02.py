@@ -0,0 +1,98 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import os, time
+import wiredtiger, wttest
+from helper import key_populate, value_populate
+from wiredtiger import stat
+
+# test_compact02.py
+#    Background compaction server.
+class test_compact02(wttest.WiredTigerTestCase):
+    uri = 'file:test_compact02'
+    config = 'allocation_size=512,leaf_page_max=512,' + \
+        'key_format=S,value_format=S'
+    nentries = 50000
+
+    # Start without the server so populating the file doesn't compact it.
+    conn_config = 'cache_size=250MB,statistics=(fast)'
+
+    def file_size(self):
+        return os.path.getsize(self.uri[len('file:'):])
+
+    # Test the background compaction server shrinks an open file.
+    def test_compact_background(self):
+        self.session.create(self.uri, self.config)
+        c = self.session.open_cursor(self.uri, None)
+        for i in range(1, self.nentries + 1):
+            c[key_populate(c, i)] = value_populate(c, i)
+        c.close()
+
+        # Reopen the connection to force the object to disk, then remove
+        # most of each range of records, leaving space throughout the file.
+        self.reopen_conn()
+        c = self.session.open_cursor(self.uri, None)
+        for i in range(1, self.nentries + 1):
+            if (i / 1000) % 10 < 8:
+                c.set_key(key_populate(c, i))
+                self.assertEqual(c.remove(), 0)
+        self.session.checkpoint(None)
+        self.session.checkpoint(None)
+        before = self.file_size()
+
+        # Start the server, the cursor keeps the file's handle open.
+        # Poll the server's statistics until it has rewritten blocks and
+        # the file has shrunk.
+        self.conn.reconfigure('compact=(rate=100,wait=1)')
+        for i in range(600):
+            stat_cursor = self.session.open_cursor('statistics:', None, None)
+            files = stat_cursor[stat.conn.block_compact_server_files][2]
+            rewrite = stat_cursor[stat.conn.block_compact_server_rewrite][2]
+            stat_cursor.close()
+            if rewrite > 0 and self.file_size() < before / 2:
+                break
+            time.sleep(0.1)
+        self.assertGreater(files, 0)
+        self.assertGreater(rewrite, 0)
+        self.assertLess(self.file_size(), before / 2)
+        c.close()
+
+        # Stop the server, and confirm the file is still correct.
+        self.conn.reconfigure('compact=(rate=0)')
+        self.session.verify(self.uri, None)
+
+    # The server requires checkpoints.
+    def test_compact_background_in_memory(self):
+        os.mkdir('IN_MEMORY')
+        msg = '/In memory configuration incompatible/'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: wiredtiger.wiredtiger_open('IN_MEMORY',
+            'create,in_memory=true,compact=(rate=10)'), msg)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,102 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_compress02.py
+#   Compressed cache operations
+#
+
+import os, run
+import wiredtiger, wttest
+from wiredtiger import stat
+from wtscenario import check_scenarios
+
+# Test reading pages back through the compressed cache
+class test_compress02(wttest.WiredTigerTestCase):
+
+    scenarios = check_scenarios([
+        ('file', dict(uri='file:test_compress02')),
+        ('table', dict(uri='table:test_compress02')),
+    ])
+
+    nrecords = 50000
+    value = "abcdefghij" * 10
+
+    # Override WiredTigerTestCase, we have extensions and a small cache.
+    def setUpConnectionOpen(self, dir):
+        extfile = os.path.join(run.wt_builddir,
+            'ext/compressors/nop/.libs/libwiredtiger_nop.so')
+        if not os.path.exists(extfile):
+            self.skipTest('compression extension "' + extfile + '" not built')
+        conn = wiredtiger.wiredtiger_open(dir, 'create,' +
+            ('error_prefix="%s: ",' % self.shortid()) +
+            'cache_size=1MB,compressed_cache=(size=20MB),statistics=(fast),' +
+            'extensions=["' + extfile + '"]')
+        self.pr(`conn`)
+        return conn
+
+    def read_all(self):
+        cursor = self.session.open_cursor(self.uri, None)
+        for idx in xrange(1, self.nrecords):
+            cursor.set_key(`idx`)
+            self.assertEqual(cursor.search(), 0)
+            self.assertEquals(cursor.get_value(), `idx` + self.value)
+        cursor.close()
+
+    # Read the object back with a cache too small to hold it, and confirm
+    # the pages read the second time come from the compressed cache.
+    def test_compressed_cache(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S,' +
+            'leaf_page_max=4096,block_compressor=nop')
+        cursor = self.session.open_cursor(self.uri, None)
+        for idx in xrange(1, self.nrecords):
+            cursor[`idx`] = `idx` + self.value
+        cursor.close()
+
+        # Force the cache to disk, so we read pages from disk.
+        self.reopen_conn()
+
+        self.read_all()
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        self.assertGreater(
+            stat_cursor[stat.conn.cache_compressed_insert][2], 0)
+        self.assertGreater(
+            stat_cursor[stat.conn.cache_compressed_bytes][2], 0)
+        hits = stat_cursor[stat.conn.cache_compressed_hit][2]
+        stat_cursor.close()
+
+        self.read_all()
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        self.assertGreater(
+            stat_cursor[stat.conn.cache_compressed_hit][2], hits)
+        stat_cursor.close()
+
+        # Verify must read the file, not the compressed cache.
+        self.session.verify(self.uri, None)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,99 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wiredtiger, wttest
+from wtscenario import check_scenarios
+
+# test_cursor10.py
+#    Cursor reverse iteration through insert lists, including entries inserted
+# behind the cursor while it's moving backward.
+class test_cursor10(wttest.WiredTigerTestCase):
+    nentries = 1000
+
+    scenarios = check_scenarios([
+        ('row', dict(keyfmt='S')),
+        ('var', dict(keyfmt='r')),
+    ])
+
+    def genkey(self, i):
+        if self.keyfmt == 'S':
+            return 'key%06d' % i
+        return long(i)
+
+    def genvalue(self, i):
+        return 'value%06d' % i
+
+    # Populate with every step'th entry, none of which has been reconciled, so
+    # they're all in insert lists.
+    def populate(self, uri, step):
+        self.session.create(uri, 'key_format=' + self.keyfmt + ',value_format=S')
+        cursor = self.session.open_cursor(uri, None, None)
+        for i in range(1, self.nentries + 1):
+            cursor[self.genkey(i * step)] = self.genvalue(i * step)
+        cursor.close()
+
+    # Walk backward, inserting the entry preceding the cursor's position every
+    # few steps: the next step must return it.
+    def test_cursor_prev_insert(self):
+        uri = 'file:cursor10'
+        self.populate(uri, 2)
+
+        cursor = self.session.open_cursor(uri, None, None)
+        icursor = self.session.open_cursor(uri, None, None)
+        expect = self.nentries * 2
+        while cursor.prev() == 0:
+            self.assertEqual(cursor.get_key(), self.genkey(expect))
+            self.assertEqual(cursor.get_value(), self.genvalue(expect))
+            if expect % 2 == 0 and expect % 7 == 0:
+                icursor[self.genkey(expect - 1)] = self.genvalue(expect - 1)
+                expect -= 1
+            else:
+                expect -= 2 if expect % 2 == 0 else 1
+        self.assertEqual(expect, 0)
+
+    # Alternate direction while moving backward through the insert list.
+    def test_cursor_prev_next(self):
+        uri = 'file:cursor10'
+        self.populate(uri, 1)
+
+        cursor = self.session.open_cursor(uri, None, None)
+        cursor.set_key(self.genkey(self.nentries / 2))
+        self.assertEqual(cursor.search(), 0)
+        for i in range(self.nentries / 2 - 1, 0, -1):
+            self.assertEqual(cursor.prev(), 0)
+            self.assertEqual(cursor.get_key(), self.genkey(i))
+            if i % 3 == 0:
+                self.assertEqual(cursor.next(), 0)
+                self.assertEqual(cursor.get_key(), self.genkey(i + 1))
+                self.assertEqual(cursor.prev(), 0)
+                self.assertEqual(cursor.get_key(), self.genkey(i))
+        self.assertEqual(cursor.prev(), wiredtiger.WT_NOTFOUND)
+
+if __name__ == '__main__':
+    wttest.run()
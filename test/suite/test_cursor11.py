@@ -0,0 +1,109 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wiredtiger, wttest
+from wtscenario import check_scenarios
+
+# test_cursor11.py
+#    Cursor next_batch: records returned in batches match records returned by
+# next, and the cursor continues where each batch left off.
+class test_cursor11(wttest.WiredTigerTestCase):
+    nentries = 1000
+
+    scenarios = check_scenarios([
+        ('file-row', dict(type='file:', keyfmt='S')),
+        ('file-var', dict(type='file:', keyfmt='r')),
+        ('table-row', dict(type='table:', keyfmt='S')),
+        ('lsm-row', dict(type='lsm:', keyfmt='S')),
+    ])
+
+    def genkey(self, i):
+        if self.keyfmt == 'S':
+            return 'key%06d' % i
+        return long(i)
+
+    def genvalue(self, i):
+        return 'value%06d' % i
+
+    def populate(self, uri):
+        self.session.create(uri, 'key_format=' + self.keyfmt + ',value_format=S')
+        cursor = self.session.open_cursor(uri, None, None)
+        for i in range(1, self.nentries + 1):
+            cursor[self.genkey(i)] = self.genvalue(i)
+        cursor.close()
+
+    # Read everything in batches of various sizes.
+    def test_cursor_next_batch(self):
+        uri = self.type + 'cursor11'
+        self.populate(uri)
+        for count in (1, 7, 100, 5000):
+            cursor = self.session.open_cursor(uri, None, None)
+            i = 0
+            while True:
+                batch = cursor.next_batch(count)
+                if len(batch) == 0:
+                    break
+                self.assertLessEqual(len(batch), count)
+                for k, v in batch:
+                    i += 1
+                    self.assertEqual(k, self.genkey(i))
+                    self.assertEqual(v, self.genvalue(i))
+            self.assertEqual(i, self.nentries)
+            cursor.close()
+
+    # A small buffer ends the batch early, and the next batch continues from
+    # there; a buffer too small for any record fails.
+    def test_cursor_next_batch_buffer(self):
+        uri = self.type + 'cursor11'
+        self.populate(uri)
+        cursor = self.session.open_cursor(uri, None, None)
+        batch = cursor.next_batch(100, 64)
+        self.assertGreater(len(batch), 0)
+        self.assertLess(len(batch), 100)
+        n = len(batch)
+        batch = cursor.next_batch(100, 64)
+        self.assertEqual(batch[0][0], self.genkey(n + 1))
+        self.assertRaises(wiredtiger.WiredTigerError,
+            lambda: cursor.next_batch(100, 4))
+        cursor.close()
+
+    # Batches and single steps can be mixed.
+    def test_cursor_next_batch_next(self):
+        uri = self.type + 'cursor11'
+        self.populate(uri)
+        cursor = self.session.open_cursor(uri, None, None)
+        self.assertEqual(len(cursor.next_batch(10)), 10)
+        self.assertEqual(cursor.next(), 0)
+        self.assertEqual(cursor.get_key(), self.genkey(11))
+        batch = cursor.next_batch(10)
+        self.assertEqual(batch[0][0], self.genkey(12))
+        cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,125 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wiredtiger, wttest
+from wtscenario import check_scenarios
+
+# test_cursor12.py
+#    Table cursor filters, alone and with projections, on tables with and
+# without column groups.
+class test_cursor12(wttest.WiredTigerTestCase):
+    uri = 'table:cursor12'
+    nentries = 1000
+
+    scenarios = check_scenarios([
+        ('no-colgroups', dict(colgroups=False)),
+        ('colgroups', dict(colgroups=True)),
+    ])
+
+    def genvalue(self, i):
+        return [i % 10, 'name%d' % (i % 3), 'pad%06d' % i]
+
+    def populate(self):
+        config = 'key_format=r,value_format=iSS,columns=(k,a,name,pad)'
+        if self.colgroups:
+            config += ',colgroups=(g1,g2,g3)'
+        self.session.create(self.uri, config)
+        if self.colgroups:
+            self.session.create('colgroup:cursor12:g1', 'columns=(a)')
+            self.session.create('colgroup:cursor12:g2', 'columns=(name)')
+            self.session.create('colgroup:cursor12:g3', 'columns=(pad)')
+        cursor = self.session.open_cursor(self.uri, None, None)
+        for i in range(1, self.nentries + 1):
+            cursor[i] = self.genvalue(i)
+        cursor.close()
+
+    def check(self, uri, filter, match, project=None):
+        expect = [i for i in range(1, self.nentries + 1)
+            if match(i, self.genvalue(i))]
+        cursor = self.session.open_cursor(uri, None, 'filter=' + filter)
+        got = []
+        for r in cursor:
+            got.append(r[0])
+            v = self.genvalue(r[0])
+            if project != None:
+                v = [v[c] for c in project]
+            self.assertEqual(r[1:], v)
+        self.assertEqual(got, expect)
+
+        # Filters apply moving backward too.
+        got = []
+        while cursor.prev() == 0:
+            got.append(cursor.get_key())
+        got.reverse()
+        self.assertEqual(got, expect)
+        cursor.close()
+
+    def test_cursor_filter(self):
+        self.populate()
+        self.check(self.uri, '(a=3)', lambda k, v: v[0] == 3)
+        self.check(self.uri, '(a=(ge=3,lt=5),name=(ne=name1))',
+            lambda k, v: 3 <= v[0] < 5 and v[1] != 'name1')
+        self.check(self.uri, '(k=(gt=100,le=200),pad=(prefix=pad0001))',
+            lambda k, v: 100 < k <= 200 and v[2].startswith('pad0001'))
+        self.check(self.uri + '(pad)', '(name=name2)',
+            lambda k, v: v[1] == 'name2', [2])
+        self.check(self.uri + '(name,a)', '(a=(gt=8))',
+            lambda k, v: v[0] > 8, [1, 0])
+
+    # Updates and removes through a filtered projection apply to the whole
+    # record.
+    def test_cursor_filter_update(self):
+        self.populate()
+        cursor = self.session.open_cursor(self.uri + '(pad)', None,
+            'filter=(a=7)')
+        self.assertEqual(cursor.next(), 0)
+        self.assertEqual(cursor.get_key(), 7)
+        cursor.remove()
+        self.assertEqual(cursor.next(), 0)
+        self.assertEqual(cursor.get_key(), 17)
+        cursor.set_value('new')
+        cursor.update()
+        cursor.close()
+
+        cursor = self.session.open_cursor(self.uri, None, None)
+        cursor.set_key(7)
+        self.assertEqual(cursor.search(), wiredtiger.WT_NOTFOUND)
+        self.assertEqual(cursor[17], [7, 'name2', 'new'])
+        cursor.close()
+
+    def test_cursor_filter_config(self):
+        self.populate()
+        for filter in ['(nosuch=1)', '(a=abc)', '(a=(prefix=1))',
+            '(a=(xx=1))']:
+            self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+                lambda: self.session.open_cursor(
+                self.uri, None, 'filter=' + filter), '/filter/')
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,122 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from wiredtiger import stat
+from wtscenario import check_scenarios
+
+# test_delta01.py
+#    Row-store leaf pages written as deltas: update and remove a few records
+# per round, checkpoint and reopen, past the configured delta chain maximum.
+class test_delta01(wttest.WiredTigerTestCase):
+    uri = 'file:test_delta01'
+    nentries = 5000
+    rounds = 8
+
+    scenarios = check_scenarios([
+        ('delta-1', dict(delta_max=1)),
+        ('delta-4', dict(delta_max=4)),
+    ])
+
+    # Override WiredTigerTestCase to enable statistics
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,statistics=(fast),' +
+            'error_prefix="%s: "' % self.shortid())
+        return conn
+
+    def key(self, i):
+        return 'key%06d' % i
+
+    def populate(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S,' +
+            'leaf_delta_max=%d' % self.delta_max)
+        expect = {}
+        cursor = self.session.open_cursor(self.uri, None, None)
+        for i in range(self.nentries):
+            expect[self.key(i)] = 'value-0-%d' % i
+            cursor[self.key(i)] = expect[self.key(i)]
+        cursor.close()
+        self.session.checkpoint()
+        self.reopen_conn()
+
+        deltas = 0
+        for r in range(1, self.rounds + 1):
+            cursor = self.session.open_cursor(self.uri, None, None)
+            for i in range(r, self.nentries, 40):
+                expect[self.key(i)] = 'value-%d-%d' % (r, i)
+                cursor[self.key(i)] = expect[self.key(i)]
+            for i in range(r, self.nentries, 97):
+                if self.key(i) in expect:
+                    cursor.set_key(self.key(i))
+                    self.assertEqual(cursor.remove(), 0)
+                    del expect[self.key(i)]
+            cursor.close()
+            self.session.checkpoint()
+            stat_cursor = self.session.open_cursor(
+                'statistics:' + self.uri, None, None)
+            deltas += stat_cursor[stat.dsrc.rec_page_delta][2]
+            stat_cursor.close()
+            self.reopen_conn()
+
+            cursor = self.session.open_cursor(self.uri, None, None)
+            self.assertEqual(dict((k, v) for k, v in cursor), expect)
+            cursor.close()
+
+        self.assertGreater(deltas, 0)
+        stat_cursor = self.session.open_cursor(
+            'statistics:' + self.uri, None, None)
+        self.assertGreater(stat_cursor[stat.dsrc.cache_read_delta][2], 0)
+        stat_cursor.close()
+        return expect
+
+    def test_delta(self):
+        self.populate()
+        self.session.verify(self.uri, None)
+
+    # Salvage a healthy file: every page is salvaged from its newest delta.
+    # Salvage can return removed records from older pages where the newer
+    # pages' key ranges don't cover them, so only check the records that
+    # weren't removed.
+    def check_salvage(self, config):
+        expect = self.populate()
+        self.session.salvage(self.uri, config)
+        cursor = self.session.open_cursor(self.uri, None, None)
+        found = dict((k, v) for k, v in cursor if k in expect)
+        cursor.close()
+        self.assertEqual(found, expect)
+        self.session.verify(self.uri, None)
+
+    def test_delta_salvage(self):
+        self.check_salvage(None)
+
+    def test_delta_salvage_threads(self):
+        self.check_salvage('threads=4')
+
+if __name__ == '__main__':
+    wttest.run()
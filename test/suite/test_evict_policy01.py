@@ -0,0 +1,99 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from wiredtiger import stat
+
+# test_evict_policy01.py
+#    Frequency-aware eviction keeps a set of pages used by point lookups in
+# cache while a large scan reads through it.
+class test_evict_policy01(wttest.WiredTigerTestCase):
+    conn_config = 'cache_size=10MB,statistics=(fast)'
+    hot_uri = 'file:test_evict_policy01_hot'
+    cold_uri = 'file:test_evict_policy01_cold'
+    nhot = 2000
+    ncold = 30000
+    value = 'x' * 1000
+
+    def key(self, i):
+        return '%08d' % i
+
+    def populate(self, uri, nentries):
+        self.session.create(uri, 'key_format=S,value_format=S')
+        cursor = self.session.open_cursor(uri, None, None)
+        for i in range(nentries):
+            cursor[self.key(i)] = self.value
+        cursor.close()
+
+    def hot_reads(self):
+        stat_cursor = self.session.open_cursor(
+            'statistics:' + self.hot_uri, None, None)
+        reads = stat_cursor[stat.dsrc.cache_read][2]
+        stat_cursor.close()
+        return reads
+
+    def lookup_hot(self, cursor):
+        for i in range(self.nhot):
+            cursor.set_key(self.key(i))
+            self.assertEqual(cursor.search(), 0)
+        cursor.reset()
+
+    # Return the hot pages read again after a scan of the cold file.
+    def hot_rereads(self, policy):
+        self.reopen_conn()
+        self.conn.reconfigure('eviction=(policy=%s)' % policy)
+        hot = self.session.open_cursor(self.hot_uri, None, None)
+        cold = self.session.open_cursor(self.cold_uri, None, None)
+
+        # Use the hot pages repeatedly while the cache fills, so eviction
+        # is running as they're used.
+        for r in range(10):
+            self.lookup_hot(hot)
+            for i in range(self.ncold / 10):
+                self.assertEqual(cold.next(), 0)
+
+        # Scan the cold file, then look up the hot records again.
+        cold.reset()
+        while cold.next() == 0:
+            pass
+        cold.close()
+        before = self.hot_reads()
+        self.lookup_hot(hot)
+        hot.close()
+        return self.hot_reads() - before
+
+    def test_evict_policy(self):
+        self.populate(self.hot_uri, self.nhot)
+        self.populate(self.cold_uri, self.ncold)
+        lru = self.hot_rereads('lru')
+        frequency = self.hot_rereads('frequency')
+        self.assertGreater(lru, 0)
+        self.assertLess(frequency, lru)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,126 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import random, time
+import wiredtiger, wttest
+from wiredtiger import stat
+
+# test_lsm03.py
+#    Test LSM cursor iteration merging many chunks, where keys are overwritten
+#    and removed in newer chunks.
+class test_lsm03(wttest.WiredTigerTestCase):
+    conn_config = 'statistics=(fast)'
+    uri = 'lsm:test_lsm03'
+    nkeys = 1000
+    nchunks = 20
+
+    # Each round of updates is larger than the chunk size, so every round
+    # fills the primary chunk and requests a switch.
+    pad = 'x' * 3000
+
+    def key(self, i):
+        return '%06d' % i
+
+    def populate(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S,' +
+            'lsm=(chunk_size=512K,merge_max=100,merge_min=100)')
+        r = random.Random(12345)
+        expect = {}
+        cursor = self.session.open_cursor(self.uri, None, None)
+        for chunk in range(self.nchunks):
+            for i in range(self.nkeys / 4):
+                k = r.randint(0, self.nkeys - 1)
+                if r.randint(0, 4) == 0:
+                    cursor.set_key(self.key(k))
+                    cursor.remove()
+                    expect.pop(k, None)
+                else:
+                    v = 'value-%d-%d' % (chunk, i) + self.pad
+                    cursor[self.key(k)] = v
+                    expect[k] = v
+            # Wait for the LSM manager to switch to a new chunk.
+            for n in range(100):
+                stat_cursor = self.session.open_cursor(
+                    'statistics:' + self.uri, None, None)
+                count = stat_cursor[stat.dsrc.lsm_chunk_count][2]
+                stat_cursor.close()
+                if count > chunk + 1:
+                    break
+                time.sleep(0.1)
+        cursor.close()
+
+        # Merges are disabled, every round's updates are in their own chunk.
+        self.assertGreaterEqual(count, self.nchunks + 1)
+        return expect
+
+    def test_lsm_merge_next(self):
+        expect = self.populate()
+        cursor = self.session.open_cursor(self.uri, None, None)
+        got = [(k, v) for k, v in cursor]
+        cursor.close()
+        self.assertEqual(got,
+            [(self.key(k), expect[k]) for k in sorted(expect.keys())])
+
+    def test_lsm_merge_prev(self):
+        expect = self.populate()
+        cursor = self.session.open_cursor(self.uri, None, None)
+        got = []
+        while cursor.prev() == 0:
+            got.append((cursor.get_key(), cursor.get_value()))
+        cursor.close()
+        self.assertEqual(got, [(self.key(k), expect[k])
+            for k in sorted(expect.keys(), reverse=True)])
+
+    # Switch direction part way through scans started by search_near.
+    def test_lsm_merge_direction(self):
+        expect = self.populate()
+        keys = sorted(expect.keys())
+        r = random.Random(54321)
+        cursor = self.session.open_cursor(self.uri, None, None)
+        for i in range(200):
+            cursor.set_key(self.key(r.randint(0, self.nkeys - 1)))
+            if cursor.search_near() == wiredtiger.WT_NOTFOUND:
+                continue
+            pos = keys.index(int(cursor.get_key()))
+            for step in range(10):
+                if r.randint(0, 1) == 0:
+                    if cursor.next() != 0:
+                        self.assertEqual(pos, len(keys) - 1)
+                        break
+                    pos += 1
+                else:
+                    if cursor.prev() != 0:
+                        self.assertEqual(pos, 0)
+                        break
+                    pos -= 1
+                self.assertEqual(cursor.get_key(), self.key(keys[pos]))
+                self.assertEqual(cursor.get_value(), expect[keys[pos]])
+        cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
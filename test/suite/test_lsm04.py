@@ -0,0 +1,101 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import time
+import wiredtiger, wttest
+from wiredtiger import stat
+
+# test_lsm04.py
+#    Test LSM trees using the skiplist memtable, where chunks are flushed by
+#    bulk loading a new file rather than checkpointing the in-memory chunk.
+class test_lsm04(wttest.WiredTigerTestCase):
+    conn_config = 'statistics=(fast)'
+    uri = 'lsm:test_lsm04'
+    nkeys = 2000
+    nchunks = 10
+
+    # Each round of inserts is larger than the chunk size, so every round
+    # fills the memtable and requests a switch.
+    pad = 'x' * 4000
+
+    def key(self, i):
+        return '%06d' % i
+
+    def value(self, chunk, i):
+        return 'value-%d-%d' % (chunk, i) + self.pad
+
+    def populate(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S,' +
+            'lsm=(chunk_size=512K,memtable=skiplist,' +
+            'merge_max=100,merge_min=100)')
+        cursor = self.session.open_cursor(self.uri, None, None)
+        for chunk in range(self.nchunks):
+            for i in range(self.nkeys):
+                if i % self.nchunks == chunk:
+                    cursor[self.key(i)] = self.value(chunk, i)
+            # Wait for the switch to a new memtable, the old one is bulk
+            # loaded into a new chunk in the background.
+            for n in range(100):
+                stat_cursor = self.session.open_cursor(
+                    'statistics:' + self.uri, None, None)
+                count = stat_cursor[stat.dsrc.lsm_chunk_count][2]
+                stat_cursor.close()
+                if count > chunk + 1:
+                    break
+                time.sleep(0.1)
+        cursor.close()
+        self.assertGreaterEqual(count, self.nchunks + 1)
+
+    def check(self):
+        cursor = self.session.open_cursor(self.uri, None, None)
+        got = [(k, v) for k, v in cursor]
+        cursor.close()
+        self.assertEqual(got, [(self.key(i), self.value(i % self.nchunks, i))
+            for i in range(self.nkeys)])
+
+    # The memtable type is persisted in the LSM tree's metadata.
+    def test_lsm_skiplist_config(self):
+        self.populate()
+        cursor = self.session.open_cursor('metadata:', None, None)
+        self.assertTrue('memtable=skiplist' in cursor[self.uri])
+        cursor.close()
+
+    def test_lsm_skiplist_reopen(self):
+        self.populate()
+        self.check()
+        self.reopen_conn()
+        self.check()
+
+    def test_lsm_skiplist_invalid(self):
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.session.create(self.uri,
+            'key_format=S,value_format=S,lsm=(memtable=hash)'),
+            '/Value \'hash\' not a permitted choice/')
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,69 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+
+import wiredtiger, wttest
+from wiredtiger import stat
+
+# test_lsm05.py
+#    Test the statistics for the LSM work units scheduled for a tree.
+class test_lsm05(wttest.WiredTigerTestCase):
+    # Several trees share a minimal set of workers, so work units queue.
+    conn_config = 'statistics=(fast),lsm_manager=(worker_thread_max=3)'
+    ntrees = 3
+    nkeys = 1000
+    value = 'x' * 4000
+
+    def test_lsm_work_stats(self):
+        uris = ['lsm:test_lsm05_%d' % t for t in range(self.ntrees)]
+        cursors = []
+        for uri in uris:
+            self.session.create(uri,
+                'key_format=S,value_format=S,lsm=(chunk_size=512K)')
+            cursors.append(self.session.open_cursor(uri, None, None))
+
+        # Interleave the inserts, so every tree switches and flushes chunks
+        # while the others do.
+        for i in range(self.nkeys):
+            for cursor in cursors:
+                cursor['%06d' % i] = self.value
+        for cursor in cursors:
+            cursor.close()
+
+        for uri in uris:
+            stat_cursor = self.session.open_cursor(
+                'statistics:' + uri, None, None)
+            self.assertGreater(stat_cursor[stat.dsrc.lsm_chunk_count][2], 1)
+            self.assertGreater(
+                stat_cursor[stat.dsrc.lsm_work_queue_wait][2], 0)
+            self.assertGreater(
+                stat_cursor[stat.dsrc.lsm_work_units_done][2], 0)
+            stat_cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
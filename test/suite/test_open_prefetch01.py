@@ -0,0 +1,78 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+#
+# test_open_prefetch01.py
+#   Prefetching files at open
+#
+
+import time
+import wiredtiger, wttest
+from wiredtiger import stat
+
+# Test prefetching the blocks read when files are opened
+class test_open_prefetch01(wttest.WiredTigerTestCase):
+    ntables = 100
+    nrecords = 100
+
+    # Override WiredTigerTestCase, we want the open prefetch pool.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir, 'create,' +
+            ('error_prefix="%s: ",' % self.shortid()) +
+            'open_prefetch=(threads=4),statistics=(fast)')
+        self.pr(`conn`)
+        return conn
+
+    def test_open_prefetch(self):
+        for i in xrange(self.ntables):
+            uri = 'table:test_open_prefetch01.' + `i`
+            self.session.create(uri, 'key_format=i,value_format=S')
+            cursor = self.session.open_cursor(uri, None)
+            for idx in xrange(self.nrecords):
+                cursor[idx] = uri
+            cursor.close()
+
+        # The files are prefetched in the background when the connection is
+        # opened, they're still opened when first used.
+        self.reopen_conn()
+        for i in xrange(100):
+            stat_cursor = self.session.open_cursor('statistics:', None, None)
+            prefetched = stat_cursor[stat.conn.dh_open_prefetch][2]
+            stat_cursor.close()
+            if prefetched == self.ntables:
+                break
+            time.sleep(0.1)
+        self.assertEqual(prefetched, self.ntables)
+        for i in xrange(self.ntables):
+            uri = 'table:test_open_prefetch01.' + `i`
+            cursor = self.session.open_cursor(uri, None)
+            for idx in xrange(self.nrecords):
+                self.assertEqual(cursor[idx], uri)
+            cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
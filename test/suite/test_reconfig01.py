@@ -37,6 +37,16 @@ class test_reconfig01(wttest.WiredTigerTestCase):
     def test_reconfig_shared_cache(self):
         self.conn.reconfigure("shared_cache=(name=pool,size=300M)")
 
+    def test_reconfig_eviction_policy(self):
+        uri = "table:test_reconfig"
+        simple_populate(self, uri, 'key_format=S', 100)
+        self.conn.reconfigure("eviction=(policy=frequency)")
+        simple_populate(self, uri, 'key_format=S', 100)
+        self.conn.reconfigure("eviction=(policy=lru)")
+        msg = '/not a permitted choice/'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.conn.reconfigure("eviction=(policy=mru)"), msg)
+
     def test_reconfig_async(self):
         # Async starts off.  Reconfigure through all the various cases, each
         # building from the previous state.
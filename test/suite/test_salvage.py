@@ -208,5 +208,38 @@ class test_salvage(wttest.WiredTigerTestCase, suite_subprocess):
         self.check_no_error_in_file(errfile)
         self.check_damaged(self.tablename)
 
+    def test_salvage_api_threads(self):
+        """
+        Test salvage via API, reading a damaged table with multiple threads.
+        """
+        self.session.create('table:' + self.tablename,
+            self.session_params + ',allocation_size=512,leaf_page_max=512')
+        self.populate(self.tablename)
+        self.damage(self.tablename)
+
+        # damage() closed the session/connection, reopen them now.
+        self.open_conn()
+        for threads in [2, 4, 64]:
+            self.session.salvage('file:' + self.tablename + ".wt",
+                'threads=' + str(threads))
+            self.check_damaged(self.tablename)
+            self.session.verify('table:' + self.tablename, None)
+
+    def test_salvage_process_threads(self):
+        """
+        Test salvage in a 'wt' process with multiple threads, on a table that
+        is purposely damaged.
+        """
+        self.session.create('table:' + self.tablename,
+            self.session_params + ',allocation_size=512,leaf_page_max=512')
+        self.populate(self.tablename)
+        self.damage(self.tablename)
+        errfile = "salvageerr.out"
+        self.runWt(["salvage", "-t", "4", self.tablename + ".wt"],
+            errfilename=errfile)
+        self.check_empty_file(errfile)  # expect no output
+        self.check_no_error_in_file(errfile)
+        self.check_damaged(self.tablename)
+
 if __name__ == '__main__':
     wttest.run()
@@ -30,6 +30,7 @@
 import os
 import shutil
 import wiredtiger, wttest
+from wiredtiger import stat
 from wttest import unittest
 from helper import key_populate, simple_populate
 
@@ -202,5 +203,34 @@ class test_shared_cache01(wttest.WiredTigerTestCase):
             self.add_records(sess, 0, nops)
         self.closeConnections()
 
+    # Read back pages evicted from the shared cache, and check the estimated
+    # hits from more cache are tracked.
+    def test_shared_cache_hit_estimates(self):
+        nops = 50000
+        self.openConnections(['WT_TEST1', 'WT_TEST2'],
+            pool_opts = ',shared_cache=(name=pool,size=20M,chunk=10M,' +
+            'reserve=5M),statistics=(fast),')
+        for sess in self.sessions:
+            sess.create(self.uri, "key_format=S,value_format=S")
+            self.add_records(sess, 0, nops)
+
+        # The tables are larger than the pool: each scan reads back pages the
+        # previous scan evicted.
+        for i in range(3):
+            for sess in self.sessions:
+                cursor = sess.open_cursor(self.uri, None, None)
+                while cursor.next() == 0:
+                    pass
+                cursor.close()
+
+        for sess in self.sessions:
+            stat_cursor = sess.open_cursor('statistics:', None, None)
+            chunk1 = stat_cursor[stat.conn.cache_pool_chunk1][2]
+            chunk8 = stat_cursor[stat.conn.cache_pool_chunk8][2]
+            stat_cursor.close()
+            self.assertGreater(chunk8, 0)
+            self.assertGreaterEqual(chunk8, chunk1)
+        self.closeConnections()
+
 if __name__ == '__main__':
     wttest.run()
@@ -0,0 +1,93 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from wiredtiger import stat
+from wtscenario import check_scenarios
+
+# test_stat06.py
+#    Latency histograms
+class test_stat06(wttest.WiredTigerTestCase):
+    uri = 'table:test_stat06'
+    nentries = 1000
+
+    scenarios = check_scenarios([
+        ('all', dict(conn_config='statistics=(all)', histograms=True)),
+        ('fast', dict(conn_config='statistics=(fast)', histograms=False)),
+    ])
+
+    # Sum a histogram's buckets.
+    def histogram(self, cursor, stats, name):
+        return sum(cursor[getattr(stats, name + '_' + str(i))][2]
+            for i in range(10))
+
+    def test_latency_histograms(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        cursor = self.session.open_cursor(self.uri, None, None)
+        for i in range(self.nentries):
+            cursor[i] = 'value' + str(i)
+        for i in range(self.nentries):
+            cursor.set_key(i)
+            self.assertEqual(cursor.search(), 0)
+        for i in range(0, self.nentries, 2):
+            cursor.set_key(i)
+            self.assertEqual(cursor.remove(), 0)
+        cursor.close()
+
+        self.session.begin_transaction()
+        cursor = self.session.open_cursor(self.uri, None, None)
+        cursor[self.nentries] = 'value'
+        cursor.close()
+        self.session.commit_transaction()
+
+        # Every operation lands in exactly one bucket: the data source counts
+        # are exact, the connection also counts metadata operations.
+        expect = self.nentries if self.histograms else 0
+        stat_cursor = self.session.open_cursor(
+            'statistics:' + self.uri, None, None)
+        self.assertEqual(self.histogram(
+            stat_cursor, stat.dsrc, 'latency_cursor_search'), expect)
+        self.assertEqual(self.histogram(
+            stat_cursor, stat.dsrc, 'latency_cursor_remove'), expect / 2)
+        self.assertEqual(self.histogram(
+            stat_cursor, stat.dsrc, 'latency_cursor_insert'),
+            expect + 1 if self.histograms else 0)
+        stat_cursor.close()
+
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        for name in ['latency_cursor_search', 'latency_cursor_insert',
+            'latency_txn_commit']:
+            count = self.histogram(stat_cursor, stat.conn, name)
+            if self.histograms:
+                self.assertGreaterEqual(count, self.nentries)
+            else:
+                self.assertEqual(count, 0)
+        stat_cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
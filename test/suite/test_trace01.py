@@ -0,0 +1,89 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import os
+from suite_subprocess import suite_subprocess
+import wiredtiger, wttest
+from wtscenario import check_scenarios
+
+# test_trace01.py
+#    Event trace ring buffers and the wt trace command
+class test_trace01(wttest.WiredTigerTestCase, suite_subprocess):
+    uri = 'table:test_trace01'
+    dump = 'WiredTigerTrace.0000000001'
+
+    scenarios = check_scenarios([
+        ('default', dict(conn_config='cache_size=1MB', entries=1024)),
+        ('small', dict(conn_config='cache_size=1MB,trace=(entries=50)',
+            entries=64)),
+    ])
+
+    # Dump the trace after checkpointing a table, and decode it.
+    def test_trace_dump(self):
+        self.session.create(self.uri, 'key_format=i,value_format=S')
+        cursor = self.session.open_cursor(self.uri, None, None)
+        for i in range(1, 10000):
+            cursor[i] = 'value' * 20 + str(i)
+        cursor.close()
+        self.session.checkpoint()
+
+        self.conn.trace_dump()
+        self.assertTrue(os.path.exists(self.dump))
+
+        self.runWt(['trace', self.dump], outfilename='trace.out')
+        with open('trace.out') as f:
+            lines = f.read().splitlines()
+        self.assertTrue(lines[0].startswith('trace dump at'))
+        self.assertTrue(
+            ('%d events per session, on demand' % self.entries) in lines[0])
+        events = ' '.join(lines[1:])
+        self.assertTrue('checkpoint stop' in events)
+        self.assertTrue('reconcile stop' in events)
+
+        # A second dump is written to a new file.
+        self.conn.trace_dump()
+        self.assertTrue(os.path.exists('WiredTigerTrace.0000000002'))
+
+    # Dumping fails if tracing is disabled.
+    def test_trace_disabled(self):
+        self.conn.close()
+        self.conn = wiredtiger.wiredtiger_open('.', 'trace=(entries=0)')
+        msg = '/tracing is not configured/'
+        self.assertRaisesWithMessage(wiredtiger.WiredTigerError,
+            lambda: self.conn.trace_dump(), msg)
+
+    # The decoder rejects files that aren't trace dumps.
+    def test_trace_not_dump(self):
+        with open('notrace', 'w') as f:
+            f.write('not a trace dump file\n' * 10)
+        self.runWt(['trace', 'notrace'],
+            outfilename='trace.out', errfilename='trace.err')
+        self.check_file_contains('trace.err', 'not a trace dump file')
+
+if __name__ == '__main__':
+    wttest.run()
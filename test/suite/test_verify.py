@@ -120,6 +120,22 @@ class test_verify(wttest.WiredTigerTestCase, suite_subprocess):
         self.session.verify('table:' + self.tablename, None)
         self.check_populate(self.tablename)
 
+    def test_verify_api_threads(self):
+        """
+        Test verify via API using multiple threads, using a populated table
+        with enough pages to verify in parallel.
+        """
+        params = 'key_format=S,value_format=S,' +\
+            'internal_page_max=512,leaf_page_max=512,allocation_size=512'
+        self.session.create('table:' + self.tablename, params)
+        self.populate(self.tablename)
+        self.session.checkpoint(None)
+        self.populate(self.tablename)
+        for threads in [1, 2, 8]:
+            self.session.verify('table:' + self.tablename,
+                'strict,threads=' + str(threads))
+        self.check_populate(self.tablename)
+
     def test_verify_api_75pct_null(self):
         """
         Test verify via API, on a damaged table.
@@ -154,6 +170,22 @@ class test_verify(wttest.WiredTigerTestCase, suite_subprocess):
         self.runWt(["verify", "table:" + self.tablename], errfilename="verifyerr.out")
         self.check_non_empty_file("verifyerr.out")
 
+    def test_verify_process_threads_75pct_null(self):
+        """
+        Test verify in a 'wt' process using multiple threads, on a table that
+        is purposely damaged, with nulls at a position about 75% through.
+        """
+        params = 'key_format=S,value_format=S,' +\
+            'internal_page_max=512,leaf_page_max=512,allocation_size=512'
+        self.session.create('table:' + self.tablename, params)
+        self.populate(self.tablename)
+        with self.open_and_position(self.tablename, 75) as f:
+            for i in range(0, 4096):
+                f.write(struct.pack('B', 0))
+        self.runWt(["verify", "-t", "4", "table:" + self.tablename],
+            errfilename="verifyerr.out")
+        self.check_non_empty_file("verifyerr.out")
+
     def test_verify_process_25pct_junk(self):
         """
         Test verify in a 'wt' process on a table that is purposely damaged,
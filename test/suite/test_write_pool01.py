@@ -0,0 +1,91 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2015 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED 'AS IS', WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from helper import key_populate, value_populate
+from helper import simple_populate, simple_populate_check
+from wiredtiger import stat
+from wtscenario import multiply_scenarios, number_scenarios
+
+# test_write_pool01.py
+#    Pages reconciled into multiple blocks, with the blocks written by the
+# write pool.
+class test_write_pool01(wttest.WiredTigerTestCase):
+    uri = 'file:test_write_pool01'
+    nentries = 20000
+
+    types = [
+        ('row', dict(keyfmt='S', valfmt='S')),
+        ('var', dict(keyfmt='r', valfmt='S')),
+        ('fix', dict(keyfmt='r', valfmt='8t')),
+    ]
+    threads = [
+        ('threads-1', dict(threads=1)),
+        ('threads-4', dict(threads=4)),
+    ]
+    scenarios = number_scenarios(multiply_scenarios('.', types, threads))
+
+    # Override WiredTigerTestCase to configure the write pool.
+    def setUpConnectionOpen(self, dir):
+        conn = wiredtiger.wiredtiger_open(dir,
+            'create,statistics=(fast),' +
+            'write_pool=(threads=%d),' % self.threads +
+            'error_prefix="%s: "' % self.shortid())
+        return conn
+
+    def test_write_pool(self):
+        # Build a large in-memory page, then checkpoint it as many blocks.
+        config = 'key_format=' + self.keyfmt + ',value_format=' + \
+            self.valfmt + ',leaf_page_max=4KB,memory_page_max=10MB'
+        simple_populate(self, self.uri, config, self.nentries)
+        self.session.checkpoint()
+        stat_cursor = self.session.open_cursor('statistics:', None, None)
+        self.assertGreater(stat_cursor[stat.conn.rec_write_pool][2] +
+            stat_cursor[stat.conn.rec_write_pool_inline][2], 0)
+        stat_cursor.close()
+
+        self.reopen_conn()
+        simple_populate_check(self, self.uri, self.nentries)
+        self.session.verify(self.uri, None)
+
+    def test_write_pool_bulk(self):
+        # Bulk load, the bulk cursor writes blocks as they're filled.
+        config = 'key_format=' + self.keyfmt + ',value_format=' + \
+            self.valfmt + ',leaf_page_max=4KB'
+        self.session.create(self.uri, config)
+        cursor = self.session.open_cursor(self.uri, None, 'bulk')
+        for i in range(1, self.nentries + 1):
+            cursor[key_populate(cursor, i)] = value_populate(cursor, i)
+        cursor.close()
+
+        self.reopen_conn()
+        simple_populate_check(self, self.uri, self.nentries)
+        self.session.verify(self.uri, None)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -3,6 +3,7 @@
 no_scale_per_second_list = [
     'async: maximum work queue length',
     'cache: bytes currently in the cache',
+    'cache: compressed cache bytes held',
     'cache: maximum bytes configured',
     'cache: maximum page size at eviction',
     'cache: pages currently held in the cache',
@@ -67,6 +68,7 @@ no_scale_per_second_list = [
 no_clear_list = [
     'async: maximum work queue length',
     'cache: bytes currently in the cache',
+    'cache: compressed cache bytes held',
     'cache: maximum bytes configured',
     'cache: maximum page size at eviction',
     'cache: pages currently held in the cache',
@@ -102,9 +104,10 @@ no_clear_list = [
 ]
 prefix_list = [
     'data-handle',
-    'reconciliation',
+    'latency',
     'LSM',
     'log',
+    'reconciliation',
     'cache',
     'transaction',
     'cursor',
@@ -116,4 +119,4 @@ prefix_list = [
     'btree',
     'compression',
 ]
-groups = {'cursor': ['cursor', 'session'], 'lsm': ['LSM', 'transaction'], 'system': ['connection', 'data-handle', 'session'], 'evict': ['cache', 'connection', 'block-manager'], 'memory': ['cache', 'connection', 'reconciliation']}
\ No newline at end of file
+groups = {'latency': ['latency'], 'lsm': ['LSM', 'transaction'], 'system': ['connection', 'data-handle', 'session'], 'cursor': ['cursor', 'session'], 'memory': ['cache', 'connection', 'reconciliation'], 'evict': ['cache', 'connection', 'block-manager']}
\ No newline at end of file